@@ -0,0 +1,140 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of Benchmark and
+// BenchmarkSuite.
+
+#include "Benchmark.h"
+#include <OPS_Globals.h>
+#include <Profiler.h>
+#include <algorithm>
+
+volatile double benchmarkSink = 0.0;
+
+Benchmark::Benchmark(const char *theName, double theWork)
+  :name(theName), work(theWork)
+{
+
+}
+
+Benchmark::~Benchmark()
+{
+
+}
+
+int
+Benchmark::setUp(void)
+{
+  return 0;
+}
+
+void
+Benchmark::prepare(void)
+{
+
+}
+
+void
+Benchmark::tearDown(void)
+{
+
+}
+
+BenchmarkSuite::BenchmarkSuite(int reps, double time, const char *theFilter)
+  :theBenchmarks(), minReps(reps), minTime(time), filter()
+{
+  if (theFilter != 0)
+    filter = theFilter;
+}
+
+BenchmarkSuite::~BenchmarkSuite()
+{
+  for (size_t i=0; i<theBenchmarks.size(); i++)
+    delete theBenchmarks[i];
+}
+
+void
+BenchmarkSuite::add(Benchmark *theBenchmark)
+{
+  theBenchmarks.push_back(theBenchmark);
+}
+
+int
+BenchmarkSuite::runAll(std::ostream &s, const char *label)
+{
+  static const int maxReps = 100000;
+  int numRun = 0;
+
+  std::streamsize oldPrecision = s.precision(9);
+
+  s << "{\n \"suite\": \"kernels\",\n";
+  if (label != 0)
+    s << " \"label\": \"" << label << "\",\n";
+  s << " \"results\": [";
+
+  for (size_t i=0; i<theBenchmarks.size(); i++) {
+    Benchmark *theBenchmark = theBenchmarks[i];
+    if (!filter.empty() && std::string(theBenchmark->getName()).find(filter) == std::string::npos)
+      continue;
+
+    if (theBenchmark->setUp() < 0) {
+      opserr << "WARNING " << theBenchmark->getName() << " - setUp failed, skipped\n";
+      theBenchmark->tearDown();
+      continue;
+    }
+
+    // one untimed repetition to warm the caches
+    theBenchmark->prepare();
+    theBenchmark->run();
+
+    std::vector<double> times;
+    double total = 0.0;
+    while ((int)times.size() < minReps || (total < minTime && (int)times.size() < maxReps)) {
+      theBenchmark->prepare();
+      double start = Profiler::now();
+      theBenchmark->run();
+      double time = Profiler::now() - start;
+      times.push_back(time);
+      total += time;
+    }
+
+    theBenchmark->tearDown();
+
+    std::sort(times.begin(), times.end());
+    int numReps = (int)times.size();
+    double median = (numReps % 2 == 1) ? times[numReps/2] :
+      0.5*(times[numReps/2-1] + times[numReps/2]);
+
+    s << (numRun == 0 ? "\n" : ",\n");
+    s << "  {\"name\": \"" << theBenchmark->getName() << "\", \"reps\": " << numReps
+      << ", \"work\": " << theBenchmark->getWork()
+      << ", \"min\": " << times[0] << ", \"median\": " << median
+      << ", \"mean\": " << total/numReps << "}";
+    numRun++;
+
+    opserr << theBenchmark->getName() << ": median " << median*1.0e6 << " us over "
+	   << numReps << " repetitions\n";
+  }
+
+  s << "\n ]\n}\n";
+  s.precision(oldPrecision);
+
+  return numRun;
+}
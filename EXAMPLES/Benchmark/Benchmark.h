@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definitions for Benchmark
+// and BenchmarkSuite. A Benchmark is one timed kernel: setUp() builds
+// the objects once, prepare() restores the state before each repetition
+// and run() is the timed repetition. The BenchmarkSuite runs each
+// benchmark for a minimum number of repetitions and a minimum time and
+// writes the min, median and mean wall clock time per repetition as JSON
+// so that results can be compared across commits.
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+class Benchmark
+{
+  public:
+    Benchmark(const char *name, double work = 1.0);
+    virtual ~Benchmark();
+
+    virtual int setUp(void);
+    virtual void prepare(void);
+    virtual void run(void) = 0;
+    virtual void tearDown(void);
+
+    const char *getName(void) const {return name.c_str();}
+    double getWork(void) const {return work;}
+
+  protected:
+    std::string name;
+    double work;     // operations per repetition, used for throughput
+};
+
+class BenchmarkSuite
+{
+  public:
+    BenchmarkSuite(int minReps, double minTime, const char *filter = 0);
+    ~BenchmarkSuite();
+
+    void add(Benchmark *theBenchmark);
+    int runAll(std::ostream &theJSON, const char *label = 0);
+
+  private:
+    std::vector<Benchmark *> theBenchmarks;
+    int minReps;
+    double minTime;
+    std::string filter;
+};
+
+// results are accumulated here so the compiler can not drop the kernels
+extern volatile double benchmarkSink;
+
+// the benchmark groups
+void addMatrixBenchmarks(BenchmarkSuite &theSuite);
+void addElementBenchmarks(BenchmarkSuite &theSuite);
+void addSystemBenchmarks(BenchmarkSuite &theSuite);
+void addRecorderBenchmarks(BenchmarkSuite &theSuite);
+
+#endif
@@ -0,0 +1,202 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: element state determination kernels, a reinforced
+// concrete fiber section driven along a cyclic deformation path and a
+// chain of ForceBeamColumn3d elements with that section.
+
+#include "Benchmark.h"
+#include <OPS_Globals.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <ForceBeamColumn3d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf3d.h>
+#include <FiberSection3d.h>
+#include <UniaxialFiber3d.h>
+#include <Concrete02.h>
+#include <Steel02.h>
+#include <ElasticMaterial.h>
+#include <Matrix.h>
+#include <Vector.h>
+
+// 20x20 in section with a ny x nz grid of concrete fibers and 12 bars
+static SectionForceDeformation *
+createFiberSection(int tag, int ny, int nz)
+{
+  Concrete02 concrete(1, -4.0, -0.002, -0.8, -0.014, 0.1, 0.4, 200.0);
+  Steel02 steel(2, 60.0, 29000.0, 0.01);
+  ElasticMaterial torsion(3, 1.0e6);
+
+  double h = 20.0;
+  double dy = h/ny;
+  double dz = h/nz;
+
+  std::vector<Fiber *> fibers;
+  Vector position(2);
+  for (int i=0; i<ny; i++)
+    for (int j=0; j<nz; j++) {
+      position(0) = -0.5*h + (i+0.5)*dy;
+      position(1) = -0.5*h + (j+0.5)*dz;
+      fibers.push_back(new UniaxialFiber3d((int)fibers.size(), concrete, dy*dz, position));
+    }
+
+  double c = 0.5*h - 2.5;
+  for (int k=0; k<12; k++) {
+    double angle = 2.0*3.14159265358979*k/12;
+    position(0) = c*cos(angle);
+    position(1) = c*sin(angle);
+    fibers.push_back(new UniaxialFiber3d((int)fibers.size(), steel, 0.79, position));
+  }
+
+  SectionForceDeformation *theSection =
+    new FiberSection3d(tag, (int)fibers.size(), &fibers[0], &torsion);
+
+  for (size_t i=0; i<fibers.size(); i++)
+    delete fibers[i];
+
+  return theSection;
+}
+
+class FiberSectionBenchmark : public Benchmark
+{
+  public:
+    FiberSectionBenchmark(int n)
+      :Benchmark(""), ny(n), nz(n), numSteps(100), theSection(0), e(4)
+      {char buf[64]; sprintf(buf, "FiberSection3d state determination %d fibers x100", n*n+12);
+	name = buf; work = numSteps*(n*n+12);}
+
+    int setUp(void) {
+      theSection = createFiberSection(1, ny, nz);
+      return 0;
+    }
+
+    void run(void) {
+      double sum = 0.0;
+      for (int k=0; k<numSteps; k++) {
+	double t = 2.0*3.14159265358979*k/numSteps;
+	e(0) = -0.0005;
+	e(1) = 0.0004*sin(t);
+	e(2) = 0.0002*cos(t);
+	e(3) = 0.0;
+	theSection->setTrialSectionDeformation(e);
+	const Vector &s = theSection->getStressResultant();
+	const Matrix &ks = theSection->getSectionTangent();
+	sum += s(1) + ks(1,1);
+      }
+      benchmarkSink += sum;
+    }
+
+    void tearDown(void) {
+      if (theSection != 0)
+	delete theSection;
+      theSection = 0;
+    }
+
+  private:
+    int ny, nz, numSteps;
+    SectionForceDeformation *theSection;
+    Vector e;
+};
+
+// a cantilever of numEle elements, each repetition imposes a new trial
+// displacement profile and forms state, tangent and resisting force
+class ForceBeamColumnBenchmark : public Benchmark
+{
+  public:
+    ForceBeamColumnBenchmark(int n)
+      :Benchmark(""), numEle(n), theDomain(0), amplitude(0.0), disp(6)
+      {char buf[64]; sprintf(buf, "ForceBeamColumn3d update+tangent+force %d elements", n);
+	name = buf; work = n;}
+
+    int setUp(void) {
+      theDomain = new Domain();
+      double L = 120.0;
+      for (int i=0; i<=numEle; i++)
+	theDomain->addNode(new Node(i+1, 6, i*L, 0.0, 0.0));
+
+      SectionForceDeformation *theSection = createFiberSection(1, 8, 8);
+      SectionForceDeformation *sections[5];
+      for (int j=0; j<5; j++)
+	sections[j] = theSection;
+
+      LobattoBeamIntegration theIntegration;
+      Vector vecxz(3);
+      vecxz(2) = 1.0;
+      LinearCrdTransf3d theTransf(1, vecxz);
+
+      for (int i=0; i<numEle; i++)
+	theDomain->addElement(new ForceBeamColumn3d(i+1, i+1, i+2, 5, sections,
+						    theIntegration, theTransf));
+
+      delete theSection;
+      return 0;
+    }
+
+    void prepare(void) {
+      // alternate between two profiles so that each repetition iterates
+      amplitude = (amplitude == 1.0) ? 0.8 : 1.0;
+      double H = numEle*120.0;
+      for (int i=0; i<=numEle; i++) {
+	double x = i*120.0/H;
+	disp.Zero();
+	disp(1) = 0.02*amplitude*H*x*x;
+	disp(2) = 0.01*amplitude*H*x*x;
+	disp(4) = -0.02*amplitude*2*x;
+	disp(5) = 0.04*amplitude*x;
+	theDomain->getNode(i+1)->setTrialDisp(disp);
+      }
+    }
+
+    void run(void) {
+      double sum = 0.0;
+      for (int i=0; i<numEle; i++) {
+	Element *theEle = theDomain->getElement(i+1);
+	theEle->update();
+	sum += theEle->getTangentStiff()(0,0);
+	sum += theEle->getResistingForce()(1);
+      }
+      benchmarkSink += sum;
+    }
+
+    void tearDown(void) {
+      if (theDomain != 0)
+	delete theDomain;
+      theDomain = 0;
+    }
+
+  private:
+    int numEle;
+    Domain *theDomain;
+    double amplitude;
+    Vector disp;
+};
+
+void
+addElementBenchmarks(BenchmarkSuite &theSuite)
+{
+  theSuite.add(new FiberSectionBenchmark(6));
+  theSuite.add(new FiberSectionBenchmark(20));
+  theSuite.add(new ForceBeamColumnBenchmark(100));
+}
@@ -0,0 +1,265 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: Matrix and Vector kernels at the sizes used in element
+// state determination (6, 12) and in small global systems (100). The
+// Solve/Invert cases are also run directly through LAPACK, as Matrix did
+// before the small dense kernels, to show the difference at these sizes.
+
+#include "Benchmark.h"
+#include <Matrix.h>
+#include <Vector.h>
+#include <stdio.h>
+
+extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv, 
+		      double *B, int *LDB, int *INFO);
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, 
+		       int *iPiv, int *INFO);
+
+extern "C" int dgetri_(int *N, double *A, int *LDA, 
+		       int *iPiv, double *Work, int *WORKL, int *INFO);
+
+// fills A with a diagonally dominant matrix so Solve/Invert succeed
+static void
+fillMatrix(Matrix &A)
+{
+  int n = A.noRows();
+  for (int i=0; i<n; i++)
+    for (int j=0; j<A.noCols(); j++)
+      A(i,j) = (i == j) ? 2.0*n : 1.0/(1.0+i+j);
+}
+
+// a general (unsymmetric) matrix, so Solve/Invert can not use Cholesky
+static void
+fillGeneralMatrix(Matrix &A)
+{
+  fillMatrix(A);
+  for (int i=0; i<A.noRows(); i++)
+    for (int j=0; j<i; j++)
+      A(i,j) += 0.5;
+}
+
+static void
+fillVector(Vector &v)
+{
+  for (int i=0; i<v.Size(); i++)
+    v(i) = 1.0 + 0.1*i;
+}
+
+class VectorAddBenchmark : public Benchmark
+{
+  public:
+    VectorAddBenchmark(int n)
+      :Benchmark("", 1000.0*n), a(n), b(n)
+      {char buf[64]; sprintf(buf, "Vector::addVector n=%d x1000", n); name = buf;
+	fillVector(a); fillVector(b);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	a.addVector(0.5, b, 0.5);
+      benchmarkSink += a(0);
+    }
+  private:
+    Vector a, b;
+};
+
+class VectorDotBenchmark : public Benchmark
+{
+  public:
+    VectorDotBenchmark(int n)
+      :Benchmark("", 1000.0*n), a(n), b(n)
+      {char buf[64]; sprintf(buf, "Vector::operator^ n=%d x1000", n); name = buf;
+	fillVector(a); fillVector(b);}
+    void run(void) {
+      double sum = 0.0;
+      for (int k=0; k<1000; k++)
+	sum += a^b;
+      benchmarkSink += sum;
+    }
+  private:
+    Vector a, b;
+};
+
+class MatrixVectorBenchmark : public Benchmark
+{
+  public:
+    MatrixVectorBenchmark(int n)
+      :Benchmark("", 1000.0*n*n), A(n,n), x(n), y(n)
+      {char buf[64]; sprintf(buf, "Matrix::addMatrixVector %dx%d x1000", n, n); name = buf;
+	fillMatrix(A); fillVector(x);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	y.addMatrixVector(0.0, A, x, 1.0);
+      benchmarkSink += y(0);
+    }
+  private:
+    Matrix A;
+    Vector x, y;
+};
+
+class MatrixProductBenchmark : public Benchmark
+{
+  public:
+    MatrixProductBenchmark(int n)
+      :Benchmark("", 1000.0*n*n*n), A(n,n), B(n,n), C(n,n)
+      {char buf[64]; sprintf(buf, "Matrix::addMatrixProduct %dx%d x1000", n, n); name = buf;
+	fillMatrix(A); fillMatrix(B);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	C.addMatrixProduct(0.0, A, B, 1.0);
+      benchmarkSink += C(0,0);
+    }
+  private:
+    Matrix A, B, C;
+};
+
+// the transformation of a basic stiffness to the global system, T'KT
+class MatrixTripleProductBenchmark : public Benchmark
+{
+  public:
+    MatrixTripleProductBenchmark(int nb, int ng)
+      :Benchmark("", 1000.0*nb*ng*(nb+ng)), T(nb,ng), K(nb,nb), C(ng,ng)
+      {char buf[64]; sprintf(buf, "Matrix::addMatrixTripleProduct %dx%d x1000", nb, ng); name = buf;
+	fillMatrix(T); fillMatrix(K);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	C.addMatrixTripleProduct(0.0, T, K, 1.0);
+      benchmarkSink += C(0,0);
+    }
+  private:
+    Matrix T, K, C;
+};
+
+class MatrixSolveBenchmark : public Benchmark
+{
+  public:
+    MatrixSolveBenchmark(int n, bool general = false)
+      :Benchmark("", 1000.0), A(n,n), b(n), x(n)
+      {char buf[64]; sprintf(buf, "Matrix::Solve %s %dx%d x1000", general ? "LU" : "SPD", n, n); name = buf;
+	if (general) fillGeneralMatrix(A); else fillMatrix(A); fillVector(b);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	A.Solve(b, x);
+      benchmarkSink += x(0);
+    }
+  private:
+    Matrix A;
+    Vector b, x;
+};
+
+class MatrixInvertBenchmark : public Benchmark
+{
+  public:
+    MatrixInvertBenchmark(int n, bool general = false)
+      :Benchmark("", 1000.0), A(n,n), Ainv(n,n)
+      {char buf[64]; sprintf(buf, "Matrix::Invert %s %dx%d x1000", general ? "LU" : "SPD", n, n); name = buf;
+	if (general) fillGeneralMatrix(A); else fillMatrix(A);}
+    void run(void) {
+      for (int k=0; k<1000; k++)
+	A.Invert(Ainv);
+      benchmarkSink += Ainv(0,0);
+    }
+  private:
+    Matrix A, Ainv;
+};
+
+// the work Matrix::Solve used to do for every size: copy to a work area
+// and call dgesv
+class LapackSolveBenchmark : public Benchmark
+{
+  public:
+    LapackSolveBenchmark(int n)
+      :Benchmark("", 1000.0), A(n,n), work(n,n), b(n), x(n), iPiv(new int[n])
+      {char buf[64]; sprintf(buf, "dgesv %dx%d x1000", n, n); name = buf;
+	fillGeneralMatrix(A); fillVector(b);}
+    ~LapackSolveBenchmark() {delete [] iPiv;}
+    void run(void) {
+      int n = A.noRows();
+      int nrhs = 1;
+      int info;
+      for (int k=0; k<1000; k++) {
+	work = A;
+	x = b;
+	dgesv_(&n, &nrhs, &work(0,0), &n, iPiv, &x(0), &n, &info);
+      }
+      benchmarkSink += x(0);
+    }
+  private:
+    Matrix A, work;
+    Vector b, x;
+    int *iPiv;
+};
+
+// the work Matrix::Invert used to do for every size: dgetrf and dgetri
+class LapackInvertBenchmark : public Benchmark
+{
+  public:
+    LapackInvertBenchmark(int n)
+      :Benchmark("", 1000.0), A(n,n), Ainv(n,n), work(n,n), iPiv(new int[n])
+      {char buf[64]; sprintf(buf, "dgetrf/dgetri %dx%d x1000", n, n); name = buf;
+	fillGeneralMatrix(A);}
+    ~LapackInvertBenchmark() {delete [] iPiv;}
+    void run(void) {
+      int n = A.noRows();
+      int workSize = n*n;
+      int info;
+      for (int k=0; k<1000; k++) {
+	Ainv = A;
+	dgetrf_(&n, &n, &Ainv(0,0), &n, iPiv, &info);
+	dgetri_(&n, &Ainv(0,0), &n, iPiv, &work(0,0), &workSize, &info);
+      }
+      benchmarkSink += Ainv(0,0);
+    }
+  private:
+    Matrix A, Ainv, work;
+    int *iPiv;
+};
+
+void
+addMatrixBenchmarks(BenchmarkSuite &theSuite)
+{
+  theSuite.add(new VectorAddBenchmark(12));
+  theSuite.add(new VectorAddBenchmark(1000));
+  theSuite.add(new VectorDotBenchmark(1000));
+  theSuite.add(new MatrixVectorBenchmark(12));
+  theSuite.add(new MatrixVectorBenchmark(100));
+  theSuite.add(new MatrixProductBenchmark(6));
+  theSuite.add(new MatrixProductBenchmark(12));
+  theSuite.add(new MatrixTripleProductBenchmark(6, 12));
+  theSuite.add(new MatrixTripleProductBenchmark(12, 12));
+  theSuite.add(new MatrixSolveBenchmark(3));
+  theSuite.add(new MatrixSolveBenchmark(3, true));
+  theSuite.add(new LapackSolveBenchmark(3));
+  theSuite.add(new MatrixSolveBenchmark(6));
+  theSuite.add(new MatrixSolveBenchmark(6, true));
+  theSuite.add(new LapackSolveBenchmark(6));
+  theSuite.add(new MatrixSolveBenchmark(12));
+  theSuite.add(new MatrixSolveBenchmark(12, true));
+  theSuite.add(new LapackSolveBenchmark(12));
+  theSuite.add(new MatrixInvertBenchmark(5));
+  theSuite.add(new MatrixInvertBenchmark(5, true));
+  theSuite.add(new LapackInvertBenchmark(5));
+  theSuite.add(new MatrixInvertBenchmark(6));
+  theSuite.add(new MatrixInvertBenchmark(6, true));
+  theSuite.add(new LapackInvertBenchmark(6));
+  theSuite.add(new MatrixInvertBenchmark(12));
+  theSuite.add(new MatrixInvertBenchmark(12, true));
+  theSuite.add(new LapackInvertBenchmark(12));
+}
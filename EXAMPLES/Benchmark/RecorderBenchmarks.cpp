@@ -0,0 +1,259 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: recorder throughput, a NodeRecorder storing all
+// displacements of a domain of 10000 nodes each repetition, to a text
+// and to a binary file. When built with HDF5 (-D_HDF5), the time to read
+// back the time history of one node from an MPCO result stored with
+// one dataset per step, and with the chunked append layout of the
+// MPCORecorder -layout append option.
+
+#include "Benchmark.h"
+#include <OPS_Globals.h>
+#include <stdio.h>
+
+#include <Domain.h>
+#include <Node.h>
+#include <NodeRecorder.h>
+#include <DataFileStream.h>
+#include <BinaryFileStream.h>
+#include <ID.h>
+#include <Vector.h>
+
+#ifdef _HDF5
+#include <hdf5.h>
+#include <vector>
+#endif
+
+class NodeRecorderBenchmark : public Benchmark
+{
+  public:
+    NodeRecorderBenchmark(int n, bool binary)
+      :Benchmark(""), numNodes(n), doBinary(binary), theDomain(0),
+       theRecorder(0), commitTag(0)
+      {char buf[80];
+	sprintf(buf, "NodeRecorder disp %s %d nodes", binary ? "binary" : "text", n);
+	name = buf; work = 6.0*n;}
+
+    int setUp(void) {
+      theDomain = new Domain();
+      Vector disp(6);
+      ID theNodes(numNodes);
+      for (int i=0; i<numNodes; i++) {
+	Node *theNode = new Node(i+1, 6, 1.0*i, 0.0, 0.0);
+	for (int j=0; j<6; j++)
+	  disp(j) = 1.0e-3*(i+j);
+	theNode->setTrialDisp(disp);
+	theNode->commitState();
+	theDomain->addNode(theNode);
+	theNodes(i) = i+1;
+      }
+
+      ID theDofs(6);
+      for (int j=0; j<6; j++)
+	theDofs(j) = j;
+
+      OPS_Stream *theStream = 0;
+      if (doBinary == true)
+	theStream = new BinaryFileStream(this->getFileName());
+      else
+	theStream = new DataFileStream(this->getFileName());
+
+      theRecorder = new NodeRecorder(theDofs, &theNodes, 0, "disp",
+				     *theDomain, *theStream);
+      commitTag = 0;
+      return 0;
+    }
+
+    void run(void) {
+      theRecorder->record(commitTag, 0.01*commitTag);
+      commitTag++;
+    }
+
+    void tearDown(void) {
+      if (theRecorder != 0)
+	delete theRecorder;
+      if (theDomain != 0)
+	delete theDomain;
+      theRecorder = 0;
+      theDomain = 0;
+      remove(this->getFileName());
+    }
+
+  private:
+    const char *getFileName(void) const
+      {return doBinary ? "benchmarkRecorder.bin" : "benchmarkRecorder.out";}
+
+    int numNodes;
+    bool doBinary;
+    Domain *theDomain;
+    Recorder *theRecorder;
+    int commitTag;
+};
+
+#ifdef _HDF5
+
+// the file written in setUp() has the datasets MPCORecorder writes for
+// a nodal result: R/DATA/STEP_<i> (numNodes x 3) for the step layout,
+// R/DATA/VALUES (numSteps x numNodes x 3) chunked as chunkSteps x
+// chunkRows x 3 for the append layout. run() reads all the steps of one
+// node.
+
+class MPCOReadBackBenchmark : public Benchmark
+{
+  public:
+    MPCOReadBackBenchmark(int nodes, int steps, bool append, int level)
+      :Benchmark(""), numNodes(nodes), numSteps(steps), doAppend(append),
+       deflate(level), theFile(-1), theNode(0)
+      {char buf[80];
+	sprintf(buf, "MPCO read-back %s%s %d nodes %d steps",
+		append ? "append" : "step", level > 0 ? " deflate" : "",
+		nodes, steps);
+	name = buf; work = 3.0*steps;}
+
+    int setUp(void) {
+      hid_t file = H5Fcreate(getFileName(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+      if (file < 0)
+	return -1;
+      hid_t group = H5Gcreate(file, "R", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+      hid_t data = H5Gcreate(group, "DATA", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+      std::vector<double> values(3*numNodes);
+      hsize_t dims[3] = {(hsize_t)numSteps, (hsize_t)numNodes, 3};
+      hid_t dset = -1;
+      if (doAppend == true) {
+	// the automatic chunk of MPCORecorder: 16 steps, about 1 MB
+	hsize_t chunk[3] = {16, (hsize_t)numNodes, 3};
+	if (chunk[1] > (1 << 20)/(sizeof(double)*3*16))
+	  chunk[1] = (1 << 20)/(sizeof(double)*3*16);
+	hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+	H5Pset_chunk(plist, 3, chunk);
+	if (deflate > 0) {
+	  H5Pset_shuffle(plist);
+	  H5Pset_deflate(plist, deflate);
+	}
+	hid_t space = H5Screate_simple(3, dims, NULL);
+	dset = H5Dcreate(data, "VALUES", H5T_IEEE_F64LE, space, H5P_DEFAULT, plist, H5P_DEFAULT);
+	H5Sclose(space);
+	H5Pclose(plist);
+      }
+
+      for (int i=0; i<numSteps; i++) {
+	for (int j=0; j<numNodes; j++)
+	  for (int k=0; k<3; k++)
+	    values[3*j+k] = 1.0e-3*(i+j+k);
+	if (doAppend == true) {
+	  hsize_t start[3] = {(hsize_t)i, 0, 0};
+	  hsize_t count[3] = {1, (hsize_t)numNodes, 3};
+	  hid_t fileSpace = H5Dget_space(dset);
+	  H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, NULL, count, NULL);
+	  hid_t memSpace = H5Screate_simple(3, count, NULL);
+	  H5Dwrite(dset, H5T_NATIVE_DOUBLE, memSpace, fileSpace, H5P_DEFAULT, &values[0]);
+	  H5Sclose(memSpace);
+	  H5Sclose(fileSpace);
+	} else {
+	  char stepName[40];
+	  sprintf(stepName, "STEP_%d", i);
+	  hid_t space = H5Screate_simple(2, &dims[1], NULL);
+	  hid_t step = H5Dcreate(data, stepName, H5T_IEEE_F64LE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	  H5Dwrite(step, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &values[0]);
+	  H5Dclose(step);
+	  H5Sclose(space);
+	}
+      }
+      if (dset >= 0)
+	H5Dclose(dset);
+      H5Gclose(data);
+      H5Gclose(group);
+      H5Fclose(file);
+
+      history.resize(3*numSteps);
+      theNode = 0;
+      return 0;
+    }
+
+    void prepare(void) {
+      // a fresh open, so that nothing is served from the chunk cache
+      theFile = H5Fopen(getFileName(), H5F_ACC_RDONLY, H5P_DEFAULT);
+      theNode = (theNode + 7919) % numNodes;
+    }
+
+    void run(void) {
+      hsize_t start[3] = {0, (hsize_t)theNode, 0};
+      if (doAppend == true) {
+	hsize_t count[3] = {(hsize_t)numSteps, 1, 3};
+	hid_t dset = H5Dopen(theFile, "R/DATA/VALUES", H5P_DEFAULT);
+	hid_t fileSpace = H5Dget_space(dset);
+	H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, NULL, count, NULL);
+	hid_t memSpace = H5Screate_simple(3, count, NULL);
+	H5Dread(dset, H5T_NATIVE_DOUBLE, memSpace, fileSpace, H5P_DEFAULT, &history[0]);
+	H5Sclose(memSpace);
+	H5Sclose(fileSpace);
+	H5Dclose(dset);
+      } else {
+	hsize_t count[2] = {1, 3};
+	hid_t memSpace = H5Screate_simple(2, count, NULL);
+	for (int i=0; i<numSteps; i++) {
+	  char stepName[40];
+	  sprintf(stepName, "R/DATA/STEP_%d", i);
+	  hid_t dset = H5Dopen(theFile, stepName, H5P_DEFAULT);
+	  hid_t fileSpace = H5Dget_space(dset);
+	  H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, &start[1], NULL, count, NULL);
+	  H5Dread(dset, H5T_NATIVE_DOUBLE, memSpace, fileSpace, H5P_DEFAULT, &history[3*i]);
+	  H5Sclose(fileSpace);
+	  H5Dclose(dset);
+	}
+	H5Sclose(memSpace);
+      }
+      H5Fclose(theFile);
+      theFile = -1;
+      benchmarkSink += history[3*numSteps-1];
+    }
+
+    void tearDown(void) {
+      remove(this->getFileName());
+    }
+
+  private:
+    const char *getFileName(void) const
+      {return doAppend ? "benchmarkAppend.mpco" : "benchmarkStep.mpco";}
+
+    int numNodes;
+    int numSteps;
+    bool doAppend;
+    int deflate;
+    hid_t theFile;
+    int theNode;
+    std::vector<double> history;
+};
+
+#endif
+
+void
+addRecorderBenchmarks(BenchmarkSuite &theSuite)
+{
+  theSuite.add(new NodeRecorderBenchmark(10000, false));
+  theSuite.add(new NodeRecorderBenchmark(10000, true));
+#ifdef _HDF5
+  theSuite.add(new MPCOReadBackBenchmark(10000, 500, false, 0));
+  theSuite.add(new MPCOReadBackBenchmark(10000, 500, true, 0));
+  theSuite.add(new MPCOReadBackBenchmark(10000, 500, true, 4));
+#endif
+}
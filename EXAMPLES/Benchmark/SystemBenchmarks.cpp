@@ -0,0 +1,191 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: system of equation kernels. A bilinear 4-node Laplacian
+// on an n x n grid is assembled into each LinearSOE (zeroA + addA of
+// every cell matrix) and then factored and solved with its solver.
+
+#include "Benchmark.h"
+#include <OPS_Globals.h>
+#include <stdio.h>
+
+#include <Graph.h>
+#include <Vertex.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <LinearSOE.h>
+#include <FullGenLinSOE.h>
+#include <FullGenLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+
+static LinearSOE *createFullGen(void)
+{return new FullGenLinSOE(*(new FullGenLinLapackSolver()));}
+
+static LinearSOE *createBandGen(void)
+{return new BandGenLinSOE(*(new BandGenLinLapackSolver()));}
+
+static LinearSOE *createBandSPD(void)
+{return new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));}
+
+static LinearSOE *createProfileSPD(void)
+{return new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));}
+
+static LinearSOE *createSparseGen(void)
+{return new SparseGenColLinSOE(*(new SuperLU()));}
+
+static LinearSOE *createUmfPack(void)
+{return new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));}
+
+static LinearSOE *createSparseSPD(void)
+{return new SymSparseLinSOE(*(new SymSparseLinSolver()), 1);}
+
+class SystemBenchmark : public Benchmark
+{
+  public:
+    SystemBenchmark(const char *soeName, LinearSOE *(*create)(void),
+		    int n, bool solve)
+      :Benchmark(""), createSOE(create), gridSize(n), doSolve(solve),
+       theSOE(0), ke(4,4), fe(4), id(4)
+      {char buf[80];
+	sprintf(buf, "%s %s %d eqn", soeName, solve ? "factor+solve" : "assemble", n*n);
+	name = buf; work = n*n;
+
+	// Laplacian of a unit square with a small shift to make it definite
+	static const double k[4][4] = {{ 4.0, -1.0, -2.0, -1.0},
+				       {-1.0,  4.0, -1.0, -2.0},
+				       {-2.0, -1.0,  4.0, -1.0},
+				       {-1.0, -2.0, -1.0,  4.0}};
+	for (int i=0; i<4; i++) {
+	  for (int j=0; j<4; j++)
+	    ke(i,j) = k[i][j]/6.0;
+	  ke(i,i) += 0.01;
+	  fe(i) = 0.25;
+	}
+      }
+
+    int setUp(void) {
+      int n = gridSize;
+      Graph theGraph(n*n);
+      for (int v=0; v<n*n; v++)
+	theGraph.addVertex(new Vertex(v, v), false);
+      for (int i=0; i<n-1; i++)
+	for (int j=0; j<n-1; j++) {
+	  this->setID(i, j);
+	  for (int a=0; a<4; a++)
+	    for (int b=a+1; b<4; b++)
+	      theGraph.addEdge(id(a), id(b));
+	}
+
+      theSOE = createSOE();
+      if (theSOE->setSize(theGraph) < 0)
+	return -1;
+
+      return 0;
+    }
+
+    void prepare(void) {
+      if (doSolve == true) {
+	this->assemble();
+	theSOE->zeroB();
+	for (int i=0; i<gridSize-1; i++)
+	  for (int j=0; j<gridSize-1; j++) {
+	    this->setID(i, j);
+	    theSOE->addB(fe, id);
+	  }
+      }
+    }
+
+    void run(void) {
+      if (doSolve == true) {
+	theSOE->solve();
+	benchmarkSink += theSOE->getX()(0);
+      } else
+	this->assemble();
+    }
+
+    void tearDown(void) {
+      if (theSOE != 0)
+	delete theSOE;
+      theSOE = 0;
+    }
+
+  private:
+    void setID(int i, int j) {
+      int n = gridSize;
+      id(0) = i*n + j;
+      id(1) = i*n + j+1;
+      id(2) = (i+1)*n + j+1;
+      id(3) = (i+1)*n + j;
+    }
+
+    void assemble(void) {
+      theSOE->zeroA();
+      for (int i=0; i<gridSize-1; i++)
+	for (int j=0; j<gridSize-1; j++) {
+	  this->setID(i, j);
+	  theSOE->addA(ke, id);
+	}
+    }
+
+    LinearSOE *(*createSOE)(void);
+    int gridSize;
+    bool doSolve;
+    LinearSOE *theSOE;
+    Matrix ke;
+    Vector fe;
+    ID id;
+};
+
+void
+addSystemBenchmarks(BenchmarkSuite &theSuite)
+{
+  struct {
+    const char *name;
+    LinearSOE *(*create)(void);
+    int n;
+  } systems[] = {
+    {"FullGeneral", createFullGen, 20},
+    {"BandGeneral", createBandGen, 60},
+    {"BandSPD", createBandSPD, 60},
+    {"ProfileSPD", createProfileSPD, 60},
+    {"SparseGeneral", createSparseGen, 60},
+    {"UmfPack", createUmfPack, 60},
+    {"SparseSPD", createSparseSPD, 60}
+  };
+
+  int numSystems = sizeof(systems)/sizeof(systems[0]);
+  for (int i=0; i<numSystems; i++) {
+    theSuite.add(new SystemBenchmark(systems[i].name, systems[i].create, systems[i].n, false));
+    theSuite.add(new SystemBenchmark(systems[i].name, systems[i].create, systems[i].n, true));
+  }
+}
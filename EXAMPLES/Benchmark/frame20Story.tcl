@@ -0,0 +1,99 @@
+# Benchmark model: 20-story, 3-bay reinforced concrete frame with fiber
+# force-based beam-columns, gravity followed by a displacement controlled
+# pushover to 2% roof drift. Units: kip, in.
+
+model BasicBuilder -ndm 2 -ndf 3
+
+set numStory 20
+set numBay 3
+set H 144.0
+set L 288.0
+
+# nodes, tag = 100*floor + column line
+for {set i 0} {$i <= $numStory} {incr i} {
+    for {set j 1} {$j <= [expr $numBay+1]} {incr j} {
+	node [expr 100*$i+$j] [expr ($j-1)*$L] [expr $i*$H]
+    }
+}
+for {set j 1} {$j <= [expr $numBay+1]} {incr j} {
+    fix $j 1 1 1
+}
+
+uniaxialMaterial Concrete02 1 -5.0 -0.002 -1.0 -0.012 0.1 0.5 250.0
+uniaxialMaterial Steel02 2 60.0 29000.0 0.01 18.0 0.925 0.15
+
+# rectangular section of depth h and width b with nBars bars top and bottom
+proc rcSection {tag h b cover nBars barArea} {
+    set y [expr $h/2.0]
+    set z [expr $b/2.0]
+    set yc [expr $y-$cover]
+    set zc [expr $z-$cover]
+    section Fiber $tag {
+	patch rect 1 16 4 [expr -$y] [expr -$z] $y $z
+	layer straight 2 $nBars $barArea $yc $zc $yc [expr -$zc]
+	layer straight 2 $nBars $barArea [expr -$yc] $zc [expr -$yc] [expr -$zc]
+    }
+}
+rcSection 1 28.0 28.0 2.5 4 1.56
+rcSection 2 30.0 18.0 2.5 3 1.0
+
+geomTransf PDelta 1
+geomTransf Linear 2
+
+set eleTag 1
+for {set i 1} {$i <= $numStory} {incr i} {
+    for {set j 1} {$j <= [expr $numBay+1]} {incr j} {
+	element forceBeamColumn $eleTag [expr 100*($i-1)+$j] [expr 100*$i+$j] 5 1 1
+	incr eleTag
+    }
+    for {set j 1} {$j <= $numBay} {incr j} {
+	element forceBeamColumn $eleTag [expr 100*$i+$j] [expr 100*$i+$j+1] 5 2 2
+	incr eleTag
+    }
+}
+
+# gravity
+pattern Plain 1 Linear {
+    for {set i 1} {$i <= $numStory} {incr i} {
+	for {set j 1} {$j <= [expr $numBay+1]} {incr j} {
+	    load [expr 100*$i+$j] 0.0 -60.0 0.0
+	}
+    }
+}
+
+system BandGeneral
+numberer RCM
+constraints Plain
+test NormDispIncr 1.0e-8 20
+algorithm Newton
+integrator LoadControl 0.1
+analysis Static
+set ok [analyze 10]
+loadConst -time 0.0
+
+# pushover with a linear lateral load profile
+pattern Plain 2 Linear {
+    for {set i 1} {$i <= $numStory} {incr i} {
+	load [expr 100*$i+1] [expr 1.0*$i/$numStory] 0.0 0.0
+    }
+}
+
+set roofNode [expr 100*$numStory+1]
+set maxDisp [expr 0.02*$numStory*$H]
+set numSteps 200
+test NormDispIncr 1.0e-6 50
+integrator DisplacementControl $roofNode 1 [expr $maxDisp/$numSteps]
+analysis Static
+
+set step 0
+while {$ok == 0 && $step < $numSteps} {
+    set ok [analyze 1]
+    if {$ok != 0} {
+	algorithm NewtonLineSearch
+	set ok [analyze 1]
+	algorithm Newton
+    }
+    incr step
+}
+
+set benchmarkOK $ok
@@ -0,0 +1,84 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: driver for the kernel benchmarks.
+//
+//   benchmark <-reps $n> <-time $seconds> <-filter $substring>
+//             <-file $out.json> <-label $commit>
+//
+// Each kernel is run at least $n times (default 10) and for at least
+// $seconds (default 0.5); the results are written as JSON to $out.json
+// or to stdout.
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include "Benchmark.h"
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+int main(int argc, char **argv)
+{
+  int minReps = 10;
+  double minTime = 0.5;
+  const char *filter = 0;
+  const char *fileName = 0;
+  const char *label = 0;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-reps") == 0 && i+1 < argc)
+      minReps = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-time") == 0 && i+1 < argc)
+      minTime = atof(argv[++i]);
+    else if (strcmp(argv[i], "-filter") == 0 && i+1 < argc)
+      filter = argv[++i];
+    else if (strcmp(argv[i], "-file") == 0 && i+1 < argc)
+      fileName = argv[++i];
+    else if (strcmp(argv[i], "-label") == 0 && i+1 < argc)
+      label = argv[++i];
+    else {
+      opserr << "usage: benchmark <-reps n> <-time seconds> <-filter substring> <-file out.json> <-label name>\n";
+      exit(-1);
+    }
+  }
+
+  BenchmarkSuite theSuite(minReps, minTime, filter);
+  addMatrixBenchmarks(theSuite);
+  addElementBenchmarks(theSuite);
+  addSystemBenchmarks(theSuite);
+  addRecorderBenchmarks(theSuite);
+
+  if (fileName != 0) {
+    std::ofstream theFile(fileName);
+    if (!theFile) {
+      opserr << "benchmark - could not open " << fileName << endln;
+      exit(-1);
+    }
+    theSuite.runAll(theFile, label);
+  } else
+    theSuite.runAll(std::cout, label);
+
+  exit(0);
+}
@@ -0,0 +1,39 @@
+# Runs the canonical benchmark models and writes, for each model, the
+# wall clock time and the analysisProfile JSON dump to a JSON file.
+#
+#   OpenSees runModels.tcl <$label> <$outputFile>
+
+set label local
+set outFile models.json
+if {[info exists argv]} {
+    if {[llength $argv] > 0} {set label [lindex $argv 0]}
+    if {[llength $argv] > 1} {set outFile [lindex $argv 1]}
+}
+
+set models {frame20Story soilColumn shellWall}
+
+set results {}
+foreach model $models {
+    wipe
+    set benchmarkOK -1
+    analysisProfile reset
+    analysisProfile on
+
+    set start [clock microseconds]
+    set error [catch {source $model.tcl} msg]
+    set elapsed [expr ([clock microseconds]-$start)*1.0e-6]
+
+    analysisProfile off
+    set profile [analysisProfile -json]
+
+    set ok [expr ($error == 0 && $benchmarkOK == 0) ? "true" : "false"]
+    lappend results "  {\"name\": \"$model\", \"ok\": $ok, \"time\": $elapsed,\n   \"profile\": $profile}"
+    puts "$model: $elapsed s (ok: $ok)"
+}
+wipe
+
+set fileId [open $outFile w]
+puts $fileId "{\n \"suite\": \"models\",\n \"label\": \"$label\",\n \"results\": \["
+puts $fileId [join $results ",\n"]
+puts $fileId " \]\n}"
+close $fileId
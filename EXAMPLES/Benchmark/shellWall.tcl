@@ -0,0 +1,71 @@
+# Benchmark model: cantilever plate wall of ShellMITC4 elements with a
+# layered J2 plate fiber section under a cyclic top displacement
+# history. The top nodes are tied in the loading direction. Units: kN, m.
+
+model BasicBuilder -ndm 3 -ndf 6
+
+set L 3.0
+set H 6.0
+set t 0.02
+set nx 16
+set nz 32
+
+for {set i 0} {$i <= $nz} {incr i} {
+    for {set j 0} {$j <= $nx} {incr j} {
+	node [expr 100*$i+$j+1] [expr $j*$L/$nx] 0.0 [expr $i*$H/$nz]
+    }
+}
+for {set j 0} {$j <= $nx} {incr j} {
+    fix [expr $j+1] 1 1 1 1 1 1
+}
+
+set topNode [expr 100*$nz+1]
+for {set j 1} {$j <= $nx} {incr j} {
+    equalDOF $topNode [expr 100*$nz+$j+1] 1
+}
+
+nDMaterial J2PlateFibre 1 2.0e8 0.3 2.5e5 1.0e6 1.0e6
+section PlateFiber 1 1 $t
+
+set eleTag 1
+for {set i 0} {$i < $nz} {incr i} {
+    for {set j 0} {$j < $nx} {incr j} {
+	set n1 [expr 100*$i+$j+1]
+	set n2 [expr $n1+1]
+	set n3 [expr $n2+100]
+	set n4 [expr $n1+100]
+	element ShellMITC4 $eleTag $n1 $n2 $n3 $n4 1
+	incr eleTag
+    }
+}
+
+pattern Plain 1 Linear {
+    load $topNode 1.0 0.0 0.0 0.0 0.0 0.0
+}
+
+system BandGeneral
+numberer RCM
+constraints Transformation
+test NormDispIncr 1.0e-8 25
+algorithm Newton
+analysis Static
+
+# cycles to increasing drift, each 0 -> +A -> -A -> 0
+set ok 0
+set dU [expr 0.0005*$H]
+foreach drift {0.0025 0.005 0.01 0.015} {
+    set A [expr $drift*$H]
+    foreach target [list $A [expr -$A] 0.0] {
+	set current [nodeDisp $topNode 1]
+	set numSteps [expr int(abs($target-$current)/$dU + 0.5)]
+	if {$numSteps < 1} {
+	    continue
+	}
+	integrator DisplacementControl $topNode 1 [expr ($target-$current)/$numSteps]
+	for {set k 0} {$k < $numSteps && $ok == 0} {incr k} {
+	    set ok [analyze 1]
+	}
+    }
+}
+
+set benchmarkOK $ok
@@ -0,0 +1,73 @@
+# Benchmark model: 3D soil column of 8-node bricks with J2 plasticity,
+# 20 m deep, under a harmonic base acceleration. The four nodes of each
+# level are tied in the horizontal directions so the column deforms as
+# a shear beam. Units: kN, m, t.
+
+model BasicBuilder -ndm 3 -ndf 3
+
+set numLayer 40
+set dz 0.5
+set B 1.0
+set rho 1.8
+
+for {set i 0} {$i <= $numLayer} {incr i} {
+    set z [expr $i*$dz]
+    node [expr 10*$i+1] 0.0 0.0 $z
+    node [expr 10*$i+2] $B  0.0 $z
+    node [expr 10*$i+3] $B  $B  $z
+    node [expr 10*$i+4] 0.0 $B  $z
+}
+for {set k 1} {$k <= 4} {incr k} {
+    fix $k 1 1 1
+}
+for {set i 1} {$i <= $numLayer} {incr i} {
+    for {set k 2} {$k <= 4} {incr k} {
+	equalDOF [expr 10*$i+1] [expr 10*$i+$k] 1 2
+    }
+}
+
+# nodal mass, each element lumps rho*V/8 on its nodes
+set m [expr $rho*$B*$B*$dz/8.0]
+for {set i 0} {$i <= $numLayer} {incr i} {
+    set f [expr ($i == 0 || $i == $numLayer) ? 1.0 : 2.0]
+    for {set k 1} {$k <= 4} {incr k} {
+	mass [expr 10*$i+$k] [expr $f*$m] [expr $f*$m] [expr $f*$m]
+    }
+}
+
+nDMaterial J2Plasticity 1 1.0e5 4.0e4 60.0 90.0 1.0 100.0
+
+for {set i 1} {$i <= $numLayer} {incr i} {
+    set b [expr 10*($i-1)]
+    set t [expr 10*$i]
+    element stdBrick $i [expr $b+1] [expr $b+2] [expr $b+3] [expr $b+4] \
+	[expr $t+1] [expr $t+2] [expr $t+3] [expr $t+4] 1
+}
+
+timeSeries Trig 1 0.0 10.0 0.5 -factor 3.0
+pattern UniformExcitation 1 1 -accel 1
+
+rayleigh 0.0 0.0 0.002 0.0
+
+system BandGeneral
+numberer RCM
+constraints Transformation
+test NormDispIncr 1.0e-8 25
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+set ok 0
+set step 0
+set numSteps 1000
+while {$ok == 0 && $step < $numSteps} {
+    set ok [analyze 1 0.01]
+    if {$ok != 0} {
+	algorithm ModifiedNewton -initial
+	set ok [analyze 1 0.01]
+	algorithm Newton
+    }
+    incr step
+}
+
+set benchmarkOK $ok
@@ -37,6 +37,7 @@
 #define ChannelAddress_h
 
 #define SOCKET_TYPE 1
+#define SHARED_MEMORY_TYPE 3
 
 class ChannelAddress
 {
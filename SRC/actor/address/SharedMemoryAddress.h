@@ -0,0 +1,42 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the class definition for SharedMemoryAddress.
+// It is used to encapsulate the name of the shared memory segment used
+// by a SharedMemoryChannel.
+
+#ifndef SharedMemoryAddress_h
+#define SharedMemoryAddress_h
+
+#include <ChannelAddress.h>
+
+class SharedMemoryAddress: public ChannelAddress
+{
+  public:
+    SharedMemoryAddress(unsigned int port);
+    virtual ~SharedMemoryAddress();
+
+    unsigned int getPort(void) const {return port;}
+
+  private:
+    unsigned int port;
+};
+
+#endif
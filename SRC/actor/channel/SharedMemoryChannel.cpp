@@ -0,0 +1,642 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the implementation of the methods needed
+// to define the SharedMemoryChannel class interface.
+
+#include "SharedMemoryChannel.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <ChannelAddress.h>
+#include <SharedMemoryAddress.h>
+#include <MovableObject.h>
+#include <OPS_Globals.h>
+
+#ifndef _WIN32
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+#endif
+
+#define SHARED_MEMORY_MAGIC 0x4F505348
+#define SHARED_MEMORY_SPINS 20000
+#define SHARED_MEMORY_CONNECT_TIMEOUT 60.0
+
+#ifndef _WIN32
+
+// one direction of the channel: head and tail are the total number of
+// bytes written and read, the seq words are bumped on every write (data)
+// and read (space) and are the words the other process blocks on
+struct SharedMemoryRing
+{
+  std::atomic<long long> head;
+  std::atomic<long long> tail;
+  std::atomic<int> dataSeq, dataWaiters;
+  std::atomic<int> spaceSeq, spaceWaiters;
+  char pad[64];
+};
+
+struct SharedMemoryHeader
+{
+  std::atomic<int> magic;
+  std::atomic<int> connected;
+  int bufferSize;
+  SharedMemoryRing rings[2];    // 0: server to client, 1: client to server
+};
+
+static void
+waitOnWord(std::atomic<int> &word, int value)
+{
+#ifdef __linux__
+  // bounded so that a missed wakeup only costs a millisecond
+  struct timespec timeout = {0, 1000000};
+  syscall(SYS_futex, (int *)&word, FUTEX_WAIT, value, &timeout, 0, 0);
+#else
+  if (word.load() == value)
+    sched_yield();
+#endif
+}
+
+static void
+wakeWord(std::atomic<int> &word)
+{
+#ifdef __linux__
+  syscall(SYS_futex, (int *)&word, FUTEX_WAKE, 1, 0, 0, 0);
+#endif
+}
+
+// wait until ready() holds, spinning first and then blocking on seq;
+// while blocked alive() is checked every few wakeups and the wait gives
+// up after timeout seconds (none if 0). Returns 0 once ready, -1 if the
+// other process is gone and -2 on the timeout.
+template <class Ready, class Alive>
+static int
+waitFor(Ready ready, std::atomic<int> &seq, std::atomic<int> &waiters,
+	Alive alive, double timeout)
+{
+  for (int i=0; i<SHARED_MEMORY_SPINS; i++)
+    if (ready())
+      return 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int count=1; ; count++) {
+    int value = seq.load();
+    waiters.fetch_add(1);
+    if (ready()) {
+      waiters.fetch_sub(1);
+      return 0;
+    }
+    waitOnWord(seq, value);
+    waiters.fetch_sub(1);
+    if (ready())
+      return 0;
+
+    if (count % 16 == 0) {
+      if (alive() == false)
+	return ready() ? 0 : -1;
+      if (timeout > 0.0 &&
+	  std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() > timeout)
+	return -2;
+    }
+  }
+}
+
+// takes (F_SETLK) or tests (F_GETLK) the lock on byte which of fd
+static int
+lockByte(int fd, int which, int cmd, struct flock &lock)
+{
+  memset(&lock, 0, sizeof(lock));
+  lock.l_type = F_WRLCK;
+  lock.l_whence = SEEK_SET;
+  lock.l_start = which;
+  lock.l_len = 1;
+  return fcntl(fd, cmd, &lock);
+}
+
+#else
+
+struct SharedMemoryRing {};
+struct SharedMemoryHeader {};
+
+#endif
+
+
+// SharedMemoryChannel(unsigned int port):
+//	constructor to create the shared memory segment for port; the other
+//	process joins it in setUpConnection().
+SharedMemoryChannel::SharedMemoryChannel(unsigned int thePort, int size)
+  :port(thePort), connectType(0), bufferSize(size), fd(-1), timeout(0.0),
+   theHeader(0), mappedSize(0), sendRing(0), recvRing(0),
+   sendData(0), recvData(0)
+{
+  sprintf(name, "/OpenSees.%u", port);
+}
+
+
+// SharedMemoryChannel(unsigned int other_Port, char *other_InetAddr):
+//	constructor to join the segment created by the process on the same
+//	machine listening on other_Port; the address is only checked to be
+//	local.
+SharedMemoryChannel::SharedMemoryChannel(unsigned int other_Port,
+					 const char *other_InetAddr, int size)
+  :port(other_Port), connectType(1), bufferSize(size), fd(-1), timeout(0.0),
+   theHeader(0), mappedSize(0), sendRing(0), recvRing(0),
+   sendData(0), recvData(0)
+{
+  sprintf(name, "/OpenSees.%u", port);
+
+  if (other_InetAddr != 0 && strcmp(other_InetAddr, "127.0.0.1") != 0 &&
+      strcmp(other_InetAddr, "localhost") != 0) {
+    opserr << "SharedMemoryChannel::SharedMemoryChannel() - address " << other_InetAddr
+	   << " is not local, a SharedMemoryChannel only connects processes on the same machine\n";
+  }
+}
+
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+#ifndef _WIN32
+  if (theHeader != 0)
+    munmap((void *)theHeader, mappedSize);
+  if (fd >= 0)
+    close(fd);
+
+  // the server removes the name if no client ever joined
+  if (connectType == 0)
+    shm_unlink(name);
+#endif
+}
+
+
+int 
+SharedMemoryChannel::setUpConnection()
+{
+#ifdef _WIN32
+  opserr << "SharedMemoryChannel::setUpConnection() - not available on this platform\n";
+  return -1;
+#else
+  if (fd >= 0) {
+    close(fd);
+    fd = -1;
+  }
+
+  if (connectType == 0) {
+
+    // create a fresh segment, removing one left by an earlier run
+    shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - could not create segment " << name << endln;
+      return -1;
+    }
+
+    mappedSize = sizeof(SharedMemoryHeader) + 2*(long long)bufferSize;
+    if (ftruncate(fd, mappedSize) != 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - could not size segment " << name << endln;
+      close(fd);
+      fd = -1;
+      return -1;
+    }
+
+  } else {
+
+    // wait for the server to create the segment and publish its size
+    for (int i=0; i<60000 && fd < 0; i++) {
+      fd = shm_open(name, O_RDWR, 0600);
+      if (fd < 0)
+	usleep(1000);
+    }
+    if (fd < 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - could not connect to segment " << name << endln;
+      return -1;
+    }
+
+    struct stat info;
+    mappedSize = 0;
+    for (int i=0; i<60000 && mappedSize == 0; i++) {
+      if (fstat(fd, &info) == 0)
+	mappedSize = info.st_size;
+      if (mappedSize == 0)
+	usleep(1000);
+    }
+    bufferSize = (int)((mappedSize - (long long)sizeof(SharedMemoryHeader))/2);
+    if (bufferSize <= 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - invalid segment " << name << endln;
+      close(fd);
+      fd = -1;
+      return -1;
+    }
+  }
+
+  // hold the lock on our byte for as long as the process lives
+  struct flock lock;
+  if (lockByte(fd, connectType, F_SETLK, lock) != 0) {
+    opserr << "SharedMemoryChannel::setUpConnection() - segment " << name << " is already in use\n";
+    close(fd);
+    fd = -1;
+    return -1;
+  }
+
+  void *theMemory = mmap(0, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (theMemory == MAP_FAILED) {
+    opserr << "SharedMemoryChannel::setUpConnection() - could not map segment " << name << endln;
+    close(fd);
+    fd = -1;
+    theHeader = 0;
+    return -1;
+  }
+  theHeader = (SharedMemoryHeader *)theMemory;
+  char *theData = (char *)theMemory + sizeof(SharedMemoryHeader);
+
+  if (connectType == 0) {
+    new (theHeader) SharedMemoryHeader();
+    theHeader->bufferSize = bufferSize;
+    for (int i=0; i<2; i++) {
+      theHeader->rings[i].head = 0;
+      theHeader->rings[i].tail = 0;
+      theHeader->rings[i].dataSeq = 0;
+      theHeader->rings[i].dataWaiters = 0;
+      theHeader->rings[i].spaceSeq = 0;
+      theHeader->rings[i].spaceWaiters = 0;
+    }
+    theHeader->connected = 0;
+    theHeader->magic.store(SHARED_MEMORY_MAGIC);
+
+    sendRing = &theHeader->rings[0];
+    recvRing = &theHeader->rings[1];
+    sendData = theData;
+    recvData = theData + bufferSize;
+
+    // wait for other process to join, then the name is no longer needed
+    SharedMemoryHeader *header = theHeader;
+    int res = waitFor([header]() {return header->connected.load() != 0;},
+		      theHeader->connected, theHeader->rings[1].dataWaiters,
+		      []() {return true;}, SHARED_MEMORY_CONNECT_TIMEOUT);
+    shm_unlink(name);
+    if (res != 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - no process joined segment " << name << endln;
+      return -1;
+    }
+
+  } else {
+
+    // the server publishes the header once it is set up
+    SharedMemoryHeader *header = theHeader;
+    for (int i=0; i<600000 && header->magic.load() != SHARED_MEMORY_MAGIC; i++) {
+      if (i >= 10000 && i % 100 == 0 && this->isPeerAlive() == false)
+	break;
+      usleep(100);
+    }
+    if (header->magic.load() != SHARED_MEMORY_MAGIC) {
+      opserr << "SharedMemoryChannel::setUpConnection() - segment " << name << " was not set up by the server\n";
+      return -1;
+    }
+
+    sendRing = &theHeader->rings[1];
+    recvRing = &theHeader->rings[0];
+    sendData = theData + bufferSize;
+    recvData = theData;
+
+    theHeader->connected.store(1);
+    wakeWord(theHeader->connected);
+  }
+
+  return 0;
+#endif
+}    
+
+
+int
+SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{	
+  if (theAddress.getType() != SHARED_MEMORY_TYPE ||
+      ((const SharedMemoryAddress &)theAddress).getPort() != port) {
+    opserr << "SharedMemoryChannel::setNextAddress() - a SharedMemoryChannel ";
+    opserr << "can only communicate with one other SharedMemoryChannel\n"; 
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::checkAddress(ChannelAddress *theAddress, const char *method)
+{
+  if (theAddress != 0 && this->setNextAddress(*theAddress) != 0) {
+    opserr << "SharedMemoryChannel::" << method << "() - invalid address\n";
+    return -1;
+  }
+  return 0;
+}
+
+
+// isPeerAlive():
+//	true while the other process holds the lock on its byte of the
+//	segment, or if that cannot be told
+bool
+SharedMemoryChannel::isPeerAlive(void)
+{
+#ifdef _WIN32
+  return true;
+#else
+  if (fd < 0)
+    return true;
+
+  struct flock lock;
+  if (lockByte(fd, 1-connectType, F_GETLK, lock) != 0)
+    return true;
+
+  return lock.l_type != F_UNLCK;
+#endif
+}
+
+
+// write(), read():
+//	copy numBytes into or out of the rings, in chunks of what fits;
+//	return -1 if the other process has gone and -2 on a timeout
+int
+SharedMemoryChannel::write(const char *data, long long numBytes)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  if (sendRing == 0) {
+    opserr << "SharedMemoryChannel::write() - no connection\n";
+    return -1;
+  }
+
+  SharedMemoryRing *ring = sendRing;
+  long long size = bufferSize;
+  SharedMemoryChannel *theChannel = this;
+
+  while (numBytes > 0) {
+    long long head = ring->head.load(std::memory_order_relaxed);
+    int res = waitFor([ring, head, size]() {
+	return head - ring->tail.load(std::memory_order_acquire) < size;},
+      ring->spaceSeq, ring->spaceWaiters,
+      [theChannel]() {return theChannel->isPeerAlive();}, timeout);
+    if (res == -1) {
+      opserr << "SharedMemoryChannel::write() - the other process has exited\n";
+      return -1;
+    } else if (res < 0) {
+      opserr << "SharedMemoryChannel::write() - timed out\n";
+      return -2;
+    }
+
+    long long space = size - (head - ring->tail.load(std::memory_order_acquire));
+    long long offset = head % size;
+    long long numCopy = numBytes;
+    if (numCopy > space)
+      numCopy = space;
+    if (numCopy > size - offset)
+      numCopy = size - offset;
+
+    memcpy(sendData + offset, data, numCopy);
+    ring->head.store(head + numCopy, std::memory_order_release);
+
+    ring->dataSeq.fetch_add(1);
+    if (ring->dataWaiters.load() > 0)
+      wakeWord(ring->dataSeq);
+
+    data += numCopy;
+    numBytes -= numCopy;
+  }
+
+  return 0;
+#endif
+}
+
+
+int
+SharedMemoryChannel::read(char *data, long long numBytes)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  if (recvRing == 0) {
+    opserr << "SharedMemoryChannel::read() - no connection\n";
+    return -1;
+  }
+
+  SharedMemoryRing *ring = recvRing;
+  long long size = bufferSize;
+  SharedMemoryChannel *theChannel = this;
+
+  while (numBytes > 0) {
+    long long tail = ring->tail.load(std::memory_order_relaxed);
+    int res = waitFor([ring, tail]() {
+	return ring->head.load(std::memory_order_acquire) > tail;},
+      ring->dataSeq, ring->dataWaiters,
+      [theChannel]() {return theChannel->isPeerAlive();}, timeout);
+    if (res == -1) {
+      opserr << "SharedMemoryChannel::read() - the other process has exited\n";
+      return -1;
+    } else if (res < 0) {
+      opserr << "SharedMemoryChannel::read() - timed out\n";
+      return -2;
+    }
+
+    long long available = ring->head.load(std::memory_order_acquire) - tail;
+    long long offset = tail % size;
+    long long numCopy = numBytes;
+    if (numCopy > available)
+      numCopy = available;
+    if (numCopy > size - offset)
+      numCopy = size - offset;
+
+    memcpy(data, recvData + offset, numCopy);
+    ring->tail.store(tail + numCopy, std::memory_order_release);
+
+    ring->spaceSeq.fetch_add(1);
+    if (ring->spaceWaiters.load() > 0)
+      wakeWord(ring->spaceSeq);
+
+    data += numCopy;
+    numBytes -= numCopy;
+  }
+
+  return 0;
+#endif
+}
+
+
+int 
+SharedMemoryChannel::sendObj(int commitTag,
+			     MovableObject &theObject, ChannelAddress *theAddress) 
+{
+  if (this->checkAddress(theAddress, "sendObj") != 0)
+    return -1;
+
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int 
+SharedMemoryChannel::recvObj(int commitTag,
+			     MovableObject &theObject, 
+			     FEM_ObjectBroker &theBroker, 
+			     ChannelAddress *theAddress)
+{
+  if (this->checkAddress(theAddress, "recvObj") != 0)
+    return -1;
+
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int 
+SharedMemoryChannel::recvMsg(int dbTag, int commitTag,
+			     Message &msg, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "recvMsg") != 0)
+    return -1;
+
+  return this->read(msg.data, msg.length);
+}
+
+
+int 
+SharedMemoryChannel::recvMsgUnknownSize(int dbTag, int commitTag,
+					Message &msg, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "recvMsgUnknownSize") != 0)
+    return -1;
+
+  // read up to the end of the line or string
+  char *gMsg = msg.data;
+  while (true) {
+    if (this->read(gMsg, 1) != 0)
+      return -1;
+    gMsg++;
+    if (*(gMsg-1) == '\0')
+      break;
+    else if (*(gMsg-1) == '\n') {
+      *gMsg = '\0';
+      break;
+    }
+  }
+
+  return 0;
+}
+
+
+int 
+SharedMemoryChannel::sendMsg(int dbTag, int commitTag,
+			     const Message &msg, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "sendMsg") != 0)
+    return -1;
+
+  return this->write(msg.data, msg.length);
+}
+
+
+int 
+SharedMemoryChannel::recvMatrix(int dbTag, int commitTag,
+				Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "recvMatrix") != 0)
+    return -1;
+
+  return this->read((char *)theMatrix.data, theMatrix.dataSize * (long long)sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::sendMatrix(int dbTag, int commitTag,
+				const Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "sendMatrix") != 0)
+    return -1;
+
+  return this->write((const char *)theMatrix.data, theMatrix.dataSize * (long long)sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::recvVector(int dbTag, int commitTag,
+				Vector &theVector, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "recvVector") != 0)
+    return -1;
+
+  return this->read((char *)theVector.theData, theVector.sz * (long long)sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::sendVector(int dbTag, int commitTag,
+				const Vector &theVector, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "sendVector") != 0)
+    return -1;
+
+  return this->write((const char *)theVector.theData, theVector.sz * (long long)sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::recvID(int dbTag, int commitTag,
+			    ID &theID, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "recvID") != 0)
+    return -1;
+
+  return this->read((char *)theID.data, theID.sz * (long long)sizeof(int));
+}
+
+
+int 
+SharedMemoryChannel::sendID(int dbTag, int commitTag,
+			    const ID &theID, ChannelAddress *theAddress)
+{	
+  if (this->checkAddress(theAddress, "sendID") != 0)
+    return -1;
+
+  return this->write((const char *)theID.data, theID.sz * (long long)sizeof(int));
+}
+
+
+// addToProgram():
+//	the arguments for an actor process to join the segment, channel
+//	type 4 followed by the local address and the port
+char *
+SharedMemoryChannel::addToProgram()
+{
+  char *newStuff =(char *)malloc(100*sizeof(char));
+  sprintf(newStuff, " 4 127.0.0.1 %u ", port);
+  return newStuff;
+}
@@ -0,0 +1,128 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the class definition for SharedMemoryChannel.
+// SharedMemoryChannel is a sub-class of channel for two processes on the
+// same machine. The processes share a POSIX shared memory segment holding
+// one single-producer single-consumer ring buffer in each direction, so a
+// message is a memcpy into the ring rather than a loopback TCP round trip.
+// Like a TCP_Socket the data is a byte stream, messages are delivered in
+// order and communication is full-duplex between the pair.
+//
+// A waiting process spins for a short time before it blocks, on Linux on
+// a futex in the segment and elsewhere by yielding, so that short
+// exchanges (hybrid simulation steps) return within microseconds.
+//
+// The segment is named after the port number, so a server created with
+// SharedMemoryChannel(port) is joined by SharedMemoryChannel(port, addr)
+// in the same way as the TCP_Socket constructors.
+//
+// Each process holds a lock on its own byte of the segment while it is
+// connected; the lock goes with the process, so a waiting process finds
+// the other one has died and returns an error as a socket would. Joining
+// gives up after a minute, and with setTimeout() a read or write gives up
+// after the given time as well.
+
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include <Channel.h>
+
+struct SharedMemoryHeader;
+struct SharedMemoryRing;
+
+class SharedMemoryChannel : public Channel
+{
+  public:
+    SharedMemoryChannel(unsigned int port, int bufferSize = 1048576);
+    SharedMemoryChannel(unsigned int other_Port, const char *other_InetAddr,
+			int bufferSize = 1048576);
+    ~SharedMemoryChannel();
+
+    char *addToProgram();
+    
+    virtual int setUpConnection();
+
+    // seconds a read or write waits for the other process, 0 (the
+    // default) waits as long as the other process is alive
+    void setTimeout(double seconds) {timeout = seconds;}
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(){ return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+    
+  private:
+    int checkAddress(ChannelAddress *theAddress, const char *method);
+    int write(const char *data, long long numBytes);
+    int read(char *data, long long numBytes);
+    bool isPeerAlive(void);
+
+    unsigned int port;
+    int connectType;          // 0 creates the segment, 1 joins it
+    int bufferSize;
+    char name[32];
+    int fd;                   // the segment, kept open for the locks
+    double timeout;
+
+    SharedMemoryHeader *theHeader;
+    long long mappedSize;
+    SharedMemoryRing *sendRing, *recvRing;
+    char *sendData, *recvData;
+};
+
+#endif 
@@ -55,6 +55,8 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <Profiler.h>
+#include <vector>
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
 #include <SensitivityAlgorithm.h>
@@ -178,6 +180,22 @@ DirectIntegrationAnalysis::initialize(void)
 int 
 DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 {
+  int result = this->analyzeSteps(numSteps, dT);
+
+  // the recorder threads may still be writing the last step, it is
+  // on file when the analysis returns
+  if (this->getDomainPtr()->waitForRecorders() < 0)
+    opserr << "WARNING DirectIntegrationAnalysis::analyze() - a recorder failed to record\n";
+
+  return result;
+}
+
+int
+DirectIntegrationAnalysis::analyzeSteps(int numSteps, double dT)
+{
+  static int profAnalyze = Profiler::getRegion("analyze");
+  ProfilerScope theScope(profAnalyze);
+
   int result = 0;
   Domain *the_Domain = this->getDomainPtr();
  // if (theEigenSOE != 0)
@@ -210,7 +228,11 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
       return -2;
     }
     
-    result = theAlgorithm->solveCurrentStep();
+    {
+      static int profAlgorithm = Profiler::getRegion("algorithm");
+      ProfilerScope theAlgorithmScope(profAlgorithm);
+      result = theAlgorithm->solveCurrentStep();
+    }
     if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -360,22 +382,51 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
 int
 DirectIntegrationAnalysis::domainChanged(void)
 {
+    static int profDomainChanged = Profiler::getRegion("domainChanged");
+    ProfilerScope theScope(profDomainChanged);
+
     Domain *the_Domain = this->getDomainPtr();
     int stamp = the_Domain->hasDomainChanged();
+    int lastStamp = domainStamp;
     domainStamp = stamp;
 
+    // if elements were only removed since the last call, the model is
+    // patched in place keeping the numbering and the SOE
+    if (theAnalysisModel->patchRemovedElements(lastStamp, *theSOE) == 0) {
+
+      if (theIntegrator->domainChanged() < 0) {
+	opserr << "DirectIntegrationAnalysis::domainChanged() - ";
+	opserr << "Integrator::domainChanged() failed";
+	return -4;
+      }
+      if (theAlgorithm->domainChanged() < 0) {
+	opserr << "DirectIntegrationAnalysis::domainChanged() - ";
+	opserr << "Algorithm::domainChanged() failed";
+	return -5;
+      }
+      return 0;
+    }
+
     theAnalysisModel->clearAll();    
     theConstraintHandler->clearAll();
     
     // now we invoke handle() on the constraint handler which
     // causes the creation of FE_Element and DOF_Group objects
     // and their addition to the AnalysisModel.
-    theConstraintHandler->handle();
+    {
+      static int profConstraints = Profiler::getRegion("constraints");
+      ProfilerScope theHandlerScope(profConstraints);
+      theConstraintHandler->handle();
+    }
 
     // we now invoke number() on the numberer which causes
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
-    theDOF_Numberer->numberDOF();
+    {
+      static int profNumberer = Profiler::getRegion("numberer");
+      ProfilerScope theNumbererScope(profNumberer);
+      theDOF_Numberer->numberDOF();
+    }
 
     theConstraintHandler->doneNumberingDOF();
 
@@ -383,7 +434,12 @@ DirectIntegrationAnalysis::domainChanged(void)
     // causes that object to determine its size
     Graph &theGraph = theAnalysisModel->getDOFGraph();
 
-    int result = theSOE->setSize(theGraph);
+    int result = 0;
+    {
+      static int profSymbolic = Profiler::getRegion("LinearSOE::symbolic");
+      ProfilerScope theSymbolicScope(profSymbolic);
+      result = theSOE->setSize(theGraph);
+    }
     if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
@@ -98,6 +98,8 @@ class DirectIntegrationAnalysis: public TransientAnalysis
   protected:
     
   private:
+    int analyzeSteps(int numSteps, double dT);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -0,0 +1,542 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// GroundMotionBatch.
+
+#include <GroundMotionBatch.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <TimeSeries.h>
+#include <GroundMotion.h>
+#include <UniformExcitation.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <TransientAnalysis.h>
+#include <TransientIntegrator.h>
+#include <OPS_Globals.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <errno.h>
+#endif
+
+void *
+OPS_GroundMotionBatch(void)
+{
+  // groundMotionBatch dof dT -accel seriesTags <-factor factors>
+  //   <-drift iNode jNode dof perpDirn> <-disp nodeTag dof>
+  //   <-extraTime t> <-numProcesses n>
+  if (OPS_GetNumRemainingInputArgs() < 4) {
+    opserr << "WARNING insufficient args: groundMotionBatch dof dT -accel seriesTags <-factor factors> <-drift iNode jNode dof perpDirn> <-disp nodeTag dof> <-extraTime t> <-numProcesses n>\n";
+    return 0;
+  }
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return 0;
+
+  int dof;
+  double dT;
+  int numData = 1;
+  if (OPS_GetIntInput(&numData, &dof) < 0 || dof < 1) {
+    opserr << "WARNING groundMotionBatch - invalid dof\n";
+    return 0;
+  }
+  if (OPS_GetDoubleInput(&numData, &dT) < 0 || dT <= 0.0) {
+    opserr << "WARNING groundMotionBatch - invalid dT\n";
+    return 0;
+  }
+
+  GroundMotionBatch *theBatch = new GroundMotionBatch(*theDomain, dof-1, dT);
+  int numFactors = 0;
+  int numRecords = 0;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *option = OPS_GetString();
+
+    if (strcmp(option, "-accel") == 0) {
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	int tag;
+	if (OPS_GetIntInput(&numData, &tag) < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	TimeSeries *theSeries = OPS_getTimeSeries(tag);
+	if (theSeries == 0) {
+	  opserr << "WARNING groundMotionBatch - no timeSeries with tag " << tag << endln;
+	  delete theBatch;
+	  return 0;
+	}
+	theBatch->addRecord(*theSeries);
+	numRecords++;
+      }
+    } else if (strcmp(option, "-factor") == 0 || strcmp(option, "-fact") == 0) {
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	double factor;
+	if (OPS_GetDoubleInput(&numData, &factor) < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	theBatch->addFactor(factor);
+	numFactors++;
+      }
+    } else if (strcmp(option, "-drift") == 0) {
+      int data[4];
+      numData = 4;
+      if (OPS_GetIntInput(&numData, data) < 0 ||
+	  theBatch->addDrift(data[0], data[1], data[2]-1, data[3]-1) < 0) {
+	opserr << "WARNING groundMotionBatch - invalid -drift iNode jNode dof perpDirn\n";
+	delete theBatch;
+	return 0;
+      }
+      numData = 1;
+    } else if (strcmp(option, "-disp") == 0) {
+      int data[2];
+      numData = 2;
+      if (OPS_GetIntInput(&numData, data) < 0 ||
+	  theBatch->addDisp(data[0], data[1]-1) < 0) {
+	opserr << "WARNING groundMotionBatch - invalid -disp nodeTag dof\n";
+	delete theBatch;
+	return 0;
+      }
+      numData = 1;
+    } else if (strcmp(option, "-extraTime") == 0) {
+      double extraTime;
+      if (OPS_GetDoubleInput(&numData, &extraTime) < 0 || extraTime < 0.0) {
+	opserr << "WARNING groundMotionBatch - invalid -extraTime t\n";
+	delete theBatch;
+	return 0;
+      }
+      theBatch->setExtraTime(extraTime);
+    } else if (strcmp(option, "-numProcesses") == 0) {
+      int num;
+      if (OPS_GetIntInput(&numData, &num) < 0) {
+	opserr << "WARNING groundMotionBatch - invalid -numProcesses n\n";
+	delete theBatch;
+	return 0;
+      }
+      theBatch->setNumProcesses(num);
+    } else
+      opserr << "WARNING groundMotionBatch - unknown option " << option << endln;
+  }
+
+  if (numRecords == 0) {
+    opserr << "WARNING groundMotionBatch - no records given with -accel\n";
+    delete theBatch;
+    return 0;
+  }
+
+  // the records as given
+  if (numFactors == 0)
+    theBatch->addFactor(1.0);
+
+  return theBatch;
+}
+
+GroundMotionBatch::GroundMotionBatch(Domain &domain, int theDof, double deltaT,
+				     double extra)
+  :theDomain(&domain), dof(theDof), dT(deltaT), extraTime(extra),
+   numProcesses(1), theRecords(), factors(), drifts(), disps(),
+   theNodes(), heights(), thePattern(0), results()
+{
+
+}
+
+GroundMotionBatch::~GroundMotionBatch()
+{
+  for (std::size_t i=0; i<theRecords.size(); i++)
+    delete theRecords[i];
+}
+
+int
+GroundMotionBatch::addRecord(TimeSeries &accelSeries)
+{
+  TimeSeries *theCopy = accelSeries.getCopy();
+  if (theCopy == 0)
+    return -1;
+
+  theRecords.push_back(theCopy);
+  return 0;
+}
+
+int
+GroundMotionBatch::addFactor(double factor)
+{
+  factors.push_back(factor);
+  return 0;
+}
+
+int
+GroundMotionBatch::addDrift(int iNode, int jNode, int theDof, int perpDirn)
+{
+  Node *nodeI = theDomain->getNode(iNode);
+  Node *nodeJ = theDomain->getNode(jNode);
+  if (nodeI == 0 || nodeJ == 0 || theDof < 0 || perpDirn < 0)
+    return -1;
+
+  const Vector &crdI = nodeI->getCrds();
+  const Vector &crdJ = nodeJ->getCrds();
+  if (perpDirn >= crdI.Size() || perpDirn >= crdJ.Size() ||
+      crdI(perpDirn) == crdJ(perpDirn))
+    return -1;
+
+  drifts.push_back(iNode);
+  drifts.push_back(jNode);
+  drifts.push_back(theDof);
+  drifts.push_back(perpDirn);
+  return 0;
+}
+
+int
+GroundMotionBatch::addDisp(int nodeTag, int theDof)
+{
+  if (theDomain->getNode(nodeTag) == 0 || theDof < 0)
+    return -1;
+
+  disps.push_back(nodeTag);
+  disps.push_back(theDof);
+  return 0;
+}
+
+void
+GroundMotionBatch::setExtraTime(double t)
+{
+  extraTime = (t > 0.0) ? t : 0.0;
+}
+
+void
+GroundMotionBatch::setNumProcesses(int num)
+{
+#ifdef _WIN32
+  if (num > 1)
+    opserr << "WARNING GroundMotionBatch -- worker processes are not available on Windows, running serially\n";
+  num = 1;
+#endif
+  numProcesses = (num > 1) ? num : 1;
+}
+
+int
+GroundMotionBatch::getNumRuns(void) const
+{
+  return (int)(theRecords.size()*factors.size());
+}
+
+int
+GroundMotionBatch::run(TransientAnalysis &theAnalysis,
+		       TransientIntegrator *theIntegrator)
+{
+  int numRuns = this->getNumRuns();
+  int numDrifts = (int)drifts.size()/4;
+  int numDisps = (int)disps.size()/2;
+  if (numRuns == 0)
+    return 0;
+  results.resize(numRuns, 1+numDrifts+numDisps);
+  results.Zero();
+
+  // the nodes may have been removed since the batch was built
+  theNodes.clear();
+  heights.clear();
+  for (int i=0; i<numDrifts; i++) {
+    Node *nodeI = theDomain->getNode(drifts[4*i]);
+    Node *nodeJ = theDomain->getNode(drifts[4*i+1]);
+    if (nodeI == 0 || nodeJ == 0) {
+      opserr << "WARNING GroundMotionBatch::run() - drift node not in the domain\n";
+      return -1;
+    }
+    int perpDirn = drifts[4*i+3];
+    theNodes.push_back(nodeI);
+    theNodes.push_back(nodeJ);
+    heights.push_back(nodeJ->getCrds()(perpDirn) - nodeI->getCrds()(perpDirn));
+  }
+  for (int i=0; i<numDisps; i++) {
+    Node *theNode = theDomain->getNode(disps[2*i]);
+    if (theNode == 0) {
+      opserr << "WARNING GroundMotionBatch::run() - node " << disps[2*i] << " not in the domain\n";
+      return -1;
+    }
+    theNodes.push_back(theNode);
+  }
+
+  // one excitation for all the runs, its motion is replaced for each
+  // run so the domain only changes when it is added and removed
+  int tag = 0;
+  while (theDomain->getLoadPattern(tag) != 0)
+    tag++;
+  GroundMotion *theMotion = new GroundMotion(0, 0, 0);
+  thePattern = new UniformExcitation(*theMotion, dof, tag);
+  if (theDomain->addLoadPattern(thePattern) == false) {
+    opserr << "WARNING GroundMotionBatch::run() - failed to add the excitation\n";
+    delete thePattern;
+    thePattern = 0;
+    return -1;
+  }
+
+  theDomain->suspendRecorders(true);
+
+  int res = 0;
+#ifndef _WIN32
+  // every run is made by a worker forked from the model as it is now, so
+  // each starts from the committed state, gravity included, and the
+  // model is left in it
+  res = this->runForked(theAnalysis, theIntegrator);
+#else
+  // without workers the runs start from revertToStart(), which loses
+  // the state the model was brought to before the batch
+  if (this->isPreloaded() == true)
+    opserr << "WARNING GroundMotionBatch::run() - the runs start from the unloaded model, the committed state and constant loads are not kept on this platform\n";
+
+  int numCols = results.noCols();
+  std::vector<double> row(numCols);
+  for (int i=0; i<numRuns; i++) {
+    theDomain->revertToStart();
+    if (theIntegrator != 0)
+      theIntegrator->revertToStart();
+    if (this->runRecord(i, theAnalysis, theIntegrator, &row[0]) < 0)
+      res = -1;
+    for (int j=0; j<numCols; j++)
+      results(i,j) = row[j];
+  }
+
+  theDomain->revertToStart();
+  if (theIntegrator != 0)
+    theIntegrator->revertToStart();
+#endif
+
+  theDomain->suspendRecorders(false);
+
+  theDomain->removeLoadPattern(tag);
+  delete thePattern;
+  thePattern = 0;
+
+  return res;
+}
+
+int
+GroundMotionBatch::runRecord(int run, TransientAnalysis &theAnalysis,
+			     TransientIntegrator *theIntegrator, double *result)
+{
+  int numFactors = (int)factors.size();
+  TimeSeries *theRecord = theRecords[run/numFactors];
+  double factor = factors[run%numFactors];
+
+  int numDrifts = (int)drifts.size()/4;
+  int numDisps = (int)disps.size()/2;
+  for (int i=0; i<=numDrifts+numDisps; i++)
+    result[i] = 0.0;
+
+  GroundMotion *theMotion = new GroundMotion(0, 0, theRecord->getCopy(), 0,
+					     dT, factor);
+  thePattern->setGroundMotion(*theMotion);
+
+  int numSteps = (int)((theRecord->getDuration() + extraTime)/dT + 0.5);
+  for (int step=0; step<numSteps; step++) {
+    if (theAnalysis.analyze(1, dT) < 0) {
+      opserr << "WARNING GroundMotionBatch - run " << run << " failed at time "
+	     << theDomain->getCurrentTime() << endln;
+      result[0] = -1.0;
+      return -1;
+    }
+
+    for (int i=0; i<numDrifts; i++) {
+      int theDof = drifts[4*i+2];
+      const Vector &dispI = theNodes[2*i]->getDisp();
+      const Vector &dispJ = theNodes[2*i+1]->getDisp();
+      if (theDof >= dispI.Size() || theDof >= dispJ.Size())
+	continue;
+      double drift = fabs((dispJ(theDof) - dispI(theDof))/heights[i]);
+      if (drift > result[1+i])
+	result[1+i] = drift;
+    }
+    for (int i=0; i<numDisps; i++) {
+      int theDof = disps[2*i+1];
+      const Vector &disp = theNodes[2*numDrifts+i]->getDisp();
+      if (theDof >= disp.Size())
+	continue;
+      double u = fabs(disp(theDof));
+      if (u > result[1+numDrifts+i])
+	result[1+numDrifts+i] = u;
+    }
+  }
+
+  return 0;
+}
+
+// isPreloaded():
+//	true if the model has been brought to a state the runs should start
+//	from, a time or a load pattern with a factor other than 0
+bool
+GroundMotionBatch::isPreloaded(void)
+{
+  if (theDomain->getCurrentTime() != 0.0)
+    return true;
+
+  LoadPattern *theLoadPattern;
+  LoadPatternIter &thePatterns = theDomain->getLoadPatterns();
+  while ((theLoadPattern = thePatterns()) != 0)
+    if (theLoadPattern != thePattern && theLoadPattern->getLoadFactor() != 0.0)
+      return true;
+
+  return false;
+}
+
+int
+GroundMotionBatch::runForked(TransientAnalysis &theAnalysis,
+			     TransientIntegrator *theIntegrator)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  int numRuns = this->getNumRuns();
+  int numCols = results.noCols();
+  int nproc = (numProcesses < numRuns) ? numProcesses : numRuns;
+
+  // set the analysis up for the excitation once, not in every worker
+  if (theAnalysis.domainChanged() < 0) {
+    opserr << "WARNING GroundMotionBatch::run() - the analysis failed to take the excitation\n";
+    return -1;
+  }
+
+  // a recorder batch still being written must be finished before the
+  // model is copied, the workers have no recorder threads to finish it
+  theDomain->waitForRecorders();
+
+  // buffered output would be written again by every worker
+  fflush(stdout);
+  fflush(stderr);
+
+  // a run not reported has failed
+  for (int i=0; i<numRuns; i++)
+    results(i,0) = -1.0;
+
+  // every run is made by its own worker forked from the current model,
+  // at most nproc at a time; a worker sends back its result row
+  std::vector<struct pollfd> fds;
+  std::vector<pid_t> pids;
+  std::vector<int> slots;
+  int res = 0;
+  int next = 0;
+  size_t size = numCols*sizeof(double);
+  while (next < numRuns || fds.empty() == false) {
+
+    // start workers up to nproc
+    while (next < numRuns && (int)fds.size() < nproc && res == 0) {
+      int fd[2];
+      if (pipe(fd) != 0) {
+	opserr << "WARNING GroundMotionBatch - failed to create pipe for worker process\n";
+	res = -1;
+	break;
+      }
+      pid_t pid = fork();
+      if (pid < 0) {
+	opserr << "WARNING GroundMotionBatch - failed to start worker process\n";
+	close(fd[0]);
+	close(fd[1]);
+	res = -1;
+	break;
+      }
+
+      if (pid == 0) {
+	// worker: its own copy of the interpreter and domain, the record
+	// starts at time 0 as after loadConst -time 0.0
+	close(fd[0]);
+	for (size_t i=0; i<fds.size(); i++)
+	  close(fds[i].fd);
+	theDomain->setCurrentTime(0.0);
+	theDomain->setCommittedTime(0.0);
+	std::vector<double> row(numCols);
+	this->runRecord(next, theAnalysis, theIntegrator, &row[0]);
+	ssize_t nwritten = write(fd[1], &row[0], size);
+	close(fd[1]);
+	fflush(stdout);
+	fflush(stderr);
+	_exit(nwritten == (ssize_t)size ? 0 : 1);
+      }
+
+      close(fd[1]);
+      struct pollfd pfd;
+      pfd.fd = fd[0];
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      fds.push_back(pfd);
+      pids.push_back(pid);
+      slots.push_back(next);
+      next++;
+    }
+    if (res < 0)
+      next = numRuns;
+    if (fds.empty())
+      break;
+
+    // wait for a worker to finish, it writes one row and exits
+    if (poll(&fds[0], fds.size(), -1) < 0) {
+      if (errno == EINTR)
+	continue;
+      opserr << "WARNING GroundMotionBatch - failed to wait for worker processes\n";
+      res = -1;
+      for (size_t k=0; k<fds.size(); k++)
+	fds[k].revents = POLLHUP;
+    }
+
+    for (int k=(int)fds.size()-1; k>=0; k--) {
+      if (fds[k].revents == 0)
+	continue;
+
+      std::vector<double> row(numCols);
+      size_t nread = 0;
+      while (nread < size) {
+	ssize_t n = read(fds[k].fd, (char *)&row[0] + nread, size - nread);
+	if (n < 0 && errno == EINTR)
+	  continue;
+	if (n <= 0)
+	  break;
+	nread += n;
+      }
+      close(fds[k].fd);
+
+      int status;
+      while (waitpid(pids[k], &status, 0) < 0 && errno == EINTR)
+	;
+
+      if (nread == size)
+	for (int i=0; i<numCols; i++)
+	  results(slots[k],i) = row[i];
+
+      fds.erase(fds.begin()+k);
+      pids.erase(pids.begin()+k);
+      slots.erase(slots.begin()+k);
+    }
+  }
+
+  for (int i=0; i<numRuns; i++)
+    if (results(i,0) < 0.0)
+      res = -1;
+
+  return res;
+#endif
+}
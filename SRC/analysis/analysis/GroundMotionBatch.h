@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef GroundMotionBatch_h
+#define GroundMotionBatch_h
+
+// Description: This file contains the class definition for
+// GroundMotionBatch. A GroundMotionBatch runs a transient analysis of
+// one model for every combination of a list of acceleration records and
+// scale factors, as needed by incremental dynamic and multi-stripe
+// analyses. The records are applied in turn by one UniformExcitation
+// whose ground motion is replaced between runs, so the domain does not
+// change and the analysis keeps its constraint handler, numbering and
+// system of equations. Each run is made by a worker process forked from
+// the model as it is when the batch is run, so every record starts from
+// the committed state, such as a gravity load held with loadConst, at
+// time 0, and the model is left in that state; numProcesses workers run
+// at a time. Only the peak drifts and displacements asked for are kept,
+// the recorders of the domain are suspended. On Windows the runs are
+// made in turn from revertToStart().
+
+#include <Matrix.h>
+#include <vector>
+
+class Domain;
+class Node;
+class TimeSeries;
+class TransientAnalysis;
+class TransientIntegrator;
+class UniformExcitation;
+
+class GroundMotionBatch
+{
+  public:
+    GroundMotionBatch(Domain &theDomain, int dof, double dT,
+		      double extraTime = 0.0);
+    ~GroundMotionBatch();
+
+    // the series are copied
+    int addRecord(TimeSeries &accelSeries);
+    int addFactor(double factor);
+    int addDrift(int iNode, int jNode, int dof, int perpDirn);
+    int addDisp(int nodeTag, int dof);
+    void setExtraTime(double t);
+    void setNumProcesses(int num);
+
+    // runs record i with factor j as run i*numFactors+j
+    int run(TransientAnalysis &theAnalysis, TransientIntegrator *theIntegrator);
+
+    int getNumRuns(void) const;
+    // one row per run: status (0 or -1) and the peaks in the order added
+    const Matrix &getResults(void) const {return results;}
+
+  private:
+    int runRecord(int run, TransientAnalysis &theAnalysis,
+		  TransientIntegrator *theIntegrator, double *result);
+    int runForked(TransientAnalysis &theAnalysis,
+		  TransientIntegrator *theIntegrator);
+    bool isPreloaded(void);
+
+    Domain *theDomain;
+    int dof;
+    double dT, extraTime;
+    int numProcesses;
+
+    std::vector<TimeSeries *> theRecords;
+    std::vector<double> factors;
+
+    // drifts (iNode, jNode, dof, perpDirn) and displacements (node, dof)
+    std::vector<int> drifts;
+    std::vector<int> disps;
+
+    // the nodes of the drifts and displacements and the drift heights,
+    // looked up when the batch is run
+    std::vector<Node *> theNodes;
+    std::vector<double> heights;
+
+    UniformExcitation *thePattern;
+    Matrix results;
+};
+
+#endif
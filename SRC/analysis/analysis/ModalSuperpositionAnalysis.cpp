@@ -0,0 +1,923 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// ModalSuperpositionAnalysis.
+
+#include <ModalSuperpositionAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
+#include <ElementalLoad.h>
+#include <ElementalLoadIter.h>
+#include <SP_ConstraintIter.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Profiler.h>
+#include <classTags.h>
+#include <OPS_Globals.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <math.h>
+#include <map>
+#include <algorithm>
+
+void *
+OPS_ModalSuperpositionAnalysis(void)
+{
+  // analysis ModalSuperposition numModes <-damp zeta> <-rayleigh alphaM betaK>
+  //   <-nonlinear eleTags> <-recoverAll> <-tol tol> <-maxIter maxIter>
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING insufficient args: analysis ModalSuperposition numModes <-damp zeta> <-rayleigh alphaM betaK> <-nonlinear eleTags> <-recoverAll> <-tol tol> <-maxIter maxIter>\n";
+    return 0;
+  }
+
+  int numModes;
+  int numData = 1;
+  if (OPS_GetIntInput(&numData, &numModes) < 0 || numModes < 1) {
+    opserr << "WARNING analysis ModalSuperposition - invalid numModes\n";
+    return 0;
+  }
+
+  double dampRatio = -1.0;
+  double rayleigh[2] = {0.0, 0.0};
+  double tol = 1.0e-6;
+  int maxIter = 25;
+  bool recoverAll = false;
+  ID eleTags(0);
+  int numEles = 0;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *option = OPS_GetString();
+
+    if (strcmp(option, "-damp") == 0) {
+      numData = 1;
+      if (OPS_GetDoubleInput(&numData, &dampRatio) < 0 || dampRatio < 0.0) {
+	opserr << "WARNING analysis ModalSuperposition - invalid -damp zeta\n";
+	return 0;
+      }
+    } else if (strcmp(option, "-rayleigh") == 0) {
+      numData = 2;
+      if (OPS_GetDoubleInput(&numData, rayleigh) < 0) {
+	opserr << "WARNING analysis ModalSuperposition - invalid -rayleigh alphaM betaK\n";
+	return 0;
+      }
+    } else if (strcmp(option, "-nonlinear") == 0) {
+      numData = 1;
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	int tag;
+	if (OPS_GetIntInput(&numData, &tag) < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	eleTags[numEles++] = tag;
+      }
+    } else if (strcmp(option, "-recoverAll") == 0) {
+      recoverAll = true;
+    } else if (strcmp(option, "-tol") == 0) {
+      numData = 1;
+      if (OPS_GetDoubleInput(&numData, &tol) < 0) {
+	opserr << "WARNING analysis ModalSuperposition - invalid -tol tol\n";
+	return 0;
+      }
+    } else if (strcmp(option, "-maxIter") == 0) {
+      numData = 1;
+      if (OPS_GetIntInput(&numData, &maxIter) < 0) {
+	opserr << "WARNING analysis ModalSuperposition - invalid -maxIter maxIter\n";
+	return 0;
+      }
+    } else
+      opserr << "WARNING analysis ModalSuperposition - unknown option " << option << endln;
+  }
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return 0;
+
+  return new ModalSuperpositionAnalysis(*theDomain, numModes, dampRatio,
+					rayleigh[0], rayleigh[1], &eleTags,
+					recoverAll, tol, maxIter);
+}
+
+ModalSuperpositionAnalysis::ModalSuperpositionAnalysis(Domain &the_Domain,
+						       int modes,
+						       double damp,
+						       double aM, double bK,
+						       const ID *nonlinearEles,
+						       bool all,
+						       double theTol,
+						       int theMaxIter)
+  :TransientAnalysis(the_Domain), numModes(modes),
+   dampRatio(damp), alphaM(aM), betaK(bK), nonlinearTags(0),
+   recoverAll(all), tol(theTol), maxIter(theMaxIter),
+   setUpDone(false), updateDomain(false), domainStamp(0),
+   lastTime(0.0), lastDT(0.0), eigenvalues(),
+   omega(), zeta(), modalMass(), coefficients(),
+   q(), qDot(), qDotDot(), q0(), qDot0(), qDotDot0(), pLoad(), pPseudo(),
+   thePatterns(), patternLoads(), theExcitations(), excitationLoads(),
+   theNodes(), nodeOffsets(), initialDisp(), initialVel(), initialAccel(),
+   recoveredNodes(), nonlinearNodes(),
+   theElements(), initialStiff(), initialForce(), initialEleDisp(), work()
+{
+  if (nonlinearEles != 0 && nonlinearEles->Size() > 0)
+    nonlinearTags = new ID(*nonlinearEles);
+}
+
+ModalSuperpositionAnalysis::~ModalSuperpositionAnalysis()
+{
+  this->clearAll();
+
+  if (nonlinearTags != 0)
+    delete nonlinearTags;
+}
+
+void
+ModalSuperpositionAnalysis::clearAll(void)
+{
+  for (size_t i=0; i<theElements.size(); i++) {
+    delete initialStiff[i];
+    delete initialForce[i];
+    delete initialEleDisp[i];
+  }
+  theElements.clear();
+  initialStiff.clear();
+  initialForce.clear();
+  initialEleDisp.clear();
+
+  thePatterns.clear();
+  patternLoads.clear();
+  theExcitations.clear();
+  excitationLoads.clear();
+
+  theNodes.clear();
+  nodeOffsets.clear();
+  initialDisp.clear();
+  initialVel.clear();
+  initialAccel.clear();
+  recoveredNodes.clear();
+  nonlinearNodes.clear();
+
+  setUpDone = false;
+}
+
+int
+ModalSuperpositionAnalysis::domainChanged(void)
+{
+  // the projection is formed again on the next step
+  setUpDone = false;
+  return 0;
+}
+
+int
+ModalSuperpositionAnalysis::analyze(int numSteps, double dT)
+{
+  static int profAnalyze = Profiler::getRegion("analyze");
+  ProfilerScope theScope(profAnalyze);
+
+  Domain *the_Domain = this->getDomainPtr();
+
+  // project the domain again if it, its eigenvectors or its state were
+  // changed since the last step
+  bool changed = (setUpDone == false);
+
+  int stamp = the_Domain->hasDomainChanged();
+  if (stamp != domainStamp || the_Domain->getCurrentTime() != lastTime)
+    changed = true;
+
+  const Vector &theEigenvalues = the_Domain->getEigenvalues();
+  if (theEigenvalues.Size() < numModes || eigenvalues.Size() < numModes)
+    changed = true;
+  else
+    for (int j=0; j<numModes && changed == false; j++)
+      if (theEigenvalues(j) != eigenvalues(j))
+	changed = true;
+
+  if (changed == true && this->setUp() < 0) {
+    opserr << "ModalSuperpositionAnalysis::analyze() - failed to project the domain on the modes\n";
+    return -1;
+  }
+
+  if (dT != lastDT && this->formCoefficients(dT) < 0)
+    return -1;
+
+  Vector qTrial(numModes);
+  Vector qDotTrial(numModes);
+  Vector qDotDotTrial(numModes);
+  Vector qLast(numModes);
+  Vector p(numModes);
+  Vector g(numModes);
+
+  for (int i=0; i<numSteps; i++) {
+
+    double time = lastTime + dT;
+    the_Domain->setCurrentTime(time);
+
+    this->formModalLoad(time, p);
+    g = pPseudo;
+
+    // integrate the modal equations, with the pseudo force of the
+    // nonlinear elements iterated to convergence
+    int numIter = 0;
+    while (true) {
+      for (int j=0; j<numModes; j++) {
+	const double *c = &coefficients[8*j];
+	double p0 = pLoad(j) + pPseudo(j);
+	double p1 = p(j) + g(j);
+	qTrial(j) = c[0]*q(j) + c[1]*qDot(j) + c[2]*p0 + c[3]*p1;
+	qDotTrial(j) = c[4]*q(j) + c[5]*qDot(j) + c[6]*p0 + c[7]*p1;
+      }
+
+      if (theElements.empty())
+	break;
+
+      if (numIter > 0) {
+	qLast -= qTrial;
+	if (qLast.Norm() <= tol*qTrial.Norm())
+	  break;
+      }
+
+      if (++numIter > maxIter) {
+	opserr << "ModalSuperpositionAnalysis::analyze() - the pseudo force failed to converge";
+	opserr << " at time " << time << endln;
+	for (size_t e=0; e<theElements.size(); e++)
+	  theElements[e]->revertToLastCommit();
+	the_Domain->setCurrentTime(lastTime);
+	return -3;
+      }
+
+      qLast = qTrial;
+      if (this->formPseudoLoad(qTrial, qDotTrial, g) < 0) {
+	opserr << "ModalSuperpositionAnalysis::analyze() - the nonlinear elements failed";
+	opserr << " at time " << time << endln;
+	for (size_t e=0; e<theElements.size(); e++)
+	  theElements[e]->revertToLastCommit();
+	the_Domain->setCurrentTime(lastTime);
+	return -3;
+      }
+    }
+
+    for (int j=0; j<numModes; j++)
+      qDotDotTrial(j) = p(j) + g(j) - 2.0*zeta(j)*omega(j)*qDotTrial(j)
+	- omega(j)*omega(j)*qTrial(j);
+
+    q = qTrial;
+    qDot = qDotTrial;
+    qDotDot = qDotDotTrial;
+    pLoad = p;
+    pPseudo = g;
+
+    // recover the response and commit
+    if (updateDomain == true) {
+      for (size_t n=0; n<theNodes.size(); n++)
+	this->recoverNode(n, q, qDot, &qDotDot);
+
+      if (the_Domain->update() < 0) {
+	opserr << "ModalSuperpositionAnalysis::analyze() - the domain failed to update";
+	opserr << " at time " << time << endln;
+	return -3;
+      }
+
+      if (the_Domain->commit() < 0) {
+	opserr << "ModalSuperpositionAnalysis::analyze() - the domain failed to commit";
+	opserr << " at time " << time << endln;
+	return -4;
+      }
+
+    } else {
+      for (size_t n=0; n<recoveredNodes.size(); n++) {
+	int index = recoveredNodes[n];
+	this->recoverNode(index, q, qDot, &qDotDot);
+	theNodes[index]->commitState();
+      }
+
+      for (size_t e=0; e<theElements.size(); e++)
+	theElements[e]->commitState();
+
+      the_Domain->setCommittedTime(time);
+      the_Domain->record();
+    }
+
+    lastTime = time;
+  }
+
+  // leave the whole domain at the final state
+  if (updateDomain == false)
+    this->recoverDomain();
+
+  return 0;
+}
+
+int
+ModalSuperpositionAnalysis::setUp(void)
+{
+  Domain *the_Domain = this->getDomainPtr();
+
+  this->clearAll();
+
+  const Vector &theEigenvalues = the_Domain->getEigenvalues();
+  if (numModes < 1 || theEigenvalues.Size() < numModes) {
+    opserr << "ModalSuperpositionAnalysis::setUp() - " << numModes
+	   << " modes wanted but " << theEigenvalues.Size()
+	   << " eigenvalues in the domain, run eigen first\n";
+    return -1;
+  }
+
+  eigenvalues = theEigenvalues;
+  domainStamp = the_Domain->hasDomainChanged();
+  lastTime = the_Domain->getCurrentTime();
+  lastDT = 0.0;
+
+  //
+  // the frequencies and damping ratios of the modes
+  //
+
+  omega.resize(numModes);
+  zeta.resize(numModes);
+  modalMass.resize(numModes);
+  q.resize(numModes);
+  qDot.resize(numModes);
+  qDotDot.resize(numModes);
+  q0.resize(numModes);
+  qDot0.resize(numModes);
+  qDotDot0.resize(numModes);
+  pLoad.resize(numModes);
+  pPseudo.resize(numModes);
+
+  const Vector *modalDamping = the_Domain->getModalDampingFactors();
+
+  for (int j=0; j<numModes; j++) {
+    omega(j) = (eigenvalues(j) > 0.0) ? sqrt(eigenvalues(j)) : 0.0;
+
+    double ratio = dampRatio;
+    if (ratio < 0.0)
+      ratio = (modalDamping != 0 && j < modalDamping->Size()) ? (*modalDamping)(j) : 0.0;
+    if (omega(j) > 0.0)
+      ratio += 0.5*alphaM/omega(j) + 0.5*betaK*omega(j);
+    zeta(j) = ratio;
+  }
+
+  //
+  // the nodes, their initial state and the modal masses
+  //
+
+  std::map<int, int> nodeIndex;
+
+  nodeOffsets.push_back(0);
+  NodeIter &theNodeIter = the_Domain->getNodes();
+  Node *theNode;
+  while ((theNode = theNodeIter()) != 0) {
+    if (theNode->getEigenvectors().noCols() < numModes) {
+      opserr << "ModalSuperpositionAnalysis::setUp() - node " << theNode->getTag()
+	     << " has fewer than " << numModes << " eigenvectors\n";
+      return -1;
+    }
+
+    nodeIndex[theNode->getTag()] = theNodes.size();
+    theNodes.push_back(theNode);
+
+    int ndf = theNode->getNumberDOF();
+    nodeOffsets.push_back(nodeOffsets.back() + ndf);
+
+    const Vector &disp = theNode->getDisp();
+    const Vector &vel = theNode->getVel();
+    const Vector &accel = theNode->getAccel();
+    for (int k=0; k<ndf; k++) {
+      initialDisp.push_back(disp(k));
+      initialVel.push_back(vel(k));
+      initialAccel.push_back(accel(k));
+    }
+  }
+
+  modalMass.Zero();
+  q0.Zero();
+  qDot0.Zero();
+  qDotDot0.Zero();
+
+  for (size_t n=0; n<theNodes.size(); n++)
+    if (this->projectMass(theNodes[n]->getMass(), &theNodes[n], 1, -1) < 0)
+      return -1;
+
+  ElementIter &theEleIter = the_Domain->getElements();
+  Element *theEle;
+  while ((theEle = theEleIter()) != 0) {
+    if (theEle->isSubdomain() == true)
+      continue;
+    if (this->projectMass(theEle->getMass(), theEle->getNodePtrs(),
+			  theEle->getNumExternalNodes(), -1) < 0) {
+      opserr << "ModalSuperpositionAnalysis::setUp() - the mass of element "
+	     << theEle->getTag() << " does not match its nodes\n";
+      return -1;
+    }
+  }
+
+  for (int j=0; j<numModes; j++) {
+    if (modalMass(j) <= 0.0) {
+      opserr << "ModalSuperpositionAnalysis::setUp() - mode " << j+1
+	     << " has no mass\n";
+      return -1;
+    }
+    q0(j) /= modalMass(j);
+    qDot0(j) /= modalMass(j);
+    qDotDot0(j) /= modalMass(j);
+  }
+
+  q = q0;
+  qDot = qDot0;
+  qDotDot = qDotDot0;
+
+  //
+  // the loads of the load patterns on the modes
+  //
+
+  LoadPatternIter &thePatternIter = the_Domain->getLoadPatterns();
+  LoadPattern *thePattern;
+  while ((thePattern = thePatternIter()) != 0) {
+    int classTag = thePattern->getClassTag();
+    if (classTag == PATTERN_TAG_LoadPattern)
+      thePatterns.push_back(thePattern);
+    else if (classTag == PATTERN_TAG_UniformExcitation)
+      theExcitations.push_back((UniformExcitation *)thePattern);
+    else {
+      opserr << "ModalSuperpositionAnalysis::setUp() - load pattern " << thePattern->getTag()
+	     << " can not be projected on the modes, only plain patterns and uniform excitations can\n";
+      return -1;
+    }
+  }
+
+  // the participation of the excitations, with the influence vectors
+  // the excitation sets in the nodes
+  excitationLoads.assign(theExcitations.size()*numModes, 0.0);
+  for (size_t e=0; e<theExcitations.size(); e++) {
+    theExcitations[e]->applyLoad(lastTime);
+
+    for (size_t n=0; n<theNodes.size(); n++)
+      this->projectMass(theNodes[n]->getMass(), &theNodes[n], 1, e);
+
+    ElementIter &theEles = the_Domain->getElements();
+    while ((theEle = theEles()) != 0)
+      if (theEle->isSubdomain() == false)
+	this->projectMass(theEle->getMass(), theEle->getNodePtrs(),
+			  theEle->getNumExternalNodes(), e);
+
+    for (int j=0; j<numModes; j++)
+      excitationLoads[e*numModes+j] /= modalMass(j);
+  }
+
+  // the loads of the plain patterns for a unit load factor
+  patternLoads.assign(thePatterns.size()*numModes, 0.0);
+  for (size_t i=0; i<thePatterns.size(); i++) {
+    thePattern = thePatterns[i];
+    double *p = &patternLoads[i*numModes];
+
+    NodalLoad *theLoad;
+    NodalLoadIter &theLoads = thePattern->getNodalLoads();
+    while ((theLoad = theLoads()) != 0) {
+      theNode = the_Domain->getNode(theLoad->getNodeTag());
+      if (theNode != 0)
+	theNode->zeroUnbalancedLoad();
+    }
+    NodalLoadIter &theLoadsToApply = thePattern->getNodalLoads();
+    while ((theLoad = theLoadsToApply()) != 0)
+      theLoad->applyLoad(1.0);
+    NodalLoadIter &theLoadsToProject = thePattern->getNodalLoads();
+    while ((theLoad = theLoadsToProject()) != 0) {
+      theNode = the_Domain->getNode(theLoad->getNodeTag());
+      if (theNode != 0) {
+	this->projectNodalForce(theNode, theNode->getUnbalancedLoad(), p);
+	theNode->zeroUnbalancedLoad();
+      }
+    }
+
+    // an elemental load is the change it makes to the resisting force
+    ElementalLoad *theEleLoad;
+    ElementalLoadIter &theEleLoads = thePattern->getElementalLoads();
+    while ((theEleLoad = theEleLoads()) != 0) {
+      theEle = the_Domain->getElement(theEleLoad->getElementTag());
+      if (theEle == 0)
+	continue;
+      theEle->zeroLoad();
+      Vector force(theEle->getResistingForce());
+      theEleLoad->applyLoad(1.0);
+      force -= theEle->getResistingForce();
+      this->projectElementForce(theEle, force, p);
+      theEle->zeroLoad();
+    }
+
+    SP_ConstraintIter &theSPs = thePattern->getSPs();
+    if (theSPs() != 0)
+      opserr << "WARNING ModalSuperpositionAnalysis - the imposed displacements of load pattern "
+	     << thePattern->getTag() << " are ignored\n";
+
+    for (int j=0; j<numModes; j++)
+      p[j] /= modalMass(j);
+  }
+
+  // put the loads of the current time back on the domain
+  the_Domain->applyLoad(lastTime);
+
+  //
+  // the nonlinear elements at the initial state
+  //
+
+  if (nonlinearTags != 0) {
+    for (int i=0; i<nonlinearTags->Size(); i++) {
+      theEle = the_Domain->getElement((*nonlinearTags)(i));
+      if (theEle == 0) {
+	opserr << "ModalSuperpositionAnalysis::setUp() - nonlinear element "
+	       << (*nonlinearTags)(i) << " not in the domain\n";
+	return -1;
+      }
+
+      theElements.push_back(theEle);
+      initialStiff.push_back(new Matrix(theEle->getTangentStiff()));
+      initialForce.push_back(new Vector(theEle->getResistingForce()));
+
+      Vector *disp = new Vector(theEle->getNumDOF());
+      Node **nodes = theEle->getNodePtrs();
+      int loc = 0;
+      for (int a=0; a<theEle->getNumExternalNodes(); a++) {
+	nonlinearNodes.push_back(nodeIndex[nodes[a]->getTag()]);
+	const Vector &nodeDisp = nodes[a]->getTrialDisp();
+	for (int k=0; k<nodeDisp.Size() && loc < disp->Size(); k++)
+	  (*disp)(loc++) = nodeDisp(k);
+      }
+      initialEleDisp.push_back(disp);
+    }
+
+    std::sort(nonlinearNodes.begin(), nonlinearNodes.end());
+    nonlinearNodes.erase(std::unique(nonlinearNodes.begin(), nonlinearNodes.end()),
+			 nonlinearNodes.end());
+  }
+
+  //
+  // the nodes recovered at each step, those the recorders read
+  //
+
+  updateDomain = recoverAll;
+  if (updateDomain == false) {
+    ID recordedNodes;
+    if (the_Domain->getRecordedNodes(recordedNodes) < 0)
+      updateDomain = true;
+    else {
+      recoveredNodes = nonlinearNodes;
+      for (int i=0; i<recordedNodes.Size(); i++) {
+	std::map<int, int>::iterator it = nodeIndex.find(recordedNodes(i));
+	if (it != nodeIndex.end())
+	  recoveredNodes.push_back(it->second);
+      }
+      std::sort(recoveredNodes.begin(), recoveredNodes.end());
+      recoveredNodes.erase(std::unique(recoveredNodes.begin(), recoveredNodes.end()),
+			   recoveredNodes.end());
+    }
+  }
+
+  this->formModalLoad(lastTime, pLoad);
+  pPseudo.Zero();
+
+  setUpDone = true;
+
+  return 0;
+}
+
+int
+ModalSuperpositionAnalysis::formCoefficients(double dT)
+{
+  if (dT <= 0.0) {
+    opserr << "ModalSuperpositionAnalysis::formCoefficients() - dT " << dT
+	   << " must be positive\n";
+    return -1;
+  }
+
+  coefficients.resize(8*numModes);
+
+  for (int j=0; j<numModes; j++) {
+    double w = omega(j);
+    double z = zeta(j);
+    double k = w*w;
+    double *c = &coefficients[8*j];
+
+    if (w > 0.0 && z < 1.0) {
+
+      // exact solution for a load varying linearly over the step
+      double sq = sqrt(1.0 - z*z);
+      double wD = w*sq;
+      double e = exp(-z*w*dT);
+      double s = sin(wD*dT);
+      double cs = cos(wD*dT);
+
+      c[0] = e*(z/sq*s + cs);
+      c[1] = e*s/wD;
+      c[2] = (2.0*z/(w*dT) + e*(((1.0 - 2.0*z*z)/(wD*dT) - z/sq)*s
+				- (1.0 + 2.0*z/(w*dT))*cs))/k;
+      c[3] = (1.0 - 2.0*z/(w*dT) + e*((2.0*z*z - 1.0)/(wD*dT)*s
+				      + 2.0*z/(w*dT)*cs))/k;
+      c[4] = -e*(w/sq*s);
+      c[5] = e*(cs - z/sq*s);
+      c[6] = (-1.0/dT + e*((w/sq + z/(dT*sq))*s + cs/dT))/k;
+      c[7] = (1.0 - e*(z/sq*s + cs))/(k*dT);
+
+    } else {
+
+      // rigid body and overdamped modes, average acceleration
+      double cD = 2.0*z*w;
+      double kHat = k + 2.0*cD/dT + 4.0/(dT*dT);
+
+      c[0] = (4.0/(dT*dT) + 2.0*cD/dT - k)/kHat;
+      c[1] = 4.0/dT/kHat;
+      c[2] = 1.0/kHat;
+      c[3] = 1.0/kHat;
+      c[4] = 2.0/dT*(c[0] - 1.0);
+      c[5] = 2.0/dT*c[1] - 1.0;
+      c[6] = 2.0/dT*c[2];
+      c[7] = 2.0/dT*c[3];
+    }
+  }
+
+  lastDT = dT;
+
+  return 0;
+}
+
+void
+ModalSuperpositionAnalysis::formModalLoad(double time, Vector &p)
+{
+  p.Zero();
+
+  for (size_t i=0; i<thePatterns.size(); i++) {
+    double factor = thePatterns[i]->formLoadFactor(time);
+    if (factor != 0.0) {
+      const double *load = &patternLoads[i*numModes];
+      for (int j=0; j<numModes; j++)
+	p(j) += factor*load[j];
+    }
+  }
+
+  for (size_t e=0; e<theExcitations.size(); e++) {
+    double accel = theExcitations[e]->getGroundAccel(time);
+    if (accel != 0.0) {
+      const double *load = &excitationLoads[e*numModes];
+      for (int j=0; j<numModes; j++)
+	p(j) -= accel*load[j];
+    }
+  }
+}
+
+int
+ModalSuperpositionAnalysis::formPseudoLoad(const Vector &qTrial,
+					   const Vector &qDotTrial, Vector &g)
+{
+  g.Zero();
+
+  for (size_t n=0; n<nonlinearNodes.size(); n++)
+    this->recoverNode(nonlinearNodes[n], qTrial, qDotTrial, 0);
+
+  // the force of the initial stiffness less the resisting force
+  for (size_t e=0; e<theElements.size(); e++) {
+    Element *theEle = theElements[e];
+    if (theEle->update() < 0)
+      return -1;
+
+    const Vector &eleDisp0 = *initialEleDisp[e];
+    int numDOF = eleDisp0.Size();
+    if ((int)work.size() < 2*numDOF)
+      work.resize(2*numDOF);
+
+    Vector deltaDisp(&work[0], numDOF);
+    Vector pseudo(&work[numDOF], numDOF);
+
+    Node **nodes = theEle->getNodePtrs();
+    int loc = 0;
+    for (int a=0; a<theEle->getNumExternalNodes(); a++) {
+      const Vector &nodeDisp = nodes[a]->getTrialDisp();
+      for (int k=0; k<nodeDisp.Size() && loc < numDOF; k++, loc++)
+	deltaDisp(loc) = nodeDisp(k) - eleDisp0(loc);
+    }
+
+    pseudo = *initialForce[e];
+    pseudo -= theEle->getResistingForce();
+    pseudo.addMatrixVector(1.0, *initialStiff[e], deltaDisp, 1.0);
+
+    this->projectElementForce(theEle, pseudo, &g(0));
+  }
+
+  for (int j=0; j<numModes; j++)
+    g(j) /= modalMass(j);
+
+  return 0;
+}
+
+void
+ModalSuperpositionAnalysis::recoverNode(int index, const Vector &qTrial,
+					const Vector &qDotTrial,
+					const Vector *qDotDotTrial)
+{
+  Node *theNode = theNodes[index];
+  int ndf = theNode->getNumberDOF();
+  int loc = nodeOffsets[index];
+  const Matrix &theVectors = theNode->getEigenvectors();
+
+  if ((int)work.size() < 3*ndf)
+    work.resize(3*ndf);
+  double *disp = &work[0];
+  double *vel = disp + ndf;
+  double *accel = vel + ndf;
+
+  for (int k=0; k<ndf; k++) {
+    disp[k] = initialDisp[loc+k];
+    vel[k] = initialVel[loc+k];
+    accel[k] = initialAccel[loc+k];
+  }
+
+  for (int j=0; j<numModes; j++) {
+    double dq = qTrial(j) - q0(j);
+    double dqDot = qDotTrial(j) - qDot0(j);
+    double dqDotDot = (qDotDotTrial != 0) ? (*qDotDotTrial)(j) - qDotDot0(j) : 0.0;
+    for (int k=0; k<ndf; k++) {
+      double phi = theVectors(k, j);
+      disp[k] += phi*dq;
+      vel[k] += phi*dqDot;
+      accel[k] += phi*dqDotDot;
+    }
+  }
+
+  Vector theDisp(disp, ndf);
+  Vector theVel(vel, ndf);
+  theNode->setTrialDisp(theDisp);
+  theNode->setTrialVel(theVel);
+  if (qDotDotTrial != 0) {
+    Vector theAccel(accel, ndf);
+    theNode->setTrialAccel(theAccel);
+  }
+}
+
+int
+ModalSuperpositionAnalysis::projectMass(const Matrix &mass, Node **nodes,
+					int numNodes, int excitation)
+{
+  int numDOF = mass.noRows();
+  if (numDOF == 0)
+    return 0;
+
+  bool isZero = true;
+  for (int k=0; k<numDOF && isZero == true; k++)
+    for (int l=0; l<numDOF; l++)
+      if (mass(k, l) != 0.0) {
+	isZero = false;
+	break;
+      }
+  if (isZero == true)
+    return 0;
+
+  // the eigenvectors and the initial state, or influence vector, of the
+  // dofs of the nodes
+  work.resize(numDOF*(numModes + 4));
+  Matrix phi(&work[0], numDOF, numModes);
+  double *x = &work[numDOF*numModes];
+
+  static Vector unit(1);
+  unit(0) = 1.0;
+
+  int loc = 0;
+  for (int a=0; a<numNodes; a++) {
+    Node *theNode = nodes[a];
+    int ndf = theNode->getNumberDOF();
+    if (loc + ndf > numDOF)
+      return -1;
+
+    const Matrix &theVectors = theNode->getEigenvectors();
+    for (int j=0; j<numModes; j++)
+      for (int k=0; k<ndf; k++)
+	phi(loc+k, j) = theVectors(k, j);
+
+    if (excitation < 0) {
+      const Vector &disp = theNode->getDisp();
+      const Vector &vel = theNode->getVel();
+      const Vector &accel = theNode->getAccel();
+      for (int k=0; k<ndf; k++) {
+	x[loc+k] = disp(k);
+	x[numDOF+loc+k] = vel(k);
+	x[2*numDOF+loc+k] = accel(k);
+      }
+    } else {
+      const Vector &r = theNode->getRV(unit);
+      for (int k=0; k<ndf; k++)
+	x[loc+k] = r(k);
+    }
+
+    loc += ndf;
+  }
+
+  if (loc != numDOF)
+    return -1;
+
+  // the column of M*phi of each mode against phi and the state
+  double *w = &work[numDOF*(numModes + 3)];
+  for (int j=0; j<numModes; j++) {
+    for (int k=0; k<numDOF; k++) {
+      double sum = 0.0;
+      for (int l=0; l<numDOF; l++)
+	sum += mass(k, l)*phi(l, j);
+      w[k] = sum;
+    }
+
+    if (excitation < 0) {
+      double mm = 0.0, mu = 0.0, mv = 0.0, ma = 0.0;
+      for (int k=0; k<numDOF; k++) {
+	mm += phi(k, j)*w[k];
+	mu += x[k]*w[k];
+	mv += x[numDOF+k]*w[k];
+	ma += x[2*numDOF+k]*w[k];
+      }
+      modalMass(j) += mm;
+      q0(j) += mu;
+      qDot0(j) += mv;
+      qDotDot0(j) += ma;
+    } else {
+      double mr = 0.0;
+      for (int k=0; k<numDOF; k++)
+	mr += x[k]*w[k];
+      excitationLoads[excitation*numModes+j] += mr;
+    }
+  }
+
+  return 0;
+}
+
+void
+ModalSuperpositionAnalysis::projectNodalForce(Node *theNode,
+					      const Vector &force, double *p)
+{
+  const Matrix &theVectors = theNode->getEigenvectors();
+  int ndf = force.Size();
+  for (int j=0; j<numModes; j++) {
+    double sum = 0.0;
+    for (int k=0; k<ndf; k++)
+      sum += theVectors(k, j)*force(k);
+    p[j] += sum;
+  }
+}
+
+void
+ModalSuperpositionAnalysis::projectElementForce(Element *theEle,
+						const Vector &force, double *p)
+{
+  Node **nodes = theEle->getNodePtrs();
+  int numDOF = force.Size();
+  int loc = 0;
+  for (int a=0; a<theEle->getNumExternalNodes(); a++) {
+    const Matrix &theVectors = nodes[a]->getEigenvectors();
+    int ndf = nodes[a]->getNumberDOF();
+    if (loc + ndf > numDOF)
+      break;
+    for (int j=0; j<numModes; j++) {
+      double sum = 0.0;
+      for (int k=0; k<ndf; k++)
+	sum += theVectors(k, j)*force(loc+k);
+      p[j] += sum;
+    }
+    loc += ndf;
+  }
+}
+
+int
+ModalSuperpositionAnalysis::recoverDomain(void)
+{
+  for (size_t n=0; n<theNodes.size(); n++) {
+    this->recoverNode(n, q, qDot, &qDotDot);
+    theNodes[n]->commitState();
+  }
+
+  int res = 0;
+  ElementIter &theEles = this->getDomainPtr()->getElements();
+  Element *theEle;
+  while ((theEle = theEles()) != 0) {
+    res += theEle->update();
+    res += theEle->commitState();
+  }
+
+  return res;
+}
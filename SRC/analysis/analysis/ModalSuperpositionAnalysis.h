@@ -0,0 +1,130 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ModalSuperpositionAnalysis_h
+#define ModalSuperpositionAnalysis_h
+
+// Description: This file contains the class definition for
+// ModalSuperpositionAnalysis. ModalSuperpositionAnalysis is a subclass
+// of TransientAnalysis which integrates the response of the domain in
+// the basis of its first numModes eigenvectors, as left in the nodes by
+// a previous eigen analysis. The modal masses, the loads of the plain
+// load patterns and the participation of the uniform excitations are
+// projected once, the uncoupled modal equations are then integrated
+// exactly for loads varying linearly over a step. The elements given as
+// nonlinear are updated at every step and the difference between their
+// linear and actual resisting forces is applied to the modes as a
+// pseudo force, iterated to convergence within the step.
+//
+// At every step only the nodes read by the recorders (and those of the
+// nonlinear elements) are recovered and committed; if a recorder needs
+// the whole domain, or recoverAll is set, the domain is updated and
+// committed as in a direct integration. The whole domain is recovered
+// at the end of analyze().
+
+#include <TransientAnalysis.h>
+#include <Vector.h>
+#include <vector>
+
+class Node;
+class Element;
+class Matrix;
+class ID;
+class LoadPattern;
+class UniformExcitation;
+
+class ModalSuperpositionAnalysis: public TransientAnalysis
+{
+  public:
+    ModalSuperpositionAnalysis(Domain &theDomain, int numModes,
+			       double dampRatio = -1.0,
+			       double alphaM = 0.0, double betaK = 0.0,
+			       const ID *nonlinearEles = 0,
+			       bool recoverAll = false,
+			       double tol = 1.0e-6, int maxIter = 25);
+    virtual ~ModalSuperpositionAnalysis();
+
+    void clearAll(void);
+
+    int analyze(int numSteps, double dT);
+    int domainChanged(void);
+
+    int getNumModes(void) const {return numModes;}
+
+  protected:
+
+  private:
+    int setUp(void);
+    int formCoefficients(double dT);
+    void formModalLoad(double time, Vector &p);
+    int formPseudoLoad(const Vector &qTrial, const Vector &qDotTrial, Vector &g);
+    void recoverNode(int index, const Vector &qTrial, const Vector &qDotTrial,
+		     const Vector *qDotDotTrial);
+    int projectMass(const Matrix &mass, Node **nodes, int numNodes,
+		    int excitation);
+    void projectNodalForce(Node *theNode, const Vector &force, double *p);
+    void projectElementForce(Element *theEle, const Vector &force, double *p);
+    int recoverDomain(void);
+
+    int numModes;
+    double dampRatio, alphaM, betaK;
+    ID *nonlinearTags;
+    bool recoverAll;
+    double tol;
+    int maxIter;
+
+    // state of the projection
+    bool setUpDone;
+    bool updateDomain;
+    int domainStamp;
+    double lastTime;
+    double lastDT;
+    Vector eigenvalues;
+
+    // modal properties, the loads are divided by the modal mass
+    Vector omega, zeta, modalMass;
+    std::vector<double> coefficients;      // 8 per mode
+    Vector q, qDot, qDotDot;               // committed modal response
+    Vector q0, qDot0, qDotDot0;            // at the initial state
+    Vector pLoad, pPseudo;                 // committed modal loads
+
+    std::vector<LoadPattern *> thePatterns;
+    std::vector<double> patternLoads;
+    std::vector<UniformExcitation *> theExcitations;
+    std::vector<double> excitationLoads;
+
+    // the nodes of the domain and their state at the initial state
+    std::vector<Node *> theNodes;
+    std::vector<int> nodeOffsets;
+    std::vector<double> initialDisp, initialVel, initialAccel;
+    std::vector<int> recoveredNodes;       // indices into theNodes
+    std::vector<int> nonlinearNodes;
+
+    // the nonlinear elements with their stiffness, force and
+    // displacements at the initial state
+    std::vector<Element *> theElements;
+    std::vector<Matrix *> initialStiff;
+    std::vector<Vector *> initialForce;
+    std::vector<Vector *> initialEleDisp;
+
+    std::vector<double> work;
+};
+
+#endif
@@ -47,6 +47,8 @@
 #include <ID.h>
 #include <Graph.h>
 #include <Timer.h>
+#include <Profiler.h>
+#include <vector>
 #include <Integrator.h>//Abbas
 
 // AddingSensitivity:BEGIN //////////////////////////////////
@@ -146,6 +148,22 @@ StaticAnalysis::clearAll(void)
 int 
 StaticAnalysis::analyze(int numSteps)
 {
+    int result = this->analyzeSteps(numSteps);
+
+    // the recorder threads may still be writing the last step, it is
+    // on file when the analysis returns
+    if (this->getDomainPtr()->waitForRecorders() < 0)
+      opserr << "WARNING StaticAnalysis::analyze() - a recorder failed to record\n";
+
+    return result;
+}
+
+int
+StaticAnalysis::analyzeSteps(int numSteps)
+{
+    static int profAnalyze = Profiler::getRegion("analyze");
+    ProfilerScope theScope(profAnalyze);
+
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
 
@@ -192,7 +210,11 @@ StaticAnalysis::analyze(int numSteps)
 	    return -2;
 	}
 
-           result = theAlgorithm->solveCurrentStep();
+	{
+	  static int profAlgorithm = Profiler::getRegion("algorithm");
+	  ProfilerScope theAlgorithmScope(profAlgorithm);
+	  result = theAlgorithm->solveCurrentStep();
+	}
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the Algorithm failed";
 	    opserr << " at iteration: " << i << " with domain at load factor ";
@@ -376,12 +398,33 @@ StaticAnalysis::initialize(void)
 int
 StaticAnalysis::domainChanged(void)
 {
+    static int profDomainChanged = Profiler::getRegion("domainChanged");
+    ProfilerScope theScope(profDomainChanged);
+
     int result = 0;
 
     Domain *the_Domain = this->getDomainPtr();
     int stamp = the_Domain->hasDomainChanged();
+    int lastStamp = domainStamp;
     domainStamp = stamp;
 
+    // if elements were only removed since the last call, the model is
+    // patched in place keeping the numbering and the SOE
+    if (theAnalysisModel->patchRemovedElements(lastStamp, *theSOE) == 0) {
+
+      if (theIntegrator->domainChanged() < 0) {
+	opserr << "StaticAnalysis::domainChanged() - ";
+	opserr << "Integrator::domainChanged() failed";
+	return -4;
+      }
+      if (theAlgorithm->domainChanged() < 0) {
+	opserr << "StaticAnalysis::domainChanged() - ";
+	opserr << "Algorithm::domainChanged() failed";
+	return -5;
+      }
+      return 0;
+    }
+
     // Timer theTimer; theTimer.start();
     // opserr << "StaticAnalysis::domainChanged(void)\n";
 
@@ -397,7 +440,11 @@ StaticAnalysis::domainChanged(void)
     // causes the creation of FE_Element and DOF_Group objects
     // and their addition to the AnalysisModel.
 
-    result = theConstraintHandler->handle();
+    {
+      static int profConstraints = Profiler::getRegion("constraints");
+      ProfilerScope theHandlerScope(profConstraints);
+      result = theConstraintHandler->handle();
+    }
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "ConstraintHandler::handle() failed";
@@ -408,7 +455,11 @@ StaticAnalysis::domainChanged(void)
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
 
-    result = theDOF_Numberer->numberDOF();
+    {
+      static int profNumberer = Profiler::getRegion("numberer");
+      ProfilerScope theNumbererScope(profNumberer);
+      result = theDOF_Numberer->numberDOF();
+    }
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "DOF_Numberer::numberDOF() failed";
@@ -427,7 +478,11 @@ StaticAnalysis::domainChanged(void)
 
     Graph &theGraph = theAnalysisModel->getDOFGraph();
 
-    result = theSOE->setSize(theGraph);
+    {
+      static int profSymbolic = Profiler::getRegion("LinearSOE::symbolic");
+      ProfilerScope theSymbolicScope(profSymbolic);
+      result = theSOE->setSize(theGraph);
+    }
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
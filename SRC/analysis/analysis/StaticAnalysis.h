@@ -97,6 +97,8 @@ class StaticAnalysis: public Analysis
   protected: 
     
   private:
+    int analyzeSteps(int numSteps);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -41,6 +41,7 @@
 #include <ConvergenceTest.h>
 #include <float.h>
 #include <AnalysisModel.h>
+#include <Profiler.h>
 
 // Constructor
 VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(
@@ -67,6 +68,22 @@ VariableTimeStepDirectIntegrationAnalysis::~VariableTimeStepDirectIntegrationAna
 int 
 VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd)
 {
+  int result = this->analyzeSteps(numSteps, dT, dtMin, dtMax, Jd);
+
+  // the recorder threads may still be writing the last step, it is
+  // on file when the analysis returns
+  if (this->getDomainPtr()->waitForRecorders() < 0)
+    opserr << "WARNING VariableTimeStepDirectIntegrationAnalysis::analyze() - a recorder failed to record\n";
+
+  return result;
+}
+
+int
+VariableTimeStepDirectIntegrationAnalysis::analyzeSteps(int numSteps, double dT, double dtMin, double dtMax, int Jd)
+{
+  static int profAnalyze = Profiler::getRegion("analyze");
+  ProfilerScope theScope(profAnalyze);
+
   // get some pointers
   Domain *theDom = this->getDomainPtr();
   EquiSolnAlgo *theAlgo = this->getAlgorithm();
@@ -108,6 +125,8 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 
 
     if (result >= 0) {
+      static int profAlgorithm = Profiler::getRegion("algorithm");
+      ProfilerScope theAlgorithmScope(profAlgorithm);
       result = theAlgo->solveCurrentStep();
       if (result < 0) 
 	result = -3;
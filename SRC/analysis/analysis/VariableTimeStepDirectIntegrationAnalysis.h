@@ -67,6 +67,7 @@ class VariableTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysi
 			       ConvergenceTest *theTest);
 
   private:
+    int analyzeSteps(int numSteps, double dT, double dtMin, double dtMax, int Jd);
 };
 
 #endif
@@ -31,6 +31,7 @@
 // of the FE_Element class interface.
 
 #include <FE_Element.h>
+#include <Profiler.h>
 #include <stdlib.h>
 
 #include <Element.h>
@@ -57,7 +58,7 @@ int FE_Element::numFEs(0);           // number of objects
 FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
-   numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
+   numDOF(ele->getNumDOF()), theModel(0), myEle(ele), myEleTag(ele->getTag()),
    theResidual(0), theTangent(0), theIntegrator(0)
 {
   if (numDOF <= 0) {
@@ -167,7 +168,7 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), myEleTag(-1), theResidual(0), theTangent(0), theIntegrator(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -297,6 +298,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     }
 
     if (myEle->isSubdomain() == false) {
+      ProfilerElementScope theScope(Profiler::ElementTangent, myEle);
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
@@ -324,6 +326,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     }    
 
     if (myEle->isSubdomain() == false) {
+      ProfilerElementScope theScope(Profiler::ElementResidual, myEle);
       theNewIntegrator->formEleResidual(this);
       return *theResidual;
     } else {
@@ -92,6 +92,8 @@ class FE_Element: public TaggedObject
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
+    // the tag of the element, known after the element has been deleted
+    int getElementTag(void) const {return myEleTag;}
 
     virtual void  Print(OPS_Stream&, int = 0) {return;};
 
@@ -118,6 +120,7 @@ class FE_Element: public TaggedObject
     int numDOF;
     AnalysisModel *theModel;
     Element *myEle;
+    int myEleTag;
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
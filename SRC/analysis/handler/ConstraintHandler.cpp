@@ -77,6 +77,12 @@ ConstraintHandler::update(void)
   return 0;
 }
 
+int
+ConstraintHandler::removeFE_Element(FE_Element *theFE)
+{
+  return 0;
+}
+
 int
 ConstraintHandler::applyLoad(void)
 {
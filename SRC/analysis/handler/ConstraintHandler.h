@@ -42,6 +42,7 @@
 
 class AnalysisMethod;
 class ID;
+class FE_Element;
 class Domain;
 class AnalysisModel;
 class Integrator;
@@ -64,6 +65,10 @@ class ConstraintHandler : public MovableObject
     virtual int doneNumberingDOF(void);
     virtual void clearAll(void) =0;    
 
+    // invoked by the AnalysisModel before it deletes an FE_Element
+    // whose element was removed from the domain
+    virtual int removeFE_Element(FE_Element *theFE);
+
   protected:
     Domain *getDomainPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
@@ -480,6 +480,21 @@ TransformationConstraintHandler::enforceSPs(void)
     return 0;
 }
 
+int
+TransformationConstraintHandler::removeFE_Element(FE_Element *theFE)
+{
+    // keep the transformed elements packed at the front of the array
+    for (int j=0; j<numFE; j++)
+      if (theFEs[j] == theFE) {
+	theFEs[j] = theFEs[numFE-1];
+	theFEs[numFE-1] = 0;
+	numFE--;
+	break;
+      }
+
+    return 0;
+}
+
 int 
 TransformationConstraintHandler::doneNumberingDOF(void)
 {
@@ -56,6 +56,7 @@ class TransformationConstraintHandler : public ConstraintHandler
     void clearAll(void);    
     int enforceSPs(void);    
     int doneNumberingDOF(void);        
+    int removeFE_Element(FE_Element *theFE);
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -31,9 +31,12 @@
 // What: "@(#) IncrementalIntegrator.C, revA"
 
 #include <IncrementalIntegrator.h>
+#include <Profiler.h>
 #include <FE_Element.h>
+#include <Element.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
+#include <Domain.h>
 #include <Vector.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
@@ -46,7 +49,8 @@ IncrementalIntegrator::IncrementalIntegrator(int clasTag)
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ linearCache(false), linearSaved(false), linearKeySize(0), linearPropertiesStamp(0)
 {
   
 }
@@ -73,6 +77,7 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
     theAnalysisModel = &theModel;
     theSOE = &theLinSOE;
     theTest = theConvergenceTest;
+    linearSaved = false;
 }
 
 
@@ -84,6 +89,9 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    static int profTangent = Profiler::getRegion("formTangent");
+    ProfilerScope theScope(profTangent);
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -93,8 +101,10 @@ IncrementalIntegrator::formTangent(int statFlag)
 	return -1;
     }
 
-    // zero the A matrix of the linearSOE
-    theSOE->zeroA();
+    // zero the A matrix of the linearSOE, or set it to the linear part
+    bool linearSet = (this->formLinearTangent() == 0);
+    if (linearSet == false)
+	theSOE->zeroA();
 
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
@@ -103,7 +113,9 @@ IncrementalIntegrator::formTangent(int statFlag)
     FE_Element *elePtr;
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	if (linearSet == true && this->isLinearFE(elePtr) == true)
+	    continue;
+	else if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
 	    opserr << "WARNING IncrementalIntegrator::formTangent -";
 	    opserr << " failed in addA for ID " << elePtr->getID();	    
 	    result = -3;
@@ -120,6 +132,84 @@ IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
     return this->formTangent(statFlag);
 }
 
+void
+IncrementalIntegrator::setLinearCache(bool onOff)
+{
+    linearCache = onOff;
+    linearSaved = false;
+}
+
+int
+IncrementalIntegrator::getLinearTangentKey(double *key)
+{
+    return -1;
+}
+
+bool
+IncrementalIntegrator::isLinearFE(FE_Element *theEle) const
+{
+    Element *myEle = theEle->getElement();
+    if (myEle == 0)
+	return false;
+
+    return myEle->isLinear();
+}
+
+int
+IncrementalIntegrator::formLinearTangent(void)
+{
+    if (linearCache == false)
+	return -1;
+
+    double key[LINEAR_TANGENT_KEY_SIZE];
+    int keySize = this->getLinearTangentKey(key);
+    if (keySize < 0 || keySize > LINEAR_TANGENT_KEY_SIZE)
+	return -1;
+
+    // reuse the saved linear part if the integrator state and the
+    // damping factors and parameter values it was formed with are
+    // unchanged; the SOE refuses if it has been resized since
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    int propertiesStamp = (theDomain != 0) ? theDomain->getPropertiesStamp() : 0;
+    bool sameKey = (linearSaved == true && keySize == linearKeySize &&
+		    propertiesStamp == linearPropertiesStamp);
+    for (int i=0; i<keySize && sameKey == true; i++)
+	if (key[i] != linearKey[i])
+	    sameKey = false;
+
+    if (sameKey == true && theSOE->restoreA() == 0)
+	return 0;
+
+    // form the linear part and save it
+    linearSaved = false;
+    theSOE->zeroA();
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while((elePtr = theEles()) != 0)
+	if (this->isLinearFE(elePtr) == true)
+	    if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+		opserr << "WARNING IncrementalIntegrator::formLinearTangent -";
+		opserr << " failed in addA for ID " << elePtr->getID();
+		return -1;
+	    }
+
+    if (theSOE->saveA() < 0) {
+	opserr << "WARNING IncrementalIntegrator::formLinearTangent -";
+	opserr << " LinearSOE can not save A, linear element cache turned off\n";
+	linearCache = false;
+	return 0;
+    }
+
+    for (int i=0; i<keySize; i++)
+	linearKey[i] = key[i];
+    linearKeySize = keySize;
+    linearPropertiesStamp = propertiesStamp;
+    linearSaved = true;
+
+    return 0;
+}
+
 int
 IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 {
@@ -129,6 +219,9 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    static int profUnbalance = Profiler::getRegion("formUnbalance");
+    ProfilerScope theScope(profUnbalance);
+
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
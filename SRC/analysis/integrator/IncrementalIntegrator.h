@@ -54,6 +54,8 @@ class Vector;
 #define SECOND_TANGENT 5
 #define HALL_TANGENT 6
 
+#define LINEAR_TANGENT_KEY_SIZE 8
+
 class IncrementalIntegrator : public Integrator
 {
   public:
@@ -80,6 +82,12 @@ class IncrementalIntegrator : public Integrator
     virtual int formEleResidual(FE_Element *theEle) =0;
     virtual int formNodUnbalance(DOF_Group *theDof) =0;    
 
+    // linear element cache: when on, the tangent of the elements that
+    // report isLinear() is assembled once and kept in the LinearSOE, each
+    // formTangent() then only adds the contributions of the other elements
+    void setLinearCache(bool onOff);
+    bool getLinearCache(void) const {return linearCache;};
+
     // methods to update the domain
     virtual int newStep(double deltaT);
     virtual int update(const Vector &deltaU) =0;
@@ -111,6 +119,17 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+
+    // fills key with the state the linear element tangents depend on
+    // (status flag, integration coefficients) and returns its size, or
+    // -1 if the linear tangent can not be kept between calls
+    virtual int getLinearTangentKey(double *key);
+    // returns 0 if A has been set to the linear part of the tangent, in
+    // which case FE_Elements for which isLinearFE() is true are skipped,
+    // -1 if A has to be zeroed and all FE_Elements added
+    int formLinearTangent(void);
+    bool isLinearFE(FE_Element *theEle) const;
+
     int statusFlag;
     double iFactor;
     double cFactor;
@@ -131,6 +150,12 @@ class IncrementalIntegrator : public Integrator
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    bool linearCache;       // linear element cache on/off
+    bool linearSaved;       // linear part has been saved in theSOE
+    int linearKeySize;
+    int linearPropertiesStamp;  // Domain properties stamp of the saved part
+    double linearKey[LINEAR_TANGENT_KEY_SIZE];
+
 };
 
 #endif
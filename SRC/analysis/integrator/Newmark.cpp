@@ -291,6 +291,23 @@ int Newmark::formEleTangent(FE_Element *theEle)
 }    
 
 
+int Newmark::getLinearTangentKey(double *key)
+{
+    if (determiningMass == true)
+        return -1;
+
+    // c1..c3 change with the time step
+    key[0] = statusFlag;
+    key[1] = c1;
+    key[2] = c2;
+    key[3] = c3;
+    key[4] = iFactor;
+    key[5] = cFactor;
+
+    return 6;
+}
+
+
 int Newmark::formNodTangent(DOF_Group *theDof)
 {
     if (determiningMass == true)
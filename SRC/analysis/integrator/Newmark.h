@@ -84,6 +84,8 @@ public:
     // AddingSensitivity:END ////////////////////////////////////
     
 protected:
+    int getLinearTangentKey(double *key);
+
     bool displ;      // a flag indicating whether displ or accel increments
     double gamma;
     double beta;
@@ -80,6 +80,14 @@ StaticIntegrator::formEleTangent(FE_Element *theEle)
     return 0;
 }    
 
+int
+StaticIntegrator::getLinearTangentKey(double *key)
+{
+    // element tangent only depends on which stiffness is asked for
+    key[0] = statusFlag;
+    return 1;
+}
+
 int
 StaticIntegrator::formEleResidual(FE_Element *theEle)
 {
@@ -65,7 +65,7 @@ class StaticIntegrator : public IncrementalIntegrator
    virtual int newStep(void) =0;    
 
   protected:
-
+    virtual int getLinearTangentKey(double *key);
  
   private:
 };
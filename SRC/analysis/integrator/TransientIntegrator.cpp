@@ -37,6 +37,7 @@
 // What: "@(#) TransientIntegrator.C, revA"
 
 #include <TransientIntegrator.h>
+#include <Profiler.h>
 #include <FE_Element.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
@@ -67,6 +68,9 @@ TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    static int profTangent = Profiler::getRegion("formTangent");
+    ProfilerScope theScope(profTangent);
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -81,7 +85,10 @@ TransientIntegrator::formTangent(int statFlag)
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations
     
-    theLinSOE->zeroA();
+    // zero A, or set it to the linear part of the tangent
+    bool linearSet = (this->formLinearTangent() == 0);
+    if (linearSet == false)
+      theLinSOE->zeroA();
 
     // do modal damping
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
@@ -108,6 +115,8 @@ TransientIntegrator::formTangent(int statFlag)
     FE_EleIter &theEles2 = theModel->getFEs();    
     FE_Element *elePtr;    
     while((elePtr = theEles2()) != 0)     {
+	if (linearSet == true && this->isLinearFE(elePtr) == true)
+	    continue;
 	if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
 	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
 	    result = -2;
@@ -120,6 +129,9 @@ TransientIntegrator::formTangent(int statFlag)
     
 int
 TransientIntegrator::formUnbalance(void) {
+    static int profUnbalance = Profiler::getRegion("formUnbalance");
+    ProfilerScope theScope(profUnbalance);
+
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
@@ -45,13 +45,18 @@
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <Node.h>
 #include <NodeIter.h>
 #include <ConstraintHandler.h>
+#include <LinearSOE.h>
+#include <Profiler.h>
 
 
 #include <MapOfTaggedObjects.h>
+#include <vector>
+#include <algorithm>
 
 #define START_EQN_NUM 0
 #define START_VERTEX_NUM 0
@@ -221,6 +226,62 @@ AnalysisModel::clearAll(void)
     numEqn = 0;    
 }
 
+int
+AnalysisModel::removeFE_Elements(const std::vector<int> &eleTags)
+{
+    if (theFEs == 0)
+	return -1;
+
+    std::vector<int> sorted(eleTags);
+    std::sort(sorted.begin(), sorted.end());
+
+    // the elements may already be deleted, so they are found by the tag
+    // kept by their FE_Element
+    std::vector<FE_Element *> found;
+    FE_EleIter &theEles = this->getFEs();
+    FE_Element *elePtr;
+    while ((elePtr = theEles()) != 0) {
+	if (elePtr->getElement() != 0 &&
+	    std::binary_search(sorted.begin(), sorted.end(), elePtr->getElementTag()))
+	    found.push_back(elePtr);
+    }
+
+    for (std::size_t i=0; i<found.size(); i++) {
+	FE_Element *theFE = found[i];
+	if (myHandler != 0)
+	    myHandler->removeFE_Element(theFE);
+	theFEs->removeComponent(theFE->getTag());
+	numFE_Ele--;
+	delete theFE;
+    }
+
+    // the graphs no longer match the model
+    this->clearDOFGraph();
+    this->clearDOFGroupGraph();
+
+    if (found.size() != eleTags.size())
+	return -1;
+
+    return 0;
+}
+
+int
+AnalysisModel::patchRemovedElements(int sinceStamp, LinearSOE &theSOE)
+{
+    if (myDomain == 0 || sinceStamp == 0 || this->getNumEqn() <= 0)
+	return -1;
+
+    std::vector<int> removed;
+    if (myDomain->getRemovedElements(sinceStamp, removed) == false ||
+	this->removeFE_Elements(removed) < 0)
+	return -1;
+
+    // the saved linear tangent may hold the removed elements
+    theSOE.clearSavedA();
+
+    return 0;
+}
+
 void
 AnalysisModel::clearDOFGraph(void) 
 {
@@ -292,6 +353,45 @@ Graph &
 AnalysisModel::getDOFGraph(void)
 {
   if (myDOFGraph == 0) {
+
+    //
+    // if the DOF_Groups hold all equations 0 through numEqn-1, which is
+    // the case after numbering, the graph is built in compressed row
+    // form directly from the FE_Element IDs
+    //
+
+    bool contiguous = (numEqn > 0);
+    std::vector<char> hasEqn(contiguous ? numEqn : 0, 0);
+    DOF_Group *dofPtr =0;
+    DOF_GrpIter &theDOFs0 = this->getDOFs();
+    while ((dofPtr = theDOFs0()) != 0 && contiguous == true) {
+      const ID &id = dofPtr->getID();
+      for (int i=0; i<id.Size(); i++) {
+	int eqn = id(i);
+	if (eqn >= numEqn)
+	  contiguous = false;
+	else if (eqn >= START_EQN_NUM)
+	  hasEqn[eqn] = 1;
+      }
+    }
+    for (int i=0; i<numEqn && contiguous == true; i++)
+      if (hasEqn[i] == 0)
+	contiguous = false;
+
+    if (contiguous == true && START_EQN_NUM == START_VERTEX_NUM) {
+      std::vector<const ID *> lists;
+      lists.reserve(numFE_Ele);
+      FE_Element *elePtr =0;
+      FE_EleIter &eleIter = this->getFEs();
+      while((elePtr = eleIter()) != 0)
+	lists.push_back(&(elePtr->getID()));
+
+      CSRGraph *theGraph = new CSRGraph();
+      theGraph->setLists(numEqn, lists);
+      myDOFGraph = theGraph;
+      return *myDOFGraph;
+    }
+
     int numVertex = this->getNumDOF_Groups();
 
     //    myDOFGraph = new Graph(numVertex);
@@ -302,7 +402,6 @@ AnalysisModel::getDOFGraph(void)
     // create a vertex for each dof
     //
     
-    DOF_Group *dofPtr =0;
     DOF_GrpIter &theDOFs = this->getDOFs();
     while ((dofPtr = theDOFs()) != 0) {
       const ID &id = dofPtr->getID();
@@ -372,6 +471,42 @@ AnalysisModel::getDOFGroupGraph(void)
 	exit(-1);
     }	
 
+    //
+    // DOF_Groups tagged 0 through numVertex-1, as created by the
+    // handlers, are held in compressed row form
+    //
+
+    DOF_Group *dofPtr;
+
+    bool contiguous = true;
+    std::vector<int> refs(numVertex, -1);
+    std::vector<int> colors(numVertex, 0);
+    DOF_GrpIter &dofIter0 = this->getDOFs();
+    while ((dofPtr = dofIter0()) != 0 && contiguous == true) {
+	int dofTag = dofPtr->getTag() - START_VERTEX_NUM;
+	if (dofTag < 0 || dofTag >= numVertex || refs[dofTag] != -1)
+	    contiguous = false;
+	else {
+	    refs[dofTag] = dofPtr->getNodeTag();
+	    colors[dofTag] = dofPtr->getNumFreeDOF();
+	}
+    }
+
+    if (contiguous == true && START_VERTEX_NUM == 0) {
+	std::vector<const ID *> lists;
+	lists.reserve(numFE_Ele);
+	FE_Element *elePtr;
+	FE_EleIter &eleIter = this->getFEs();
+	while((elePtr = eleIter()) != 0)
+	    lists.push_back(&(elePtr->getDOFtags()));
+
+	CSRGraph *theGraph = new CSRGraph();
+	theGraph->setLists(numVertex, lists);
+	theGraph->setVertexData(refs, colors);
+	myGroupGraph = theGraph;
+	return *myGroupGraph;
+    }
+
     //    myGroupGraph = new Graph(numVertex);
     MapOfTaggedObjects *graphStorage = new MapOfTaggedObjects();
     myGroupGraph = new Graph(*graphStorage);
@@ -382,8 +517,6 @@ AnalysisModel::getDOFGroupGraph(void)
 	exit(-1);
     }	
 	
-    DOF_Group *dofPtr;
-
     // now create the vertices with a reference equal to the DOF_Group number.
     // and a tag which ranges from 0 through numVertex-1
 
@@ -564,6 +697,9 @@ AnalysisModel::applyLoadDomain(double pseudoTime)
 
     // invoke the method
     myDomain->applyLoad(pseudoTime);
+
+    static int profConstraints = Profiler::getRegion("constraints");
+    ProfilerScope theScope(profConstraints);
     myHandler->applyLoad();
 }
 
@@ -580,8 +716,11 @@ AnalysisModel::updateDomain(void)
 
     // invoke the method
     int res = myDomain->update();
-    if (res == 0)
+    if (res == 0) {
+      static int profConstraints = Profiler::getRegion("constraints");
+      ProfilerScope theScope(profConstraints);
       return myHandler->update();
+    }
 
     return res;
 }
@@ -601,13 +740,19 @@ AnalysisModel::updateDomain(double newTime, double dT)
     // invoke the method
 
     int res = 0;
+    static int profConstraints = Profiler::getRegion("constraints");
+
     myDomain->applyLoad(newTime);
-    if (res == 0)
+    if (res == 0) {
+      ProfilerScope theScope(profConstraints);
       res = myHandler->applyLoad();
+    }
     if (res == 0)
       res = myDomain->update();
-    if (res == 0)
+    if (res == 0) {
+      ProfilerScope theScope(profConstraints);
       res = myHandler->update();
+    }
 
     return res;
 }
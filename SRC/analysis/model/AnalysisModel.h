@@ -40,6 +40,7 @@
 // What: "@(#) AnalysisModel.h, revA"
 
 #include <MovableObject.h>
+#include <vector>
 
 class TaggedObjectStorage;
 class Domain;
@@ -47,10 +48,12 @@ class FE_EleIter;
 class DOF_GrpIter;
 class Graph;
 class FE_Element;
+class Element;
 class DOF_Group;
 class Vector;
 class FEM_ObjectBroker;
 class ConstraintHandler;
+class LinearSOE;
 
 class AnalysisModel: public MovableObject
 {
@@ -67,6 +70,17 @@ class AnalysisModel: public MovableObject
     virtual void clearAll(void);
     virtual void clearDOFGraph(void);
     virtual void clearDOFGroupGraph(void);
+
+    // removes the FE_Elements of the elements with the given tags taken
+    // out of the domain, keeping the DOF_Groups and their numbering;
+    // returns -1 if not all were found
+    virtual int removeFE_Elements(const std::vector<int> &eleTags);
+
+    // if elements were only removed from the domain since the stamp
+    // sinceStamp, removes their FE_Elements and drops the linear part
+    // saved in theSOE, whose structure still holds the remaining elements;
+    // returns -1 if the model has to be built again
+    int patchRemovedElements(int sinceStamp, LinearSOE &theSOE);
     
     // methods to access the FE_Elements and DOF_Groups and their numbers
     virtual int getNumDOF_Groups(void) const;		
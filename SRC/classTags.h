@@ -970,6 +970,8 @@
 #define RECORDER_TAGS_PVDRecorder               19
 #define RECORDER_TAGS_MPCORecorder               20
 
+#define GENERATOR_TAGS_ContactSearch		1
+
 #define OPS_STREAM_TAGS_FileStream		1
 #define OPS_STREAM_TAGS_StandardStream		2
 #define OPS_STREAM_TAGS_XmlFileStream		3
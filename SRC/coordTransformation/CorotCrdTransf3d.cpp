@@ -43,19 +43,11 @@
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
-Matrix CorotCrdTransf3d::T(7,12);
 Matrix CorotCrdTransf3d::Tlg(12,12);
 Matrix CorotCrdTransf3d::TlgInv(12, 12);
 Matrix CorotCrdTransf3d::Tbl(6,12);
 Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
 
 void* OPS_CorotCrdTransf3d()
 {
@@ -100,7 +92,9 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
-nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false),
+geomCurrent(false)
 {
     // check vector that defines local xz plane
     if (&vecInLocXZPlane == 0 || vecInLocXZPlane.Size() != 3 )
@@ -182,7 +176,9 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
-nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false),
+geomCurrent(false)
 {
     // Permutation matrix (to renumber basic dof's)
     
@@ -259,6 +255,7 @@ CorotCrdTransf3d::revertToLastCommit(void)
     alphaIq = alphaIqcommit;
     alphaJq = alphaJqcommit;
     
+    geomCurrent = false;
     this->update();
     
     return 0;
@@ -275,6 +272,7 @@ CorotCrdTransf3d::revertToStart(void)
     alphaI.Zero();
     alphaJ.Zero();
     
+    geomCurrent = false;
     this->update();
     return 0;
 }
@@ -340,6 +338,7 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     //opserr << "alphaJq: " << alphaJq;
     
     this->commitState();
+    geomCurrent = false;
 
     return 0;
 }
@@ -385,6 +384,18 @@ CorotCrdTransf3d::update(void)
             dispJ(j) -= nodeJInitialDisp[j];
     }
     
+    // if the nodes have not moved since the last update the geometry is
+    // still current, only the iterative increment is reset
+    if (geomCurrent == true) {
+        for (k = 0; k < 6; k++)
+            if (dispI(k) != ugCache[k] || dispJ(k) != ugCache[k+6])
+                break;
+        if (k == 6) {
+            ulpr = ul;
+            return 0;
+        }
+    }
+    
     // get the iterative spins dAlphaI and dAlphaJ 
     // (rotational displacement increments at both nodes)
     
@@ -548,6 +559,12 @@ CorotCrdTransf3d::update(void)
             // compute the transformation matrix
             this->compTransfMatrixBasicGlobal();
             
+            for (k = 0; k < 6; k++) {
+                ugCache[k]   = dispI(k);
+                ugCache[k+6] = dispJ(k);
+            }
+            geomCurrent = true;
+            
             return 0;
 }
 
@@ -1176,6 +1193,17 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
     this->update();
     
+    // transform resisting forces from the basic system to local coordinates
+    static Vector pl(7);
+    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
+    
+    return this->compGlobalStiffMatrix(kb, pl);
+}
+
+
+const Matrix &
+CorotCrdTransf3d::compGlobalStiffMatrix(const Matrix &kb, const Vector &pl)
+{
     int i, j, k;   
     // transform tangent stiffness matrix from the basic system to local coordinates
     static Matrix kl(7,7);
@@ -1184,10 +1212,6 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //    opserr << "kb: " << kb;
     //    opserr << "Tp: " << Tp;
     
-    // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
-    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
-    
     // transform tangent  stiffness matrix from local to global coordinates
     //static Matrix kg(12,12);
     
@@ -2126,6 +2150,7 @@ CorotCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
   alphaJq = alphaJqcommit;
   
   initialDispChecked = true;
+  geomCurrent = false;
   return 0;  
 }
 
@@ -91,6 +91,7 @@ private:
     void compTransfMatrixBasicGlobalNew(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg);
     void compTransfMatrixBasicLocal(Matrix &Tbl);
+    const Matrix &compGlobalStiffMatrix(const Matrix &kb, const Vector &pl);
     const Vector &getQuaternionFromRotMatrix(const Matrix &RotMatrix) const;
     const Vector &getQuaternionFromPseudoRotVector(const Vector &theta) const;
     const Vector &getTangScaledPseudoVectorFromQuaternion(const Vector &theta) const;
@@ -125,19 +126,25 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
+    // geometry of the last update, kept per object so that it is computed
+    // once per update and reused by the force and stiffness methods
+    Matrix RI;                  // nodal triad for node 1
+    Matrix RJ;                  // nodal triad for node 2
+    Matrix Rbar;                // mean nodal triad 
+    Matrix e;                   // base vectors
+    Matrix T;                   // transformation matrix from basic to global system
+    Matrix Lr2, Lr3, A;         // auxiliary matrices
+    
     static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
     static Matrix Tlg;          // transformation matrix from global to local system
     static Matrix TlgInv;       // inverse of transformation matrix from global to local system
     static Matrix Tbl;          // transformation matrix from local to basic system
     static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
+
+    double ugCache[12];         // nodal trial displacements of the last update
+    bool geomCurrent;           // geometry above is valid for ugCache
 };
 #endif
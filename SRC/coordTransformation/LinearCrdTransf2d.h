@@ -93,6 +93,7 @@ public:
     const Matrix &getInitialGlobalStiffMatrix(const Matrix &basicStiff);
     
     CrdTransf *getCopy2d(void);
+    bool isLinear(void) {return true;};
     
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -241,6 +241,9 @@ LinearCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
         return error;
     
+    // the basic to global transformation does not change, set it up once
+    this->compTransfMatrixBasicGlobal();
+    
     return 0;
 }
 
@@ -325,6 +328,102 @@ LinearCrdTransf3d::compTransfMatrixLocalGlobal(Matrix &Tlg)
 }
 
 
+void
+LinearCrdTransf3d::compTransfMatrixBasicGlobal(void)
+{
+    // global to local, ul = Alg*ug, with the rigid joint offsets
+    // ul_trans = R*(ug_trans + W*ug_rot)
+    double Alg[12][12];
+    int i, j, k;
+    for (i = 0; i < 12; i++)
+        for (j = 0; j < 12; j++)
+            Alg[i][j] = 0.0;
+    
+    for (k = 0; k < 12; k += 3)
+        for (i = 0; i < 3; i++)
+            for (j = 0; j < 3; j++)
+                Alg[k+i][k+j] = R[i][j];
+    
+    double *offsets[2] = {nodeIOffset, nodeJOffset};
+    for (int nd = 0; nd < 2; nd++) {
+        double *o = offsets[nd];
+        if (o == 0)
+            continue;
+        double W[3][3] = {{0.0, o[2], -o[1]}, {-o[2], 0.0, o[0]}, {o[1], -o[0], 0.0}};
+        int rt = 6*nd;
+        for (i = 0; i < 3; i++)
+            for (j = 0; j < 3; j++)
+                Alg[rt+i][rt+3+j] = R[i][0]*W[0][j] + R[i][1]*W[1][j] + R[i][2]*W[2][j];
+    }
+    
+    // local to basic, ub = Tbl*ul
+    double oneOverL = 1.0/L;
+    double Tbl[6][12];
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 12; j++)
+            Tbl[i][j] = 0.0;
+    
+    Tbl[0][0] = -1.0;      Tbl[0][6] = 1.0;
+    Tbl[1][1] = oneOverL;  Tbl[1][7] = -oneOverL; Tbl[1][5] = 1.0;
+    Tbl[2][1] = oneOverL;  Tbl[2][7] = -oneOverL; Tbl[2][11] = 1.0;
+    Tbl[3][2] = -oneOverL; Tbl[3][8] = oneOverL;  Tbl[3][4] = 1.0;
+    Tbl[4][2] = -oneOverL; Tbl[4][8] = oneOverL;  Tbl[4][10] = 1.0;
+    Tbl[5][3] = -1.0;      Tbl[5][9] = 1.0;
+    
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 12; j++) {
+            double sum = 0.0;
+            for (k = 0; k < 12; k++)
+                sum += Tbl[i][k]*Alg[k][j];
+            Tbg[i][j] = sum;
+        }
+}
+
+
+void
+LinearCrdTransf3d::getBasicFromGlobal(const double *ug, Vector &ub)
+{
+    for (int i = 0; i < 6; i++) {
+        const double *Ti = Tbg[i];
+        double sum = 0.0;
+        for (int j = 0; j < 12; j++)
+            sum += Ti[j]*ug[j];
+        ub(i) = sum;
+    }
+}
+
+
+void
+LinearCrdTransf3d::addGlobalForceFromLocalLoad(const Vector &p0, double *pg)
+{
+    // end forces due to element p0 loads, assuming member loads are in
+    // the local system
+    double plI[3], plJ[3];
+    plI[0] = p0(0); plI[1] = p0(1); plI[2] = p0(3);
+    plJ[0] = 0.0;   plJ[1] = p0(2); plJ[2] = p0(4);
+    
+    double pgI[3], pgJ[3];
+    for (int i = 0; i < 3; i++) {
+        pgI[i] = R[0][i]*plI[0] + R[1][i]*plI[1] + R[2][i]*plI[2];
+        pgJ[i] = R[0][i]*plJ[0] + R[1][i]*plJ[1] + R[2][i]*plJ[2];
+        pg[i]   += pgI[i];
+        pg[i+6] += pgJ[i];
+    }
+    
+    if (nodeIOffset) {
+        pg[3] += -nodeIOffset[2]*pgI[1] + nodeIOffset[1]*pgI[2];
+        pg[4] +=  nodeIOffset[2]*pgI[0] - nodeIOffset[0]*pgI[2];
+        pg[5] += -nodeIOffset[1]*pgI[0] + nodeIOffset[0]*pgI[1];
+    }
+    
+    if (nodeJOffset) {
+        pg[9]  += -nodeJOffset[2]*pgJ[1] + nodeJOffset[1]*pgJ[2];
+        pg[10] +=  nodeJOffset[2]*pgJ[0] - nodeJOffset[0]*pgJ[2];
+        pg[11] += -nodeJOffset[1]*pgJ[0] + nodeJOffset[0]*pgJ[1];
+    }
+}
+
+
 int
 LinearCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
@@ -412,58 +511,8 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
             ug[j+6] -= nodeJInitialDisp[j];
     }
     
-    double oneOverL = 1.0/L;
-    
     static Vector ub(6);
-    
-    static double ul[12];
-    
-    ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
-    ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
-    ul[2]  = R[2][0]*ug[0] + R[2][1]*ug[1] + R[2][2]*ug[2];
-    
-    ul[3]  = R[0][0]*ug[3] + R[0][1]*ug[4] + R[0][2]*ug[5];
-    ul[4]  = R[1][0]*ug[3] + R[1][1]*ug[4] + R[1][2]*ug[5];
-    ul[5]  = R[2][0]*ug[3] + R[2][1]*ug[4] + R[2][2]*ug[5];
-    
-    ul[6]  = R[0][0]*ug[6] + R[0][1]*ug[7] + R[0][2]*ug[8];
-    ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
-    ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
-    
-    ul[9]  = R[0][0]*ug[9] + R[0][1]*ug[10] + R[0][2]*ug[11];
-    ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
-    ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
-    
-    static double Wu[3];
-    if (nodeIOffset) {
-        Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
-        Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
-        Wu[2] =  nodeIOffset[1]*ug[3] - nodeIOffset[0]*ug[4];
-        
-        ul[0] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[1] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[2] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    if (nodeJOffset) {
-        Wu[0] =  nodeJOffset[2]*ug[10] - nodeJOffset[1]*ug[11];
-        Wu[1] = -nodeJOffset[2]*ug[9]  + nodeJOffset[0]*ug[11];
-        Wu[2] =  nodeJOffset[1]*ug[9]  - nodeJOffset[0]*ug[10];
-        
-        ul[6] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[7] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[8] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    ub(0) = ul[6] - ul[0];
-    double tmp;
-    tmp = oneOverL*(ul[1]-ul[7]);
-    ub(1) = ul[5] + tmp;
-    ub(2) = ul[11] + tmp;
-    tmp = oneOverL*(ul[8]-ul[2]);
-    ub(3) = ul[4] + tmp;
-    ub(4) = ul[10] + tmp;
-    ub(5) = ul[9] - ul[3];
+    this->getBasicFromGlobal(ug, ub);
     
     return ub;
 }
@@ -482,58 +531,8 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
         ug[i+6] = disp2(i);
     }
     
-    double oneOverL = 1.0/L;
-    
     static Vector ub(6);
-    
-    static double ul[12];
-    
-    ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
-    ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
-    ul[2]  = R[2][0]*ug[0] + R[2][1]*ug[1] + R[2][2]*ug[2];
-    
-    ul[3]  = R[0][0]*ug[3] + R[0][1]*ug[4] + R[0][2]*ug[5];
-    ul[4]  = R[1][0]*ug[3] + R[1][1]*ug[4] + R[1][2]*ug[5];
-    ul[5]  = R[2][0]*ug[3] + R[2][1]*ug[4] + R[2][2]*ug[5];
-    
-    ul[6]  = R[0][0]*ug[6] + R[0][1]*ug[7] + R[0][2]*ug[8];
-    ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
-    ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
-    
-    ul[9]  = R[0][0]*ug[9] + R[0][1]*ug[10] + R[0][2]*ug[11];
-    ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
-    ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
-    
-    static double Wu[3];
-    if (nodeIOffset) {
-        Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
-        Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
-        Wu[2] =  nodeIOffset[1]*ug[3] - nodeIOffset[0]*ug[4];
-        
-        ul[0] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[1] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[2] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    if (nodeJOffset) {
-        Wu[0] =  nodeJOffset[2]*ug[10] - nodeJOffset[1]*ug[11];
-        Wu[1] = -nodeJOffset[2]*ug[9]  + nodeJOffset[0]*ug[11];
-        Wu[2] =  nodeJOffset[1]*ug[9]  - nodeJOffset[0]*ug[10];
-        
-        ul[6] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[7] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[8] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    ub(0) = ul[6] - ul[0];
-    double tmp;
-    tmp = oneOverL*(ul[1]-ul[7]);
-    ub(1) = ul[5] + tmp;
-    ub(2) = ul[11] + tmp;
-    tmp = oneOverL*(ul[8]-ul[2]);
-    ub(3) = ul[4] + tmp;
-    ub(4) = ul[10] + tmp;
-    ub(5) = ul[9] - ul[3];
+    this->getBasicFromGlobal(ug, ub);
     
     return ub;
 }
@@ -552,58 +551,8 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
         ug[i+6] = disp2(i);
     }
     
-    double oneOverL = 1.0/L;
-    
     static Vector ub(6);
-    
-    static double ul[12];
-    
-    ul[0]  = R[0][0]*ug[0] + R[0][1]*ug[1] + R[0][2]*ug[2];
-    ul[1]  = R[1][0]*ug[0] + R[1][1]*ug[1] + R[1][2]*ug[2];
-    ul[2]  = R[2][0]*ug[0] + R[2][1]*ug[1] + R[2][2]*ug[2];
-    
-    ul[3]  = R[0][0]*ug[3] + R[0][1]*ug[4] + R[0][2]*ug[5];
-    ul[4]  = R[1][0]*ug[3] + R[1][1]*ug[4] + R[1][2]*ug[5];
-    ul[5]  = R[2][0]*ug[3] + R[2][1]*ug[4] + R[2][2]*ug[5];
-    
-    ul[6]  = R[0][0]*ug[6] + R[0][1]*ug[7] + R[0][2]*ug[8];
-    ul[7]  = R[1][0]*ug[6] + R[1][1]*ug[7] + R[1][2]*ug[8];
-    ul[8]  = R[2][0]*ug[6] + R[2][1]*ug[7] + R[2][2]*ug[8];
-    
-    ul[9]  = R[0][0]*ug[9] + R[0][1]*ug[10] + R[0][2]*ug[11];
-    ul[10] = R[1][0]*ug[9] + R[1][1]*ug[10] + R[1][2]*ug[11];
-    ul[11] = R[2][0]*ug[9] + R[2][1]*ug[10] + R[2][2]*ug[11];
-    
-    static double Wu[3];
-    if (nodeIOffset) {
-        Wu[0] =  nodeIOffset[2]*ug[4] - nodeIOffset[1]*ug[5];
-        Wu[1] = -nodeIOffset[2]*ug[3] + nodeIOffset[0]*ug[5];
-        Wu[2] =  nodeIOffset[1]*ug[3] - nodeIOffset[0]*ug[4];
-        
-        ul[0] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[1] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[2] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    if (nodeJOffset) {
-        Wu[0] =  nodeJOffset[2]*ug[10] - nodeJOffset[1]*ug[11];
-        Wu[1] = -nodeJOffset[2]*ug[9]  + nodeJOffset[0]*ug[11];
-        Wu[2] =  nodeJOffset[1]*ug[9]  - nodeJOffset[0]*ug[10];
-        
-        ul[6] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-        ul[7] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-        ul[8] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-    }
-    
-    ub(0) = ul[6] - ul[0];
-    double tmp;
-    tmp = oneOverL*(ul[1]-ul[7]);
-    ub(1) = ul[5] + tmp;
-    ub(2) = ul[11] + tmp;
-    tmp = oneOverL*(ul[8]-ul[2]);
-    ub(3) = ul[4] + tmp;
-    ub(4) = ul[10] + tmp;
-    ub(5) = ul[9] - ul[3];
+    this->getBasicFromGlobal(ug, ub);
     
     return ub;
 }
@@ -612,207 +561,58 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 LinearCrdTransf3d::getBasicTrialVel(void)
 {
-	// determine global velocities
-	const Vector &vel1 = nodeIPtr->getTrialVel();
-	const Vector &vel2 = nodeJPtr->getTrialVel();
-	
-	static double vg[12];
-	for (int i = 0; i < 6; i++) {
-		vg[i]   = vel1(i);
-		vg[i+6] = vel2(i);
-	}
-	
-	double oneOverL = 1.0/L;
-	
-	static Vector vb(6);
-	
-	static double vl[12];
-	
-	vl[0]  = R[0][0]*vg[0] + R[0][1]*vg[1] + R[0][2]*vg[2];
-	vl[1]  = R[1][0]*vg[0] + R[1][1]*vg[1] + R[1][2]*vg[2];
-	vl[2]  = R[2][0]*vg[0] + R[2][1]*vg[1] + R[2][2]*vg[2];
-	
-	vl[3]  = R[0][0]*vg[3] + R[0][1]*vg[4] + R[0][2]*vg[5];
-	vl[4]  = R[1][0]*vg[3] + R[1][1]*vg[4] + R[1][2]*vg[5];
-	vl[5]  = R[2][0]*vg[3] + R[2][1]*vg[4] + R[2][2]*vg[5];
-	
-	vl[6]  = R[0][0]*vg[6] + R[0][1]*vg[7] + R[0][2]*vg[8];
-	vl[7]  = R[1][0]*vg[6] + R[1][1]*vg[7] + R[1][2]*vg[8];
-	vl[8]  = R[2][0]*vg[6] + R[2][1]*vg[7] + R[2][2]*vg[8];
-	
-	vl[9]  = R[0][0]*vg[9] + R[0][1]*vg[10] + R[0][2]*vg[11];
-	vl[10] = R[1][0]*vg[9] + R[1][1]*vg[10] + R[1][2]*vg[11];
-	vl[11] = R[2][0]*vg[9] + R[2][1]*vg[10] + R[2][2]*vg[11];
-	
-	static double Wu[3];
-	if (nodeIOffset) {
-		Wu[0] =  nodeIOffset[2]*vg[4] - nodeIOffset[1]*vg[5];
-		Wu[1] = -nodeIOffset[2]*vg[3] + nodeIOffset[0]*vg[5];
-		Wu[2] =  nodeIOffset[1]*vg[3] - nodeIOffset[0]*vg[4];
-		
-		vl[0] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-		vl[1] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-		vl[2] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-	}
-	
-	if (nodeJOffset) {
-		Wu[0] =  nodeJOffset[2]*vg[10] - nodeJOffset[1]*vg[11];
-		Wu[1] = -nodeJOffset[2]*vg[9]  + nodeJOffset[0]*vg[11];
-		Wu[2] =  nodeJOffset[1]*vg[9]  - nodeJOffset[0]*vg[10];
-		
-		vl[6] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-		vl[7] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-		vl[8] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-	}
-	
-	vb(0) = vl[6] - vl[0];
-	double tmp;
-	tmp = oneOverL*(vl[1]-vl[7]);
-	vb(1) = vl[5] + tmp;
-	vb(2) = vl[11] + tmp;
-	tmp = oneOverL*(vl[8]-vl[2]);
-	vb(3) = vl[4] + tmp;
-	vb(4) = vl[10] + tmp;
-	vb(5) = vl[9] - vl[3];
-	
-	return vb;
+    // determine global velocities
+    const Vector &vel1 = nodeIPtr->getTrialVel();
+    const Vector &vel2 = nodeJPtr->getTrialVel();
+    
+    static double vg[12];
+    for (int i = 0; i < 6; i++) {
+        vg[i]   = vel1(i);
+        vg[i+6] = vel2(i);
+    }
+    
+    static Vector vb(6);
+    this->getBasicFromGlobal(vg, vb);
+    
+    return vb;
 }
 
 
 const Vector &
 LinearCrdTransf3d::getBasicTrialAccel(void)
 {
-	// determine global accelerations
-	const Vector &accel1 = nodeIPtr->getTrialAccel();
-	const Vector &accel2 = nodeJPtr->getTrialAccel();
-	
-	static double ag[12];
-	for (int i = 0; i < 6; i++) {
-		ag[i]   = accel1(i);
-		ag[i+6] = accel2(i);
-	}
-	
-	double oneOverL = 1.0/L;
-	
-	static Vector ab(6);
-	
-	static double al[12];
-	
-	al[0]  = R[0][0]*ag[0] + R[0][1]*ag[1] + R[0][2]*ag[2];
-	al[1]  = R[1][0]*ag[0] + R[1][1]*ag[1] + R[1][2]*ag[2];
-	al[2]  = R[2][0]*ag[0] + R[2][1]*ag[1] + R[2][2]*ag[2];
-	
-	al[3]  = R[0][0]*ag[3] + R[0][1]*ag[4] + R[0][2]*ag[5];
-	al[4]  = R[1][0]*ag[3] + R[1][1]*ag[4] + R[1][2]*ag[5];
-	al[5]  = R[2][0]*ag[3] + R[2][1]*ag[4] + R[2][2]*ag[5];
-	
-	al[6]  = R[0][0]*ag[6] + R[0][1]*ag[7] + R[0][2]*ag[8];
-	al[7]  = R[1][0]*ag[6] + R[1][1]*ag[7] + R[1][2]*ag[8];
-	al[8]  = R[2][0]*ag[6] + R[2][1]*ag[7] + R[2][2]*ag[8];
-	
-	al[9]  = R[0][0]*ag[9] + R[0][1]*ag[10] + R[0][2]*ag[11];
-	al[10] = R[1][0]*ag[9] + R[1][1]*ag[10] + R[1][2]*ag[11];
-	al[11] = R[2][0]*ag[9] + R[2][1]*ag[10] + R[2][2]*ag[11];
-	
-	static double Wu[3];
-	if (nodeIOffset) {
-		Wu[0] =  nodeIOffset[2]*ag[4] - nodeIOffset[1]*ag[5];
-		Wu[1] = -nodeIOffset[2]*ag[3] + nodeIOffset[0]*ag[5];
-		Wu[2] =  nodeIOffset[1]*ag[3] - nodeIOffset[0]*ag[4];
-		
-		al[0] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-		al[1] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-		al[2] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-	}
-	
-	if (nodeJOffset) {
-		Wu[0] =  nodeJOffset[2]*ag[10] - nodeJOffset[1]*ag[11];
-		Wu[1] = -nodeJOffset[2]*ag[9]  + nodeJOffset[0]*ag[11];
-		Wu[2] =  nodeJOffset[1]*ag[9]  - nodeJOffset[0]*ag[10];
-		
-		al[6] += R[0][0]*Wu[0] + R[0][1]*Wu[1] + R[0][2]*Wu[2];
-		al[7] += R[1][0]*Wu[0] + R[1][1]*Wu[1] + R[1][2]*Wu[2];
-		al[8] += R[2][0]*Wu[0] + R[2][1]*Wu[1] + R[2][2]*Wu[2];
-	}
-	
-	ab(0) = al[6] - al[0];
-	double tmp;
-	tmp = oneOverL*(al[1]-al[7]);
-	ab(1) = al[5] + tmp;
-	ab(2) = al[11] + tmp;
-	tmp = oneOverL*(al[8]-al[2]);
-	ab(3) = al[4] + tmp;
-	ab(4) = al[10] + tmp;
-	ab(5) = al[9] - al[3];
-	
-	return ab;
+    // determine global accelerations
+    const Vector &accel1 = nodeIPtr->getTrialAccel();
+    const Vector &accel2 = nodeJPtr->getTrialAccel();
+    
+    static double ag[12];
+    for (int i = 0; i < 6; i++) {
+        ag[i]   = accel1(i);
+        ag[i+6] = accel2(i);
+    }
+    
+    static Vector ab(6);
+    this->getBasicFromGlobal(ag, ab);
+    
+    return ab;
 }
 
 
 const Vector &
 LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
-    // transform resisting forces from the basic system to local coordinates
-    static double pl[12];
-    
-    double q0 = pb(0);
-    double q1 = pb(1);
-    double q2 = pb(2);
-    double q3 = pb(3);
-    double q4 = pb(4);
-    double q5 = pb(5);
-    
-    double oneOverL = 1.0/L;
-    
-    pl[0]  = -q0;
-    pl[1]  =  oneOverL*(q1+q2);
-    pl[2]  = -oneOverL*(q3+q4);
-    pl[3]  = -q5;
-    pl[4]  =  q3;
-    pl[5]  =  q1;
-    pl[6]  =  q0;
-    pl[7]  = -pl[1];
-    pl[8]  = -pl[2];
-    pl[9]  =  q5;
-    pl[10] =  q4;
-    pl[11] =  q2;
-    
-    pl[0] += p0(0);
-    pl[1] += p0(1);
-    pl[7] += p0(2);
-    pl[2] += p0(3);
-    pl[8] += p0(4);
-    
-    // transform resisting forces  from local to global coordinates
+    // transform resisting forces from the basic to global coordinates
     static Vector pg(12);
     
-    pg(0)  = R[0][0]*pl[0] + R[1][0]*pl[1] + R[2][0]*pl[2];
-    pg(1)  = R[0][1]*pl[0] + R[1][1]*pl[1] + R[2][1]*pl[2];
-    pg(2)  = R[0][2]*pl[0] + R[1][2]*pl[1] + R[2][2]*pl[2];
-    
-    pg(3)  = R[0][0]*pl[3] + R[1][0]*pl[4] + R[2][0]*pl[5];
-    pg(4)  = R[0][1]*pl[3] + R[1][1]*pl[4] + R[2][1]*pl[5];
-    pg(5)  = R[0][2]*pl[3] + R[1][2]*pl[4] + R[2][2]*pl[5];
-    
-    pg(6)  = R[0][0]*pl[6] + R[1][0]*pl[7] + R[2][0]*pl[8];
-    pg(7)  = R[0][1]*pl[6] + R[1][1]*pl[7] + R[2][1]*pl[8];
-    pg(8)  = R[0][2]*pl[6] + R[1][2]*pl[7] + R[2][2]*pl[8];
-    
-    pg(9)  = R[0][0]*pl[9] + R[1][0]*pl[10] + R[2][0]*pl[11];
-    pg(10) = R[0][1]*pl[9] + R[1][1]*pl[10] + R[2][1]*pl[11];
-    pg(11) = R[0][2]*pl[9] + R[1][2]*pl[10] + R[2][2]*pl[11];
+    double q[6];
+    for (int i = 0; i < 6; i++)
+        q[i] = pb(i);
     
-    if (nodeIOffset) {
-        pg(3) += -nodeIOffset[2]*pg(1) + nodeIOffset[1]*pg(2);
-        pg(4) +=  nodeIOffset[2]*pg(0) - nodeIOffset[0]*pg(2);
-        pg(5) += -nodeIOffset[1]*pg(0) + nodeIOffset[0]*pg(1);
-    }
+    for (int j = 0; j < 12; j++)
+        pg(j) = Tbg[0][j]*q[0] + Tbg[1][j]*q[1] + Tbg[2][j]*q[2]
+            + Tbg[3][j]*q[3] + Tbg[4][j]*q[4] + Tbg[5][j]*q[5];
     
-    if (nodeJOffset) {
-        pg(9)  += -nodeJOffset[2]*pg(7) + nodeJOffset[1]*pg(8);
-        pg(10) +=  nodeJOffset[2]*pg(6) - nodeJOffset[0]*pg(8);
-        pg(11) += -nodeJOffset[1]*pg(6) + nodeJOffset[0]*pg(7);
-    }
+    this->addGlobalForceFromLocalLoad(p0, &pg(0));
     
     return pg;
 }
@@ -821,298 +621,41 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
-    double oneOverL = 1.0/L;
+    return this->compGlobalStiffMatrix(KB);
+}
+
+
+const Matrix &
+LinearCrdTransf3d::compGlobalStiffMatrix(const Matrix &KB)
+{
+    // kg = Tbg' * kb * Tbg
+    static double tmp[6][12];
+    int i, j, k;
     
-    int i,j;
     for (i = 0; i < 6; i++)
-        for (j = 0; j < 6; j++)
-            kb[i][j] = KB(i,j);
-        
-        // Transform basic stiffness to local system
-        // First compute kb*T_{bl}
-        for (i = 0; i < 6; i++) {
-            tmp[i][0]  = -kb[i][0];
-            tmp[i][1]  =  oneOverL*(kb[i][1]+kb[i][2]);
-            tmp[i][2]  = -oneOverL*(kb[i][3]+kb[i][4]);
-            tmp[i][3]  = -kb[i][5];
-            tmp[i][4]  =  kb[i][3];
-            tmp[i][5]  =  kb[i][1];
-            tmp[i][6]  =  kb[i][0];
-            tmp[i][7]  = -tmp[i][1];
-            tmp[i][8]  = -tmp[i][2];
-            tmp[i][9]  =  kb[i][5];
-            tmp[i][10] =  kb[i][4];
-            tmp[i][11] =  kb[i][2];
-        }
-        
-        // Now compute T'_{bl}*(kb*T_{bl})
-        for (i = 0; i < 12; i++) {
-            kl[0][i]  = -tmp[0][i];
-            kl[1][i]  =  oneOverL*(tmp[1][i]+tmp[2][i]);
-            kl[2][i]  = -oneOverL*(tmp[3][i]+tmp[4][i]);
-            kl[3][i]  = -tmp[5][i];
-            kl[4][i]  =  tmp[3][i];
-            kl[5][i]  =  tmp[1][i];
-            kl[6][i]  =  tmp[0][i];
-            kl[7][i]  = -kl[1][i];
-            kl[8][i]  = -kl[2][i];
-            kl[9][i]  =  tmp[5][i];
-            kl[10][i] =  tmp[4][i];
-            kl[11][i] =  tmp[2][i];
+        for (j = 0; j < 12; j++) {
+            double sum = 0.0;
+            for (k = 0; k < 6; k++)
+                sum += KB(i,k)*Tbg[k][j];
+            tmp[i][j] = sum;
         }
-        
-        static double RWI[3][3];
-        
-        if (nodeIOffset) {
-            // Compute RWI
-            RWI[0][0] = -R[0][1]*nodeIOffset[2] + R[0][2]*nodeIOffset[1];
-            RWI[1][0] = -R[1][1]*nodeIOffset[2] + R[1][2]*nodeIOffset[1];
-            RWI[2][0] = -R[2][1]*nodeIOffset[2] + R[2][2]*nodeIOffset[1];
-            
-            RWI[0][1] =  R[0][0]*nodeIOffset[2] - R[0][2]*nodeIOffset[0];
-            RWI[1][1] =  R[1][0]*nodeIOffset[2] - R[1][2]*nodeIOffset[0];
-            RWI[2][1] =  R[2][0]*nodeIOffset[2] - R[2][2]*nodeIOffset[0];
-            
-            RWI[0][2] = -R[0][0]*nodeIOffset[1] + R[0][1]*nodeIOffset[0];
-            RWI[1][2] = -R[1][0]*nodeIOffset[1] + R[1][1]*nodeIOffset[0];
-            RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
-        }
-        
-        static double RWJ[3][3];
-        
-        if (nodeJOffset) {
-            // Compute RWJ
-            RWJ[0][0] = -R[0][1]*nodeJOffset[2] + R[0][2]*nodeJOffset[1];
-            RWJ[1][0] = -R[1][1]*nodeJOffset[2] + R[1][2]*nodeJOffset[1];
-            RWJ[2][0] = -R[2][1]*nodeJOffset[2] + R[2][2]*nodeJOffset[1];
-            
-            RWJ[0][1] =  R[0][0]*nodeJOffset[2] - R[0][2]*nodeJOffset[0];
-            RWJ[1][1] =  R[1][0]*nodeJOffset[2] - R[1][2]*nodeJOffset[0];
-            RWJ[2][1] =  R[2][0]*nodeJOffset[2] - R[2][2]*nodeJOffset[0];
-            
-            RWJ[0][2] = -R[0][0]*nodeJOffset[1] + R[0][1]*nodeJOffset[0];
-            RWJ[1][2] = -R[1][0]*nodeJOffset[1] + R[1][1]*nodeJOffset[0];
-            RWJ[2][2] = -R[2][0]*nodeJOffset[1] + R[2][1]*nodeJOffset[0];
-        }
-        
-        // Transform local stiffness to global system
-        // First compute kl*T_{lg}
-        int m;
-        for (m = 0; m < 12; m++) {
-            tmp[m][0] = kl[m][0]*R[0][0] + kl[m][1]*R[1][0]  + kl[m][2]*R[2][0];
-            tmp[m][1] = kl[m][0]*R[0][1] + kl[m][1]*R[1][1]  + kl[m][2]*R[2][1];
-            tmp[m][2] = kl[m][0]*R[0][2] + kl[m][1]*R[1][2]  + kl[m][2]*R[2][2];
-            
-            tmp[m][3] = kl[m][3]*R[0][0] + kl[m][4]*R[1][0]  + kl[m][5]*R[2][0];
-            tmp[m][4] = kl[m][3]*R[0][1] + kl[m][4]*R[1][1]  + kl[m][5]*R[2][1];
-            tmp[m][5] = kl[m][3]*R[0][2] + kl[m][4]*R[1][2]  + kl[m][5]*R[2][2];
-            
-            if (nodeIOffset) {
-                tmp[m][3]  += kl[m][0]*RWI[0][0]  + kl[m][1]*RWI[1][0]  + kl[m][2]*RWI[2][0];
-                tmp[m][4]  += kl[m][0]*RWI[0][1]  + kl[m][1]*RWI[1][1]  + kl[m][2]*RWI[2][1];
-                tmp[m][5]  += kl[m][0]*RWI[0][2]  + kl[m][1]*RWI[1][2]  + kl[m][2]*RWI[2][2];
-            }
-            
-            tmp[m][6] = kl[m][6]*R[0][0] + kl[m][7]*R[1][0]  + kl[m][8]*R[2][0];
-            tmp[m][7] = kl[m][6]*R[0][1] + kl[m][7]*R[1][1]  + kl[m][8]*R[2][1];
-            tmp[m][8] = kl[m][6]*R[0][2] + kl[m][7]*R[1][2]  + kl[m][8]*R[2][2];
-            
-            tmp[m][9]  = kl[m][9]*R[0][0] + kl[m][10]*R[1][0] + kl[m][11]*R[2][0];
-            tmp[m][10] = kl[m][9]*R[0][1] + kl[m][10]*R[1][1] + kl[m][11]*R[2][1];
-            tmp[m][11] = kl[m][9]*R[0][2] + kl[m][10]*R[1][2] + kl[m][11]*R[2][2];
-            
-            if (nodeJOffset) {
-                tmp[m][9]   += kl[m][6]*RWJ[0][0]  + kl[m][7]*RWJ[1][0]  + kl[m][8]*RWJ[2][0];
-                tmp[m][10]  += kl[m][6]*RWJ[0][1]  + kl[m][7]*RWJ[1][1]  + kl[m][8]*RWJ[2][1];
-                tmp[m][11]  += kl[m][6]*RWJ[0][2]  + kl[m][7]*RWJ[1][2]  + kl[m][8]*RWJ[2][2];
-            }
-            
-        }
-        
-        // Now compute T'_{lg}*(kl*T_{lg})
-        for (m = 0; m < 12; m++) {
-            kg(0,m) = R[0][0]*tmp[0][m] + R[1][0]*tmp[1][m]  + R[2][0]*tmp[2][m];
-            kg(1,m) = R[0][1]*tmp[0][m] + R[1][1]*tmp[1][m]  + R[2][1]*tmp[2][m];
-            kg(2,m) = R[0][2]*tmp[0][m] + R[1][2]*tmp[1][m]  + R[2][2]*tmp[2][m];
-            
-            kg(3,m) = R[0][0]*tmp[3][m] + R[1][0]*tmp[4][m]  + R[2][0]*tmp[5][m];
-            kg(4,m) = R[0][1]*tmp[3][m] + R[1][1]*tmp[4][m]  + R[2][1]*tmp[5][m];
-            kg(5,m) = R[0][2]*tmp[3][m] + R[1][2]*tmp[4][m]  + R[2][2]*tmp[5][m];
-            
-            if (nodeIOffset) {
-                kg(3,m) += RWI[0][0]*tmp[0][m]  + RWI[1][0]*tmp[1][m] + RWI[2][0]*tmp[2][m];
-                kg(4,m) += RWI[0][1]*tmp[0][m]  + RWI[1][1]*tmp[1][m] + RWI[2][1]*tmp[2][m];
-                kg(5,m) += RWI[0][2]*tmp[0][m]  + RWI[1][2]*tmp[1][m] + RWI[2][2]*tmp[2][m];
-            }
-            
-            kg(6,m) = R[0][0]*tmp[6][m] + R[1][0]*tmp[7][m]  + R[2][0]*tmp[8][m];
-            kg(7,m) = R[0][1]*tmp[6][m] + R[1][1]*tmp[7][m]  + R[2][1]*tmp[8][m];
-            kg(8,m) = R[0][2]*tmp[6][m] + R[1][2]*tmp[7][m]  + R[2][2]*tmp[8][m];
-            
-            kg(9,m)  = R[0][0]*tmp[9][m] + R[1][0]*tmp[10][m] + R[2][0]*tmp[11][m];
-            kg(10,m) = R[0][1]*tmp[9][m] + R[1][1]*tmp[10][m] + R[2][1]*tmp[11][m];
-            kg(11,m) = R[0][2]*tmp[9][m] + R[1][2]*tmp[10][m] + R[2][2]*tmp[11][m];
-            
-            if (nodeJOffset) {
-                kg(9,m)  += RWJ[0][0]*tmp[6][m]  + RWJ[1][0]*tmp[7][m] + RWJ[2][0]*tmp[8][m];
-                kg(10,m) += RWJ[0][1]*tmp[6][m]  + RWJ[1][1]*tmp[7][m] + RWJ[2][1]*tmp[8][m];
-                kg(11,m) += RWJ[0][2]*tmp[6][m]  + RWJ[1][2]*tmp[7][m] + RWJ[2][2]*tmp[8][m];
-            }
+    
+    for (i = 0; i < 12; i++)
+        for (j = 0; j < 12; j++) {
+            double sum = 0.0;
+            for (k = 0; k < 6; k++)
+                sum += Tbg[k][i]*tmp[k][j];
+            kg(i,j) = sum;
         }
-        
-        return kg;
+    
+    return kg;
 }
 
 
 const Matrix &
 LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-    static double kb[6][6];		// Basic stiffness
-    static double kl[12][12];	// Local stiffness
-    static double tmp[12][12];	// Temporary storage
-    double oneOverL = 1.0/L;
-    
-    int i,j;
-    for (i = 0; i < 6; i++)
-        for (j = 0; j < 6; j++)
-            kb[i][j] = KB(i,j);
-        
-        // Transform basic stiffness to local system
-        // First compute kb*T_{bl}
-        for (i = 0; i < 6; i++) {
-            tmp[i][0]  = -kb[i][0];
-            tmp[i][1]  =  oneOverL*(kb[i][1]+kb[i][2]);
-            tmp[i][2]  = -oneOverL*(kb[i][3]+kb[i][4]);
-            tmp[i][3]  = -kb[i][5];
-            tmp[i][4]  =  kb[i][3];
-            tmp[i][5]  =  kb[i][1];
-            tmp[i][6]  =  kb[i][0];
-            tmp[i][7]  = -tmp[i][1];
-            tmp[i][8]  = -tmp[i][2];
-            tmp[i][9]  =  kb[i][5];
-            tmp[i][10] =  kb[i][4];
-            tmp[i][11] =  kb[i][2];
-        }
-        
-        // Now compute T'_{bl}*(kb*T_{bl})
-        for (i = 0; i < 12; i++) {
-            kl[0][i]  = -tmp[0][i];
-            kl[1][i]  =  oneOverL*(tmp[1][i]+tmp[2][i]);
-            kl[2][i]  = -oneOverL*(tmp[3][i]+tmp[4][i]);
-            kl[3][i]  = -tmp[5][i];
-            kl[4][i]  =  tmp[3][i];
-            kl[5][i]  =  tmp[1][i];
-            kl[6][i]  =  tmp[0][i];
-            kl[7][i]  = -kl[1][i];
-            kl[8][i]  = -kl[2][i];
-            kl[9][i]  =  tmp[5][i];
-            kl[10][i] =  tmp[4][i];
-            kl[11][i] =  tmp[2][i];
-        }
-        
-        static double RWI[3][3];
-        
-        if (nodeIOffset) {
-            // Compute RWI
-            RWI[0][0] = -R[0][1]*nodeIOffset[2] + R[0][2]*nodeIOffset[1];
-            RWI[1][0] = -R[1][1]*nodeIOffset[2] + R[1][2]*nodeIOffset[1];
-            RWI[2][0] = -R[2][1]*nodeIOffset[2] + R[2][2]*nodeIOffset[1];
-            
-            RWI[0][1] =  R[0][0]*nodeIOffset[2] - R[0][2]*nodeIOffset[0];
-            RWI[1][1] =  R[1][0]*nodeIOffset[2] - R[1][2]*nodeIOffset[0];
-            RWI[2][1] =  R[2][0]*nodeIOffset[2] - R[2][2]*nodeIOffset[0];
-            
-            RWI[0][2] = -R[0][0]*nodeIOffset[1] + R[0][1]*nodeIOffset[0];
-            RWI[1][2] = -R[1][0]*nodeIOffset[1] + R[1][1]*nodeIOffset[0];
-            RWI[2][2] = -R[2][0]*nodeIOffset[1] + R[2][1]*nodeIOffset[0];
-        }
-        
-        static double RWJ[3][3];
-        
-        if (nodeJOffset) {
-            // Compute RWJ
-            RWJ[0][0] = -R[0][1]*nodeJOffset[2] + R[0][2]*nodeJOffset[1];
-            RWJ[1][0] = -R[1][1]*nodeJOffset[2] + R[1][2]*nodeJOffset[1];
-            RWJ[2][0] = -R[2][1]*nodeJOffset[2] + R[2][2]*nodeJOffset[1];
-            
-            RWJ[0][1] =  R[0][0]*nodeJOffset[2] - R[0][2]*nodeJOffset[0];
-            RWJ[1][1] =  R[1][0]*nodeJOffset[2] - R[1][2]*nodeJOffset[0];
-            RWJ[2][1] =  R[2][0]*nodeJOffset[2] - R[2][2]*nodeJOffset[0];
-            
-            RWJ[0][2] = -R[0][0]*nodeJOffset[1] + R[0][1]*nodeJOffset[0];
-            RWJ[1][2] = -R[1][0]*nodeJOffset[1] + R[1][1]*nodeJOffset[0];
-            RWJ[2][2] = -R[2][0]*nodeJOffset[1] + R[2][1]*nodeJOffset[0];
-        }
-        
-        // Transform local stiffness to global system
-        // First compute kl*T_{lg}
-        int m;
-        for (m = 0; m < 12; m++) {
-            tmp[m][0] = kl[m][0]*R[0][0] + kl[m][1]*R[1][0]  + kl[m][2]*R[2][0];
-            tmp[m][1] = kl[m][0]*R[0][1] + kl[m][1]*R[1][1]  + kl[m][2]*R[2][1];
-            tmp[m][2] = kl[m][0]*R[0][2] + kl[m][1]*R[1][2]  + kl[m][2]*R[2][2];
-            
-            tmp[m][3] = kl[m][3]*R[0][0] + kl[m][4]*R[1][0]  + kl[m][5]*R[2][0];
-            tmp[m][4] = kl[m][3]*R[0][1] + kl[m][4]*R[1][1]  + kl[m][5]*R[2][1];
-            tmp[m][5] = kl[m][3]*R[0][2] + kl[m][4]*R[1][2]  + kl[m][5]*R[2][2];
-            
-            if (nodeIOffset) {
-                tmp[m][3]  += kl[m][0]*RWI[0][0]  + kl[m][1]*RWI[1][0]  + kl[m][2]*RWI[2][0];
-                tmp[m][4]  += kl[m][0]*RWI[0][1]  + kl[m][1]*RWI[1][1]  + kl[m][2]*RWI[2][1];
-                tmp[m][5]  += kl[m][0]*RWI[0][2]  + kl[m][1]*RWI[1][2]  + kl[m][2]*RWI[2][2];
-            }
-            
-            tmp[m][6] = kl[m][6]*R[0][0] + kl[m][7]*R[1][0]  + kl[m][8]*R[2][0];
-            tmp[m][7] = kl[m][6]*R[0][1] + kl[m][7]*R[1][1]  + kl[m][8]*R[2][1];
-            tmp[m][8] = kl[m][6]*R[0][2] + kl[m][7]*R[1][2]  + kl[m][8]*R[2][2];
-            
-            tmp[m][9]  = kl[m][9]*R[0][0] + kl[m][10]*R[1][0] + kl[m][11]*R[2][0];
-            tmp[m][10] = kl[m][9]*R[0][1] + kl[m][10]*R[1][1] + kl[m][11]*R[2][1];
-            tmp[m][11] = kl[m][9]*R[0][2] + kl[m][10]*R[1][2] + kl[m][11]*R[2][2];
-            
-            if (nodeJOffset) {
-                tmp[m][9]   += kl[m][6]*RWJ[0][0]  + kl[m][7]*RWJ[1][0]  + kl[m][8]*RWJ[2][0];
-                tmp[m][10]  += kl[m][6]*RWJ[0][1]  + kl[m][7]*RWJ[1][1]  + kl[m][8]*RWJ[2][1];
-                tmp[m][11]  += kl[m][6]*RWJ[0][2]  + kl[m][7]*RWJ[1][2]  + kl[m][8]*RWJ[2][2];
-            }
-            
-        }
-        
-        // Now compute T'_{lg}*(kl*T_{lg})
-        for (m = 0; m < 12; m++) {
-            kg(0,m) = R[0][0]*tmp[0][m] + R[1][0]*tmp[1][m]  + R[2][0]*tmp[2][m];
-            kg(1,m) = R[0][1]*tmp[0][m] + R[1][1]*tmp[1][m]  + R[2][1]*tmp[2][m];
-            kg(2,m) = R[0][2]*tmp[0][m] + R[1][2]*tmp[1][m]  + R[2][2]*tmp[2][m];
-            
-            kg(3,m) = R[0][0]*tmp[3][m] + R[1][0]*tmp[4][m]  + R[2][0]*tmp[5][m];
-            kg(4,m) = R[0][1]*tmp[3][m] + R[1][1]*tmp[4][m]  + R[2][1]*tmp[5][m];
-            kg(5,m) = R[0][2]*tmp[3][m] + R[1][2]*tmp[4][m]  + R[2][2]*tmp[5][m];
-            
-            if (nodeIOffset) {
-                kg(3,m) += RWI[0][0]*tmp[0][m]  + RWI[1][0]*tmp[1][m] + RWI[2][0]*tmp[2][m];
-                kg(4,m) += RWI[0][1]*tmp[0][m]  + RWI[1][1]*tmp[1][m] + RWI[2][1]*tmp[2][m];
-                kg(5,m) += RWI[0][2]*tmp[0][m]  + RWI[1][2]*tmp[1][m] + RWI[2][2]*tmp[2][m];
-            }
-            
-            kg(6,m) = R[0][0]*tmp[6][m] + R[1][0]*tmp[7][m]  + R[2][0]*tmp[8][m];
-            kg(7,m) = R[0][1]*tmp[6][m] + R[1][1]*tmp[7][m]  + R[2][1]*tmp[8][m];
-            kg(8,m) = R[0][2]*tmp[6][m] + R[1][2]*tmp[7][m]  + R[2][2]*tmp[8][m];
-            
-            kg(9,m)  = R[0][0]*tmp[9][m] + R[1][0]*tmp[10][m] + R[2][0]*tmp[11][m];
-            kg(10,m) = R[0][1]*tmp[9][m] + R[1][1]*tmp[10][m] + R[2][1]*tmp[11][m];
-            kg(11,m) = R[0][2]*tmp[9][m] + R[1][2]*tmp[10][m] + R[2][2]*tmp[11][m];
-            
-            if (nodeJOffset) {
-                kg(9,m)  += RWJ[0][0]*tmp[6][m]  + RWJ[1][0]*tmp[7][m] + RWJ[2][0]*tmp[8][m];
-                kg(10,m) += RWJ[0][1]*tmp[6][m]  + RWJ[1][1]*tmp[7][m] + RWJ[2][1]*tmp[8][m];
-                kg(11,m) += RWJ[0][2]*tmp[6][m]  + RWJ[1][2]*tmp[7][m] + RWJ[2][2]*tmp[8][m];
-            }
-        }
-        
-        return kg;
+    return this->compGlobalStiffMatrix(KB);
 }
 
 
@@ -1151,6 +694,9 @@ LinearCrdTransf3d::getCopy3d(void)
     for (int i = 0; i < 3; i++)
         for (int j = 0; j < 3; j++)
             theCopy->R[i][j] = R[i][j];
+    for (int i = 0; i < 6; i++)
+        for (int j = 0; j < 12; j++)
+            theCopy->Tbg[i][j] = Tbg[i][j];
         
         return theCopy;
 }
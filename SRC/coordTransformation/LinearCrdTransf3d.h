@@ -73,6 +73,7 @@ public:
     const Matrix &getInitialGlobalStiffMatrix(const Matrix &basicStiff);
     
     CrdTransf *getCopy3d(void);
+    bool isLinear(void) {return true;};
     
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -94,6 +95,10 @@ public:
 private:
     int computeElemtLengthAndOrient(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg);
+    void compTransfMatrixBasicGlobal(void);
+    void getBasicFromGlobal(const double *ug, Vector &ub);
+    void addGlobalForceFromLocalLoad(const Vector &p0, double *pg);
+    const Matrix &compGlobalStiffMatrix(const Matrix &kb);
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -102,6 +107,8 @@ private:
     
     double R[3][3];	 // rotation matrix
     double L;        // undeformed element length
+    double Tbg[6][12];	 // transformation from global to basic, including
+			 // the rigid joint offsets; constant, set in initialize()
 
     static Matrix Tlg;  // matrix that transforms from global to local coordinates
     static Matrix kg;   // global stiffness matrix
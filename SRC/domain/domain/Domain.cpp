@@ -45,6 +45,10 @@
 #include <NodalLoadIter.h>
 #include <Element.h>
 #include <Node.h>
+#include <NodalStateStore.h>
+#include <CompiledLoadPatterns.h>
+#include <UniaxialMaterialBatch.h>
+#include <RecorderScheduler.h>
 #include <SP_Constraint.h>
 #include <Pressure_Constraint.h>
 #include <MP_Constraint.h>
@@ -55,6 +59,7 @@
 #include <Response.h>
 
 #include <MapOfTaggedObjects.h>
+#include <DenseMapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
 
 #include <SingleDomEleIter.h>
@@ -75,7 +80,9 @@
 #include <Matrix.h>
 #include <Graph.h>
 #include <Recorder.h>
+#include <Profiler.h>
 #include <MeshRegion.h>
+#include <ElementGenerator.h>
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
@@ -91,20 +98,24 @@ bool          ops_InitialStateAnalysis = false;
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1), lastFullChangeStamp(0),
+ changeDepth(0), changePending(false), propertiesStamp(0),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), theGenerators(0), numGenerators(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0), theNodalState(0), theCompiledLoads(0),
+ theMaterialBatch(0), useMaterialBatch(false),
+ theRecorderScheduler(0), recordersSuspended(false)
 {
   
-    // init the arrays for storing the domain components
-    theElements = new MapOfTaggedObjects();
-    theNodes    = new MapOfTaggedObjects();
+    // init the arrays for storing the domain components; the nodes and
+    // elements are held in contiguous arrays with hashed tag lookup
+    theElements = new DenseMapOfTaggedObjects();
+    theNodes    = new DenseMapOfTaggedObjects();
     theSPs      = new MapOfTaggedObjects();
     thePCs      = new MapOfTaggedObjects();
     theMPs      = new MapOfTaggedObjects();    
@@ -146,18 +157,22 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1), lastFullChangeStamp(0),
+ changeDepth(0), changePending(false), propertiesStamp(0),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), theGenerators(0), numGenerators(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
-{
-    // init the arrays for storing the domain components
-    theElements = new MapOfTaggedObjects();
-    theNodes    = new MapOfTaggedObjects();
+ lastChannel(0), paramIndex(0), paramSize(0), numParameters(0), theNodalState(0), theCompiledLoads(0),
+ theMaterialBatch(0), useMaterialBatch(false),
+ theRecorderScheduler(0), recordersSuspended(false)
+{
+    // init the arrays for storing the domain components; the nodes and
+    // elements are held in contiguous arrays with hashed tag lookup
+    theElements = new DenseMapOfTaggedObjects();
+    theNodes    = new DenseMapOfTaggedObjects();
     theSPs      = new MapOfTaggedObjects();
     thePCs      = new MapOfTaggedObjects();
     theMPs      = new MapOfTaggedObjects();    
@@ -201,7 +216,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1), lastFullChangeStamp(0),
+ changeDepth(0), changePending(false), propertiesStamp(0),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
@@ -210,10 +226,12 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theSPs(&theSPsStorage),
  theMPs(&theMPsStorage), 
  theLoadPatterns(&theLoadPatternsStorage),
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), theGenerators(0), numGenerators(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0), theNodalState(0), theCompiledLoads(0),
+ theMaterialBatch(0), useMaterialBatch(false),
+ theRecorderScheduler(0), recordersSuspended(false)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -264,14 +282,17 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 Domain::Domain(TaggedObjectStorage &theStorage)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1), lastFullChangeStamp(0),
+ changeDepth(0), changePending(false), propertiesStamp(0),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), theGenerators(0), numGenerators(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0), theNodalState(0), theCompiledLoads(0),
+ theMaterialBatch(0), useMaterialBatch(false),
+ theRecorderScheduler(0), recordersSuspended(false)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -324,9 +345,24 @@ Domain::Domain(TaggedObjectStorage &theStorage)
 
 Domain::~Domain()
 {
+  // finish writing the recorders before they are deleted
+  if (theRecorderScheduler != 0) {
+    delete theRecorderScheduler;
+    theRecorderScheduler = 0;
+  }
+
   // delete the objects in the domain
   this->Domain::clearAll();
 
+  if (theNodalState != 0)
+    delete theNodalState;
+
+  if (theCompiledLoads != 0)
+    delete theCompiledLoads;
+
+  if (theMaterialBatch != 0)
+    delete theMaterialBatch;
+
   // delete all the storage objects
   // SEGMENT FAULT WILL OCCUR IF THESE OBJECTS WERE NOT CONSTRUCTED
   // USING NEW
@@ -457,6 +493,23 @@ Domain::addElement(Element *element)
 
 
 
+// int reserveNodesAndElements(int numNodes, int numElements);
+//	Method to size the node and element containers ahead of adding a
+//	large number of components; a size of 0 leaves a container as is.
+
+int
+Domain::reserveNodesAndElements(int numNodes, int numElements)
+{
+  int res = 0;
+  if (numNodes > theNodes->getNumComponents())
+    res += theNodes->setSize(numNodes);
+  if (numElements > theElements->getNumComponents())
+    res += theElements->setSize(numElements);
+
+  return res;
+}
+
+
 // void addNode(Node *);
 //	Method to add a Node to the model.
 
@@ -474,6 +527,7 @@ Domain::addNode(Node * node)
   bool result = theNodes->addComponent(node);
   if (result == true) {
       node->setDomain(this);
+      this->nodesChanged();
       this->domainChange();
       
       // see if the physical bounds are changed
@@ -761,6 +815,7 @@ Domain::addParameter(Parameter *theParam)
   if (paramTag == 0) {
     // don't add it .. just invoke setDomain on the parameter
     theParam->setDomain(this);
+    this->propertiesChanged();
     return true;
   }
 
@@ -935,6 +990,13 @@ Domain::clearAll(void) {
   while ((thePattern = thePatterns()) != 0)
     thePattern->clearAll();
 
+  // give the nodes back their own storage before they are deleted
+  if (theNodalState != 0)
+    theNodalState->unpack();
+
+  if (theCompiledLoads != 0)
+    theCompiledLoads->invalidate();
+
   // clean out the containers
   theElements->clearAll();
   theNodes->clearAll();
@@ -946,6 +1008,7 @@ Domain::clearAll(void) {
   numParameters = 0;
 
   // remove the recorders
+  this->waitForRecorders();
   int i;
   for (i=0; i<numRecorders; i++)
 	  if (theRecorders[i] != 0)
@@ -966,6 +1029,8 @@ Domain::clearAll(void) {
     theRegions = 0;
   }
 
+  this->removeElementGenerators();
+
   // set the time back to 0.0
   currentTime = 0.0;
   committedTime = 0.0;
@@ -983,6 +1048,8 @@ Domain::clearAll(void) {
   
   currentGeoTag = 0;
   lastGeoSendTag = -1;
+  lastFullChangeStamp = 0;
+  removedElements.clear();
   
   // rest the flag to be as initial
   hasDomainChangedFlag = false;
@@ -993,6 +1060,8 @@ Domain::clearAll(void) {
 
   currentGeoTag = 0;
   lastGeoSendTag = -1;
+  lastFullChangeStamp = 0;
+  removedElements.clear();
   lastChannel = 0;
 
   // rest the flag to be as initial
@@ -1022,12 +1091,12 @@ Domain::removeElement(int tag)
   if (mc == 0) 
       return 0;
 
-  // otherwise mark the domain as having changed
-  this->domainChange();
-  
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
   Element *result = (Element *)mc;
+
+  // otherwise mark the domain as having changed
+  this->elementRemoved(tag);
   //  result->setDomain(0);
   return result;
 }
@@ -1043,6 +1112,7 @@ Domain::removeNode(int tag)
       return 0;  
 
   // mark the domain has having changed 
+  this->nodesChanged();
   this->domainChange();
   
   // perform a downward cast to a Node (safe as only Node added to
@@ -1772,11 +1842,11 @@ Domain::applyLoad(double timeStep)
 	if (elePtr->isSubdomain() == false)
 	    elePtr->zeroLoad();    
 
-    // now loop over load patterns, invoking applyLoad on them
-    LoadPattern *thePattern;
-    LoadPatternIter &thePatterns = this->getLoadPatterns();
-    while((thePattern = thePatterns()) != 0)
-      thePattern->applyLoad(timeStep);
+    // now apply the load patterns, the nodal loads of the plain ones
+    // in a single pass over the nodes
+    if (theCompiledLoads == 0)
+      theCompiledLoads = new CompiledLoadPatterns();
+    theCompiledLoads->applyLoad(*this, timeStep);
 
     //
     // finally loop over the MP_Constraints and SP_Constraints of the domain
@@ -1856,6 +1926,8 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
     result += nodePtr->setRayleighDampingFactor(alphaM);
   }
 
+  this->propertiesChanged();
+
   return result;
 }
 
@@ -1866,9 +1938,19 @@ Domain::record(bool fromAnalysis)
   int res = 0;
 
   // invoke record on all recorders
-  for (int i=0; i<numRecorders; i++)
-    if (theRecorders[i] != 0)
-      res += theRecorders[i]->record(commitTag, currentTime);
+  static int profRecorders = Profiler::getRegion("recorders");
+  ProfilerScope theScope(profRecorders);
+
+  if (recordersSuspended == false) {
+    if (theRecorderScheduler != 0) {
+      res += theRecorderScheduler->record(theRecorders, numRecorders, commitTag, currentTime);
+      res += theRecorderScheduler->wait();
+    } else {
+      for (int i=0; i<numRecorders; i++)
+	if (theRecorders[i] != 0)
+	  res += theRecorders[i]->record(commitTag, currentTime);
+    }
+  }
   
   // update the commitTag
   commitTag++;
@@ -1879,13 +1961,28 @@ Domain::record(bool fromAnalysis)
 int
 Domain::commit(void)
 {
+    static int profCommit = Profiler::getRegion("Domain::commit");
+    ProfilerScope theScope(profCommit);
+
     // 
-    // first invoke commit on all nodes and elements in the domain
+    // first invoke commit on all nodes and elements in the domain, the
+    // nodal kinematics are packed into the store on the first commit
+    // after the domain has changed and then committed as whole arrays
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0) {
-      nodePtr->commitState();
+    if (theNodalState == 0)
+      theNodalState = new NodalStateStore();
+
+    if (theNodalState->isPacked() == false)
+      theNodalState->pack(this->getNodes());
+
+    if (theNodalState->isPacked() == true)
+      theNodalState->commit();
+    else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != 0) {
+	nodePtr->commitState();
+      }
     }
 
     Element *elePtr;
@@ -1898,10 +1995,30 @@ Domain::commit(void)
     committedTime = currentTime;
     dT = 0.0;
 
+    // let the element generators add and remove their elements for the
+    // next step, before the recorders see the domain
+    for (int i=0; i<numGenerators; i++)
+      if (theGenerators[i]->update() < 0)
+	opserr << "WARNING Domain::commit - element generator " << theGenerators[i]->getTag() << " failed\n";
+
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    static int profRecorders = Profiler::getRegion("recorders");
+    ProfilerScope theRecorderScope(profRecorders);
+
+    // as when recorded directly a failed recorder does not fail the
+    // commit; with recorder threads a failed write shows up at the next
+    // commit, when the batch it belongs to has been waited for, and is
+    // reported there
+    if (recordersSuspended == false) {
+      if (theRecorderScheduler != 0) {
+	if (theRecorderScheduler->record(theRecorders, numRecorders, commitTag, currentTime) < 0)
+	  opserr << "WARNING Domain::commit - a recorder failed to record\n";
+      } else {
+	for (int i=0; i<numRecorders; i++)
+	  if (theRecorders[i] != 0)
+	    theRecorders[i]->record(commitTag, currentTime);
+      }
+    }
 
     // update the commitTag
     commitTag++;
@@ -1915,10 +2032,14 @@ Domain::revertToLastCommit(void)
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
     
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0)
+    if (theNodalState != 0 && theNodalState->isPacked() == true)
+      theNodalState->revertToLastCommit();
+    else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != 0)
 	nodePtr->revertToLastCommit();
+    }
     
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
@@ -1955,9 +2076,14 @@ Domain::revertToStart(void)
 	elePtr->revertToStart();
     }
 
+    // the generated elements start again from the initial state
+    for (int i=0; i<numGenerators; i++)
+      theGenerators[i]->revertToStart();
+
     // ADDED BY TERJE //////////////////////////////////
     // invoke 'restart' on all recorders
-    for (int i=0; i<numRecorders; i++) 
+    this->waitForRecorders();
+    for (int i=0; i<numRecorders && recordersSuspended == false; i++) 
       if (theRecorders[i] != 0)
 	theRecorders[i]->restart();
     /////////////////////////////////////////////////////
@@ -1979,6 +2105,9 @@ Domain::update(void)
   ops_Dt = dT;
   ops_TheActiveDomain = this;
 
+  static int profUpdate = Profiler::getRegion("Domain::update");
+  ProfilerScope theScope(profUpdate);
+
   int ok = 0;
 
   // invoke update on all the ele's
@@ -1987,9 +2116,14 @@ Domain::update(void)
 
   while ((theEle = theEles()) != 0) {
     ops_TheActiveElement = theEle;
+    ProfilerElementScope theEleScope(Profiler::ElementUpdate, theEle);
     ok += theEle->update();
   }
 
+  // set the materials the elements gathered strains for
+  if (useMaterialBatch == true)
+    ok += theMaterialBatch->evaluate();
+
   if (ok != 0)
     opserr << "Domain::update - domain failed in update\n";
 
@@ -1997,6 +2131,16 @@ Domain::update(void)
 }
 
 
+
+void
+Domain::setMaterialBatch(bool onOff)
+{
+  if (onOff == true && theMaterialBatch == 0)
+    theMaterialBatch = new UniaxialMaterialBatch();
+
+  useMaterialBatch = onOff;
+}
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2020,6 +2164,7 @@ Domain::updateParameter(int tag, int value)
   // convert to a parameter & update
   Parameter *result = (Parameter *)mc;
   int res = result->update(value);
+  this->propertiesChanged();
 
   return res;
 }
@@ -2038,6 +2183,7 @@ Domain::updateParameter(int tag, double value)
 
   Parameter *theParam = (Parameter *)mc;
   int res =  theParam->update(value);
+  this->propertiesChanged();
   return res;
 }
 
@@ -2141,15 +2287,83 @@ void
 Domain::setDomainChangeStamp(int newStamp)
 {
     currentGeoTag = newStamp;
+
+    // stamps are no longer comparable, force a full change
+    lastFullChangeStamp = newStamp+1;
+    removedElements.clear();
 }
 
 
 void
 Domain::domainChange(void)
 {
+    // within beginChanges() and endChanges() the change is marked once
+    if (changeDepth > 0) {
+      changePending = true;
+      return;
+    }
+
     hasDomainChangedFlag = true;
+
+    // changes made now show up under the next stamp
+    lastFullChangeStamp = currentGeoTag+1;
+    removedElements.clear();
+
+    // the loads may refer to removed nodes, recompiled on the next step
+    if (theCompiledLoads != 0)
+      theCompiledLoads->invalidate();
+}
+
+
+// void elementRemoved(int tag)
+//	Invoked when an element is removed from the domain. A removal leaves
+//	the node set alone, so it is only recorded, by tag as the element may
+//	be deleted, for the analysis to patch its model on the next change of
+//	stamp.
+
+void
+Domain::elementRemoved(int tag)
+{
+  hasDomainChangedFlag = true;
+  removedElements.push_back(std::make_pair(currentGeoTag+1, tag));
+}
+
+
+// void nodesChanged(void)
+//	Invoked when a node is added to or removed from the domain. The
+//	nodes give their storage back and are packed again, with the new
+//	node set, on the next commit; other changes of the domain leave the
+//	store packed.
+
+void
+Domain::nodesChanged(void)
+{
+  if (theNodalState != 0 && theNodalState->isPacked() == true)
+    theNodalState->unpack();
 }
 
+// void beginChanges(void), endChanges(void)
+//	Bracket a group of additions and removals made in one go, such as
+//	the pair elements of a contact search; the domainChange() calls made
+//	in between are merged into one made by the outermost endChanges().
+
+void
+Domain::beginChanges(void)
+{
+  changeDepth++;
+}
+
+void
+Domain::endChanges(void)
+{
+  if (changeDepth > 0)
+    changeDepth--;
+
+  if (changeDepth == 0 && changePending == true) {
+    changePending = false;
+    this->domainChange();
+  }
+}
 
 bool 
 Domain::getDomainChangeFlag(void)
@@ -2158,6 +2372,23 @@ Domain::getDomainChangeFlag(void)
 }
 
 
+bool
+Domain::getRemovedElements(int sinceStamp, std::vector<int> &removed)
+{
+  removed.clear();
+
+  // a full change or nothing at all since the stamp
+  if (sinceStamp < lastFullChangeStamp || sinceStamp >= currentGeoTag)
+    return false;
+
+  for (std::size_t i=0; i<removedElements.size(); i++)
+    if (removedElements[i].first > sinceStamp && removedElements[i].first <= currentGeoTag)
+      removed.push_back(removedElements[i].second);
+
+  return removed.size() != 0;
+}
+
+
 int
 Domain::hasDomainChanged(void)
 {	
@@ -2326,6 +2557,8 @@ Domain::addRecorder(Recorder &theRecorder)
 int
 Domain::removeRecorders(void)
 {
+    this->waitForRecorders();
+
     for (int i=0; i<numRecorders; i++)  
       if (theRecorders[i] != 0)
 	delete theRecorders[i];
@@ -2342,6 +2575,8 @@ Domain::removeRecorders(void)
 int
 Domain::removeRecorder(int tag)
 {
+  this->waitForRecorders();
+
   for (int i=0; i<numRecorders; i++) {
     if (theRecorders[i] != 0) {
       if (theRecorders[i]->getTag() == tag) {
@@ -2358,6 +2593,97 @@ Domain::removeRecorder(int tag)
 
 
 
+int
+Domain::setRecorderThreads(int numThreads)
+{
+  if (theRecorderScheduler != 0) {
+    if (theRecorderScheduler->getNumThreads() == numThreads)
+      return 0;
+    delete theRecorderScheduler;
+    theRecorderScheduler = 0;
+  }
+
+  if (numThreads > 0)
+    theRecorderScheduler = new RecorderScheduler(numThreads);
+
+  return 0;
+}
+
+int
+Domain::getRecorderThreads(void)
+{
+  if (theRecorderScheduler == 0)
+    return 0;
+
+  return theRecorderScheduler->getNumThreads();
+}
+
+int
+Domain::getRecordedNodes(ID &theNodeTags)
+{
+  // the union of the nodes of the recorders, -1 if one of them needs
+  // the whole domain
+  for (int i=0; i<numRecorders; i++) {
+    if (theRecorders[i] == 0)
+      continue;
+
+    ID recorderNodes;
+    if (theRecorders[i]->getRecordedNodes(recorderNodes) < 0)
+      return -1;
+
+    for (int j=0; j<recorderNodes.Size(); j++)
+      theNodeTags.insert(recorderNodes(j));
+  }
+
+  return 0;
+}
+
+int
+Domain::waitForRecorders(void)
+{
+  if (theRecorderScheduler == 0)
+    return 0;
+
+  return theRecorderScheduler->wait();
+}
+
+
+int
+Domain::addElementGenerator(ElementGenerator &theGenerator)
+{
+    // not added, and left to the caller to delete, if it fails
+    if (theGenerator.setDomain(*this) < 0)
+      return -1;
+
+    ElementGenerator **newGenerators = new ElementGenerator *[numGenerators + 1];
+    
+    for (int i=0; i<numGenerators; i++)
+	newGenerators[i] = theGenerators[i];
+    newGenerators[numGenerators] = &theGenerator;
+    if (theGenerators != 0)
+      delete [] theGenerators;
+    
+    theGenerators = newGenerators;
+    numGenerators++;
+
+    return 0;
+}
+
+int
+Domain::removeElementGenerators(void)
+{
+    for (int i=0; i<numGenerators; i++)
+      delete theGenerators[i];
+    numGenerators = 0;
+
+    if (theGenerators != 0) {
+      delete [] theGenerators;
+      theGenerators = 0;
+    }
+
+    return 0;
+}
+
 int  
 Domain::addRegion(MeshRegion &theRegion)
 {
@@ -3363,6 +3689,8 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
     // this way if restoring froma a database and domain has not changed for the analysis
     // the analysis will not have to to do a domainChanged() operation
     currentGeoTag = domainData(0);
+    lastFullChangeStamp = currentGeoTag+1;
+    removedElements.clear();
 
     lastGeoSendTag = currentGeoTag;
     hasDomainChangedFlag = false;
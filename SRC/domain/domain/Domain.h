@@ -38,6 +38,7 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <vector>
 
 class Element;
 class Node;
@@ -67,6 +68,7 @@ class SingleDomParamIter;
 
 class MeshRegion;
 class Recorder;
+class ElementGenerator;
 class Graph;
 class NodeGraph;
 class ElementGraph;
@@ -74,6 +76,10 @@ class Channel;
 class FEM_ObjectBroker;
 
 class TaggedObjectStorage;
+class NodalStateStore;
+class CompiledLoadPatterns;
+class UniaxialMaterialBatch;
+class RecorderScheduler;
 
 class Domain
 {
@@ -104,6 +110,9 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+
+    // method to pre-size the node and element storage before a bulk addition
+    virtual  int  reserveNodesAndElements(int numNodes, int numElements);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -204,7 +213,22 @@ class Domain
     virtual int hasDomainChanged(void);
     virtual bool getDomainChangeFlag(void);    
     virtual void domainChange(void);    
+    // the changes made in between are marked with a single domainChange()
+    void beginChanges(void);
+    void endChanges(void);
     virtual void setDomainChangeStamp(int newStamp);
+    // the stamp the next hasDomainChanged() will return, without resetting
+    int getDomainChangeStamp(void) const {return hasDomainChangedFlag ? currentGeoTag+1 : currentGeoTag;}
+
+    // true if the only changes made after the stamp sinceStamp were
+    // element removals, in which case the tags of the removed elements
+    // are returned
+    virtual bool getRemovedElements(int sinceStamp, std::vector<int> &removed);
+
+    // marks a change of the damping factors or parameter values, which
+    // changes the element matrices but not the model itself
+    void propertiesChanged(void) {propertiesStamp++;}
+    int getPropertiesStamp(void) const {return propertiesStamp;}
 
 
     // methods for output
@@ -212,6 +236,20 @@ class Domain
     virtual int  removeRecorders(void);
     virtual int  removeRecorder(int tag);
     virtual int  record(bool fromAnalysis=true);
+    virtual int  getRecordedNodes(ID &theNodeTags);
+
+    // recorders staged at commit and written by numThreads worker
+    // threads while the analysis goes on, 0 records them in commit
+    int setRecorderThreads(int numThreads);
+    int getRecorderThreads(void);
+    int waitForRecorders(void);
+
+    // while suspended the recorders are neither invoked nor restarted
+    void suspendRecorders(bool onOff) {recordersSuspended = onOff;}
+
+    // components adding and removing elements at commit, see ElementGenerator
+    virtual int  addElementGenerator(ElementGenerator &theGenerator);
+    virtual int  removeElementGenerators(void);
 
     virtual int  addRegion(MeshRegion &theRegion);    	
     virtual MeshRegion *getRegion(int region);    	
@@ -232,8 +270,24 @@ class Domain
 
     virtual int calculateNodalReactions(int flag);
 
+    // contiguous nodal kinematics, 0 until the first commit
+    NodalStateStore *getNodalStateStore(void) {return theNodalState;}
+
+    // class-grouped evaluation of element uniaxial materials, 0 unless
+    // switched on, see UniaxialMaterialBatch
+    void setMaterialBatch(bool onOff);
+    UniaxialMaterialBatch *getMaterialBatch(void) {return useMaterialBatch ? theMaterialBatch : 0;}
+
   protected:    
 
+    // the node set has changed, see NodalStateStore
+    void nodesChanged(void);
+
+    // invoked by removeElement(); records the removal for the analysis to
+    // patch its model in place, subclasses overriding domainChange()
+    // override this to fall back to it
+    virtual void elementRemoved(int tag);
+
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
 
@@ -248,6 +302,11 @@ class Domain
     bool   hasDomainChangedFlag;      // a bool flag used to indicate if GeoTag needs to be ++
     int    theDbTag;                   // the Domains unique database tag == 0
     int    lastGeoSendTag;            // the value of currentGeoTag when sendSelf was last invoked
+    int    lastFullChangeStamp;       // the stamp of the last change other than an element removal
+    std::vector<std::pair<int, int> > removedElements; // (stamp, element tag) removed since then
+    int    changeDepth;               // nesting of beginChanges()
+    bool   changePending;             // domainChange() deferred to endChanges()
+    int    propertiesStamp;           // incremented by propertiesChanged()
     int dbEle, dbNod, dbSPs, dbPCs, dbMPs, dbLPs, dbParam; // database tags for storing info
 
     bool eleGraphBuiltFlag;
@@ -276,6 +335,9 @@ class Domain
     MeshRegion **theRegions;
     int numRegions;    
 
+    ElementGenerator **theGenerators;
+    int numGenerators;
+
     int commitTag;
     
     Vector theBounds;
@@ -294,6 +356,20 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // contiguous nodal kinematics, see NodalStateStore
+    NodalStateStore *theNodalState;
+
+    // nodal loads of the plain patterns grouped by node
+    CompiledLoadPatterns *theCompiledLoads;
+
+    // kept once created so elements can leave it when switched off
+    UniaxialMaterialBatch *theMaterialBatch;
+    bool useMaterialBatch;
+
+    // 0 unless recorders are written by worker threads
+    RecorderScheduler *theRecorderScheduler;
+    bool recordersSuspended;
 };
 
 #endif
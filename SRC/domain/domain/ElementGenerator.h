@@ -0,0 +1,53 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ElementGenerator_h
+#define ElementGenerator_h
+
+// Description: This file contains the class definition for
+// ElementGenerator. An ElementGenerator is a component of the Domain that
+// adds elements to and removes elements from the domain as the analysis
+// proceeds, e.g. the contact pair elements of a ContactSearch. The Domain
+// invokes update() in commit(), once the nodes and elements are committed
+// and before the recorders record, and revertToStart() in revertToStart(),
+// so that the model is never changed from within the recorders.
+
+#include <TaggedObject.h>
+#include <MovableObject.h>
+
+class Domain;
+
+class ElementGenerator: public TaggedObject, public MovableObject
+{
+  public:
+    ElementGenerator(int tag, int classTag);
+    virtual ~ElementGenerator();
+
+    // invoked by Domain::addElementGenerator()
+    virtual int setDomain(Domain &theDomain) = 0;
+
+    // bring the generated elements up to date with the committed state
+    virtual int update(void) = 0;
+
+    // remove the generated elements and start again from the initial state
+    virtual int revertToStart(void) = 0;
+};
+
+#endif
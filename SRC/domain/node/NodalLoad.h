@@ -49,6 +49,11 @@ class NodalLoad : public Load
     virtual int getNodeTag(void) const;
     virtual void applyLoad(double loadFactor);
     virtual void applyLoadSensitivity(double loadFactor);
+
+    // the reference load and whether it ignores the load factor, used
+    // when the load is applied in bulk by CompiledLoadPatterns
+    const Vector *getLoadVector(void) const {return load;}
+    bool isLoadConstant(void) const {return konstant;}
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
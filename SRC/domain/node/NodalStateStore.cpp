@@ -0,0 +1,231 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of NodalStateStore.
+
+#include <NodalStateStore.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <OPS_Globals.h>
+
+NodalStateStore::NodalStateStore()
+  :theData(0), theDynamicData(0), numDOF(0), uniformNDF(-1), packed(false)
+{
+
+}
+
+NodalStateStore::~NodalStateStore()
+{
+  this->unpack();
+}
+
+int
+NodalStateStore::pack(NodeIter &theIter)
+{
+  this->unpack();
+
+  // count the dof of the nodes not already held by another store
+  Node *theNode;
+  int size = 0;
+  bool dynamic = false;
+  while ((theNode = theIter()) != 0) {
+    if (theNode->getStateStore() == 0) {
+      theNodes.push_back(theNode);
+      size += theNode->getNumberDOF();
+      if (theNode->hasDynamicState() == true)
+	dynamic = true;
+    } else
+      otherNodes.push_back(theNode);
+  }
+
+  numDOF = size;
+  uniformNDF = -1;
+  if (otherNodes.empty() && theNodes.empty() == false) {
+    uniformNDF = theNodes[0]->getNumberDOF();
+    for (int slot=1; slot<(int)theNodes.size(); slot++)
+      if (theNodes[slot]->getNumberDOF() != uniformNDF) {
+	uniformNDF = -1;
+	break;
+      }
+  }
+
+  if (numDOF == 0) {
+    packed = true;
+    return 0;
+  }
+
+  theData = new double[TrialVel*numDOF];
+  if (dynamic == true)
+    theDynamicData = new double[(NumBlocks-TrialVel)*numDOF];
+
+  // hand every node a view onto its slot in each of the blocks
+  double *blocks[NumBlocks];
+  int loc = 0;
+  int numNodes = (int)theNodes.size();
+  for (int slot=0; slot<numNodes; slot++) {
+    theNode = theNodes[slot];
+    for (int j=0; j<NumBlocks; j++)
+      blocks[j] = (this->getBlock(j) != 0) ? this->getBlock(j) + loc : 0;
+    theLocs.push_back(loc);
+    if (theNode->setStateStorage(this, slot, blocks) < 0) {
+      opserr << "NodalStateStore::pack() - failed to set storage for node " << theNode->getTag() << endln;
+      packed = true;
+      this->unpack();
+      return -1;
+    }
+    loc += theNode->getNumberDOF();
+  }
+
+  packed = true;
+  return 0;
+}
+
+void
+NodalStateStore::unpack(void)
+{
+  int numNodes = (int)theNodes.size();
+  for (int slot=0; slot<numNodes; slot++)
+    if (theNodes[slot] != 0)
+      theNodes[slot]->releaseStateStorage();
+
+  theNodes.clear();
+  theLocs.clear();
+  otherNodes.clear();
+
+  if (theData != 0)
+    delete [] theData;
+  theData = 0;
+  if (theDynamicData != 0)
+    delete [] theDynamicData;
+  theDynamicData = 0;
+  numDOF = 0;
+  uniformNDF = -1;
+  packed = false;
+}
+
+void
+NodalStateStore::removeNode(int slot)
+{
+  if (slot >= 0 && slot < (int)theNodes.size()) {
+    theNodes[slot] = 0;
+    uniformNDF = -1;
+  }
+}
+
+double *
+NodalStateStore::getBlock(int block)
+{
+  if (block < TrialVel)
+    return theData + block*numDOF;
+
+  if (theDynamicData == 0)
+    return 0;
+
+  return theDynamicData + (block-TrialVel)*numDOF;
+}
+
+int
+NodalStateStore::createDynamic(void)
+{
+  if (theDynamicData != 0)
+    return 0;
+
+  int size = (NumBlocks-TrialVel)*numDOF;
+  theDynamicData = new double[size];
+  for (int i=0; i<size; i++)
+    theDynamicData[i] = 0.0;
+
+  double *blocks[NumBlocks];
+  int numNodes = (int)theNodes.size();
+  for (int slot=0; slot<numNodes; slot++) {
+    Node *theNode = theNodes[slot];
+    if (theNode == 0)
+      continue;
+    for (int j=0; j<NumBlocks; j++)
+      blocks[j] = this->getBlock(j) + theLocs[slot];
+    theNode->setDynamicStorage(blocks);
+  }
+
+  return 0;
+}
+
+int
+NodalStateStore::commit(void)
+{
+  // commit = trial, incr = 0
+  double *trial = theData;
+  double *committed = theData + CommitDisp*numDOF;
+  for (int i=0; i<numDOF; i++)
+    committed[i] = trial[i];
+
+  double *incr = theData + IncrDisp*numDOF;
+  for (int i=0; i<2*numDOF; i++)
+    incr[i] = 0.0;
+
+  if (theDynamicData != 0) {
+    trial = this->getBlock(TrialVel);
+    committed = this->getBlock(CommitVel);
+    for (int i=0; i<numDOF; i++)
+      committed[i] = trial[i];
+
+    trial = this->getBlock(TrialAccel);
+    committed = this->getBlock(CommitAccel);
+    for (int i=0; i<numDOF; i++)
+      committed[i] = trial[i];
+  }
+
+  int numOther = (int)otherNodes.size();
+  for (int i=0; i<numOther; i++)
+    otherNodes[i]->commitState();
+
+  return 0;
+}
+
+int
+NodalStateStore::revertToLastCommit(void)
+{
+  // trial = commit, incr = 0
+  double *trial = theData;
+  double *committed = theData + CommitDisp*numDOF;
+  for (int i=0; i<numDOF; i++)
+    trial[i] = committed[i];
+
+  double *incr = theData + IncrDisp*numDOF;
+  for (int i=0; i<2*numDOF; i++)
+    incr[i] = 0.0;
+
+  if (theDynamicData != 0) {
+    trial = this->getBlock(TrialVel);
+    committed = this->getBlock(CommitVel);
+    for (int i=0; i<numDOF; i++)
+      trial[i] = committed[i];
+
+    trial = this->getBlock(TrialAccel);
+    committed = this->getBlock(CommitAccel);
+    for (int i=0; i<numDOF; i++)
+      trial[i] = committed[i];
+  }
+
+  int numOther = (int)otherNodes.size();
+  for (int i=0; i<numOther; i++)
+    otherNodes[i]->revertToLastCommit();
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef NodalStateStore_h
+#define NodalStateStore_h
+
+// Description: This file contains the class definition for NodalStateStore.
+// A NodalStateStore holds the trial, committed and incremental nodal
+// kinematics of all the nodes of a Domain in contiguous arrays, one array
+// per quantity (structure of arrays); a node has the same slot, in the
+// order the nodes were packed, in every array. Once packed the Node
+// objects keep their Vector interface but the Vectors are views into the
+// store, so that the domain commit and revert are single loops over the
+// whole arrays instead of a walk over the nodes.
+//
+// As a Node creates its velocity and acceleration only when they are
+// first used, the velocity and acceleration arrays are only allocated
+// when a node of the store has them, at the pack or later when one asks
+// for them; until then getBlock() returns 0 for them.
+//
+// The store is packed by the Domain on the first commit and unpacked,
+// giving each Node its own storage back, whenever a node is added to or
+// removed from the domain.
+
+#include <vector>
+
+class Node;
+class NodeIter;
+
+class NodalStateStore
+{
+  public:
+    enum {TrialDisp, CommitDisp, IncrDisp, IncrDeltaDisp,
+	  TrialVel, CommitVel, TrialAccel, CommitAccel, NumBlocks};
+
+    NodalStateStore();
+    ~NodalStateStore();
+
+    int pack(NodeIter &theNodes);
+    void unpack(void);
+    bool isPacked(void) const {return packed;}
+
+    // invoked by the Node destructor on a node still in the store
+    void removeNode(int slot);
+
+    // invoked by a Node in the store that needs its velocity or
+    // acceleration, gives every node of the store both
+    int createDynamic(void);
+
+    int commit(void);
+    int revertToLastCommit(void);
+
+    int getNumDOF(void) const {return numDOF;}
+    double *getBlock(int block);
+
+    // ndf of the nodes if every node of the domain is in the store with
+    // the same ndf, so that a block is a numNodes x ndf array in the order
+    // the nodes were packed, -1 otherwise
+    int getUniformNDF(void) const {return uniformNDF;}
+
+  private:
+    double *theData;          // the displacement arrays
+    double *theDynamicData;   // the velocity and acceleration arrays or 0
+    int numDOF;
+    int uniformNDF;
+    bool packed;
+
+    std::vector<Node *> theNodes;    // nodes in the store, by slot
+    std::vector<int> theLocs;        // start of each slot in the blocks
+    std::vector<Node *> otherNodes;  // nodes held by another store
+};
+
+#endif
@@ -32,6 +32,7 @@
 // What: "@(#) Node.h, revA"
    
 #include <Node.h>
+#include <NodalStateStore.h>
 #include <stdlib.h>
 
 #include <Element.h>
@@ -190,7 +191,8 @@ Node::Node(int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0), 
  incrDeltaDisp(0),
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0)
 {
@@ -213,7 +215,8 @@ Node::Node(int tag, int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0)
 {
@@ -236,7 +239,8 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0)
 {
@@ -295,7 +299,8 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0)
 {
@@ -356,7 +361,8 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0)
 {
@@ -418,7 +424,8 @@ Node::Node(const Node &otherNode, bool copyMass)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), dispCommit(0), dispIncr(0), dispIncrDelta(0),
+ velCommit(0), accelCommit(0), theStateStore(0), stateSlot(-1), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
    reaction(0), displayLocation(0)
 {
@@ -446,8 +453,12 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for displacement\n";
       exit(-1);
     }
-    for (int i=0; i<4*numberDOF; i++)
+    for (int i=0; i<numberDOF; i++) {
       disp[i] = otherNode.disp[i];
+      dispCommit[i] = otherNode.dispCommit[i];
+      dispIncr[i] = otherNode.dispIncr[i];
+      dispIncrDelta[i] = otherNode.dispIncrDelta[i];
+    }
   }    
   
   if (otherNode.commitVel != 0) {
@@ -455,8 +466,10 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for velocity\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
+    for (int i=0; i<numberDOF; i++) {
       vel[i] = otherNode.vel[i];
+      velCommit[i] = otherNode.velCommit[i];
+    }
   }    
   
   if (otherNode.commitAccel != 0) {
@@ -464,8 +477,10 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for acceleration\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
+    for (int i=0; i<numberDOF; i++) {
       accel[i] = otherNode.accel[i];
+      accelCommit[i] = otherNode.accelCommit[i];
+    }
   }    
   
   
@@ -561,14 +576,18 @@ Node::~Node()
     if (unbalLoad != 0)
 	delete unbalLoad;
     
-    if (disp != 0)
+    if (theStateStore != 0)
+	theStateStore->removeNode(stateSlot);
+    else {
+      if (disp != 0)
 	delete [] disp;
 
-    if (vel != 0)
+      if (vel != 0)
 	delete [] vel;
 
-    if (accel != 0)
+      if (accel != 0)
 	delete [] accel;
+    }
 
     if (mass != 0)
 	delete mass;
@@ -787,8 +806,8 @@ Node::setTrialDisp(double value, int dof)
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
     double tDisp = value;
-    disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
-    disp[dof+3*numberDOF] = tDisp - disp[dof];	
+    dispIncr[dof] = tDisp - dispCommit[dof];
+    dispIncrDelta[dof] = tDisp - disp[dof];	
     disp[dof] = tDisp;
 
     return 0;
@@ -818,8 +837,8 @@ Node::setTrialDisp(const Vector &newTrialDisp)
     // as we are sure of size and this way is quicker
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
-	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
-	disp[i+3*numberDOF] = tDisp - disp[i];	
+	dispIncr[i] = tDisp - dispCommit[i];
+	dispIncrDelta[i] = tDisp - disp[i];	
 	disp[i] = tDisp;
     }
 
@@ -894,8 +913,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] = incrDispI;
-	  disp[i+2*numberDOF] = incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  dispIncr[i] = incrDispI;
+	  dispIncrDelta[i] = incrDispI;
 	}
 	return 0;
     }
@@ -904,8 +923,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
     for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] += incrDispI;
-	  disp[i+2*numberDOF] += incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  dispIncr[i] += incrDispI;
+	  dispIncrDelta[i] = incrDispI;
     }
 
     return 0;
@@ -1032,9 +1051,22 @@ Node::addInertiaLoadToUnbalance(const Vector &accelG, double fact)
   // form - fact * M*R*accelG and add it to the unbalanced load
   //(*unbalLoad) -= ((*mass) * (*R) * accelG)*fact;
 
-  Matrix MR(mass->noRows(), R->noCols());
-  MR.addMatrixProduct(0.0, *mass, *R, 1.0);
-  unbalLoad->addMatrixVector(1.0, MR, accelG, -fact);
+  // a row of M*R at a time, without forming M*R in a new Matrix on
+  // every call; this is invoked for each node and excitation every step
+  int numCol = R->noCols();
+  for (int i=0; i<numberDOF; i++) {
+    double sum = 0.0;
+    for (int k=0; k<numCol; k++) {
+      double a = accelG(k);
+      if (a == 0.0)
+	continue;
+      double mr = 0.0;
+      for (int j=0; j<numberDOF; j++)
+	mr += (*mass)(i,j) * (*R)(j,k);
+      sum += mr * a;
+    }
+    (*unbalLoad)(i) -= sum * fact;
+  }
 
   return 0;
 }
@@ -1139,22 +1171,22 @@ Node::commitState()
     // check disp exists, if does set commit = trial, incr = 0.0
     if (trialDisp != 0) {
       for (int i=0; i<numberDOF; i++) {
-	disp[i+numberDOF] = disp[i];  
-        disp[i+2*numberDOF] = 0.0;
-        disp[i+3*numberDOF] = 0.0;
+	dispCommit[i] = disp[i];  
+        dispIncr[i] = 0.0;
+        dispIncrDelta[i] = 0.0;
       }
     }		    
     
     // check vel exists, if does set commit = trial    
     if (trialVel != 0) {
       for (int i=0; i<numberDOF; i++)
-	vel[i+numberDOF] = vel[i];
+	velCommit[i] = vel[i];
     }
     
     // check accel exists, if does set commit = trial        
     if (trialAccel != 0) {
       for (int i=0; i<numberDOF; i++)
-	accel[i+numberDOF] = accel[i];
+	accelCommit[i] = accel[i];
     }
 
     // if we get here we are done
@@ -1169,22 +1201,22 @@ Node::revertToLastCommit()
     // check disp exists, if does set trial = last commit, incr = 0
     if (disp != 0) {
       for (int i=0 ; i<numberDOF; i++) {
-	disp[i] = disp[i+numberDOF];
-	disp[i+2*numberDOF] = 0.0;
-	disp[i+3*numberDOF] = 0.0;
+	disp[i] = dispCommit[i];
+	dispIncr[i] = 0.0;
+	dispIncrDelta[i] = 0.0;
       }
     }
     
     // check vel exists, if does set trial = last commit
     if (vel != 0) {
       for (int i=0 ; i<numberDOF; i++)
-	vel[i] = vel[numberDOF+i];
+	vel[i] = velCommit[i];
     }
 
     // check accel exists, if does set trial = last commit
     if (accel != 0) {    
       for (int i=0 ; i<numberDOF; i++)
-	accel[i] = accel[numberDOF+i];
+	accel[i] = accelCommit[i];
     }
 
     // if we get here we are done
@@ -1197,20 +1229,28 @@ Node::revertToStart()
 {
     // check disp exists, if does set all to zero
     if (disp != 0) {
-      for (int i=0 ; i<4*numberDOF; i++)
+      for (int i=0 ; i<numberDOF; i++) {
 	disp[i] = 0.0;
+	dispCommit[i] = 0.0;
+	dispIncr[i] = 0.0;
+	dispIncrDelta[i] = 0.0;
+      }
     }
 
     // check vel exists, if does set all to zero
     if (vel != 0) {
-      for (int i=0 ; i<2*numberDOF; i++)
+      for (int i=0 ; i<numberDOF; i++) {
 	vel[i] = 0.0;
+	velCommit[i] = 0.0;
+      }
     }
 
     // check accel exists, if does set all to zero
     if (accel != 0) {    
-      for (int i=0 ; i<2*numberDOF; i++)
+      for (int i=0 ; i<numberDOF; i++) {
 	accel[i] = 0.0;
+	accelCommit[i] = 0.0;
+      }
     }
     
     if (unbalLoad != 0) 
@@ -1625,7 +1665,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantities equal to committed
       for (int i=0; i<numberDOF; i++)
-	disp[i] = disp[i+numberDOF];  // set trial equal commited
+	disp[i] = dispCommit[i];  // set trial equal commited
 
     } else if (commitDisp != 0) {
       // if going back to initial we will just zero the vectors
@@ -1647,7 +1687,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
-	vel[i] = vel[i+numberDOF];  // set trial equal commited
+	vel[i] = velCommit[i];  // set trial equal commited
     }
 
     if (data(4) == 0) {
@@ -1663,7 +1703,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
       
       // set the trial values
       for (int i=0; i<numberDOF; i++)
-	accel[i] = accel[i+numberDOF];  // set trial equal commited
+	accel[i] = accelCommit[i];  // set trial equal commited
     }
 
     if (data(5) == 0) {
@@ -1846,11 +1886,11 @@ Node::createDisp(void)
   }
   for (int i=0; i<4*numberDOF; i++)
     disp[i] = 0.0;
-    
-  commitDisp = new Vector(&disp[numberDOF], numberDOF); 
-  trialDisp = new Vector(disp, numberDOF);
-  incrDisp = new Vector(&disp[2*numberDOF], numberDOF);
-  incrDeltaDisp = new Vector(&disp[3*numberDOF], numberDOF);
+
+  dispCommit = &disp[numberDOF];
+  dispIncr = &disp[2*numberDOF];
+  dispIncrDelta = &disp[3*numberDOF];
+  this->bindDisp();
   
   if (commitDisp == 0 || trialDisp == 0 || incrDisp == 0 || incrDeltaDisp == 0) {
     opserr << "WARNING - Node::createDisp() " <<
@@ -1865,6 +1905,9 @@ Node::createDisp(void)
 int
 Node::createVel(void)
 {
+    if (theStateStore != 0)
+      return theStateStore->createDynamic();
+
     vel = new double[2*numberDOF];
     
     if (vel == 0) {
@@ -1873,9 +1916,9 @@ Node::createVel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
       vel[i] = 0.0;
-    
-    commitVel = new Vector(&vel[numberDOF], numberDOF); 
-    trialVel = new Vector(vel, numberDOF);
+
+    velCommit = &vel[numberDOF];
+    this->bindVel();
     
     if (commitVel == 0 || trialVel == 0) {
       opserr << "WARNING - Node::createVel() %s" <<
@@ -1889,6 +1932,9 @@ Node::createVel(void)
 int
 Node::createAccel(void)
 {
+    if (theStateStore != 0)
+      return theStateStore->createDynamic();
+
     accel = new double[2*numberDOF];
     
     if (accel == 0) {
@@ -1897,9 +1943,9 @@ Node::createAccel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
 	accel[i] = 0.0;
-    
-    commitAccel = new Vector(&accel[numberDOF], numberDOF);
-    trialAccel = new Vector(accel, numberDOF);
+
+    accelCommit = &accel[numberDOF];
+    this->bindAccel();
     
     if (commitAccel == 0 || trialAccel == 0) {
       opserr << "WARNING - Node::createAccel() ran out of memory creating Vectors(double *,int)\n";
@@ -1910,6 +1956,164 @@ Node::createAccel(void)
 }
 
 
+// bindDisp(), bindVel() and bindAccel():
+// private methods to create the Vector objects on the current arrays or,
+// if they already exist, to point them at the current arrays.
+
+void
+Node::bindDisp(void)
+{
+  if (trialDisp == 0) {
+    commitDisp = new Vector(dispCommit, numberDOF); 
+    trialDisp = new Vector(disp, numberDOF);
+    incrDisp = new Vector(dispIncr, numberDOF);
+    incrDeltaDisp = new Vector(dispIncrDelta, numberDOF);
+  } else {
+    commitDisp->setData(dispCommit, numberDOF);
+    trialDisp->setData(disp, numberDOF);
+    incrDisp->setData(dispIncr, numberDOF);
+    incrDeltaDisp->setData(dispIncrDelta, numberDOF);
+  }
+}
+
+void
+Node::bindVel(void)
+{
+  if (trialVel == 0) {
+    commitVel = new Vector(velCommit, numberDOF); 
+    trialVel = new Vector(vel, numberDOF);
+  } else {
+    commitVel->setData(velCommit, numberDOF);
+    trialVel->setData(vel, numberDOF);
+  }
+}
+
+void
+Node::bindAccel(void)
+{
+  if (trialAccel == 0) {
+    commitAccel = new Vector(accelCommit, numberDOF); 
+    trialAccel = new Vector(accel, numberDOF);
+  } else {
+    commitAccel->setData(accelCommit, numberDOF);
+    trialAccel->setData(accel, numberDOF);
+  }
+}
+
+
+// setStateStorage(), setDynamicStorage() and releaseStateStorage():
+// move the nodal kinematics into the slots of a NodalStateStore, creating
+// the displacement arrays if they do not yet exist, and back into arrays
+// owned by the node. The velocity and acceleration are only moved when
+// the store has blocks for them (blocks[TrialVel] != 0).
+
+int
+Node::setStateStorage(NodalStateStore *theStore, int slot, double **blocks)
+{
+  if (theStateStore != 0) {
+    opserr << "WARNING - Node::setStateStorage() - node " << this->getTag() << " already in a store\n";
+    return -1;
+  }
+
+  if (disp == 0 && this->createDisp() < 0)
+    return -2;
+
+  double *own = disp;
+  for (int i=0; i<numberDOF; i++) {
+    blocks[NodalStateStore::TrialDisp][i] = disp[i];
+    blocks[NodalStateStore::CommitDisp][i] = dispCommit[i];
+    blocks[NodalStateStore::IncrDisp][i] = dispIncr[i];
+    blocks[NodalStateStore::IncrDeltaDisp][i] = dispIncrDelta[i];
+  }
+
+  disp = blocks[NodalStateStore::TrialDisp];
+  dispCommit = blocks[NodalStateStore::CommitDisp];
+  dispIncr = blocks[NodalStateStore::IncrDisp];
+  dispIncrDelta = blocks[NodalStateStore::IncrDeltaDisp];
+
+  this->bindDisp();
+
+  delete [] own;
+
+  if (blocks[NodalStateStore::TrialVel] != 0)
+    this->setDynamicStorage(blocks);
+
+  theStateStore = theStore;
+  stateSlot = slot;
+
+  return 0;
+}
+
+int
+Node::setDynamicStorage(double **blocks)
+{
+  // arrays owned by the node, if it has created them
+  double *ownVel = vel;
+  double *ownAccel = accel;
+
+  for (int i=0; i<numberDOF; i++) {
+    blocks[NodalStateStore::TrialVel][i] = (vel != 0) ? vel[i] : 0.0;
+    blocks[NodalStateStore::CommitVel][i] = (vel != 0) ? velCommit[i] : 0.0;
+    blocks[NodalStateStore::TrialAccel][i] = (accel != 0) ? accel[i] : 0.0;
+    blocks[NodalStateStore::CommitAccel][i] = (accel != 0) ? accelCommit[i] : 0.0;
+  }
+
+  vel = blocks[NodalStateStore::TrialVel];
+  velCommit = blocks[NodalStateStore::CommitVel];
+  accel = blocks[NodalStateStore::TrialAccel];
+  accelCommit = blocks[NodalStateStore::CommitAccel];
+
+  this->bindVel();
+  this->bindAccel();
+
+  if (ownVel != 0)
+    delete [] ownVel;
+  if (ownAccel != 0)
+    delete [] ownAccel;
+
+  return 0;
+}
+
+int
+Node::releaseStateStorage(void)
+{
+  if (theStateStore == 0)
+    return 0;
+
+  double *stored[8] = {disp, dispCommit, dispIncr, dispIncrDelta,
+		       vel, velCommit, accel, accelCommit};
+
+  theStateStore = 0;
+  stateSlot = -1;
+
+  if (this->createDisp() < 0)
+    return -1;
+
+  for (int i=0; i<numberDOF; i++) {
+    disp[i] = stored[0][i];
+    dispCommit[i] = stored[1][i];
+    dispIncr[i] = stored[2][i];
+    dispIncrDelta[i] = stored[3][i];
+  }
+
+  // the velocity and acceleration only if the store had them
+  if (stored[4] == 0)
+    return 0;
+
+  if (this->createVel() < 0 || this->createAccel() < 0)
+    return -1;
+
+  for (int i=0; i<numberDOF; i++) {
+    vel[i] = stored[4][i];
+    velCommit[i] = stored[5][i];
+    accel[i] = stored[6][i];
+    accelCommit[i] = stored[7][i];
+  }
+
+  return 0;
+}
+
+
 // AddingSensitivity:BEGIN ///////////////////////////////////////
 
 Matrix
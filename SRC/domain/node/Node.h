@@ -49,6 +49,7 @@ class Renderer;
 
 class DOF_Group;
 class NodalThermalAction; //L.Jiang [ SIF ]
+class NodalStateStore;
 
 class Node : public DomainComponent
 {
@@ -108,6 +109,14 @@ class Node : public DomainComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // public methods to hold the nodal kinematics in a NodalStateStore,
+    // blocks are the slots of the node in each of the store arrays
+    int setStateStorage(NodalStateStore *theStore, int slot, double **blocks);
+    int setDynamicStorage(double **blocks);
+    int releaseStateStorage(void);
+    bool hasDynamicState(void) const {return vel != 0 || accel != 0;}
+    NodalStateStore *getStateStore(void) const {return theStateStore;}
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void);
     virtual int setMass(const Matrix &theMass);
@@ -173,6 +182,9 @@ class Node : public DomainComponent
     int createDisp(void);
     int createVel(void);
     int createAccel(void); 
+    void bindDisp(void);
+    void bindVel(void);
+    void bindAccel(void);
 
     // private data associated with each node object
     int numberDOF;                    // number of dof at Node
@@ -186,6 +198,10 @@ class Node : public DomainComponent
     
     double *disp, *vel, *accel; // double arrays holding the displ, 
                                 // vel and accel values
+    double *dispCommit, *dispIncr, *dispIncrDelta; // views into disp,
+    double *velCommit, *accelCommit;               // vel and accel
+    NodalStateStore *theStateStore;   // store holding the arrays, 0 if own
+    int stateSlot;
 
     int dbTag1, dbTag2, dbTag3, dbTag4; // needed for database
     Matrix *R;                          // nodal participation matrix
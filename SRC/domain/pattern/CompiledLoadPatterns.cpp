@@ -0,0 +1,208 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// CompiledLoadPatterns.
+
+#include <CompiledLoadPatterns.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
+#include <classTags.h>
+#include <OPS_Globals.h>
+#include <algorithm>
+
+namespace {
+  struct CompiledNodalLoad {
+    int segment;
+    Node *theNode;
+    const Vector *theLoad;
+    int slot;
+    bool operator<(const CompiledNodalLoad &other) const {
+      if (segment != other.segment)
+	return segment < other.segment;
+      return theNode < other.theNode;
+    }
+  };
+}
+
+CompiledLoadPatterns::CompiledLoadPatterns()
+  :compiled(false)
+{
+
+}
+
+CompiledLoadPatterns::~CompiledLoadPatterns()
+{
+
+}
+
+bool
+CompiledLoadPatterns::isCurrent(Domain &theDomain)
+{
+  if (compiled == false)
+    return false;
+
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatternIter = theDomain.getLoadPatterns();
+  std::size_t i = 0;
+  while ((thePattern = thePatternIter()) != 0) {
+    if (i >= thePatterns.size() || thePatterns[i] != thePattern ||
+	patternGeoTags[i] != thePattern->getCurrentGeoTag())
+      return false;
+    i++;
+  }
+
+  return i == thePatterns.size();
+}
+
+int
+CompiledLoadPatterns::compile(Domain &theDomain)
+{
+  thePatterns.clear();
+  patternGeoTags.clear();
+  isPlain.clear();
+  segmentPatterns.clear();
+  segmentNodes.clear();
+  theNodes.clear();
+  nodeStart.clear();
+  theLoads.clear();
+  factorSlot.clear();
+
+  std::vector<CompiledNodalLoad> entries;
+  int segment = 0;
+  segmentPatterns.push_back(0);
+
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatternIter = theDomain.getLoadPatterns();
+  while ((thePattern = thePatternIter()) != 0) {
+    int slot = (int)thePatterns.size();
+    thePatterns.push_back(thePattern);
+    patternGeoTags.push_back(thePattern->getCurrentGeoTag());
+
+    // a pattern is only compiled if all its nodal loads are plain ones
+    bool plain = thePattern->canCompileNodalLoads();
+    std::size_t first = entries.size();
+    NodalLoad *theLoad;
+    NodalLoadIter &theLoadIter = thePattern->getNodalLoads();
+    while (plain == true && (theLoad = theLoadIter()) != 0) {
+      if (theLoad->getClassTag() != LOAD_TAG_NodalLoad) {
+	plain = false;
+	break;
+      }
+      const Vector *theVector = theLoad->getLoadVector();
+      Node *theNode = theDomain.getNode(theLoad->getNodeTag());
+      if (theNode == 0) {
+	opserr << "WARNING CompiledLoadPatterns::compile() - No associated Node node ";
+	opserr << " for NodalLoad " << *theLoad;
+	continue;
+      }
+      if (theVector == 0)
+	continue;
+      CompiledNodalLoad entry;
+      entry.segment = segment;
+      entry.theNode = theNode;
+      entry.theLoad = theVector;
+      entry.slot = theLoad->isLoadConstant() ? -1 : slot;
+      entries.push_back(entry);
+    }
+
+    if (plain == false)
+      entries.resize(first);
+    isPlain.push_back(plain ? 1 : 0);
+
+    // a pattern applying its own loads closes the segment
+    if (plain == false) {
+      segmentPatterns.push_back(slot+1);
+      segment++;
+    }
+  }
+
+  int numPatterns = (int)thePatterns.size();
+  if (segmentPatterns.back() != numPatterns) {
+    segmentPatterns.push_back(numPatterns);
+    segment++;
+  }
+
+  // the constant loads use the last slot
+  factors.assign(numPatterns+1, 0.0);
+  factors[numPatterns] = 1.0;
+
+  // group by segment and node keeping the pattern order of the loads on
+  // each node, so that the loads are summed in the same order as pattern
+  // by pattern
+  std::stable_sort(entries.begin(), entries.end());
+
+  theLoads.reserve(entries.size());
+  factorSlot.reserve(entries.size());
+  std::size_t next = 0;
+  for (int k=0; k<segment; k++) {
+    segmentNodes.push_back((int)theNodes.size());
+    for (; next<entries.size() && entries[next].segment == k; next++) {
+      if (next == 0 || entries[next].theNode != entries[next-1].theNode ||
+	  entries[next].segment != entries[next-1].segment) {
+	theNodes.push_back(entries[next].theNode);
+	nodeStart.push_back((int)next);
+      }
+      theLoads.push_back(entries[next].theLoad);
+      factorSlot.push_back(entries[next].slot < 0 ? numPatterns : entries[next].slot);
+    }
+  }
+  segmentNodes.push_back((int)theNodes.size());
+  nodeStart.push_back((int)entries.size());
+
+  compiled = true;
+  return 0;
+}
+
+void
+CompiledLoadPatterns::applyLoad(Domain &theDomain, double pseudoTime)
+{
+  if (this->isCurrent(theDomain) == false)
+    this->compile(theDomain);
+
+  // the load factors first, the nodal loads of the plain patterns of a
+  // segment are then added in one pass over its nodes
+  int numPatterns = (int)thePatterns.size();
+  for (int i=0; i<numPatterns; i++)
+    if (isPlain[i] != 0)
+      factors[i] = thePatterns[i]->formLoadFactor(pseudoTime);
+
+  int numSegments = (int)segmentPatterns.size() - 1;
+  for (int k=0; k<numSegments; k++) {
+    for (int i=segmentNodes[k]; i<segmentNodes[k+1]; i++) {
+      Node *theNode = theNodes[i];
+      for (int j=nodeStart[i]; j<nodeStart[i+1]; j++)
+	theNode->addUnbalancedLoad(*theLoads[j], factors[factorSlot[j]]);
+    }
+
+    // then the rest of the loads of the segment, pattern by pattern,
+    // ending with the pattern that applies its own loads
+    for (int i=segmentPatterns[k]; i<segmentPatterns[k+1]; i++)
+      if (isPlain[i] != 0)
+	thePatterns[i]->applyNonNodalLoads();
+      else
+	thePatterns[i]->applyLoad(pseudoTime);
+  }
+}
@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef CompiledLoadPatterns_h
+#define CompiledLoadPatterns_h
+
+// Description: This file contains the class definition for
+// CompiledLoadPatterns. It applies the load patterns of a Domain with the
+// nodal loads of the plain patterns gathered into lists sorted by node,
+// each entry holding the node, the reference load and the slot of the
+// load factor it is scaled by. A step then evaluates one factor per
+// pattern and runs a single pass over the nodes of each list, instead of
+// visiting every NodalLoad of every pattern through the iterators.
+//
+// Elemental loads, SP_Constraints and patterns with their own applyLoad()
+// (excitations, MultiSupportPattern, ...) are applied as before. A
+// pattern with its own applyLoad() ends a segment: the plain patterns
+// before it are compiled into one list that is applied before it, so the
+// loads on every node are summed in the same order as pattern by pattern
+// and the unbalanced loads are the same to the last bit. The lists are
+// rebuilt when the set of patterns or the loads of a pattern change,
+// which is checked on every step from the pattern geometry tags.
+
+#include <vector>
+
+class Domain;
+class Node;
+class Vector;
+class LoadPattern;
+
+class CompiledLoadPatterns
+{
+  public:
+    CompiledLoadPatterns();
+    ~CompiledLoadPatterns();
+
+    void applyLoad(Domain &theDomain, double pseudoTime);
+    void invalidate(void) {compiled = false;}
+
+  private:
+    int compile(Domain &theDomain);
+    bool isCurrent(Domain &theDomain);
+
+  private:
+    bool compiled;
+
+    // all patterns of the domain in iteration order and their tags when
+    // compiled; isPlain marks those whose nodal loads are in the list
+    std::vector<LoadPattern *> thePatterns;
+    std::vector<int> patternGeoTags;
+    std::vector<char> isPlain;
+
+    // one slot per pattern plus a last slot fixed to 1.0 for the loads
+    // that are independent of the load factor
+    std::vector<double> factors;
+
+    // segment k holds the patterns segmentPatterns[k] to
+    // segmentPatterns[k+1]-1, at most the last of which is not plain, and
+    // the nodes segmentNodes[k] to segmentNodes[k+1]-1
+    std::vector<int> segmentPatterns;
+    std::vector<int> segmentNodes;
+
+    // nodal loads grouped by segment and node: the loads of theNodes[i]
+    // are the entries nodeStart[i] to nodeStart[i+1]-1, in pattern order
+    std::vector<Node *> theNodes;
+    std::vector<int> nodeStart;
+    std::vector<const Vector *> theLoads;
+    std::vector<int> factorSlot;
+};
+
+#endif
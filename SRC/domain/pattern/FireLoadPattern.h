@@ -57,6 +57,7 @@ class FireLoadPattern : public LoadPattern
     FireLoadPattern(int tag, int classTag);
     
     void applyLoad(double time);
+    bool canCompileNodalLoads(void) {return false;}
 	
     bool addSP_Constraint(SP_Constraint *);
 
@@ -402,17 +402,39 @@ void
 LoadPattern::applyLoad(double pseudoTime)
 {
   // first determine the load factor
-  if (theSeries != 0 && isConstant != 0) {
-    loadFactor = theSeries->getFactor(pseudoTime);
-    loadFactor *= scaleFactor;
-  }
+  this->formLoadFactor(pseudoTime);
 
   NodalLoad *nodLoad;
   NodalLoadIter &theNodalIter = this->getNodalLoads();
 
   while ((nodLoad = theNodalIter()) != 0)
     nodLoad->applyLoad(loadFactor);
-    
+
+  this->applyNonNodalLoads();
+}
+
+bool
+LoadPattern::canCompileNodalLoads(void)
+{
+  // subclasses with their own applyLoad() pass their own class tag
+  return this->getClassTag() == PATTERN_TAG_LoadPattern;
+}
+
+double
+LoadPattern::formLoadFactor(double pseudoTime)
+{
+  // the factor is kept fixed once setLoadConstant() has been called
+  if (theSeries != 0 && isConstant != 0) {
+    loadFactor = theSeries->getFactor(pseudoTime);
+    loadFactor *= scaleFactor;
+  }
+
+  return loadFactor;
+}
+
+void
+LoadPattern::applyNonNodalLoads(void)
+{
   ElementalLoad *eleLoad;
   ElementalLoadIter &theElementalIter = this->getElementalLoads();
   while ((eleLoad = theElementalIter()) != 0)
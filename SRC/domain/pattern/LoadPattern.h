@@ -87,6 +87,14 @@ class LoadPattern : public DomainComponent
 	virtual void unsetLoadConstant(void);
     virtual double getLoadFactor(void);
 
+    // used by CompiledLoadPatterns: true if applyLoad() is the one of this
+    // class, so the nodal loads can be applied in bulk by the Domain, in
+    // which case the Domain sets the load factor and applies the rest
+    virtual bool canCompileNodalLoads(void);
+    double formLoadFactor(double pseudoTime);
+    void applyNonNodalLoads(void);
+    int getCurrentGeoTag(void) const {return currentGeoTag;}
+
     // methods for o/p
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -36,15 +36,11 @@
 #include <Channel.h>
 #include <math.h>
 
-#include <fstream>
-using std::ifstream;
-
-#include <iomanip>
-using std::ios;
-
 #include <PathTimeSeries.h>
+#include <RecordFileReader.h>
 #include <elementAPI.h>
 #include <string>
+#include <vector>
 
 void* OPS_PathSeries()
 {
@@ -269,63 +265,39 @@ PathSeries::PathSeries(int tag,
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
    otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
 {
-  // determine the number of data points .. open file and count num entries
-  int numDataPoints = 0;
-  double dataPoint;
-
-  ifstream theFile;
-  theFile.open(fileName);
+  // read the file once, the values are kept in the record cache if set
+  std::vector<double> data;
+  int numDataPoints = OPS_ReadRecordFile(fileName, data);
 
-  if (theFile.bad() || !theFile.is_open()) {
+  if (numDataPoints < 0) {
     opserr << "WARNING - PathSeries::PathSeries()";
     opserr << " - could not open file " << fileName << endln;
-  } else {
-    while (theFile >> dataPoint)
-      numDataPoints++;
-  }   
-  theFile.close();
+  }
 
-  // create a vector and read in the data
-  if (numDataPoints != 0) {
+  // create a vector and copy in the data
+  else if (numDataPoints != 0) {
 
     // increment size if we need to prepend a zero value
+    int offset = 0;
     if (prependZero == true)
-      numDataPoints++;
-    
-    // first open the file
-    ifstream theFile1;
-    theFile1.open(fileName, ios::in);
-    if (theFile1.bad() || !theFile1.is_open()) {
-      opserr << "WARNING - PathSeries::PathSeries()";
-      opserr << " - could not open file " << fileName << endln;
-    } else {
-
-      // now create the vector
-      thePath = new Vector(numDataPoints);
-
-      // ensure we did not run out of memory
-      if (thePath == 0 || thePath->Size() == 0) {
-	opserr << "PathSeries::PathSeries() - ran out of memory constructing";
-	opserr << " a Vector of size: " << numDataPoints << endln;
-
-	if (thePath != 0)
-	  delete thePath;
-	thePath = 0;
-      }
+      offset = 1;
 
-      // read the data from the file
-      else {
-	int count = 0;
-    if (prependZero == true)
-      count++;
-	while (theFile1 >> dataPoint) {
-	  (*thePath)(count) = dataPoint;
-	  count++;
-	}
-      }
+    // now create the vector
+    thePath = new Vector(numDataPoints + offset);
+
+    // ensure we did not run out of memory
+    if (thePath == 0 || thePath->Size() == 0) {
+      opserr << "PathSeries::PathSeries() - ran out of memory constructing";
+      opserr << " a Vector of size: " << numDataPoints + offset << endln;
+
+      if (thePath != 0)
+	delete thePath;
+      thePath = 0;
+    }
 
-      // finally close the file
-      theFile1.close();
+    else {
+      for (int i = 0; i < numDataPoints; i++)
+	(*thePath)(i + offset) = data[i];
     }
   }
 }
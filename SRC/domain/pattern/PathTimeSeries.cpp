@@ -38,13 +38,10 @@
 #include <PathTimeSeries.h>
 #include <Vector.h>
 #include <Channel.h>
+#include <RecordFileReader.h>
 #include <math.h>
-
-#include <fstream>
-using std::ifstream;
-
-#include <iomanip>
-using std::ios;
+#include <vector>
+#include <algorithm>
 
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
@@ -99,101 +96,48 @@ PathTimeSeries::PathTimeSeries(int tag,
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
    useLast(last)
 {
-  // determine the number of data points
-  int numDataPoints1 =0;
-  int numDataPoints2 =0;
-  double dataPoint;
-  ifstream theFile;
-  
-  // first open and go through file containing path
-  theFile.open(filePathName, ios::in);
-  if (theFile.bad() || !theFile.is_open()) {
+  // read each file once, the values are kept in the record cache if set
+  std::vector<double> pathData, timeData;
+  int numDataPoints1 = OPS_ReadRecordFile(filePathName, pathData);
+  if (numDataPoints1 < 0) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << filePathName << endln;
-  } else {
-    while (theFile >> dataPoint)
-      numDataPoints1++;
-  }   
-  theFile.close();
-
-  // now open and go through file containing time
-  ifstream theFile1;
-  theFile1.open(fileTimeName, ios::in);
-  if (theFile1.bad() || !theFile1.is_open()) {
+    numDataPoints1 = 0;
+  }
+
+  int numDataPoints2 = OPS_ReadRecordFile(fileTimeName, timeData);
+  if (numDataPoints2 < 0) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << fileTimeName << endln;
-  } else {
-    while (theFile1 >> dataPoint)
-      numDataPoints2++;
-  }   
-  theFile1.close();
+    numDataPoints2 = 0;
+  }
 
   // check number of data entries in both are the same
   if (numDataPoints1 != numDataPoints2) {
     opserr << "WARNING PathTimeSeries::PathTimeSeries() - files containing data ";
     opserr << "points for path and time do not contain same number of points\n";
-  } else {
+  } else if (numDataPoints1 != 0) {
 
+    // now create the two vector
+    thePath = new Vector(numDataPoints1);
+    time = new Vector(numDataPoints1);
 
-    // create a vector and read in the data
-    if (numDataPoints1 != 0) {
-
-      // now create the two vector
-      thePath = new Vector(numDataPoints1);
-      time = new Vector(numDataPoints1);
-
-      // ensure did not run out of memory creating copies
-      if (thePath == 0 || thePath->Size() == 0 ||
-	  time == 0 || time->Size() == 0) {
-	  
-        opserr << "WARNING PathTimeSeries::PathTimeSeries() - out of memory\n ";
-	if (thePath != 0)
-	  delete thePath;
-	if (time != 0)
-	  delete time;
-	thePath = 0;
-	time = 0;
-      }
-      
-      // first open the path file and read in the data
-      ifstream theFile2;
-      theFile2.open(filePathName, ios::in);
-      if (theFile2.bad() || !theFile2.is_open()) {
-	opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-	opserr << " - could not open file " << filePathName << endln;
+    // ensure did not run out of memory creating copies
+    if (thePath == 0 || thePath->Size() == 0 ||
+	time == 0 || time->Size() == 0) {
+
+      opserr << "WARNING PathTimeSeries::PathTimeSeries() - out of memory\n ";
+      if (thePath != 0)
 	delete thePath;
+      if (time != 0)
 	delete time;
-	thePath = 0;
-	time =0;
-      } else { // read in the path data and then do the time
-	int count = 0;
-	while (theFile2 >> dataPoint) {
-	  (*thePath)(count) = dataPoint;
-	  count++;
-	}
-
-	// finally close the file
-	theFile2.close();
-
-	// now open the time file and read in the data
-	ifstream theFile3;
-	theFile3.open(fileTimeName, ios::in);
-	if (theFile3.bad() || !theFile3.is_open()) {
-	  opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-	  opserr << " - could not open file " << fileTimeName << endln;
-	  delete thePath;
-	  delete time;
-	  thePath = 0;
-	  time =0;
-	} else { // read in the data
-	  int count = 0;
-	  while (theFile3 >> dataPoint) {
-	    (*time)(count) = dataPoint;
-	    count++;
-	  }
-	  theFile3.close();
-	} // read in the data 
-      }   // read in the path data and then do the time
+      thePath = 0;
+      time = 0;
+    } else {
+      for (int i = 0; i < numDataPoints1; i++) {
+	(*thePath)(i) = pathData[i];
+	(*time)(i) = timeData[i];
+      }
     }
   }
 }
@@ -206,22 +150,13 @@ PathTimeSeries::PathTimeSeries(int tag,
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastChannel(0), useLast(last)
 {
-  // determine the number of data points
-  int numDataPoints = 0;
-  double dataPoint;
-  ifstream theFile;
-  
-  // first open and go through file counting entries
-  theFile.open(fileName, ios::in);
-  if (theFile.bad() || !theFile.is_open()) {
+  // read the file once, the values are kept in the record cache if set
+  std::vector<double> data;
+  int numDataPoints = OPS_ReadRecordFile(fileName, data);
+  if (numDataPoints < 0) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << fileName << endln;
-  }
-  else {
-    while (theFile >> dataPoint) {
-      numDataPoints++;
-      theFile >> dataPoint;	// Read in second value of pair
-    }
+    numDataPoints = 0;
   }
 
   if ((numDataPoints % 2) != 0) {
@@ -230,10 +165,7 @@ PathTimeSeries::PathTimeSeries(int tag,
     numDataPoints--;
   }
 
-
-  theFile.close();
-
-  // create a vector and read in the data
+  // create a vector and copy in the data
   if (numDataPoints != 0) {
     
     // now create the two vector
@@ -251,32 +183,12 @@ PathTimeSeries::PathTimeSeries(int tag,
       thePath = 0;
       time = 0;
     }
-    
-    // first open the file and read in the data
-    ifstream theFile1;
-    theFile1.open(fileName, ios::in);
-    if (theFile1.bad() || !theFile1.is_open()) {
-      
-      opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-      opserr << " - could not open file " << fileName << endln;
-      delete thePath;
-      delete time;
-      thePath = 0;
-      time =0;
-    }
-    else { // read in the time and then read the value
-      int count = 0;
-      while (theFile1 >> dataPoint) {
-	(*time)(count) = dataPoint;
-	theFile1 >> dataPoint;
-	(*thePath)(count) = dataPoint;
-
-	count++;
+    else { // the time and then the value of each point
+      for (int i = 0; i < numDataPoints/2; i++) {
+	(*time)(i) = data[2*i];
+	(*thePath)(i) = data[2*i+1];
       }
-      
-      // finally close the file
-      theFile1.close();
-    } 
+    }
   }
 }
 
@@ -329,14 +241,20 @@ PathTimeSeries::getFactor(double pseudoTime)
       return cFactor*(*thePath)[sizem1];
   }
 
-  // otherwise go find the current interval
-  double time2 = (*time)(currentTimeLoc+1);
+  // otherwise go find the current interval, it is usually the next one
+  // and is otherwise searched for from the current location
+  const double *times = &(*time)(0);
+  double time2 = times[currentTimeLoc+1];
   if (pseudoTime > time2) {
-    while ((pseudoTime > time2) && (currentTimeLoc < sizem2)) {
+    if (currentTimeLoc < sizem2 && pseudoTime > times[currentTimeLoc+2]) {
+      // first time point at or after pseudoTime ends the interval
+      int end = std::lower_bound(times+currentTimeLoc+2, times+size, pseudoTime) - times;
+      currentTimeLoc = (end-1 < sizem2) ? end-1 : sizem2;
+    } else if (currentTimeLoc < sizem2)
       currentTimeLoc++;
-      time1 = time2;
-      time2 = (*time)(currentTimeLoc+1);
-    }
+    time1 = times[currentTimeLoc];
+    time2 = times[currentTimeLoc+1];
+
     // if pseudo time greater than ending time return 0
     if (pseudoTime > time2) {
       if (useLast == false)
@@ -346,11 +264,12 @@ PathTimeSeries::getFactor(double pseudoTime)
     }
 
   } else if (pseudoTime < time1) {
-    while ((pseudoTime < time1) && (currentTimeLoc > 0)) {
-      currentTimeLoc--;
-      time2 = time1;	
-      time1 = (*time)(currentTimeLoc);
-    }
+    // last time point at or before pseudoTime starts the interval
+    int start = std::upper_bound(times, times+currentTimeLoc, pseudoTime) - times;
+    currentTimeLoc = (start > 0) ? start-1 : 0;
+    time1 = times[currentTimeLoc];
+    time2 = times[currentTimeLoc+1];
+
     // if starting time less than initial starting time return 0
     if (pseudoTime < time1)
       return 0.0;
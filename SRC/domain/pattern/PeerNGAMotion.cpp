@@ -36,7 +36,10 @@
 #include <PeerNGAMotion.h>
 #include <Vector.h>
 #include <Channel.h>
+#include <RecordFileReader.h>
 #include <math.h>
+#include <string>
+#include <vector>
 
 #include <stdio.h>
 #include <time.h>
@@ -142,6 +145,10 @@ PeerNGAMotion::PeerNGAMotion(int tag,
     return;
   }
 
+  // a record downloaded before is kept in the record cache if set
+  if (this->readCache(peerPage) == 0)
+    return;
+
   if (httpGet("peer.berkeley.edu",peerPage,80,&eqData) != 0) {
     if (httpGet("peer.berkeley.edu",peerPage,80,&eqData) != 0) {
       opserr << "PeerNGAMotion::PeerNGAMotion() - could not connect to PEER Database, ";
@@ -194,8 +201,8 @@ PeerNGAMotion::PeerNGAMotion(int tag,
   }
   
   free(eqData);
-  
-  // create copies of the vectors
+
+  this->writeCache(peerPage);
 }
 
 
@@ -224,6 +231,10 @@ PeerNGAMotion::PeerNGAMotion(int tag,
     return;
   }
   
+  // a record downloaded before is kept in the record cache if set
+  if (this->readCache(peerPage) == 0)
+    return;
+
   if (httpGet("peer.berkeley.edu",peerPage,80,&eqData) != 0) {
     opserr << "PeerNGAMotion::PeerNGAMotion() - could not connect to PEER Database, ";
     return; 
@@ -262,8 +273,8 @@ PeerNGAMotion::PeerNGAMotion(int tag,
   }
     
   free(eqData);
-  
-  // create copies of the vectors
+
+  this->writeCache(peerPage);
 }
 
 PeerNGAMotion::PeerNGAMotion(int tag,
@@ -279,6 +290,42 @@ PeerNGAMotion::PeerNGAMotion(int tag,
 }
 
 
+int
+PeerNGAMotion::readCache(const char *peerPage)
+{
+  // the time step followed by the points of the record
+  std::vector<double> data;
+  std::string key = std::string("PeerNGAMotion ") + peerPage;
+  if (OPS_ReadRecordCache(key.c_str(), data) < 2)
+    return -1;
+
+  int nPts = (int)data.size()-1;
+  dT = data[0];
+  thePath = new Vector(nPts);
+  for (int i=0; i<nPts; i++)
+    (*thePath)(i) = data[i+1];
+
+  return 0;
+}
+
+
+int
+PeerNGAMotion::writeCache(const char *peerPage)
+{
+  if (thePath == 0 || thePath->Size() == 0)
+    return -1;
+
+  int nPts = thePath->Size();
+  std::vector<double> data(nPts+1);
+  data[0] = dT;
+  for (int i=0; i<nPts; i++)
+    data[i+1] = (*thePath)(i);
+
+  std::string key = std::string("PeerNGAMotion ") + peerPage;
+  return OPS_WriteRecordCache(key.c_str(), data);
+}
+
+
 TimeSeries *
 PeerNGAMotion::getCopy(void) 
 {
@@ -88,6 +88,10 @@ class PeerNGAMotion : public TimeSeries
 		double cFactor);
   
  private:
+  // the record of a page kept in the record cache, if one is set
+  int readCache(const char *peerPage);
+  int writeCache(const char *peerPage);
+
   Vector *thePath;      // vector containg the data points
   double dT;
   int currentTimeLoc;   // current location in time
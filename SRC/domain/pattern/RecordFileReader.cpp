@@ -0,0 +1,422 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of the record file
+// reader and cache used by the path series.
+
+#include <RecordFileReader.h>
+#include <OPS_Globals.h>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+// the cache directory, taken from OPS_RECORD_CACHE until set
+static std::string theCacheDir;
+static bool cacheDirSet = false;
+
+static const char recordCacheMagic[8] = {'O','P','S','R','E','C','0','1'};
+
+// the powers of ten that are exact doubles, a mantissa below 2^53
+// multiplied or divided by one of them is correctly rounded
+static const double exactPowers[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline bool
+isSpace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+static inline bool
+isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+// converts the number starting at p, returns the position after it or p
+// if there is no number there; values the fast path cannot convert
+// exactly are handed to strtod
+static const char *
+parseNumber(const char *p, const char *end, double &value)
+{
+  const char *start = p;
+  bool negative = false;
+  if (p < end && (*p == '+' || *p == '-')) {
+    negative = (*p == '-');
+    p++;
+  }
+
+  unsigned long long mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool anyDigits = false;
+  bool exact = true;
+
+  while (p < end && isDigit(*p)) {
+    anyDigits = true;
+    if (numDigits < 19) {
+      mantissa = mantissa*10 + (*p - '0');
+      if (mantissa != 0)
+	numDigits++;
+    } else {
+      exponent++;
+      if (*p != '0')
+	exact = false;
+    }
+    p++;
+  }
+
+  if (p < end && *p == '.') {
+    p++;
+    while (p < end && isDigit(*p)) {
+      anyDigits = true;
+      if (numDigits < 19) {
+	mantissa = mantissa*10 + (*p - '0');
+	if (mantissa != 0)
+	  numDigits++;
+	exponent--;
+      } else if (*p != '0')
+	exact = false;
+      p++;
+    }
+  }
+
+  if (anyDigits == false)
+    return start;
+
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char *q = p+1;
+    bool negativeExp = false;
+    if (q < end && (*q == '+' || *q == '-')) {
+      negativeExp = (*q == '-');
+      q++;
+    }
+    if (q < end && isDigit(*q)) {
+      int e = 0;
+      while (q < end && isDigit(*q)) {
+	if (e < 100000)
+	  e = e*10 + (*q - '0');
+	q++;
+      }
+      exponent += negativeExp ? -e : e;
+      p = q;
+    }
+  }
+
+  if (mantissa == 0 && exact == true) {
+    value = negative ? -0.0 : 0.0;
+  } else if (exact == true && mantissa <= (1ULL << 53) &&
+	     exponent >= -22 && exponent <= 22) {
+    value = (double)mantissa;
+    if (exponent < 0)
+      value /= exactPowers[-exponent];
+    else
+      value *= exactPowers[exponent];
+    if (negative)
+      value = -value;
+  } else {
+    std::string number(start, p - start);
+    value = strtod(number.c_str(), 0);
+  }
+
+  return p;
+}
+
+static int
+parseRecord(const char *p, const char *end, std::vector<double> &data)
+{
+  data.clear();
+  data.reserve((end - p)/12 + 1);
+
+  while (true) {
+    while (p < end && isSpace(*p))
+      p++;
+    if (p == end)
+      break;
+
+    double value;
+    const char *next = parseNumber(p, end, value);
+    if (next == p)
+      break;
+    data.push_back(value);
+    p = next;
+  }
+
+  return (int)data.size();
+}
+
+static int
+readTextFile(const char *fileName, std::vector<double> &data)
+{
+  data.clear();
+
+#ifndef _WIN32
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return -1;
+  }
+  if (st.st_size == 0) {
+    close(fd);
+    return 0;
+  }
+
+  void *theMap = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (theMap != MAP_FAILED) {
+    const char *text = (const char *)theMap;
+    int num = parseRecord(text, text + st.st_size, data);
+    munmap(theMap, st.st_size);
+    return num;
+  }
+#endif
+
+  // read the whole file at once
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0)
+    return -1;
+
+  fseek(theFile, 0, SEEK_END);
+  long size = ftell(theFile);
+  fseek(theFile, 0, SEEK_SET);
+
+  std::vector<char> buffer(size + 1);
+  if (size > 0 && fread(&buffer[0], 1, size, theFile) != (size_t)size) {
+    fclose(theFile);
+    return -1;
+  }
+  fclose(theFile);
+
+  return parseRecord(&buffer[0], &buffer[0] + size, data);
+}
+
+static const std::string &
+getCacheDir(void)
+{
+  if (cacheDirSet == false) {
+    const char *dirName = getenv("OPS_RECORD_CACHE");
+    OPS_SetRecordCache(dirName);
+  }
+  return theCacheDir;
+}
+
+static std::string
+getCacheFileName(const std::string &key)
+{
+  // FNV-1a hash of the key, the key itself is stored to catch collisions
+  unsigned long long hash = 14695981039346656037ULL;
+  for (std::size_t i=0; i<key.size(); i++) {
+    hash ^= (unsigned char)key[i];
+    hash *= 1099511628211ULL;
+  }
+
+  char name[40];
+  sprintf(name, "/%016llx.rec", hash);
+  return getCacheDir() + name;
+}
+
+static std::string
+getFileKey(const char *fileName, const struct stat &st)
+{
+  char fullName[4096];
+#ifdef _WIN32
+  if (_fullpath(fullName, fileName, sizeof(fullName)) == 0)
+#else
+  if (realpath(fileName, fullName) == 0)
+#endif
+    return std::string();
+
+  // the modification time to the nanosecond where the system keeps it, so
+  // that a file rewritten within the same second gets a new key
+#if defined(_WIN32)
+  long long nsec = 0;
+#elif defined(__APPLE__)
+  long long nsec = (long long)st.st_mtimespec.tv_nsec;
+#else
+  long long nsec = (long long)st.st_mtim.tv_nsec;
+#endif
+
+  char stamp[96];
+  sprintf(stamp, " %lld %lld.%09lld", (long long)st.st_size, (long long)st.st_mtime, nsec);
+  return std::string("file ") + fullName + stamp;
+}
+
+void
+OPS_SetRecordCache(const char *dirName)
+{
+  cacheDirSet = true;
+  theCacheDir.clear();
+  if (dirName == 0 || dirName[0] == '\0')
+    return;
+
+  theCacheDir = dirName;
+  while (theCacheDir.size() > 1 &&
+	 (theCacheDir[theCacheDir.size()-1] == '/' || theCacheDir[theCacheDir.size()-1] == '\\'))
+    theCacheDir.erase(theCacheDir.size()-1);
+
+  // the directory may already be there
+#ifdef _WIN32
+  _mkdir(theCacheDir.c_str());
+#else
+  mkdir(theCacheDir.c_str(), 0777);
+#endif
+}
+
+const char *
+OPS_GetRecordCache(void)
+{
+  return getCacheDir().c_str();
+}
+
+int
+OPS_ReadRecordCache(const char *key, std::vector<double> &data)
+{
+  data.clear();
+  if (key == 0 || getCacheDir().empty())
+    return -1;
+
+  FILE *theFile = fopen(getCacheFileName(key).c_str(), "rb");
+  if (theFile == 0)
+    return -1;
+
+  std::size_t keyLength = strlen(key);
+  char magic[8];
+  unsigned long long header[2];
+  bool ok = fread(magic, 1, 8, theFile) == 8 &&
+    memcmp(magic, recordCacheMagic, 8) == 0 &&
+    fread(header, sizeof(unsigned long long), 2, theFile) == 2 &&
+    header[0] == keyLength;
+
+  if (ok == true) {
+    std::string storedKey(keyLength, '\0');
+    ok = (keyLength == 0 || fread(&storedKey[0], 1, keyLength, theFile) == keyLength) &&
+      storedKey == key;
+  }
+
+  // the count must match what is left of the file before anything is
+  // allocated for it, a damaged or truncated file is a miss
+  if (ok == true) {
+    long start = ftell(theFile);
+    ok = start >= 0 && fseek(theFile, 0, SEEK_END) == 0;
+    long end = ok ? ftell(theFile) : -1;
+    ok = ok && end >= start && fseek(theFile, start, SEEK_SET) == 0 &&
+      header[1] == (unsigned long long)(end - start) / sizeof(double) &&
+      (unsigned long long)(end - start) % sizeof(double) == 0;
+  }
+
+  if (ok == true) {
+    data.resize(header[1]);
+    ok = header[1] == 0 ||
+      fread(&data[0], sizeof(double), header[1], theFile) == header[1];
+  }
+  fclose(theFile);
+
+  if (ok == false) {
+    data.clear();
+    return -1;
+  }
+
+  return (int)data.size();
+}
+
+int
+OPS_WriteRecordCache(const char *key, const std::vector<double> &data)
+{
+  if (key == 0 || getCacheDir().empty())
+    return -1;
+
+  std::string fileName = getCacheFileName(key);
+
+  // written under a name of its own and renamed, so another process
+  // never reads a partial file
+  char suffix[32];
+#ifdef _WIN32
+  sprintf(suffix, ".%d.tmp", (int)_getpid());
+#else
+  sprintf(suffix, ".%d.tmp", (int)getpid());
+#endif
+  std::string tmpName = fileName + suffix;
+
+  FILE *theFile = fopen(tmpName.c_str(), "wb");
+  if (theFile == 0)
+    return -1;
+
+  std::size_t keyLength = strlen(key);
+  unsigned long long header[2];
+  header[0] = keyLength;
+  header[1] = data.size();
+  bool ok = fwrite(recordCacheMagic, 1, 8, theFile) == 8 &&
+    fwrite(header, sizeof(unsigned long long), 2, theFile) == 2 &&
+    fwrite(key, 1, keyLength, theFile) == keyLength &&
+    (data.size() == 0 ||
+     fwrite(&data[0], sizeof(double), data.size(), theFile) == data.size());
+  if (fclose(theFile) != 0)
+    ok = false;
+
+  if (ok == false || rename(tmpName.c_str(), fileName.c_str()) != 0) {
+    // another process may have written the same record already
+    remove(tmpName.c_str());
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+OPS_ReadRecordFile(const char *fileName, std::vector<double> &data)
+{
+  data.clear();
+
+  std::string key;
+  if (getCacheDir().empty() == false) {
+    struct stat st;
+    if (stat(fileName, &st) == 0)
+      key = getFileKey(fileName, st);
+    if (key.empty() == false && OPS_ReadRecordCache(key.c_str(), data) >= 0)
+      return (int)data.size();
+  }
+
+  int num = readTextFile(fileName, data);
+  if (num < 0)
+    return -1;
+
+  if (key.empty() == false)
+    OPS_WriteRecordCache(key.c_str(), data);
+
+  return num;
+}
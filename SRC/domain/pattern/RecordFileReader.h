@@ -0,0 +1,49 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef RecordFileReader_h
+#define RecordFileReader_h
+
+// Description: This file contains the functions used by the path series
+// to read their record files. A text file is mapped and its numbers are
+// converted in one pass; as with ifstream >> reading stops at the first
+// entry that is not a number. When a cache directory is set the values
+// are also kept there as a binary file named from the path, size and
+// modification time of the record, so later runs and other processes
+// reading the same record skip the conversion. The cache file is written
+// to a temporary name and renamed, so concurrent readers never see a
+// partial file.
+
+#include <vector>
+
+// reads the values of a text record file, returns their number or -1 if
+// the file could not be read
+int OPS_ReadRecordFile(const char *fileName, std::vector<double> &data);
+
+// values stored under a key that is not a local file (a downloaded record),
+// returns the number of values or -1 if not in the cache
+int OPS_ReadRecordCache(const char *key, std::vector<double> &data);
+int OPS_WriteRecordCache(const char *key, const std::vector<double> &data);
+
+// 0 or an empty name switches the cache off
+void OPS_SetRecordCache(const char *dirName);
+const char *OPS_GetRecordCache(void);
+
+#endif
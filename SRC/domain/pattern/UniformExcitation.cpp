@@ -46,6 +46,8 @@
 
 void* OPS_TimeSeriesIntegrator();
 
+UniformExcitation *UniformExcitation::lastRWriter = 0;
+
 void* OPS_UniformExcitationPattern()
 {
     if (OPS_GetNumRemainingInputArgs() < 2) {
@@ -190,7 +192,8 @@ void* OPS_UniformExcitationPattern()
 
 UniformExcitation::UniformExcitation()
 :EarthquakePattern(0, PATTERN_TAG_UniformExcitation), 
- theMotion(0), theDof(0), vel0(0.0), fact(0.0)
+ theMotion(0), theDof(0), vel0(0.0), fact(0.0),
+ lastRStamp(-1), lastRFact(0.0)
 {
 
 }
@@ -199,7 +202,8 @@ UniformExcitation::UniformExcitation()
 UniformExcitation::UniformExcitation(GroundMotion &_theMotion, 
 				     int dof, int tag, double velZero, double theFactor)
 :EarthquakePattern(tag, PATTERN_TAG_UniformExcitation), 
- theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(theFactor)
+ theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(theFactor),
+ lastRStamp(-1), lastRFact(0.0)
 {
   // add the motion to the list of ground motions
   this->addMotion(*theMotion);
@@ -208,6 +212,8 @@ UniformExcitation::UniformExcitation(GroundMotion &_theMotion,
 
 UniformExcitation::~UniformExcitation()
 {
+  if (lastRWriter == this)
+    lastRWriter = 0;
 
 }
 
@@ -218,6 +224,32 @@ UniformExcitation::getGroundMotion(void)
   return theMotion;
 }
 
+double
+UniformExcitation::getGroundAccel(double time)
+{
+  if (theMotion == 0)
+    return 0.0;
+
+  return theMotion->getAccel(time);
+}
+
+int
+UniformExcitation::setGroundMotion(GroundMotion &newMotion)
+{
+  if (theMotion == 0)
+    return this->addMotion(newMotion);
+
+  // the pattern owns its motion, replace it in the list and delete it
+  for (int i=0; i<numMotions; i++)
+    if (theMotions[i] == theMotion)
+      theMotions[i] = &newMotion;
+
+  delete theMotion;
+  theMotion = &newMotion;
+
+  return 0;
+}
+
 int
 UniformExcitation::setParameter(const char **argv, int argc, Parameter &param)
 {
@@ -285,6 +317,15 @@ UniformExcitation::applyLoad(double time)
     Domain *theDomain = this->getDomain();
     if (theDomain == 0)
         return;
+
+    // the R set on the last step still holds for a translational dof
+    int stamp = theDomain->getDomainChangeStamp();
+    if (lastRWriter == this && lastRStamp == stamp && lastRFact == fact) {
+        this->EarthquakePattern::applyLoad(time);
+        return;
+    }
+
+    bool coordinateFree = true;
     
     NodeIter &theNodes = theDomain->getNodes();
     Node *theNode;
@@ -303,6 +344,7 @@ UniformExcitation::applyLoad(double time)
             else if (theDof == 2) {
                 double xCrd = crds(0);
                 double yCrd = crds(1);
+                coordinateFree = false;
                 theNode->setR(0, 0, -fact*yCrd);
                 theNode->setR(1, 0, fact*xCrd);
                 theNode->setR(2, 0, fact);
@@ -315,6 +357,7 @@ UniformExcitation::applyLoad(double time)
             else if (theDof == 3) {
                 double yCrd = crds(1);
                 double zCrd = crds(2);
+                coordinateFree = false;
                 theNode->setR(1, 0, -fact*zCrd);
                 theNode->setR(2, 0, fact*yCrd);
                 theNode->setR(3, 0, fact);
@@ -322,6 +365,7 @@ UniformExcitation::applyLoad(double time)
             else if (theDof == 4) {
                 double xCrd = crds(0);
                 double zCrd = crds(2);
+                coordinateFree = false;
                 theNode->setR(0, 0, fact*zCrd);
                 theNode->setR(2, 0, -fact*xCrd);
                 theNode->setR(4, 0, fact);
@@ -329,12 +373,20 @@ UniformExcitation::applyLoad(double time)
             else if (theDof == 5) {
                 double xCrd = crds(0);
                 double yCrd = crds(1);
+                coordinateFree = false;
                 theNode->setR(0, 0, -fact*yCrd);
                 theNode->setR(1, 0, fact*xCrd);
                 theNode->setR(5, 0, fact);
             }
         }
     }
+
+    if (coordinateFree == true) {
+        lastRWriter = this;
+        lastRStamp = stamp;
+        lastRFact = fact;
+    } else
+        lastRWriter = 0;
     
     this->EarthquakePattern::applyLoad(time);
     
@@ -356,6 +408,7 @@ UniformExcitation::applyLoadSensitivity(double time)
       theNode->setNumColR(1);
       theNode->setR(theDof, 0, 1.0);
     }
+    lastRWriter = 0;
 //  }
 
   this->EarthquakePattern::applyLoadSensitivity(time);
@@ -62,6 +62,11 @@ class UniformExcitation : public EarthquakePattern
     // AddingSensitivity:END ///////////////////////////////////
     
     const GroundMotion *getGroundMotion(void);
+    double getGroundAccel(double time);
+
+    // replaces the motion without changing the domain, so an analysis
+    // keeps its numbering and system of equations
+    int setGroundMotion(GroundMotion &theMotion);
     
  protected:
     
@@ -70,6 +75,13 @@ class UniformExcitation : public EarthquakePattern
     int theDof;      // the dof corrseponding to the ground motion
     double vel0;     // the initial velocity, should be neg of ug dot(0)
     double fact;
+
+    // the R matrices of the nodes are only rewritten if another excitation
+    // has set them since, the domain has changed or they depend on the
+    // nodal coordinates (rotational dof)
+    static UniformExcitation *lastRWriter;
+    int lastRStamp;
+    double lastRFact;
 };
 
 #endif
@@ -307,6 +307,7 @@ MeshRegion::setRayleighDampingFactors(double alpham, double betak, double betak0
 	theEle->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
   }
+  theDomain->propertiesChanged();
 
   if (theNodes != 0) {
     for (int i=0; i<theNodes->Size(); i++) {
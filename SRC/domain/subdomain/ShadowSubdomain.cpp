@@ -546,6 +546,9 @@ ShadowSubdomain::removeElement(int tag)
 	Element *theEle = theObjectBroker->getNewElement(theType);
 	if (theEle != 0) 
 	    this->recvObject(*theEle);
+
+	// once the actor has answered, so the messages do not cross
+	this->elementRemoved(tag);
     
 	return theEle;
     }
@@ -1196,6 +1199,13 @@ ShadowSubdomain::getDomainChangeFlag(void)
 }
 
 
+// the actor and the buffers are only brought up to date by a full change
+void
+ShadowSubdomain::elementRemoved(int tag)
+{
+    this->domainChange();
+}
+
 void
 ShadowSubdomain::domainChange(void)
 {
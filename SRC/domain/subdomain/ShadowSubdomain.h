@@ -179,7 +179,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int calculateNodalReactions(bool inclInertia);
     
   protected:    
-
+    virtual void elementRemoved(int tag);
 
     virtual int buildMap(void);
     virtual int buildEleGraph(Graph *theEleGraph);
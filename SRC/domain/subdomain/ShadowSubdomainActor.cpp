@@ -35,6 +35,7 @@
 #include <TCP_Socket.h>
 // #include <TCP_SocketNoDelay.h>
 #include <UDP_Socket.h>
+#include <SharedMemoryChannel.h>
 #include <SocketAddress.h>
 #include <Message.h>
 
@@ -53,6 +54,11 @@ int main(int argv, char **argc)
 	int port = atoi(argc[3]);	
 	theChannel = new TCP_Socket(port,machine);
     }
+    else if (channelType == 4) {
+	char *machine = argc[2];    	
+	int port = atoi(argc[3]);	
+	theChannel = new SharedMemoryChannel(port,machine);
+    }
     //    else if (channelType == 2) {
     //	char *machine = argc[2];    	
     //	int port = atoi(argc[3]);	    
@@ -194,6 +194,7 @@ Subdomain::addNode(Node * node)
   bool result = internalNodes->addComponent(node);
   if (result == true) {
       node->setDomain(this);
+      this->nodesChanged();
       this->domainChange();    
   }
 
@@ -225,6 +226,7 @@ Subdomain::addExternalNode(Node *thePtr)
     if (result == true) {
       //	result = realExternalNodes->addComponent(thePtr);
 	newDummy->setDomain(this);
+	this->nodesChanged();
 	this->domainChange();    
     }
     
@@ -243,12 +245,14 @@ Subdomain::removeNode(int tag)
         //	  Node *dummy = (Node *)object;
 	//	  object = realExternalNodes->removeComponent(tag);      	  
 	Node *result = (Node *)object;
+	this->nodesChanged();
 	this->domainChange();          
 	//	  delete dummy;
 	return result;	  
       }
   }
   else {
+      this->nodesChanged();
       this->domainChange();          
       Node *result = (Node *)object;
       return result;	  
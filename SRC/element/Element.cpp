@@ -407,6 +407,12 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isLinear(void)
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
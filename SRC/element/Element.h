@@ -66,6 +66,9 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+    // true if the stiffness, damping and mass matrices do not depend on
+    // the state of the element, e.g. linear elastic and small displacement
+    virtual bool isLinear(void);
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
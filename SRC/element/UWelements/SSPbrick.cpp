@@ -398,6 +398,12 @@ SSPbrick::revertToStart(void)
 	return theMaterial->revertToStart();
 }
 
+bool
+SSPbrick::isLinear(void)
+{
+	return theMaterial->isLinear();
+}
+
 int
 SSPbrick::update(void)
 // this function updates variables for an incremental step n to n+1
@@ -64,6 +64,7 @@ class SSPbrick : public Element
 	int commitState(void);
 	int revertToLastCommit(void);
 	int revertToStart(void);
+	bool isLinear(void);
 	int update(void);
 
 	// public methods to obtain stiffness, mass, damping, and residual info
@@ -38,6 +38,7 @@
 #include <Information.h>
 #include <ElementResponse.h>
 #include <TCP_Socket.h>
+#include <SharedMemoryChannel.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -47,10 +48,11 @@
 // responsible for allocating the necessary space needed
 // by each object and storing the tags of the end nodes.
 Adapter::Adapter(int tag, ID nodes, ID *dof,
-    const Matrix &_kb, int ipport, int addRay, const Matrix *_mb)
+    const Matrix &_kb, int ipport, int addRay, const Matrix *_mb, int _shm)
     : Element(tag, ELE_TAG_Adapter),
     connectedExternalNodes(nodes), basicDOF(1), numExternalNodes(0),
-    numDOF(0), numBasicDOF(0), kb(_kb), ipPort(ipport), addRayleigh(addRay),
+    numDOF(0), numBasicDOF(0), kb(_kb), ipPort(ipport), shm(_shm),
+    addRayleigh(addRay),
     mb(0), tPast(0.0), theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -102,7 +104,7 @@ Adapter::Adapter(int tag, ID nodes, ID *dof,
 Adapter::Adapter()
     : Element(0, ELE_TAG_Adapter),
     connectedExternalNodes(1), basicDOF(1), numExternalNodes(0),
-    numDOF(0), numBasicDOF(0), kb(1,1), ipPort(0), addRayleigh(0), mb(0),
+    numDOF(0), numBasicDOF(0), kb(1,1), ipPort(0), shm(0), addRayleigh(0), mb(0),
     tPast(0.0), theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -502,7 +504,7 @@ const Vector& Adapter::getResistingForceIncInertia()
 int Adapter::sendSelf(int commitTag, Channel &sChannel)
 {
     // send element parameters
-    static Vector data(9);
+    static Vector data(10);
     data(0) = this->getTag();
     data(1) = numExternalNodes;
     data(2) = ipPort;
@@ -512,6 +514,7 @@ int Adapter::sendSelf(int commitTag, Channel &sChannel)
     data(6) = betaK;
     data(7) = betaK0;
     data(8) = betaKc;
+    data(9) = shm;
     sChannel.sendVector(0, commitTag, data);
     
     // send the end nodes and dofs
@@ -540,7 +543,7 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
         delete mb;
     
     // receive element parameters
-    static Vector data(9);
+    static Vector data(10);
     rChannel.recvVector(0, commitTag, data);
     this->setTag((int)data(0));
     numExternalNodes = (int)data(1);
@@ -550,6 +553,7 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
     betaK = data(6);
     betaK0 = data(7);
     betaKc = data(8);
+    shm = (int)data(9);
     
     // initialize nodes and receive them
     connectedExternalNodes.resize(numExternalNodes);
@@ -674,6 +678,8 @@ void Adapter::Print(OPS_Stream &s, int flag)
         s << endln;
         s << "  kb: " << kb << endln;
         s << "  ipPort: " << ipPort << endln;
+        if (shm)
+            s << "  channel: shared memory" << endln;
         s << "  addRayleigh: " << addRayleigh << endln;
         if (mb != 0)
             s << "  mb: " << *mb << endln;
@@ -882,7 +888,10 @@ int Adapter::getResponse(int responseID, Information &eleInformation)
 int Adapter::setupConnection()
 {
     // setup the connection
-    theChannel = new TCP_Socket(ipPort);
+    if (shm)
+        theChannel = new SharedMemoryChannel(ipPort);
+    else
+        theChannel = new TCP_Socket(ipPort);
     if (theChannel != 0) {
         opserr << "\nChannel successfully created: "
             << "Waiting for ECSimAdapter experimental control...\n";
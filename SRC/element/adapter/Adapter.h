@@ -64,7 +64,7 @@ public:
     // constructors
     Adapter(int tag, ID nodes, ID *dof,
         const Matrix &stif, int ipPort,
-        int addRayleigh = 0, const Matrix *mass = 0);
+        int addRayleigh = 0, const Matrix *mass = 0, int shm = 0);
     Adapter();
     
     // destructor
@@ -124,6 +124,7 @@ private:
     
     Matrix kb;                  // stiffness matrix in basic system
     int ipPort;                 // ipPort
+    int shm;                    // shared memory channel flag
     int addRayleigh;            // flag to add Rayleigh damping
     Matrix *mb;                 // mass matrix in basic system
     double tPast;               // past time
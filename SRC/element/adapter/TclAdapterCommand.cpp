@@ -54,7 +54,7 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     if ((argc-eleArgStart) < 8) {
         opserr << "WARNING insufficient arguments\n";
         printCommand(argc, argv);
-        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-doRayleigh> <-mass Mij>\n";
+        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-shm> <-doRayleigh> <-mass Mij>\n";
         return TCL_ERROR;
     }
     
@@ -65,6 +65,7 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     int tag, node, dof, ipPort, argi, i, j, k;
     int numNodes = 0, numDOFj = 0, numDOF = 0;
     int doRayleigh = 0;
+    int shm = 0;
     Matrix *mass = 0;
     
     if (Tcl_GetInt(interp, argv[1+eleArgStart], &tag) != TCL_OK) {
@@ -168,10 +169,12 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
         return TCL_ERROR;
     }
     argi++;
-    // get optional rayleigh flag
+    // get optional rayleigh and shared memory flags
     for (int i = argi; i < argc; i++)  {
         if (strcmp(argv[i], "-doRayleigh") == 0)
             doRayleigh = 1;
+        else if (strcmp(argv[i], "-shm") == 0)
+            shm = 1;
     }
     // get optional mass matrix
     for (int i = argi; i < argc; i++) {
@@ -198,9 +201,9 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     
     // now create the adapter and add it to the Domain
     if (mass == 0)
-        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh);
+        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, 0, shm);
     else
-        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, mass);
+        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, mass, shm);
     
     // cleanup dynamic memory
     if (dofs != 0)
@@ -273,6 +273,18 @@ int  Brick::revertToStart( )
   return success ;
 }
 
+
+//linear if all materials are linear
+bool  Brick::isLinear( ) 
+{
+  for ( int i=0; i<8; i++ ) {
+    if ( materialPointers[i]->isLinear( ) == false )
+      return false ;
+  }
+
+  return true ;
+}
+
 //print out element data
 void  Brick::Print(OPS_Stream &s, int flag)
 {
@@ -89,6 +89,7 @@ class Brick : public Element {
     
     //revert to start 
     int revertToStart( ) ;
+    bool isLinear( ) ;
 
     // update
     int update(void);
@@ -351,6 +351,12 @@ ElasticBeam2d::revertToStart()
     return theCoordTransf->revertToStart();
 }
 
+bool
+ElasticBeam2d::isLinear(void)
+{
+    return theCoordTransf->isLinear();
+}
+
 int
 ElasticBeam2d::update(void)
 {
@@ -65,6 +65,7 @@ class ElasticBeam2d : public Element
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isLinear(void);
     
     int update(void);
     const Matrix &getTangentStiff(void);
@@ -360,6 +360,12 @@ ElasticBeam3d::revertToStart()
     return theCoordTransf->revertToStart();
 }
 
+bool
+ElasticBeam3d::isLinear(void)
+{
+    return theCoordTransf->isLinear();
+}
+
 int
 ElasticBeam3d::update(void)
 {
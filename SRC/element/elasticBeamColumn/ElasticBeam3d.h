@@ -71,6 +71,7 @@ class ElasticBeam3d : public Element
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isLinear(void);
     
     int update(void);
     const Matrix &getTangentStiff(void);
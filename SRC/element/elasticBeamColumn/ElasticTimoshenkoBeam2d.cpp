@@ -318,6 +318,12 @@ int ElasticTimoshenkoBeam2d::revertToStart()
 }
 
 
+bool ElasticTimoshenkoBeam2d::isLinear()
+{
+    return (nlGeo == 0 && theCoordTransf->isLinear());
+}
+
+
 int ElasticTimoshenkoBeam2d::update()
 {
     return 0;
@@ -321,6 +321,12 @@ int ElasticTimoshenkoBeam3d::revertToStart()
 }
 
 
+bool ElasticTimoshenkoBeam3d::isLinear()
+{
+    return (nlGeo == 0 && theCoordTransf->isLinear());
+}
+
+
 int ElasticTimoshenkoBeam3d::update()
 {
     return 0;
@@ -64,6 +64,7 @@ public:
     int commitState();
     int revertToLastCommit();
     int revertToStart();
+    bool isLinear();
     int update();
     
     // public methods to obtain stiffness, mass, damping and residual information
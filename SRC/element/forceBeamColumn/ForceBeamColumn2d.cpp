@@ -112,6 +112,7 @@ void* OPS_ForceBeamColumn2d()
     // options
     double mass = 0.0, tol=1e-12;
     int maxIter = 10;
+    bool warm = false;
     numData = 1;
     while(OPS_GetNumRemainingInputArgs() > 0) {
 	const char* type = OPS_GetString();
@@ -133,6 +134,8 @@ void* OPS_ForceBeamColumn2d()
 		    return 0;
 		}
 	    }
+	} else if(strcmp(type,"-warm") == 0) {
+	    warm = true;
 	}
     }
 
@@ -168,7 +171,7 @@ void* OPS_ForceBeamColumn2d()
     }
 
     Element *theEle =  new ForceBeamColumn2d(iData[0],iData[1],iData[2],secTags.Size(),sections,
-					     *bi,*theTransf,mass,maxIter,tol);
+					     *bi,*theTransf,mass,maxIter,tol,warm);
     delete [] sections;
     return theEle;
 }
@@ -272,7 +275,9 @@ ForceBeamColumn2d::ForceBeamColumn2d():
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0), Ssr(0), vscommit(0), 
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), parameterID(0)
+  Ki(0), warmStart(false), dvLast(NEBD), SeCorr(NEBD),
+  numUpdates(0), numLocalIters(0), numSubdivides(0), numFailures(0),
+  parameterID(0)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
@@ -296,7 +301,7 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance, bool warm):
   Element(tag,ELE_TAG_ForceBeamColumn2d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
@@ -305,7 +310,9 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0),Ssr(0), vscommit(0), 
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), parameterID(0)
+  Ki(0), warmStart(warm), dvLast(NEBD), SeCorr(NEBD),
+  numUpdates(0), numLocalIters(0), numSubdivides(0), numFailures(0),
+  parameterID(0)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
@@ -494,6 +501,10 @@ ForceBeamColumn2d::commitState()
   // commit the element variables state
   kvcommit = kv;
   Secommit = Se;
+
+  // the warm start extrapolates within a step only
+  dvLast.Zero();
+  SeCorr.Zero();
   
   //   initialFlag = 0;  fmk - commented out, see what happens to Example3.1.tcl if uncommented
   //                         - i have not a clue why, ask remo if he ever gets in contact with us again!
@@ -528,6 +539,9 @@ int ForceBeamColumn2d::revertToLastCommit()
   // revert the element state to last commit
   Se   = Secommit;
   kv   = kvcommit;
+
+  dvLast.Zero();
+  SeCorr.Zero();
   
   initialFlag = 0;
   // this->update();
@@ -562,6 +576,10 @@ int ForceBeamColumn2d::revertToStart()
   
   Se.Zero();
   kv.Zero();
+
+  dvLast.Zero();
+  SeCorr.Zero();
+  numUpdates = numLocalIters = numSubdivides = numFailures = 0;
   
   initialFlag = 0;
   // this->update();
@@ -809,6 +827,27 @@ ForceBeamColumn2d::update()
   dvToDo = dv;
   dvTrial = dvToDo;
 
+  // dv and the predicted Se for it, kept for the next warm start
+  static Vector dvStart(NEBD);
+  static Vector SePredict(NEBD);
+  double warmFactor = 0.0;
+  if (warmStart) {
+    dvStart = dv;
+    SePredict = Se;
+    SePredict.addMatrixVector(1.0, kv, dv, 1.0);
+
+    double dvLastNorm2 = dvLast ^ dvLast;
+    if (dvLastNorm2 > 0.0) {
+      warmFactor = (dv ^ dvLast)/dvLastNorm2;
+      if (warmFactor < 0.0)
+	warmFactor = 0.0;
+      else if (warmFactor > 1.0)
+	warmFactor = 1.0;
+    }
+  }
+
+  numUpdates++;
+
   static double factor = 10;
 
   maxSubdivisions = 4;
@@ -845,6 +884,12 @@ ForceBeamColumn2d::update()
       dSe.addMatrixVector(0.0, kvTrial, dvTrial, 1.0);
       SeTrial += dSe;
 
+      // warm start on the first newton try of the whole dv only
+      if (warmFactor > 0.0) {
+	SeTrial.addVector(1.0, SeCorr, warmFactor);
+	warmFactor = 0.0;
+      }
+
       if (initialFlag != 2) {
 
 	int numIters = maxIters;
@@ -852,6 +897,9 @@ ForceBeamColumn2d::update()
 	  numIters = 10*maxIters; // allow 10 times more iterations for initial tangent
 	
 	for (j=0; j <numIters; j++) {
+
+	  numLocalIters++;
+
 	  // initialize f and vr for integration
 	  f.Zero();
 	  vr.Zero();
@@ -1114,6 +1162,7 @@ ForceBeamColumn2d::update()
 	    if (j == (numIters-1) && (l == 2)) {
 	      dvTrial /= factor;
 	      numSubdivide++;
+	      numSubdivides++;
 	    }
 	  }
 	} // for (j=0; j<numIters; j++)
@@ -1125,12 +1174,19 @@ ForceBeamColumn2d::update()
   // if fail to converge we return an error flag & print an error message
 
   if (converged == false) {
+    numFailures++;
     opserr << "WARNING - ForceBeamColumn2d::update - failed to get compatible ";
     opserr << "element forces & deformations for element: ";
     opserr << this->getTag() << "(dW: << " << dW << ")\n";
     return -1;
   }
 
+  if (warmStart) {
+    dvLast = dvStart;
+    SeCorr = Se;
+    SeCorr -= SePredict;
+  }
+
   initialFlag = 1;
 
   return 0;
@@ -1592,6 +1648,7 @@ ForceBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
       beamIntegr->setDbTag(beamIntegrDbTag);
   }
   idData(9) = beamIntegrDbTag;
+  idData(10) = (warmStart) ? 1 : 0;
 
   if (theChannel.sendID(dbTag, commitTag, idData) < 0) {
     opserr << "ForceBeamColumn2d::sendSelf() - failed to send ID data\n";
@@ -1714,6 +1771,7 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   connectedExternalNodes(1) = idData(2);
   maxIters = idData(4);
   initialFlag = idData(5);
+  warmStart = (idData(10) == 1) ? true : false;
   
   int crdTransfClassTag = idData(6);
   int crdTransfDbTag = idData(7);
@@ -2488,6 +2546,15 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
     output.tag("ResponseType","Mz_2");
 
     theResponse =  new ElementResponse(this, 13, theVector);
+
+    // local iteration statistics
+  } else if (strcmp(argv[0],"iterationStats") == 0) {
+    output.tag("ResponseType","numUpdates");
+    output.tag("ResponseType","numLocalIters");
+    output.tag("ResponseType","numSubdivides");
+    output.tag("ResponseType","numFailures");
+
+    theResponse = new ElementResponse(this, 20, Vector(4));
   
     // section response -
   } else if (strstr(argv[0],"sectionX") != 0) {
@@ -2601,6 +2668,15 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   else if (responseID == 13)
     return eleInfo.setVector(this->getRayleighDampingForces());
+
+  else if (responseID == 20) {
+    static Vector stats(4);
+    stats(0) = numUpdates;
+    stats(1) = numLocalIters;
+    stats(2) = numSubdivides;
+    stats(3) = numFailures;
+    return eleInfo.setVector(stats);
+  }
   
   else if (responseID == 2) {
     double p0[3]; p0[0] = 0.0; p0[1] = 0.0; p0[2] = 0.0;
@@ -81,7 +81,8 @@ class ForceBeamColumn2d: public Element
 		    int numSections, SectionForceDeformation **sec,
 		    BeamIntegration &beamIntegr,
 		    CrdTransf &coordTransf, double rho = 0.0, 
-		    int maxNumIters = 10, double tolerance = 1.0e-12);
+		    int maxNumIters = 10, double tolerance = 1.0e-12,
+		    bool warmStart = false);
   
   ~ForceBeamColumn2d();
   
@@ -199,6 +200,19 @@ class ForceBeamColumn2d: public Element
 
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
+
+  // warm start of the local iterations: the part of the change in Se
+  // the tangent predictor missed in the last update is added again,
+  // scaled by the projection of dv on the last dv
+  bool   warmStart;
+  Vector dvLast;                 // basic deformation increment of last update
+  Vector SeCorr;                 // converged Se minus predicted Se in last update
+
+  // local iteration statistics, see the iterationStats response
+  int numUpdates;
+  int numLocalIters;
+  int numSubdivides;
+  int numFailures;
   
   static Vector *vsSubdivide;
   static Vector *SsrSubdivide;
@@ -117,6 +117,7 @@ void* OPS_ForceBeamColumn3d()
     // options
     double mass = 0.0, tol=1e-12;
     int maxIter = 10;
+    bool warm = false;
     numData = 1;
     while(OPS_GetNumRemainingInputArgs() > 0) {
 	const char* type = OPS_GetString();
@@ -138,6 +139,8 @@ void* OPS_ForceBeamColumn3d()
 		    return 0;
 		}
 	    }
+	} else if(strcmp(type,"-warm") == 0) {
+	    warm = true;
 	}
     }
 
@@ -172,7 +175,7 @@ void* OPS_ForceBeamColumn3d()
     }
 
     Element *theEle =  new ForceBeamColumn3d(iData[0],iData[1],iData[2],secTags.Size(),sections,
-					     *bi,*theTransf,mass,maxIter,tol);
+					     *bi,*theTransf,mass,maxIter,tol,warm);
     delete [] sections;
     return theEle;
 }
@@ -189,7 +192,9 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0), Ssr(0), vscommit(0),
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), isTorsion(false), parameterID(0)
+  Ki(0), isTorsion(false), warmStart(false), dvLast(NEBD), SeCorr(NEBD),
+  numUpdates(0), numLocalIters(0), numSubdivides(0), numFailures(0),
+  parameterID(0)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
@@ -213,7 +218,7 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance, bool warm):
   Element(tag,ELE_TAG_ForceBeamColumn3d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
@@ -222,7 +227,9 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0),Ssr(0), vscommit(0),
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0), 
-  Ki(0), isTorsion(false), parameterID(0)
+  Ki(0), isTorsion(false), warmStart(warm), dvLast(NEBD), SeCorr(NEBD),
+  numUpdates(0), numLocalIters(0), numSubdivides(0), numFailures(0),
+  parameterID(0)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
@@ -411,6 +418,10 @@ ForceBeamColumn3d::commitState()
   // commit the element variables state
   kvcommit = kv;
   Secommit = Se;
+
+  // the warm start extrapolates within a step only
+  dvLast.Zero();
+  SeCorr.Zero();
   
   //   initialFlag = 0;  fmk - commented out, see what happens to Example3.1.tcl if uncommented
   //                         - i have not a clue why, ask remo if he ever gets in contact with us again!
@@ -445,6 +456,9 @@ int ForceBeamColumn3d::revertToLastCommit()
   // revert the element state to last commit
   Se   = Secommit;
   kv   = kvcommit;
+
+  dvLast.Zero();
+  SeCorr.Zero();
   
   initialFlag = 0;
   // this->update();
@@ -479,6 +493,10 @@ int ForceBeamColumn3d::revertToStart()
   
   Se.Zero();
   kv.Zero();
+
+  dvLast.Zero();
+  SeCorr.Zero();
+  numUpdates = numLocalIters = numSubdivides = numFailures = 0;
   
   initialFlag = 0;
   // this->update();
@@ -723,6 +741,27 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
     dvToDo = dv;
     dvTrial = dvToDo;
 
+    // dv and the predicted Se for it, kept for the next warm start
+    static Vector dvStart(NEBD);
+    static Vector SePredict(NEBD);
+    double warmFactor = 0.0;
+    if (warmStart) {
+      dvStart = dv;
+      SePredict = Se;
+      SePredict.addMatrixVector(1.0, kv, dv, 1.0);
+
+      double dvLastNorm2 = dvLast ^ dvLast;
+      if (dvLastNorm2 > 0.0) {
+	warmFactor = (dv ^ dvLast)/dvLastNorm2;
+	if (warmFactor < 0.0)
+	  warmFactor = 0.0;
+	else if (warmFactor > 1.0)
+	  warmFactor = 1.0;
+      }
+    }
+
+    numUpdates++;
+
     static double factor = 10;
     double dW0 = 0.0;
 
@@ -760,6 +799,12 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	dSe.addMatrixVector(0.0, kvTrial, dvTrial, 1.0);
 	SeTrial += dSe;
 
+	// warm start on the first newton try of the whole dv only
+	if (warmFactor > 0.0) {
+	  SeTrial.addVector(1.0, SeCorr, warmFactor);
+	  warmFactor = 0.0;
+	}
+
 	if (initialFlag != 2) {
 
 	  int numIters = maxIters;
@@ -768,6 +813,8 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 
 	  for (j=0; j <numIters; j++) {
 
+	    numLocalIters++;
+
 	    // initialize f and vr for integration
 	    f.Zero();
 	    vr.Zero();
@@ -1109,6 +1156,7 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	      if (j == (numIters-1) && (l == 2)) {
 		dvTrial /= factor;
 		numSubdivide++;
+		numSubdivides++;
 	      }
 	    }
 
@@ -1120,6 +1168,7 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
     // if fail to converge we return an error flag & print an error message
 
     if (converged == false) {
+      numFailures++;
       opserr << "WARNING - ForceBeamColumn3d::update - failed to get compatible ";
       opserr << "element forces & deformations for element: ";
       opserr << this->getTag() << "(dW: << " << dW << ", dW0: " << dW0 << ")\n";
@@ -1137,6 +1186,12 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
       return -1;
     }
 
+    if (warmStart) {
+      dvLast = dvStart;
+      SeCorr = Se;
+      SeCorr -= SePredict;
+    }
+
     initialFlag = 1;
 
     return 0;
@@ -1603,6 +1658,8 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     idData(4) = maxIters;
     idData(5) = initialFlag;
     idData(6) = (isTorsion) ? 1 : 0;
+    if (warmStart)
+      idData(6) += 2;
 
     idData(7) = crdTransf->getClassTag();
     int crdTransfDbTag  = crdTransf->getDbTag();
@@ -1745,7 +1802,8 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     connectedExternalNodes(1) = idData(2);
     maxIters = idData(4);
     initialFlag = idData(5);
-    isTorsion = (idData(6) == 1) ? true : false;
+    isTorsion = (idData(6) & 1) ? true : false;
+    warmStart = (idData(6) & 2) ? true : false;
 
     int crdTransfClassTag = idData(7);
     int crdTransfDbTag = idData(8);
@@ -2609,6 +2667,15 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
       theResponse = new ElementResponse(this, 12, theVector);
 
+      // local iteration statistics
+    } else if (strcmp(argv[0],"iterationStats") == 0) {
+      output.tag("ResponseType","numUpdates");
+      output.tag("ResponseType","numLocalIters");
+      output.tag("ResponseType","numSubdivides");
+      output.tag("ResponseType","numFailures");
+
+      theResponse = new ElementResponse(this, 20, Vector(4));
+
     } else if (strcmp(argv[0],"sections") ==0) { 
       CompositeResponse *theCResponse = new CompositeResponse();
       int numResponse = 0;
@@ -2758,6 +2825,15 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     return eleInfo.setVector(vp);
   }
 
+  else if (responseID == 20) {
+    static Vector stats(4);
+    stats(0) = numUpdates;
+    stats(1) = numLocalIters;
+    stats(2) = numSubdivides;
+    stats(3) = numFailures;
+    return eleInfo.setVector(stats);
+  }
+
   else if (responseID == 12)
     return eleInfo.setVector(this->getRayleighDampingForces());
 
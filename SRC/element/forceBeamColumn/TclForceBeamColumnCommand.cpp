@@ -267,6 +267,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       
     int numIter = 10;
     double tol = 1.0e-12;
+    bool warm = false;
     double mass = 0.0;
     int cMass = 0;
     BeamIntegration *beamIntegr = 0;
@@ -307,6 +308,9 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       } else if ((strcmp(argv[argi],"-cMass") == 0) || (strcmp(argv[argi],"cMass") == 0)) {
           cMass = 1;
           argi++;
+      } else if (strcmp(argv[argi],"-warm") == 0) {
+	warm = true;
+	argi++;
       } else if (strcmp(argv[argi],"-integration") == 0) {
 
 	argi++;
@@ -393,7 +397,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       else if (strcmp(argv[1],"dispBeamColumnWithSensitivity") == 0)
 	theElement = new DispBeamColumn2dWithSensitivity(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass);
       else
-	theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass, numIter, tol);
+	theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass, numIter, tol, warm);
     }
     else {
       if (strcmp(argv[1],"elasticForceBeamColumn") == 0)
@@ -405,7 +409,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       else if (strcmp(argv[1],"dispBeamColumnWithSensitivity") == 0)
 	theElement = new DispBeamColumn3dWithSensitivity(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass);
       else
-	theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass, numIter, tol);
+	theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass, numIter, tol, warm);
     }
 
     delete beamIntegr;
@@ -1264,6 +1268,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
   int cMass = 0;
   int numIter = 10;
   double tol = 1.0e-12;
+  bool warm = false;
 
   while (argi < argc) {
     if (strcmp(argv[argi],"-iter") == 0) {
@@ -1301,6 +1306,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     } else if ((strcmp(argv[argi],"-cMass") == 0 || strcmp(argv[argi],"cMass") == 0)) {
       cMass = 1;
       argi++;
+    } else if (strcmp(argv[argi],"-warm") == 0) {
+      warm = true;
     }
     argi += 1;
   }
@@ -1327,7 +1334,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     else if (strcmp(argv[1],"elasticForceBeamColumnWarping") == 0)
       theElement = new ElasticForceBeamColumnWarping2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d);
     else 
-      theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d, mass, numIter, tol);
+      theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d, mass, numIter, tol, warm);
   }
   else {
     if (strcmp(argv[1],"elasticForceBeamColumn") == 0)
@@ -1335,7 +1342,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     else if (strcmp(argv[1],"dispBeamColumn") == 0)
       theElement = new DispBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, cMass);
     else
-      theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, numIter, tol);
+      theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, numIter, tol, warm);
   }
 
   if (beamIntegr != 0)
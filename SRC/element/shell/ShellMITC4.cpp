@@ -323,6 +323,21 @@ int  ShellMITC4::revertToStart( )
   return success ;
 }
 
+
+//linear if the basis is fixed and all sections are linear
+bool  ShellMITC4::isLinear( ) 
+{
+  if ( doUpdateBasis == true )
+    return false ;
+
+  for ( int i = 0; i < 4; i++ ) {
+    if ( materialPointers[i]->isLinear( ) == false )
+      return false ;
+  }
+
+  return true ;
+}
+
 //print out element data
 void  ShellMITC4::Print( OPS_Stream &s, int flag )
 {
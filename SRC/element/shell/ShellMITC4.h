@@ -83,6 +83,7 @@ class ShellMITC4 : public Element {
     
     //revert to start 
     int revertToStart( ) ;
+    bool isLinear( ) ;
 
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
@@ -39,6 +39,7 @@
 #include <Information.h>
 #include <ElementResponse.h>
 #include <UniaxialMaterial.h>
+#include <UniaxialMaterialBatch.h>
 
 #include <float.h>
 #include <math.h>
@@ -216,7 +217,7 @@ TwoNodeLink::TwoNodeLink(int tag, int dim, int Nd1, int Nd2,
     const Vector sdI, int addRay, double m)
     : Element(tag, ELE_TAG_TwoNodeLink),
     numDIM(dim), numDOF(0), connectedExternalNodes(2),
-    theMaterials(0), numDir(direction.Size()), dir(0), trans(3,3),
+    theMaterials(0), theBatch(0), batchSlots(0), numDir(direction.Size()), dir(0), trans(3,3),
     x(_x), y(_y), Mratio(Mr), shearDistI(sdI), addRayleigh(addRay),
     mass(m), L(0.0), onP0(true), ub(0), ubdot(0), qb(0), ul(0),
     Tgl(0,0), Tlb(0,0), theMatrix(0), theVector(0), theLoad(0)
@@ -341,7 +342,7 @@ TwoNodeLink::TwoNodeLink(int tag, int dim, int Nd1, int Nd2,
 TwoNodeLink::TwoNodeLink()
     : Element(0, ELE_TAG_TwoNodeLink),
     numDIM(0), numDOF(0), connectedExternalNodes(2),
-    theMaterials(0), numDir(0), dir(0), trans(3,3), x(0), y(0),
+    theMaterials(0), theBatch(0), batchSlots(0), numDir(0), dir(0), trans(3,3), x(0), y(0),
     Mratio(0), shearDistI(0), addRayleigh(0), mass(0.0), L(0.0),
     onP0(false), ub(0), ubdot(0), qb(0), ul(0), Tgl(0,0), Tlb(0,0),
     theMatrix(0), theVector(0), theLoad(0)
@@ -370,6 +371,7 @@ TwoNodeLink::~TwoNodeLink()
         delete theLoad;
     
     // delete the materials
+    this->setMaterialBatch(0);
     if (theMaterials != 0)  {
         for (int i=0; i<numDir; i++)
             if (theMaterials[i] != 0)
@@ -522,6 +524,10 @@ int TwoNodeLink::commitState()
 {
     int errCode = 0;
     
+    // set any material models still pending in the batch
+    if (theBatch != 0)
+        theBatch->evaluate();
+    
     // commit material models
     for (int i=0; i<numDir; i++)
         errCode += theMaterials[i]->commitState();
@@ -540,6 +546,9 @@ int TwoNodeLink::revertToLastCommit()
     // revert material models
     for (int i=0; i<numDir; i++)
         errCode += theMaterials[i]->revertToLastCommit();
+    if (theBatch != 0)
+        for (int i=0; i<numDir; i++)
+            theBatch->refresh(batchSlots[i]);
     
     return errCode;
 }
@@ -557,6 +566,9 @@ int TwoNodeLink::revertToStart()
     // revert material models
     for (int i=0; i<numDir; i++)
         errCode += theMaterials[i]->revertToStart();
+    if (theBatch != 0)
+        for (int i=0; i<numDir; i++)
+            theBatch->refresh(batchSlots[i]);
     
     return errCode;
 }
@@ -589,7 +601,16 @@ int TwoNodeLink::update()
     //ub = (Tlb*Tgl)*ug;
     //ubdot = (Tlb*Tgl)*ugdot;
     
-    // set trial response for material models
+    // set trial response for material models, in batch mode they are
+    // set by the domain once all elements are updated
+    UniaxialMaterialBatch *theDomainBatch = this->getDomain()->getMaterialBatch();
+    if (theDomainBatch != theBatch)
+        this->setMaterialBatch(theDomainBatch);
+    if (theBatch != 0)  {
+        for (int i=0; i<numDir; i++)
+            theBatch->setTrialStrain(batchSlots[i], ub(i), ubdot(i));
+        return errCode;
+    }
     for (int i=0; i<numDir; i++)
         errCode += theMaterials[i]->setTrialStrain(ub(i),ubdot(i));
     
@@ -604,9 +625,16 @@ const Matrix& TwoNodeLink::getTangentStiff()
     
     // get resisting forces and stiffnesses
     Matrix kb(numDir,numDir);
-    for (int i=0; i<numDir; i++)  {
-        qb(i) = theMaterials[i]->getStress();
-        kb(i,i) = theMaterials[i]->getTangent();
+    if (theBatch != 0)  {
+        for (int i=0; i<numDir; i++)  {
+            qb(i) = theBatch->getStress(batchSlots[i]);
+            kb(i,i) = theBatch->getTangent(batchSlots[i]);
+        }
+    } else  {
+        for (int i=0; i<numDir; i++)  {
+            qb(i) = theMaterials[i]->getStress();
+            kb(i,i) = theMaterials[i]->getTangent();
+        }
     }
     
     // transform from basic to local system
@@ -664,7 +692,10 @@ const Matrix& TwoNodeLink::getDamp()
         factThis = 1.0;
     }
     
-    // now add damping tangent from materials
+    // now add damping tangent from materials, these are not held
+    // by the batch
+    if (theBatch != 0)
+        theBatch->evaluate();
     Matrix cb(numDir,numDir);
     for (int i=0; i<numDir; i++)  {
         cb(i,i) = theMaterials[i]->getDampTangent();
@@ -755,8 +786,13 @@ const Vector& TwoNodeLink::getResistingForce()
     theVector->Zero();
     
     // get resisting forces
-    for (int i=0; i<numDir; i++)
-        qb(i) = theMaterials[i]->getStress();
+    if (theBatch != 0)  {
+        for (int i=0; i<numDir; i++)
+            qb(i) = theBatch->getStress(batchSlots[i]);
+    } else  {
+        for (int i=0; i<numDir; i++)
+            qb(i) = theMaterials[i]->getStress();
+    }
     
     // determine resisting forces in local system
     Vector ql(numDOF);
@@ -858,6 +894,7 @@ int TwoNodeLink::recvSelf(int commitTag, Channel &rChannel,
     FEM_ObjectBroker &theBroker)
 {
     // delete dynamic memory
+    this->setMaterialBatch(0);
     if (dir != 0)
         delete dir;
     if (theMaterials != 0)  {
@@ -1175,6 +1212,9 @@ Response* TwoNodeLink::setResponse(const char **argv, int argc,
             int matNum = atoi(argv[1]);
             if (matNum >= 1 && matNum <= numDir)
                 theResponse =  theMaterials[matNum-1]->setResponse(&argv[2], argc-2, output);
+            // evaluate the material batch before the response is read
+            if (theResponse != 0 && this->getDomain() != 0)
+                theResponse = new UniaxialMaterialBatchResponse(this->getDomain(), theResponse);
         }
     }
     
@@ -1186,6 +1226,9 @@ Response* TwoNodeLink::setResponse(const char **argv, int argc,
 
 int TwoNodeLink::getResponse(int responseID, Information &eleInfo)
 {
+    if (theBatch != 0)
+        theBatch->evaluate();
+    
     Vector defoAndForce(numDir*2);
     
     switch (responseID)  {
@@ -1595,6 +1638,27 @@ void TwoNodeLink::addPDeltaStiff(Matrix &kLocal)
 }
 
 
+void TwoNodeLink::setMaterialBatch(UniaxialMaterialBatch *theDomainBatch)
+{
+    // leave the batch the materials are in
+    if (theBatch != 0)  {
+        for (int i=0; i<numDir; i++)
+            theBatch->removeMaterial(batchSlots[i]);
+        delete [] batchSlots;
+        batchSlots = 0;
+    }
+    
+    // and join the new one
+    theBatch = theDomainBatch;
+    if (theBatch == 0)
+        return;
+    
+    batchSlots = new int [numDir];
+    for (int i=0; i<numDir; i++)
+        batchSlots[i] = theBatch->addMaterial(theMaterials[i]);
+}
+
+
 int TwoNodeLink::setParameter(const char **argv, int argc, Parameter &param)
 {
     int result = -1;
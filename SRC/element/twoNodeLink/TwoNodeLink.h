@@ -39,6 +39,7 @@
 
 class Channel;
 class UniaxialMaterial;
+class UniaxialMaterialBatch;
 class Response;
 
 // Type of dimension of element NxDy has dimension x=1,2,3 and
@@ -113,6 +114,7 @@ private:
     void setTranLocalBasic();
     void addPDeltaForces(Vector &pLocal);
     void addPDeltaStiff(Matrix &kLocal);
+    void setMaterialBatch(UniaxialMaterialBatch *theDomainBatch);
     
     // private attributes - a copy for each object of the class
     int numDIM;                         // 1, 2, or 3 dimensions
@@ -120,6 +122,8 @@ private:
     ID connectedExternalNodes;          // contains the tags of the end nodes
     Node *theNodes[2];                  // array of nodes
     UniaxialMaterial **theMaterials;    // array of uniaxial materials
+    UniaxialMaterialBatch *theBatch;    // material batch of the domain
+    int *batchSlots;                    // slots of the materials in theBatch
     
     // parameters
     int numDir;         // number of directions
@@ -0,0 +1,546 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of ContactSearch.
+
+#include <ContactSearch.h>
+#include <ZeroLengthContact2D.h>
+#include <ZeroLengthContact3D.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <MeshRegion.h>
+#include <elementAPI.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// cell coordinates are packed into 21 bits each
+static const long long cellOffset = 1 << 20;
+
+static inline long long
+packCell(long long i, long long j, long long k)
+{
+  return ((i + cellOffset) << 42) | ((j + cellOffset) << 21) | (k + cellOffset);
+}
+
+static void
+addNode(ID &nodes, int tag)
+{
+  nodes[nodes.Size()] = tag;
+}
+
+static void
+removeDuplicates(ID &nodes)
+{
+  // a node is listed once even if several elements share it
+  if (nodes.Size() == 0)
+    return;
+  std::vector<int> tags(nodes.Size());
+  for (int i = 0; i < nodes.Size(); i++)
+    tags[i] = nodes(i);
+  std::sort(tags.begin(), tags.end());
+  tags.erase(std::unique(tags.begin(), tags.end()), tags.end());
+
+  nodes.resize((int)tags.size());
+  for (int i = 0; i < (int)tags.size(); i++)
+    nodes(i) = tags[i];
+}
+
+static int
+addElementNodes(ID &nodes, Domain *theDomain, int eleTag)
+{
+  Element *theEle = theDomain->getElement(eleTag);
+  if (theEle == 0) {
+    opserr << "WARNING contactSearch - element " << eleTag << " does not exist\n";
+    return -1;
+  }
+  const ID &eleNodes = theEle->getExternalNodes();
+  for (int i = 0; i < eleNodes.Size(); i++)
+    addNode(nodes, eleNodes(i));
+  return 0;
+}
+
+static int
+getTagList(ID &nodes, Domain *theDomain, bool elements)
+{
+  // read node or element tags until the next flag
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    int tag;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &tag) < 0) {
+      OPS_ResetCurrentInputArg(-1);
+      break;
+    }
+    if (elements) {
+      if (addElementNodes(nodes, theDomain, tag) < 0)
+	return -1;
+      continue;
+    }
+    if (theDomain->getNode(tag) == 0) {
+      opserr << "WARNING contactSearch - node " << tag << " does not exist\n";
+      return -1;
+    }
+    addNode(nodes, tag);
+  }
+  return 0;
+}
+
+static int
+getRegionNodes(ID &nodes, Domain *theDomain)
+{
+  int regTag;
+  int numdata = 1;
+  if (OPS_GetIntInput(&numdata, &regTag) < 0) {
+    opserr << "WARNING contactSearch - invalid region tag\n";
+    return -1;
+  }
+  MeshRegion *theRegion = theDomain->getRegion(regTag);
+  if (theRegion == 0) {
+    opserr << "WARNING contactSearch - region " << regTag << " does not exist\n";
+    return -1;
+  }
+  // the nodes of the region and those of its elements
+  const ID &regNodes = theRegion->getNodes();
+  for (int i = 0; i < regNodes.Size(); i++)
+    addNode(nodes, regNodes(i));
+  const ID &regEles = theRegion->getElements();
+  for (int i = 0; i < regEles.Size(); i++)
+    if (addElementNodes(nodes, theDomain, regEles(i)) < 0)
+      return -1;
+  return 0;
+}
+
+int
+OPS_ContactSearch()
+{
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return -1;
+
+  int ndm = OPS_GetNDM();
+  if (ndm != 2 && ndm != 3) {
+    opserr << "WARNING contactSearch - only ndm 2 or 3 is supported\n";
+    return -1;
+  }
+
+  int tag;
+  int numdata = 1;
+  if (OPS_GetIntInput(&numdata, &tag) < 0) {
+    opserr << "WARNING contactSearch - invalid tag\n";
+    opserr << "Want: contactSearch tag? -master nodes.. -slave nodes.. -radius r? -Kn Kn? -Kt Kt? -mu mu?\n";
+    return -1;
+  }
+
+  ID masterNodes(0, 64), slaveNodes(0, 64);
+  double radius = 0.0, release = 0.0;
+  double Kn = 0.0, Kt = 0.0, mu = 0.0, c = 0.0;
+  int dir = 0;
+  Vector normal(2);
+  normal(1) = 1.0;
+  int eleTag = -1;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *flag = OPS_GetString();
+    double *dval = 0;
+    if (strcmp(flag, "-master") == 0) {
+      if (getTagList(masterNodes, theDomain, false) < 0) return -1;
+    } else if (strcmp(flag, "-slave") == 0) {
+      if (getTagList(slaveNodes, theDomain, false) < 0) return -1;
+    } else if (strcmp(flag, "-masterElements") == 0) {
+      if (getTagList(masterNodes, theDomain, true) < 0) return -1;
+    } else if (strcmp(flag, "-slaveElements") == 0) {
+      if (getTagList(slaveNodes, theDomain, true) < 0) return -1;
+    } else if (strcmp(flag, "-masterRegion") == 0) {
+      if (getRegionNodes(masterNodes, theDomain) < 0) return -1;
+    } else if (strcmp(flag, "-slaveRegion") == 0) {
+      if (getRegionNodes(slaveNodes, theDomain) < 0) return -1;
+    } else if (strcmp(flag, "-radius") == 0) {
+      dval = &radius;
+    } else if (strcmp(flag, "-release") == 0) {
+      dval = &release;
+    } else if (strcmp(flag, "-Kn") == 0) {
+      dval = &Kn;
+    } else if (strcmp(flag, "-Kt") == 0) {
+      dval = &Kt;
+    } else if (strcmp(flag, "-mu") == 0) {
+      dval = &mu;
+    } else if (strcmp(flag, "-c") == 0) {
+      dval = &c;
+    } else if (strcmp(flag, "-dir") == 0) {
+      if (OPS_GetIntInput(&numdata, &dir) < 0) {
+	opserr << "WARNING contactSearch - invalid -dir\n";
+	return -1;
+      }
+    } else if (strcmp(flag, "-eleTag") == 0) {
+      if (OPS_GetIntInput(&numdata, &eleTag) < 0) {
+	opserr << "WARNING contactSearch - invalid -eleTag\n";
+	return -1;
+      }
+    } else if (strcmp(flag, "-normal") == 0) {
+      int two = 2;
+      double n[2];
+      if (OPS_GetDoubleInput(&two, n) < 0) {
+	opserr << "WARNING contactSearch - invalid -normal\n";
+	return -1;
+      }
+      normal(0) = n[0];
+      normal(1) = n[1];
+    } else {
+      opserr << "WARNING contactSearch - unknown option " << flag << endln;
+      return -1;
+    }
+
+    if (dval != 0 && OPS_GetDoubleInput(&numdata, dval) < 0) {
+      opserr << "WARNING contactSearch - invalid value for " << flag << endln;
+      return -1;
+    }
+  }
+
+  removeDuplicates(masterNodes);
+  removeDuplicates(slaveNodes);
+
+  if (masterNodes.Size() == 0 || slaveNodes.Size() == 0) {
+    opserr << "WARNING contactSearch - no master or slave nodes given\n";
+    return -1;
+  }
+  if (radius <= 0.0) {
+    opserr << "WARNING contactSearch - a positive -radius is required\n";
+    return -1;
+  }
+  if (release < radius)
+    release = 1.5 * radius;
+
+  // pair elements are numbered after the largest existing element tag
+  if (eleTag < 0) {
+    eleTag = 0;
+    ElementIter &theEles = theDomain->getElements();
+    Element *theEle;
+    while ((theEle = theEles()) != 0)
+      if (theEle->getTag() >= eleTag)
+	eleTag = theEle->getTag() + 1;
+  }
+
+  ContactSearch *theSearch = new ContactSearch(tag, masterNodes, slaveNodes,
+					       radius, release, Kn, Kt, mu, c,
+					       dir, normal, eleTag);
+
+  if (theDomain->addElementGenerator(*theSearch) < 0) {
+    opserr << "WARNING contactSearch - could not add to domain\n";
+    delete theSearch;
+    return -1;
+  }
+
+  return 0;
+}
+
+ContactSearch::ContactSearch(int tag, const ID &masters, const ID &slaves,
+			     double r, double rr,
+			     double kn, double kt, double m, double c,
+			     int dir, const Vector &n, int startEleTag)
+  :ElementGenerator(tag, GENERATOR_TAGS_ContactSearch),
+   masterNodes(masters), slaveNodes(slaves), radius(r), releaseRadius(rr),
+   Kn(kn), Kt(kt), mu(m), cohesion(c), direction(dir), normal(n),
+   nextEleTag(startEleTag), theDomain(0), numCreated(0), numRemoved(0)
+{
+
+}
+
+ContactSearch::~ContactSearch()
+{
+  // the pair elements belong to the domain once added
+}
+
+int
+ContactSearch::setDomain(Domain &domain)
+{
+  theDomain = &domain;
+
+  if (this->setNodes() < 0)
+    return -1;
+
+  // initial search so that pairs already in range take part in the first step
+  return this->update();
+}
+
+int
+ContactSearch::setNodes(void)
+{
+  if (theDomain == 0)
+    return 0;
+
+  int numMaster = masterNodes.Size();
+  int numSlave = slaveNodes.Size();
+
+  masterPtrs.resize(numMaster);
+  slavePtrs.resize(numSlave);
+
+  for (int i = 0; i < numMaster; i++) {
+    masterPtrs[i] = theDomain->getNode(masterNodes(i));
+    if (masterPtrs[i] == 0) {
+      opserr << "WARNING ContactSearch::setNodes - master node " << masterNodes(i) << " does not exist\n";
+      return -1;
+    }
+  }
+  for (int i = 0; i < numSlave; i++) {
+    slavePtrs[i] = theDomain->getNode(slaveNodes(i));
+    if (slavePtrs[i] == 0) {
+      opserr << "WARNING ContactSearch::setNodes - slave node " << slaveNodes(i) << " does not exist\n";
+      return -1;
+    }
+  }
+
+  masterCrd.resize(3 * numMaster);
+  cellKeys.resize(numMaster);
+  cellOrder.resize(numMaster);
+
+  return 0;
+}
+
+int
+ContactSearch::getPosition(Node *theNode, double *x) const
+{
+  const Vector &crd = theNode->getCrds();
+  const Vector &disp = theNode->getTrialDisp();
+  int ndm = crd.Size();
+
+  x[0] = x[1] = x[2] = 0.0;
+  for (int i = 0; i < ndm && i < 3; i++) {
+    x[i] = crd(i);
+    if (i < disp.Size())
+      x[i] += disp(i);
+  }
+
+  return ndm;
+}
+
+struct ContactSearchKeyLess {
+  const long long *keys;
+  bool operator()(int a, int b) const {return keys[a] < keys[b];}
+};
+
+int
+ContactSearch::search(ID &nearest, Vector &dist)
+{
+  int numMaster = (int)masterPtrs.size();
+  int numSlave = (int)slavePtrs.size();
+  double h = radius;
+
+  // bin the master nodes into a uniform grid of cell size radius,
+  // stored as a list of master indices sorted by cell key
+  for (int i = 0; i < numMaster; i++) {
+    double *x = &masterCrd[3*i];
+    this->getPosition(masterPtrs[i], x);
+    cellKeys[i] = packCell((long long)floor(x[0]/h),
+			   (long long)floor(x[1]/h),
+			   (long long)floor(x[2]/h));
+    cellOrder[i] = i;
+  }
+
+  ContactSearchKeyLess keyLess;
+  keyLess.keys = &cellKeys[0];
+  std::sort(cellOrder.begin(), cellOrder.end(), keyLess);
+
+  std::vector<long long> sortedKeys(numMaster);
+  for (int i = 0; i < numMaster; i++)
+    sortedKeys[i] = cellKeys[cellOrder[i]];
+
+  int kRange = (masterPtrs[0]->getCrds().Size() > 2) ? 1 : 0;
+  double r2 = radius * radius;
+
+  // narrow phase for each slave over the neighbouring cells
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int s = 0; s < numSlave; s++) {
+    double x[3];
+    this->getPosition(slavePtrs[s], x);
+    long long ci = (long long)floor(x[0]/h);
+    long long cj = (long long)floor(x[1]/h);
+    long long ck = (long long)floor(x[2]/h);
+
+    int best = -1;
+    double bestD2 = r2;
+    for (long long i = ci-1; i <= ci+1; i++)
+      for (long long j = cj-1; j <= cj+1; j++)
+	for (long long k = ck-kRange; k <= ck+kRange; k++) {
+	  long long key = packCell(i, j, k);
+	  std::vector<long long>::const_iterator it =
+	    std::lower_bound(sortedKeys.begin(), sortedKeys.end(), key);
+	  for (; it != sortedKeys.end() && *it == key; it++) {
+	    int m = cellOrder[it - sortedKeys.begin()];
+	    const double *y = &masterCrd[3*m];
+	    double d2 = (x[0]-y[0])*(x[0]-y[0]) + (x[1]-y[1])*(x[1]-y[1]) + (x[2]-y[2])*(x[2]-y[2]);
+	    if (d2 <= bestD2 && slavePtrs[s] != masterPtrs[m]) {
+	      bestD2 = d2;
+	      best = m;
+	    }
+	  }
+	}
+
+    nearest(s) = best;
+    dist(s) = (best >= 0) ? sqrt(bestD2) : 2.0 * releaseRadius;
+  }
+
+  return 0;
+}
+
+int
+ContactSearch::update(void)
+{
+  if (theDomain == 0 || masterPtrs.empty() || slavePtrs.empty())
+    return 0;
+
+  int numSlave = (int)slavePtrs.size();
+  ID nearest(numSlave);
+  Vector dist(numSlave);
+
+  if (this->search(nearest, dist) < 0)
+    return -1;
+
+  // an active pair element is kept, with its friction and slip history,
+  // until the pair separates beyond the release radius, even if another
+  // master node has come closer; a free slave is paired with the nearest
+  // master node within the search radius
+  std::vector<int> released, added;
+  for (int s = 0; s < numSlave; s++) {
+    std::map<int, std::pair<int,int> >::iterator it = activePairs.find(s);
+    if (it != activePairs.end()) {
+      int m = it->second.second;
+      double x[3], y[3];
+      this->getPosition(slavePtrs[s], x);
+      this->getPosition(masterPtrs[m], y);
+      double d = sqrt((x[0]-y[0])*(x[0]-y[0]) + (x[1]-y[1])*(x[1]-y[1]) + (x[2]-y[2])*(x[2]-y[2]));
+      if (d <= releaseRadius)
+	continue;
+      released.push_back(s);
+    }
+    if (nearest(s) >= 0)
+      added.push_back(s);
+  }
+
+  if (released.empty() && added.empty())
+    return 0;
+
+  // only the pairs that change are touched, as one change of the domain
+  int res = 0;
+  theDomain->beginChanges();
+  for (std::size_t i = 0; i < released.size() && res == 0; i++)
+    res = this->deactivate(released[i]);
+  for (std::size_t i = 0; i < added.size() && res == 0; i++)
+    res = this->activate(added[i], nearest(added[i]));
+  theDomain->endChanges();
+
+  return res;
+}
+
+int
+ContactSearch::activate(int s, int m)
+{
+  int ndm = slavePtrs[s]->getCrds().Size();
+  int eleTag = nextEleTag;
+  while (theDomain->getElement(eleTag) != 0)
+    eleTag++;
+  nextEleTag = eleTag + 1;
+
+  Element *theEle = 0;
+  if (ndm == 2)
+    theEle = new ZeroLengthContact2D(eleTag, slaveNodes(s), masterNodes(m),
+				     Kn, Kt, mu, normal);
+  else
+    theEle = new ZeroLengthContact3D(eleTag, slaveNodes(s), masterNodes(m),
+				     direction, Kn, Kt, mu, cohesion, 0.0, 0.0);
+
+  if (theEle == 0 || theDomain->addElement(theEle) == false) {
+    opserr << "WARNING ContactSearch::activate - failed to add pair element " << eleTag << endln;
+    if (theEle != 0)
+      delete theEle;
+    return -1;
+  }
+
+  activePairs[s] = std::pair<int,int>(eleTag, m);
+  numCreated++;
+
+  return 0;
+}
+
+int
+ContactSearch::deactivate(int s)
+{
+  std::map<int, std::pair<int,int> >::iterator it = activePairs.find(s);
+  if (it == activePairs.end())
+    return 0;
+
+  Element *theEle = theDomain->removeElement(it->second.first);
+  if (theEle != 0)
+    delete theEle;
+
+  activePairs.erase(it);
+  numRemoved++;
+
+  return 0;
+}
+
+int
+ContactSearch::revertToStart(void)
+{
+  if (theDomain == 0)
+    return 0;
+
+  // back at the start the pairs start again without history
+  theDomain->beginChanges();
+  while (!activePairs.empty())
+    this->deactivate(activePairs.begin()->first);
+  theDomain->endChanges();
+
+  return this->update();
+}
+
+int
+ContactSearch::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "ContactSearch::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+int
+ContactSearch::recvSelf(int commitTag, Channel &theChannel,
+			FEM_ObjectBroker &theBroker)
+{
+  opserr << "ContactSearch::recvSelf() - not yet implemented\n";
+  return -1;
+}
+
+void
+ContactSearch::Print(OPS_Stream &s, int flag)
+{
+  s << "ContactSearch: " << this->getTag() << endln;
+  s << "  master nodes: " << masterNodes.Size() << ", slave nodes: " << slaveNodes.Size() << endln;
+  s << "  radius: " << radius << ", release radius: " << releaseRadius << endln;
+  s << "  active pairs: " << (int)activePairs.size();
+  s << ", created: " << numCreated << ", removed: " << numRemoved << endln;
+}
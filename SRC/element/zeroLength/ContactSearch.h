@@ -0,0 +1,109 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ContactSearch_h
+#define ContactSearch_h
+
+// Description: This file contains the class definition for ContactSearch.
+// A ContactSearch owns a set of master and slave nodes and, after every
+// commit, runs a uniform-grid broad phase to find for each slave node the
+// nearest master node within the search radius. A ZeroLengthContact2D/3D
+// pair element is created for each new near pair and removed again once
+// the pair separates beyond the release radius, so only near pairs are
+// present in the domain and evaluated by the analysis. A pair element is
+// kept, with its friction history, for as long as the pair stays within
+// the release radius, and the pairs added and removed in a step are
+// applied as a single change of the domain.
+//
+// It is an ElementGenerator of the domain, so that the search is refreshed
+// in every Domain::commit(), before the recorders record the step.
+//
+// command:
+//   contactSearch $tag -master $nd1 ... -slave $nd1 ... -radius $r
+//        -Kn $Kn -Kt $Kt -mu $mu <-c $c> <-dir $dir> <-normal $nx $ny>
+//        <-release $rr> <-eleTag $startTag>
+//   -masterElements $ele1 ... and -slaveElements $ele1 ... take the nodes
+//   of the listed elements, -masterRegion $regTag and -slaveRegion $regTag
+//   the nodes and element nodes of a region defined with the region
+//   command.
+
+#include <ElementGenerator.h>
+#include <ID.h>
+#include <Vector.h>
+#include <vector>
+#include <map>
+
+class Domain;
+class Node;
+
+class ContactSearch: public ElementGenerator
+{
+  public:
+    ContactSearch(int tag, const ID &masterNodes, const ID &slaveNodes,
+		  double radius, double releaseRadius,
+		  double Kn, double Kt, double mu, double c,
+		  int direction, const Vector &normal, int startEleTag);
+    ~ContactSearch();
+
+    int setDomain(Domain &theDomain);
+    int update(void);
+    int revertToStart(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag);
+
+    int getNumActivePairs(void) const {return (int)activePairs.size();}
+
+  private:
+    int setNodes(void);
+
+    // broad phase: nearest master node for each slave node, -1 if none
+    // lies within the radius; distances are returned in dist
+    int search(ID &nearest, Vector &dist);
+    int activate(int slaveIndex, int masterIndex);
+    int deactivate(int slaveIndex);
+    int getPosition(Node *theNode, double *x) const;
+
+  private:
+    ID masterNodes, slaveNodes;
+    double radius, releaseRadius;
+    double Kn, Kt, mu, cohesion;
+    int direction;
+    Vector normal;
+    int nextEleTag;
+
+    Domain *theDomain;
+    std::vector<Node *> masterPtrs, slavePtrs;
+
+    // slave index -> (pair element tag, master index)
+    std::map<int, std::pair<int,int> > activePairs;
+
+    // scratch storage for the uniform grid, reused between steps
+    std::vector<double> masterCrd;
+    std::vector<long long> cellKeys;
+    std::vector<int> cellOrder;
+
+    int numCreated, numRemoved;
+};
+
+#endif
@@ -39,6 +39,7 @@
 #include <Message.h>
 #include <FEM_ObjectBroker.h>
 #include <UniaxialMaterial.h>
+#include <UniaxialMaterialBatch.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 
@@ -124,7 +125,7 @@ CoupledZeroLength::CoupledZeroLength(int tag,
    connectedExternalNodes(2),
    dimension(0), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
    theMatrix(0), theVector(0),
-   theMaterial(0), dirn1(direction1), dirn2(direction2), d0(0), v0(0)
+   theMaterial(0), theBatch(0), batchSlot(-1), dirn1(direction1), dirn2(direction2), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
   theMaterial = theMat.getCopy();
@@ -156,7 +157,7 @@ CoupledZeroLength::CoupledZeroLength(void)
    connectedExternalNodes(2),
    dimension(0), numDOF(0), transformation(3,3),
    theMatrix(0), theVector(0),
-   theMaterial(0), dirn1(0), dirn2(0), d0(0), v0(0)
+   theMaterial(0), theBatch(0), batchSlot(-1), dirn1(0), dirn2(0), d0(0), v0(0)
 {
   // ensure the connectedExternalNode ID is of correct size 
   if (connectedExternalNodes.Size() != 2)
@@ -174,6 +175,8 @@ CoupledZeroLength::CoupledZeroLength(void)
 //  and on the matertial object.
 CoupledZeroLength::~CoupledZeroLength()
 {
+  this->setMaterialBatch(0);
+
   if (theMaterial != 0)
     delete theMaterial;
 
@@ -349,6 +352,10 @@ CoupledZeroLength::commitState()
       opserr << "CoupledZeroLength::commitState () - failed in base class";
     }    
 
+    // set the material if still pending in the batch
+    if (theBatch != 0)
+      theBatch->evaluate();
+
     // commit 1d materials
     code += theMaterial->commitState();
 
@@ -370,6 +377,8 @@ CoupledZeroLength::revertToLastCommit()
     
     // revert state for 1d materials
     code += theMaterial->revertToLastCommit();
+    if (theBatch != 0)
+      theBatch->refresh(batchSlot);
     
     return code;
 }
@@ -382,6 +391,8 @@ CoupledZeroLength::revertToStart()
     
     // revert to start for 1d materials
     code += theMaterial->revertToStart();
+    if (theBatch != 0)
+      theBatch->refresh(batchSlot);
     
     return code;
 }
@@ -422,9 +433,31 @@ CoupledZeroLength::update(void)
 	strain *= -1.0;
     }
 
+    // in batch mode the material is set by the domain once all
+    // elements are updated
+    UniaxialMaterialBatch *theDomainBatch = this->getDomain()->getMaterialBatch();
+    if (theDomainBatch != theBatch)
+      this->setMaterialBatch(theDomainBatch);
+    if (theBatch != 0) {
+      theBatch->setTrialStrain(batchSlot, strain, strainRate);
+      return 0;
+    }
+
     return theMaterial->setTrialStrain(strain,strainRate);
 }
 
+void
+CoupledZeroLength::setMaterialBatch(UniaxialMaterialBatch *theDomainBatch)
+{
+    if (theBatch != 0)
+      theBatch->removeMaterial(batchSlot);
+    batchSlot = -1;
+
+    theBatch = theDomainBatch;
+    if (theBatch != 0)
+      batchSlot = theBatch->addMaterial(theMaterial);
+}
+
 const Matrix &
 CoupledZeroLength::getTangentStiff(void)
 {
@@ -436,7 +469,10 @@ CoupledZeroLength::getTangentStiff(void)
     // zero stiffness matrix
     stiff.Zero();
 
-    E = theMaterial->getTangent();    
+    if (theBatch != 0)
+      E = theBatch->getTangent(batchSlot);
+    else
+      E = theMaterial->getTangent();    
 
     int numNodeDof = numDOF/2;
     int dirn1b = dirn1+numNodeDof;
@@ -525,6 +561,9 @@ CoupledZeroLength::getDamp(void)
     if (useRayleighDamping == 1)
         damp = this->Element::getDamp();
 
+    if (theBatch != 0)
+      theBatch->evaluate();
+
     double eta;
     eta = theMaterial->getDampTangent();
 
@@ -585,8 +624,13 @@ CoupledZeroLength::getResistingForce()
     theVector->Zero();
 
     // get resisting force for material
-    force = theMaterial->getStress();
-    strain = theMaterial->getStrain();
+    if (theBatch != 0) {
+      force = theBatch->getStress(batchSlot);
+      strain = theBatch->getStrain(batchSlot);
+    } else {
+      force = theMaterial->getStress();
+      strain = theMaterial->getStrain();
+    }
 
     double Fx = force;
     double Fy = force;
@@ -716,6 +760,9 @@ CoupledZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int matDbTag = idData(8);
   int matClassTag = idData(9);
 
+  // the material may be replaced below
+  this->setMaterialBatch(0);
+
   // If null, get a new one from the broker
   if (theMaterial == 0 || theMaterial->getClassTag() != matClassTag) {
     if (theMaterial != 0)
@@ -856,6 +903,9 @@ CoupledZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
     } else if (strcmp(argv[0],"material") == 0) {
       if (argc > 1) {
 	theResponse =  theMaterial->setResponse(&argv[1], argc-1, output);
+	// evaluate the material batch before the response is read
+	if (theResponse != 0 && this->getDomain() != 0)
+	  theResponse = new UniaxialMaterialBatchResponse(this->getDomain(), theResponse);
       }
     }
 
@@ -867,6 +917,9 @@ CoupledZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 CoupledZeroLength::getResponse(int responseID, Information &eleInformation)
 {
+    if (theBatch != 0)
+      theBatch->evaluate();
+
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
     const Vector  diff  = disp2-disp1;
@@ -43,6 +43,7 @@ enum Etype { D1N2, D2N4, D2N6, D3N6, D3N12 };
 
 class Node;
 class UniaxialMaterial;
+class UniaxialMaterialBatch;
 
 class CoupledZeroLength : public Element {
  public:
@@ -105,6 +106,8 @@ class CoupledZeroLength : public Element {
  protected:
     
  private:
+    void setMaterialBatch(UniaxialMaterialBatch *theDomainBatch);
+
     Etype elemType;
   
     // private attributes - a copy for each object of the class
@@ -121,6 +124,8 @@ class CoupledZeroLength : public Element {
     
     // Storage for uniaxial material models
     UniaxialMaterial *theMaterial;    // array of pointers to 1d materials
+    UniaxialMaterialBatch *theBatch;  // material batch of the domain
+    int batchSlot;                    // slot of theMaterial in theBatch
     int dirn1;
     int dirn2;
     double dX;
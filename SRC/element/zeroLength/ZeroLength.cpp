@@ -38,6 +38,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <UniaxialMaterial.h>
+#include <UniaxialMaterialBatch.h>
 #include <Renderer.h>
 
 #include <math.h>
@@ -240,7 +241,8 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0),
+  theBatch(0), batchSlots(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
   theMaterial1d = new UniaxialMaterial*  [numMaterials1d];
@@ -284,7 +286,8 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(2),
   theMatrix(0), theVector(0),
-  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0),
+  theBatch(0), batchSlots(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
   theMaterial1d = new UniaxialMaterial*[2];
@@ -335,7 +338,8 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0),
+  theBatch(0), batchSlots(0), d0(0), v0(0)
 {
 
     // allocate memory for numMaterials1d uniaxial material models
@@ -386,7 +390,8 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0),
+  theBatch(0), batchSlots(0), d0(0), v0(0)
 {
 
     // allocate memory for numMaterials1d uniaxial material models
@@ -433,7 +438,8 @@ ZeroLength::ZeroLength(void)
   dimension(0), numDOF(0), transformation(3,3),
   theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
-  dir1d(0), t1d(0), d0(0), v0(0)
+  dir1d(0), t1d(0),
+  theBatch(0), batchSlots(0), d0(0), v0(0)
 {
     // ensure the connectedExternalNode ID is of correct size 
     if (connectedExternalNodes.Size() != 2)
@@ -452,6 +458,9 @@ ZeroLength::~ZeroLength()
     // invoke the destructor on any objects created by the object
     // that the object still holds a pointer to
 
+    // leave the material batch before the materials are deleted
+    this->setMaterialBatch(0);
+
     // invoke destructors on material objects
   int numMat = numMaterials1d;
   if (useRayleighDamping == 2)
@@ -646,6 +655,10 @@ ZeroLength::commitState()
       opserr << "ZeroLength::commitState () - failed in base class";
     }    
 
+    // set any materials still pending in the batch
+    if (theBatch != 0)
+      theBatch->evaluate();
+
     // commit 1d materials
     int numMat = numMaterials1d;
     if (useRayleighDamping == 2)
@@ -667,6 +680,10 @@ ZeroLength::revertToLastCommit()
       numMat *= 2;
     for (int i=0; i<numMat; i++) 
 	code += theMaterial1d[i]->revertToLastCommit();
+
+    if (theBatch != 0)
+      for (int i=0; i<numMat; i++)
+	theBatch->refresh(batchSlots[i]);
     
     return code;
 }
@@ -683,6 +700,10 @@ ZeroLength::revertToStart()
       numMat *= 2;
     for (int i=0; i<numMat; i++) 
 	code += theMaterial1d[i]->revertToStart();
+
+    if (theBatch != 0)
+      for (int i=0; i<numMat; i++)
+	theBatch->refresh(batchSlots[i]);
     
     return code;
 }
@@ -708,6 +729,12 @@ ZeroLength::update(void)
     if (v0 != 0)
       diffv -= *v0;
     
+    // in batch mode the strains are only gathered here, the materials
+    // are set by the domain once all elements are updated
+    UniaxialMaterialBatch *theDomainBatch = this->getDomain()->getMaterialBatch();
+    if (theDomainBatch != theBatch)
+      this->setMaterialBatch(theDomainBatch);
+
     // loop over 1d materials
     
     //    Matrix& tran = *t1d;
@@ -716,6 +743,12 @@ ZeroLength::update(void)
 	// compute strain and rate; set as current trial for material
 	strain     = this->computeCurrentStrain1d(mat,diff );
         strainRate = this->computeCurrentStrain1d(mat,diffv);
+	if (theBatch != 0) {
+	  theBatch->setTrialStrain(batchSlots[mat], strain, strainRate);
+	  if (useRayleighDamping == 2)
+	    theBatch->setTrialStrain(batchSlots[mat+numMaterials1d], strainRate);
+	  continue;
+	}
 	ret += theMaterial1d[mat]->setTrialStrain(strain,strainRate);
 	if (useRayleighDamping == 2) {
 	  ret += theMaterial1d[mat+numMaterials1d]->setTrialStrain(strainRate);	  
@@ -742,7 +775,10 @@ ZeroLength::getTangentStiff(void)
     for (int mat=0; mat<numMaterials1d; mat++) {
       
       // get tangent for material
-      E = theMaterial1d[mat]->getTangent();
+      if (theBatch != 0)
+	E = theBatch->getTangent(batchSlots[mat]);
+      else
+	E = theMaterial1d[mat]->getTangent();
       
       // compute contribution of material to tangent matrix
       for (int i=0; i<numDOF; i++)
@@ -822,7 +858,10 @@ ZeroLength::getDamp(void)
       for (int mat=0; mat<numMaterials1d; mat++) {
 	
         // get tangent for material
-        eta = theMaterial1d[mat+numMaterials1d]->getTangent();
+        if (theBatch != 0)
+	  eta = theBatch->getTangent(batchSlots[mat+numMaterials1d]);
+	else
+	  eta = theMaterial1d[mat+numMaterials1d]->getTangent();
 	
         // compute contribution of material to tangent matrix
         for (int i=0; i<numDOF; i++)
@@ -832,6 +871,10 @@ ZeroLength::getDamp(void)
 
     } else {
 
+      // damping tangents are not gathered by the batch
+      if (theBatch != 0)
+	theBatch->evaluate();
+
       // loop over 1d materials and add their damping tangents
       double eta;
       Matrix& tran = *t1d;;
@@ -900,7 +943,10 @@ ZeroLength::getResistingForce()
   for (int mat=0; mat<numMaterials1d; mat++) {
     
     // get resisting force for material
-    force = theMaterial1d[mat]->getStress();
+    if (theBatch != 0)
+      force = theBatch->getStress(batchSlots[mat]);
+    else
+      force = theMaterial1d[mat]->getStress();
     
     // compute residual due to resisting force
     for (int i=0; i<numDOF; i++)
@@ -928,7 +974,11 @@ ZeroLength::getResistingForceIncInertia()
       for (int mat=0; mat<numMaterials1d; mat++) {
 	
 	// get resisting force for material
-	double force = theMaterial1d[mat+numMaterials1d]->getStress();
+	double force;
+	if (theBatch != 0)
+	  force = theBatch->getStress(batchSlots[mat+numMaterials1d]);
+	else
+	  force = theMaterial1d[mat+numMaterials1d]->getStress();
     
 	// compute residual due to resisting force
 	for (int i=0; i<numDOF; i++)
@@ -1020,6 +1070,9 @@ ZeroLength::sendSelf(int commitTag, Channel &theChannel)
 int
 ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  // the materials may be replaced below
+  this->setMaterialBatch(0);
+
   int res = 0;
   
   int dataTag = this->getDbTag();
@@ -1331,6 +1384,9 @@ ZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
 	  numMat *= 2;
 	if (matNum >= 1 && matNum <= numMat)
 	  theResponse =  theMaterial1d[matNum-1]->setResponse(&argv[2], argc-2, output);
+	// evaluate the material batch before the response is read
+	if (theResponse != 0 && this->getDomain() != 0)
+	  theResponse = new UniaxialMaterialBatchResponse(this->getDomain(), theResponse);
       }
     }
 
@@ -1349,6 +1405,9 @@ ZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ZeroLength::getResponse(int responseID, Information &eleInformation)
 {
+    if (theBatch != 0)
+      theBatch->evaluate();
+
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
     const Vector  diff  = disp2-disp1;
@@ -1445,6 +1504,8 @@ ZeroLength::getResistingForceSensitivity(int gradIndex)
 {
   // Recompute strains to be safe
   this->update();
+  if (theBatch != 0)
+    theBatch->evaluate();
 
   double dfdh;
 
@@ -1671,6 +1732,31 @@ ZeroLength::computeCurrentStrain1d( int mat,
 
     return strain;
 }
+
+// Join the material batch of the domain, leaving the batch the
+// materials are in; a null batch only leaves
+void
+ZeroLength::setMaterialBatch(UniaxialMaterialBatch *theDomainBatch)
+{
+    int numMat = numMaterials1d;
+    if (useRayleighDamping == 2)
+      numMat *= 2;
+
+    if (theBatch != 0) {
+      for (int i=0; i<numMat; i++)
+	theBatch->removeMaterial(batchSlots[i]);
+      delete [] batchSlots;
+      batchSlots = 0;
+    }
+
+    theBatch = theDomainBatch;
+    if (theBatch == 0)
+      return;
+
+    batchSlots = new int[numMat];
+    for (int i=0; i<numMat; i++)
+      batchSlots[i] = theBatch->addMaterial(theMaterial1d[i]);
+}
 	      
 void
 ZeroLength::updateDir(const Vector& x, const Vector& y)
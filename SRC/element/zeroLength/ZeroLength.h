@@ -54,6 +54,7 @@ enum Etype { D1N2, D2N4, D2N6, D3N6, D3N12 };
 class Node;
 class Channel;
 class UniaxialMaterial;
+class UniaxialMaterialBatch;
 class Response;
 
 class ZeroLength : public Element
@@ -164,6 +165,7 @@ class ZeroLength : public Element
     
     void   setTran1d ( Etype e, int n );
     double computeCurrentStrain1d ( int mat, const Vector& diff ) const;    
+    void   setMaterialBatch ( UniaxialMaterialBatch *theDomainBatch );
 
     // private attributes - a copy for each object of the class
     ID  connectedExternalNodes;         // contains the tags of the end nodes
@@ -183,6 +185,10 @@ class ZeroLength : public Element
     ID               *dir1d;     	   // array of directions 0-5 for 1d materials
     Matrix           *t1d; 	   // hold the transformation matrix
 
+    // slots of the 1d materials in the material batch of the domain
+    UniaxialMaterialBatch *theBatch;
+    int              *batchSlots;
+
     // vector pointers to initial disp and vel if present
     Vector *d0;
     Vector *v0;
@@ -0,0 +1,274 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for CSRGraph.
+
+#include <CSRGraph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <DenseMapOfTaggedObjects.h>
+#include <ID.h>
+#include <algorithm>
+
+CSRGraph::CSRGraph()
+  :Graph(*(new DenseMapOfTaggedObjects())),
+   numVertex(0), rowStart(1, 0), adjacency(), refs(), colors(),
+   verticesCreated(false), csrCurrent(true)
+{
+
+}
+
+CSRGraph::~CSRGraph()
+{
+
+}
+
+int
+CSRGraph::setLists(int nV, const std::vector<const ID *> &lists)
+{
+  if (verticesCreated == true) {
+    opserr << "WARNING CSRGraph::setLists() - vertices already created\n";
+    return -1;
+  }
+
+  numVertex = (nV > 0) ? nV : 0;
+  int numLists = (int)lists.size();
+
+  // the lists each vertex is in, stored in compressed form
+  std::vector<int> listStart(numVertex+1, 0);
+  for (int l=0; l<numLists; l++) {
+    const ID &list = *lists[l];
+    for (int i=0; i<list.Size(); i++) {
+      int v = list(i);
+      if (v >= 0 && v < numVertex)
+	listStart[v+1]++;
+    }
+  }
+  for (int v=0; v<numVertex; v++)
+    listStart[v+1] += listStart[v];
+
+  std::vector<int> vertexLists(listStart[numVertex]);
+  std::vector<int> next(listStart.begin(), listStart.end()-1);
+  for (int l=0; l<numLists; l++) {
+    const ID &list = *lists[l];
+    for (int i=0; i<list.Size(); i++) {
+      int v = list(i);
+      if (v >= 0 && v < numVertex)
+	vertexLists[next[v]++] = l;
+    }
+  }
+
+  // first pass counts the distinct neighbours of each vertex, the
+  // second stores them; marker[w] == v once w is counted for v
+  std::vector<int> marker(numVertex, -1);
+  rowStart.assign(numVertex+1, 0);
+
+  for (int pass=0; pass<2; pass++) {
+    if (pass == 1) {
+      for (int v=0; v<numVertex; v++)
+	rowStart[v+1] += rowStart[v];
+      adjacency.resize(rowStart[numVertex]);
+      marker.assign(numVertex, -1);
+    }
+
+    for (int v=0; v<numVertex; v++) {
+      marker[v] = v;
+      int loc = rowStart[v];
+      for (int k=listStart[v]; k<listStart[v+1]; k++) {
+	const ID &list = *lists[vertexLists[k]];
+	for (int i=0; i<list.Size(); i++) {
+	  int w = list(i);
+	  if (w >= 0 && w < numVertex && marker[w] != v) {
+	    marker[w] = v;
+	    if (pass == 0)
+	      rowStart[v+1]++;
+	    else
+	      adjacency[loc++] = w;
+	  }
+	}
+      }
+      if (pass == 1)
+	std::sort(adjacency.begin()+rowStart[v], adjacency.begin()+loc);
+    }
+  }
+
+  refs.clear();
+  colors.clear();
+  csrCurrent = true;
+
+  return 0;
+}
+
+int
+CSRGraph::setVertexData(const std::vector<int> &theRefs,
+			const std::vector<int> &theColors)
+{
+  if ((int)theRefs.size() != numVertex || (int)theColors.size() != numVertex) {
+    opserr << "WARNING CSRGraph::setVertexData() - size not equal to number of vertices\n";
+    return -1;
+  }
+
+  refs = theRefs;
+  colors = theColors;
+
+  return 0;
+}
+
+const CSRGraph *
+CSRGraph::getCSR(void)
+{
+  if (csrCurrent == true)
+    return this;
+
+  return 0;
+}
+
+const int *
+CSRGraph::getAdjacency(void) const
+{
+  if (adjacency.empty())
+    return 0;
+
+  return &adjacency[0];
+}
+
+int
+CSRGraph::createVertices(void)
+{
+  if (verticesCreated == true)
+    return 0;
+
+  verticesCreated = true;
+
+  for (int v=0; v<numVertex; v++) {
+    int ref = refs.empty() ? v : refs[v];
+    int color = colors.empty() ? 0 : colors[v];
+    Vertex *vertexPtr = new Vertex(v, ref, 0.0, color);
+    if (this->Graph::addVertex(vertexPtr, false) == false) {
+      opserr << "WARNING CSRGraph::createVertices() - failed to add vertex " << v << endln;
+      return -1;
+    }
+  }
+
+  // edges in increasing order, so each adjacency ID is appended to
+  for (int v=0; v<numVertex; v++)
+    for (int k=rowStart[v]; k<rowStart[v+1]; k++)
+      if (adjacency[k] > v)
+	if (this->Graph::addEdge(v, adjacency[k]) < 0)
+	  return -2;
+
+  return 0;
+}
+
+bool
+CSRGraph::addVertex(Vertex *vertexPtr, bool checkAdjacency)
+{
+  this->createVertices();
+  csrCurrent = false;
+  return this->Graph::addVertex(vertexPtr, checkAdjacency);
+}
+
+int
+CSRGraph::addEdge(int vertexTag, int otherVertexTag)
+{
+  this->createVertices();
+  csrCurrent = false;
+  return this->Graph::addEdge(vertexTag, otherVertexTag);
+}
+
+Vertex *
+CSRGraph::getVertexPtr(int vertexTag)
+{
+  this->createVertices();
+  return this->Graph::getVertexPtr(vertexTag);
+}
+
+VertexIter &
+CSRGraph::getVertices(void)
+{
+  this->createVertices();
+  return this->Graph::getVertices();
+}
+
+int
+CSRGraph::getNumVertex(void) const
+{
+  if (csrCurrent == true)
+    return numVertex;
+
+  return this->Graph::getNumVertex();
+}
+
+int
+CSRGraph::getNumEdge(void) const
+{
+  if (csrCurrent == true)
+    return rowStart[numVertex]/2;
+
+  return this->Graph::getNumEdge();
+}
+
+int
+CSRGraph::getFreeTag(void)
+{
+  if (csrCurrent == true && verticesCreated == false)
+    return numVertex;
+
+  return this->Graph::getFreeTag();
+}
+
+Vertex *
+CSRGraph::removeVertex(int tag, bool removeEdgeFlag)
+{
+  this->createVertices();
+  csrCurrent = false;
+  return this->Graph::removeVertex(tag, removeEdgeFlag);
+}
+
+int
+CSRGraph::merge(Graph &other)
+{
+  this->createVertices();
+  csrCurrent = false;
+  return this->Graph::merge(other);
+}
+
+void
+CSRGraph::Print(OPS_Stream &s, int flag)
+{
+  this->createVertices();
+  this->Graph::Print(s, flag);
+}
+
+int
+CSRGraph::sendSelf(int commitTag, Channel &theChannel)
+{
+  this->createVertices();
+  return this->Graph::sendSelf(commitTag, theChannel);
+}
+
+int
+CSRGraph::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  // received as Vertex objects only
+  verticesCreated = true;
+  csrCurrent = false;
+  return this->Graph::recvSelf(commitTag, theChannel, theBroker);
+}
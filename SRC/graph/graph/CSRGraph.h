@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+// Description: This file contains the class definition for CSRGraph.
+// CSRGraph stores the adjacency of a graph with vertices 0 through
+// numVertex-1 in compressed row form: the neighbours of vertex i are
+// adjacency[rowStart[i]] through adjacency[rowStart[i+1]-1], sorted and
+// without the vertex itself. It is built in two passes from lists of
+// connected vertices, e.g. the FE_Element IDs, without creating a
+// Vertex per vertex. Numberers and LinearSOEs that know about it obtain
+// the arrays from Graph::getCSR(); for all other users the Graph
+// interface is kept by creating the Vertex objects on first use.
+
+#include <Graph.h>
+#include <vector>
+
+class ID;
+
+class CSRGraph : public Graph
+{
+  public:
+    CSRGraph();
+    ~CSRGraph();
+
+    // each list connects all its entries in 0..numVertex-1, other
+    // entries (e.g. negative equation numbers) are ignored
+    int setLists(int numVertex, const std::vector<const ID *> &lists);
+    // reference and color given to the Vertex objects if created
+    int setVertexData(const std::vector<int> &refs,
+		      const std::vector<int> &colors);
+
+    const CSRGraph *getCSR(void);
+    const int *getRowStart(void) const {return &rowStart[0];};
+    const int *getAdjacency(void) const;
+    int getDegree(int vertex) const {return rowStart[vertex+1]-rowStart[vertex];};
+
+    // Graph interface
+    bool addVertex(Vertex *vertexPtr, bool checkAdjacency = true);
+    int addEdge(int vertexTag, int otherVertexTag);
+
+    Vertex *getVertexPtr(int vertexTag);
+    VertexIter &getVertices(void);
+    int getNumVertex(void) const;
+    int getNumEdge(void) const;
+    int getFreeTag(void);
+    Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
+
+    int merge(Graph &other);
+
+    void Print(OPS_Stream &s, int flag =0);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    int createVertices(void);
+
+    int numVertex;
+    std::vector<int> rowStart;
+    std::vector<int> adjacency;
+    std::vector<int> refs;
+    std::vector<int> colors;
+
+    bool verticesCreated;  // Vertex objects exist in the Graph storage
+    bool csrCurrent;       // false once the graph is changed through Graph
+};
+
+#endif
@@ -44,6 +44,7 @@ class VertexIter;
 class TaggedObjectStorage;
 class Channel;
 class FEM_ObjectBroker;
+class CSRGraph;
 
 class Graph
 {
@@ -65,10 +66,13 @@ class Graph
     virtual Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
 
     virtual int merge(Graph &other);
+
+    // compressed row form of the graph if it holds one, see CSRGraph
+    virtual const CSRGraph *getCSR(void) {return 0;};
     
     virtual void Print(OPS_Stream &s, int flag =0);
-    int sendSelf(int commitTag, Channel &theChannel);
-    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
     friend OPS_Stream &operator<<(OPS_Stream &s, Graph &M);    
     
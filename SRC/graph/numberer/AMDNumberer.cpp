@@ -31,6 +31,7 @@
 
 #include <AMDNumberer.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <ID.h>
@@ -63,6 +64,18 @@ AMD::number(Graph &theGraph, int startVertex)
 
   theResult.resize(numVertex);
 
+  // a compressed row graph already holds the arrays amd needs
+  const CSRGraph *theCSR = theGraph.getCSR();
+  if (theCSR != 0 && theCSR->getAdjacency() != 0) {
+    int *P = new int[numVertex];
+    amd_order(numVertex, theCSR->getRowStart(), theCSR->getAdjacency(), P,
+	      (double *)NULL, (double *)NULL);
+    for (int i=0; i<numVertex; i++)
+      theResult[i] = P[i];
+    delete [] P;
+    return theResult;
+  }
+
   int nnz = 0;
   Vertex *vertexPtr;
   VertexIter &vertexIter = theGraph.getVertices();
@@ -35,6 +35,7 @@
 
 #include <RCM.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <ID.h>
@@ -94,6 +95,11 @@ RCM::number(Graph &theGraph, int startVertex)
     
     if (numVertex == 0) 
 	return *theRefResult;
+
+    // compressed row graph is numbered directly from its arrays
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0 && GPS == false)
+	return this->numberCSR(*theCSR, startVertex);
 	    
 
     // we first set the Tmp of all vertices to -1, indicating
@@ -273,6 +279,66 @@ RCM::number(Graph &theGraph, int startVertex)
 
 
 
+// same numbering as above for a CSRGraph, vertex tags are 0 through
+// numVertex-1 and a marker array takes the place of the vertex Tmp.
+
+const ID &
+RCM::numberCSR(const CSRGraph &theGraph, int startVertex)
+{
+    const int *rowStart = theGraph.getRowStart();
+    const int *adjacency = theGraph.getAdjacency();
+
+    ID &theResult = *theRefResult;
+    ID marker(numVertex);
+    for (int i=0; i<numVertex; i++)
+	marker(i) = -1;
+
+    if (startVertex != -1 && (startVertex < 0 || startVertex >= numVertex)) {
+	opserr << "WARNING:  RCM::number - No vertex with tag ";
+	opserr << startVertex << "Exists - using first come from iter\n";
+	startVertex = -1;
+    }
+    if (startVertex == -1)
+	startVertex = 0;
+
+    int nextUnmarked = 0; // position of the vertex iter for disconnected graphs
+    int currentMark = numVertex-1;  // marks current vertex visiting.
+    int nextMark = currentMark -1;  // indiactes where to put next Tag in ID.
+    theResult(currentMark) = startVertex;
+    marker(startVertex) = currentMark;
+
+    // we continue till the ID is full
+    while (nextMark >= 0) {
+	// go through the current vertex adjacency and add vertices which
+	// have not yet been marked
+	int vertex = theResult(currentMark);
+	for (int i=rowStart[vertex]; i<rowStart[vertex+1]; i++) {
+	    int vertexTag = adjacency[i];
+	    if (marker(vertexTag) == -1) {
+		marker(vertexTag) = nextMark;
+		theResult(nextMark--) = vertexTag;
+	    }
+	}
+
+	// go to the next vertex
+	currentMark--;
+
+	// check to see if graph is disconneted
+	if ((currentMark == nextMark) && (currentMark >= 0)) {
+	    int vertexTag = nextUnmarked++;
+	    while (marker(vertexTag) != -1)
+		vertexTag = nextUnmarked++;
+
+	    nextMark--;
+	    marker(vertexTag) = currentMark;
+	    theResult(currentMark) = vertexTag;
+	}
+    }
+
+    return theResult;
+}
+
+
 int
 RCM::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -35,7 +35,8 @@
 // number() method with the Graph to be numbered.
 //
 // Side effects: numberer() changes the Tmp values of the vertices to
-// the number assigned to that vertex.
+// the number assigned to that vertex, except for a graph held in
+// compressed row form (CSRGraph) which is numbered without its vertices.
 //
 // What: "@(#) RCM.h, revA"
 
@@ -44,6 +45,8 @@
 
 #include <GraphNumberer.h>
 
+class CSRGraph;
+
 #ifndef _bool_h
 #include <bool.h>
 #endif
@@ -64,6 +67,7 @@ class RCM: public GraphNumberer
   protected:
     
   private:
+    const ID &numberCSR(const CSRGraph &theGraph, int lastVertex);
     
     int numVertex;
     ID *theRefResult;
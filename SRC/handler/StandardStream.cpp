@@ -26,10 +26,55 @@
 #include <Vector.h>
 #include <iostream>
 #include <iomanip>
+#include <mutex>
+#include <atomic>
 using std::cerr;
 using std::ios;
 using std::setiosflags;
 
+// all StandardStreams share cerr, and recorders may write to theirs from
+// the recorder worker threads; while such threads exist each output call
+// holds this lock so rows and messages written by different threads do
+// not interleave, otherwise no lock is taken. It is recursive as the
+// composite calls (tag, attr, write(Vector)) are built on the single
+// value operators. Function statics, as opserr may be written to while
+// other files are still being initialised.
+static std::recursive_mutex &
+getOutputMutex(void)
+{
+  static std::recursive_mutex theMutex;
+  return theMutex;
+}
+
+static std::atomic<int> &
+getNumThreaded(void)
+{
+  static std::atomic<int> numThreaded(0);
+  return numThreaded;
+}
+
+namespace {
+class OutputLock
+{
+ public:
+  OutputLock() :locked(getNumThreaded().load() > 0)
+    {if (locked) getOutputMutex().lock();}
+  ~OutputLock()
+    {if (locked) getOutputMutex().unlock();}
+ private:
+  bool locked;
+};
+}
+
+void
+StandardStream::setThreaded(bool onOff)
+{
+  if (onOff)
+    getNumThreaded()++;
+  else
+    getNumThreaded()--;
+}
+
 StandardStream::StandardStream(int indent)
   :OPS_Stream(OPS_STREAM_TAGS_FileStream), 
    fileOpen(0), echoApplication(true),  indentSize(indent), numIndent(-1)
@@ -49,6 +94,8 @@ StandardStream::~StandardStream()
 int 
 StandardStream::setFile(const char *fileName, openMode mode, bool echo)
 {
+  OutputLock lock;
+
   if (fileOpen == 1) {
     theFile.close();
     fileOpen = 0;
@@ -76,6 +123,8 @@ StandardStream::setFile(const char *fileName, openMode mode, bool echo)
 int 
 StandardStream::setPrecision(int prec)
 {
+  OutputLock lock;
+
   cerr << std::setprecision(prec);
 
   if (fileOpen != 0)
@@ -87,6 +136,8 @@ StandardStream::setPrecision(int prec)
 int 
 StandardStream::setFloatField(floatField field)
 {
+  OutputLock lock;
+
 #ifndef _WIN32
   if (field == FIXEDD) {
 	  cerr << setiosflags(ios::fixed);
@@ -106,6 +157,8 @@ StandardStream::setFloatField(floatField field)
 int 
 StandardStream::tag(const char *tagName)
 {
+  OutputLock lock;
+
   // output the xml for it to the file
   this->indent();
   (*this) << tagName << "\n";
@@ -118,6 +171,8 @@ StandardStream::tag(const char *tagName)
 int
 StandardStream::tag(const char *tagName, const char *value)
 {
+  OutputLock lock;
+
   // output the xml for it to the file
   this->indent();
   (*this) << tagName << " " << value << "\n";
@@ -131,6 +186,8 @@ StandardStream::tag(const char *tagName, const char *value)
 int 
 StandardStream::endTag()
 {
+  OutputLock lock;
+
   numIndent--;
 
   return 0;
@@ -139,6 +196,8 @@ StandardStream::endTag()
 int 
 StandardStream::attr(const char *name, int value)
 {
+  OutputLock lock;
+
   this->indent();
   (*this) << name << " = " << value << "\n";
   
@@ -148,6 +207,8 @@ StandardStream::attr(const char *name, int value)
 int 
 StandardStream::attr(const char *name, double value)
 {
+  OutputLock lock;
+
   this->indent();
   (*this) << name << " = " << value << "\n";
 
@@ -157,6 +218,8 @@ StandardStream::attr(const char *name, double value)
 int 
 StandardStream::attr(const char *name, const char *value)
 {
+  OutputLock lock;
+
   this->indent();
   (*this) << name << " = " << value << "\n";
 
@@ -166,6 +229,8 @@ StandardStream::attr(const char *name, const char *value)
 int 
 StandardStream::write(Vector &data)
 {
+  OutputLock lock;
+
   this->indent();
   (*this) << data;  
 
@@ -176,6 +241,8 @@ StandardStream::write(Vector &data)
 OPS_Stream& 
 StandardStream::write(const char *s,int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr.write(s, n);
 
@@ -188,6 +255,8 @@ StandardStream::write(const char *s,int n)
 OPS_Stream& 
 StandardStream::write(const unsigned char*s, int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr.write((const char *) s, n);
 
@@ -199,6 +268,8 @@ StandardStream::write(const unsigned char*s, int n)
 OPS_Stream& 
 StandardStream::write(const signed char*s, int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr.write((const char *)s, n);
 
@@ -210,6 +281,8 @@ StandardStream::write(const signed char*s, int n)
 OPS_Stream& 
 StandardStream::write(const void *s, int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr.write((const char *)s, n);
 
@@ -221,6 +294,8 @@ StandardStream::write(const void *s, int n)
 OPS_Stream& 
 StandardStream::operator<<(char c)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << c;
 
@@ -232,6 +307,8 @@ StandardStream::operator<<(char c)
 OPS_Stream& 
 StandardStream::operator<<(unsigned char c)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << c;
 
@@ -243,6 +320,8 @@ StandardStream::operator<<(unsigned char c)
 OPS_Stream& 
 StandardStream::operator<<(signed char c)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << c;
 
@@ -254,6 +333,8 @@ StandardStream::operator<<(signed char c)
 OPS_Stream& 
 StandardStream::operator<<(const char *s)
 {
+  OutputLock lock;
+
   // note that we do the flush so that a "/n" before
   // a crash will cause a flush() - similar to what 
   if (echoApplication == true) {
@@ -272,6 +353,8 @@ StandardStream::operator<<(const char *s)
 OPS_Stream& 
 StandardStream::operator<<(const unsigned char *s)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << s;
 
@@ -283,6 +366,8 @@ StandardStream::operator<<(const unsigned char *s)
 OPS_Stream& 
 StandardStream::operator<<(const signed char *s)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << s;
 
@@ -294,6 +379,8 @@ StandardStream::operator<<(const signed char *s)
 OPS_Stream& 
 StandardStream::operator<<(const void *p)
 {
+  OutputLock lock;
+
 /*
 //  cerr << p;
 
@@ -305,6 +392,8 @@ StandardStream::operator<<(const void *p)
 OPS_Stream& 
 StandardStream::operator<<(int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr <<  n;
 
@@ -317,6 +406,8 @@ StandardStream::operator<<(int n)
 OPS_Stream& 
 StandardStream::operator<<(unsigned int n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << 1.0*n;
 
@@ -328,6 +419,8 @@ StandardStream::operator<<(unsigned int n)
 OPS_Stream& 
 StandardStream::operator<<(long n)
 {
+  OutputLock lock;
+
 /*
 cerr << n;
 
@@ -339,6 +432,8 @@ if (fileOpen != 0)
 OPS_Stream& 
 StandardStream::operator<<(unsigned long n)
 {
+  OutputLock lock;
+
 /*
   cerr << n;
 
@@ -350,6 +445,8 @@ StandardStream::operator<<(unsigned long n)
 OPS_Stream& 
 StandardStream::operator<<(short n)
 {
+  OutputLock lock;
+
 /*
   cerr << n;
 
@@ -361,6 +458,8 @@ StandardStream::operator<<(short n)
 OPS_Stream& 
 StandardStream::operator<<(unsigned short n)
 {
+  OutputLock lock;
+
 /*
   cerr << n;
 
@@ -373,6 +472,8 @@ return *this;
 OPS_Stream& 
 StandardStream::operator<<(bool b)
 {
+  OutputLock lock;
+
 /*
   cerr << b;
 
@@ -384,6 +485,8 @@ StandardStream::operator<<(bool b)
 OPS_Stream& 
 StandardStream::operator<<(double n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << n;
 
@@ -395,6 +498,8 @@ StandardStream::operator<<(double n)
 OPS_Stream& 
 StandardStream::operator<<(float n)
 {
+  OutputLock lock;
+
   if (echoApplication == true)
     cerr << n;
 
@@ -408,6 +513,8 @@ StandardStream::operator<<(float n)
 void
 StandardStream::indent(void)
 {
+  OutputLock lock;
+
   for (int i=0; i<numIndent; i++) {
     cerr << indentString;
     if (fileOpen != 0)
@@ -73,6 +73,10 @@ class StandardStream : public OPS_Stream
   OPS_Stream& operator<<(double n);
   OPS_Stream& operator<<(float n);
 
+  // to be invoked by objects that write from threads other than the
+  // main one, output is serialised while one of them is on
+  static void setThreaded(bool onOff);
+
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
 	       FEM_ObjectBroker &theBroker);
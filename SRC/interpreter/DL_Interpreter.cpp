@@ -79,6 +79,20 @@ DL_Interpreter::setString(const char*)
     return -1;
 }
 
+int
+DL_Interpreter::setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values)
+{
+    return -1;
+}
+
+int
+DL_Interpreter::setDoubleArray(double *data, int numRows, int numCols)
+{
+    // interpreters without array objects get the flattened array
+    return this->setDouble(data, numRows*numCols);
+}
+
 int
 DL_Interpreter::runCommand(const char*)
 {
@@ -28,6 +28,9 @@
 #ifndef DL_Interpreter_h
 #define DL_Interpreter_h
 
+#include <string>
+#include <vector>
+
 class Command;
 
 class DL_Interpreter
@@ -55,6 +58,10 @@ class DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual int setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values);
+    // row major numRows x numCols array, copied by the interpreter
+    virtual int setDoubleArray(double *data, int numRows, int numCols);
 
     // methods to run a command in the interpreter
     virtual int runCommand(const char*);
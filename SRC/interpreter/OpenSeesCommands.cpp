@@ -91,7 +91,7 @@ OpenSeesCommands::OpenSeesCommands(DL_Interpreter* interp)
      theSOE(0), theEigenSOE(0), theNumberer(0), theHandler(0),
      theStaticIntegrator(0), theTransientIntegrator(0),
      theAlgorithm(0), theStaticAnalysis(0), theTransientAnalysis(0),
-     thePFEMAnalysis(0),
+     thePFEMAnalysis(0), theModalAnalysis(0),
      theAnalysisModel(0), theTest(0), numEigen(0), theDatabase(0),
      theBroker(), theTimer(), theSimulationInfo()
 {
@@ -433,6 +433,10 @@ OpenSeesCommands::setStaticAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
 
     // create static analysis
     if (theAnalysisModel == 0) {
@@ -504,6 +508,10 @@ OpenSeesCommands::setPFEMAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
 
     // create PFEM analysis
     if(OPS_GetNumRemainingInputArgs() < 3) {
@@ -595,6 +603,10 @@ OpenSeesCommands::setVariableAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
 
     // make sure all the components have been built,
     // otherwise print a warning and use some defaults
@@ -679,6 +691,10 @@ OpenSeesCommands::setTransientAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
 
     // create transient analysis
     if (theAnalysisModel == 0) {
@@ -737,6 +753,43 @@ OpenSeesCommands::setTransientAnalysis()
 // AddingSensitivity:END /////////////////////////////////
 }
 
+int
+OpenSeesCommands::setModalAnalysis()
+{
+    // delete the old analysis
+    if (theStaticAnalysis != 0) {
+	delete theStaticAnalysis;
+	theStaticAnalysis = 0;
+    }
+    if (theTransientAnalysis != 0) {
+	delete theTransientAnalysis;
+	theTransientAnalysis = 0;
+    }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
+
+    theModalAnalysis = (ModalSuperpositionAnalysis*)OPS_ModalSuperpositionAnalysis();
+    if (theModalAnalysis == 0) {
+	return -1;
+    }
+
+    // run the eigen analysis giving the modes if not yet done
+    int numModes = theModalAnalysis->getNumModes();
+    if (theDomain->getEigenvalues().Size() < numModes) {
+	numEigen = numModes;
+	if (this->eigen(EigenSOE_TAGS_ArpackSOE, 0.0, true, true) < 0) {
+	    opserr << "WARNING analysis ModalSuperposition - eigen analysis failed\n";
+	    delete theModalAnalysis;
+	    theModalAnalysis = 0;
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
 #ifdef _RELIABILITY
 int
 OpenSeesCommands::setReliabilityStaticAnalysis()
@@ -910,6 +963,9 @@ OpenSeesCommands::wipeAnalysis()
     	theTransientAnalysis->clearAll();
     	delete theTransientAnalysis;
     }
+    if (theModalAnalysis != 0) {
+    	delete theModalAnalysis;
+    }
 
     theAlgorithm = 0;
     theHandler = 0;
@@ -922,6 +978,7 @@ OpenSeesCommands::wipeAnalysis()
     theStaticAnalysis = 0;
     theTransientAnalysis = 0;
     thePFEMAnalysis = 0;
+    theModalAnalysis = 0;
     theTest = 0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
@@ -1054,6 +1111,20 @@ int OPS_SetString(const char* str)
     return interp->setString(str);
 }
 
+int OPS_SetDoubleDictOutput(const std::vector<std::string>& keys,
+			    const std::vector<double>& values)
+{
+    DL_Interpreter* interp = cmds->getInterpreter();
+    return interp->setDoubleDict(keys, values);
+}
+
+int OPS_SetDoubleArrayOutput(double *data, int numRows, int numCols)
+{
+    DL_Interpreter* interp = cmds->getInterpreter();
+    if (data == 0 && numRows*numCols > 0) return -1;
+    return interp->setDoubleArray(data, numRows, numCols);
+}
+
 Domain* OPS_GetDomain(void)
 {
     return cmds->getDomain();
@@ -1662,6 +1733,12 @@ int OPS_Analysis()
 	       (strcmp(type,"VariableTransient") == 0)) {
 	cmds->setVariableAnalysis();
 
+    } else if (strcmp(type, "ModalSuperposition") == 0 ||
+	       strcmp(type, "Modal") == 0) {
+	if (cmds->setModalAnalysis() < 0) {
+	    return -1;
+	}
+
 #ifdef _RELIABILITY
     } else if (strcmp(type, "ReliabilityStatic") == 0) {
 	if (cmds->setReliabilityStaticAnalysis() < 0) {
@@ -1687,6 +1764,8 @@ int OPS_analyze()
     StaticAnalysis* theStaticAnalysis = cmds->getStaticAnalysis();
     TransientAnalysis* theTransientAnalysis = cmds->getTransientAnalysis();
     PFEMAnalysis* thePFEMAnalysis = cmds->getPFEMAnalysis();
+    if (theTransientAnalysis == 0)
+	theTransientAnalysis = cmds->getModalAnalysis();
 
     if (theStaticAnalysis != 0) {
 	if (OPS_GetNumRemainingInputArgs() < 1) {
@@ -1829,6 +1908,45 @@ int OPS_resetModel()
     return 0;
 }
 
+int OPS_groundMotionBatch()
+{
+    // groundMotionBatch dof dT -accel seriesTags ..., returns the status
+    // and peaks of every run one run after the other
+    TransientAnalysis* theTransientAnalysis = cmds->getTransientAnalysis();
+    TransientIntegrator* theTransientIntegrator = cmds->getTransientIntegrator();
+    if (theTransientAnalysis == 0) {
+	theTransientAnalysis = cmds->getModalAnalysis();
+	theTransientIntegrator = 0;
+    }
+    if (theTransientAnalysis == 0) {
+	opserr << "WARNING groundMotionBatch - no transient analysis has been defined\n";
+	return -1;
+    }
+
+    GroundMotionBatch* theBatch = (GroundMotionBatch*)OPS_GroundMotionBatch();
+    if (theBatch == 0) return -1;
+
+    // failed runs are reported by their status
+    theBatch->run(*theTransientAnalysis, theTransientIntegrator);
+
+    const Matrix& results = theBatch->getResults();
+    int numdata = results.noRows()*results.noCols();
+    std::vector<double> data(numdata > 0 ? numdata : 1);
+    for (int i=0; i<results.noRows(); i++) {
+	for (int j=0; j<results.noCols(); j++) {
+	    data[i*results.noCols()+j] = results(i,j);
+	}
+    }
+    delete theBatch;
+
+    if (OPS_SetDoubleOutput(&numdata, &data[0]) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_initializeAnalysis()
 {
     DirectIntegrationAnalysis* theTransientAnalysis =
@@ -1851,6 +1969,46 @@ int OPS_initializeAnalysis()
     return 0;
 }
 
+int OPS_linearCache()
+{
+    // linearCache <on|off>, returns 1 if the cache is on
+    StaticIntegrator* theStaticIntegrator = cmds->getStaticIntegrator();
+    TransientIntegrator* theTransientIntegrator = cmds->getTransientIntegrator();
+
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	bool onOff = false;
+	if (strcmp(opt, "on") == 0) {
+	    onOff = true;
+	} else if (strcmp(opt, "off") != 0) {
+	    opserr << "WARNING linearCache <on|off>\n";
+	    return -1;
+	}
+	if (theStaticIntegrator == 0 && theTransientIntegrator == 0) {
+	    opserr << "WARNING linearCache - no integrator has been defined\n";
+	    return -1;
+	}
+	if (theStaticIntegrator != 0)
+	    theStaticIntegrator->setLinearCache(onOff);
+	if (theTransientIntegrator != 0)
+	    theTransientIntegrator->setLinearCache(onOff);
+    }
+
+    int res = 0;
+    if (theStaticIntegrator != 0 && theStaticIntegrator->getLinearCache() == true)
+	res = 1;
+    if (theTransientIntegrator != 0 && theTransientIntegrator->getLinearCache() == true)
+	res = 1;
+
+    int numdata = 1;
+    if (OPS_SetIntOutput(&numdata, &res) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_printA()
 {
     FileStream outputFile;
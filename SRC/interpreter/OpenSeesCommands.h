@@ -42,6 +42,8 @@
 #include <FEM_ObjectBrokerAllClasses.h>
 #include <PFEMAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
+#include <ModalSuperpositionAnalysis.h>
+#include <GroundMotionBatch.h>
 #ifdef _RELIABILITY
 #include <ReliabilityStaticAnalysis.h>
 #include <ReliabilityDirectIntegrationAnalysis.h>
@@ -99,6 +101,9 @@ public:
     void setTransientAnalysis();
     DirectIntegrationAnalysis* getTransientAnalysis() {return theTransientAnalysis;}
 
+    int setModalAnalysis();
+    ModalSuperpositionAnalysis* getModalAnalysis() {return theModalAnalysis;}
+
     void setNumEigen(int num) {numEigen = num;}
     int getNumEigen() {return numEigen;}
     EigenSOE* getEigenSOE() {return theEigenSOE;}
@@ -136,6 +141,7 @@ private:
     DirectIntegrationAnalysis* theTransientAnalysis;
     PFEMAnalysis* thePFEMAnalysis;
     VariableTimeStepDirectIntegrationAnalysis* theVariableTimeStepTransientAnalysis;
+    ModalSuperpositionAnalysis* theModalAnalysis;
     AnalysisModel* theAnalysisModel;
     ConvergenceTest *theTest;
 
@@ -160,6 +166,11 @@ private:
 // Declaration of all OpenSees APIs except those declared in elementAPI.h//
 ///////////////////////////////////////////////////////////////////////////
 
+/* OpenSeesCommands.cpp */
+int OPS_SetDoubleDictOutput(const std::vector<std::string>& keys,
+			    const std::vector<double>& values);
+int OPS_SetDoubleArrayOutput(double *data, int numRows, int numCols);
+
 /* OpenSeesUniaxialMaterialCommands.cpp */
 int OPS_UniaxialMaterial();
 int OPS_testUniaxialMaterial();
@@ -231,6 +242,11 @@ int OPS_nodeBounds();
 int OPS_setPrecision();
 int OPS_getEleTags();
 int OPS_getNodeTags();
+int OPS_nodeDispArray();
+int OPS_nodeVelArray();
+int OPS_nodeAccelArray();
+int OPS_eleResponseArray();
+int OPS_iterationStats();
 int OPS_getParamTags();
 int OPS_getParamValue();
 int OPS_sectionForce();
@@ -243,6 +259,7 @@ int OPS_basicDeformation();
 int OPS_basicForce();
 int OPS_basicStiffness();
 int OPS_version();
+int OPS_analysisProfile();
 int OPS_maxOpenFiles();
 
 /* OpenSeesMiscCommands.cpp */
@@ -260,6 +277,9 @@ int OPS_setElementRayleighDampingFactors();
 int OPS_MeshRegion();
 int OPS_peerNGA();
 int OPS_domainChange();
+int OPS_materialBatch();
+int OPS_recorderThreads();
+int OPS_recordCache();
 int OPS_record();
 int OPS_stripOpenSeesXML();
 int OPS_convertBinaryToText();
@@ -285,7 +305,9 @@ int OPS_Analysis();
 int OPS_analyze();
 int OPS_eigenAnalysis();
 int OPS_resetModel();
+int OPS_groundMotionBatch();
 int OPS_initializeAnalysis();
+int OPS_linearCache();
 int OPS_printA();
 int OPS_printB();
 int OPS_printModel();
@@ -315,6 +337,8 @@ void* OPS_NewtonLineSearch();
 
 /* Defined in its own class.cpp*/
 int OPS_Node();
+int OPS_Nodes();
+int OPS_Elements();
 int OPS_HomogeneousBC();
 int OPS_EqualDOF();
 int OPS_EqualDOF_Mixed();
@@ -322,6 +346,7 @@ int OPS_HomogeneousBC_X();
 int OPS_HomogeneousBC_Y();
 int OPS_HomogeneousBC_Z();
 int OPS_BackgroundMesh();
+int OPS_ContactSearch();
 int OPS_ShallowFoundationGen();
 
 void* OPS_TimeSeriesIntegrator();
@@ -358,6 +383,9 @@ void* OPS_CTestRelativeNormDispIncr();
 void* OPS_CTestRelativeEnergyIncr();
 void* OPS_CTestRelativeTotalNormDispIncr();
 
+void* OPS_ModalSuperpositionAnalysis();
+void* OPS_GroundMotionBatch();
+
 void* OPS_LoadControlIntegrator();
 void* OPS_DisplacementControlIntegrator();
 void* OPS_Newmark();
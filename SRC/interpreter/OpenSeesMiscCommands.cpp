@@ -42,6 +42,8 @@
 #include <RigidRod.h>
 #include <RigidBeam.h>
 #include <RigidDiaphragm.h>
+#include <UniaxialMaterialBatch.h>
+#include <RecordFileReader.h>
 
 int OPS_loadConst()
 {
@@ -611,6 +613,7 @@ int OPS_setElementRayleighDampingFactors()
 
     Element *theEle = theDomain->getElement(eleTag);
     theEle->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+    theDomain->propertiesChanged();
 
     return 0;
 }
@@ -1034,6 +1037,89 @@ int OPS_domainChange()
     return 0;
 }
 
+int OPS_materialBatch()
+{
+    // materialBatch <on|off>, returns the number of batched materials
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt, "on") == 0) {
+	    theDomain->setMaterialBatch(true);
+	} else if (strcmp(opt, "off") == 0) {
+	    theDomain->setMaterialBatch(false);
+	} else {
+	    opserr << "WARNING materialBatch <on|off>\n";
+	    return -1;
+	}
+    }
+
+    int numMat = 0;
+    UniaxialMaterialBatch* theBatch = theDomain->getMaterialBatch();
+    if (theBatch != 0)
+	numMat = theBatch->getNumMaterials();
+
+    int numdata = 1;
+    if (OPS_SetIntOutput(&numdata, &numMat) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_recorderThreads()
+{
+    // recorderThreads <numThreads>, returns the number of threads
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	int numThreads = 0;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &numThreads) < 0) {
+	    opserr << "WARNING recorderThreads <numThreads>\n";
+	    return -1;
+	}
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+	// the recorder streams of a parallel model communicate when written
+	if (numThreads > 0) {
+	    opserr << "WARNING recorderThreads is not available in a parallel model, ignored\n";
+	    numThreads = 0;
+	}
+#endif
+	theDomain->setRecorderThreads(numThreads);
+    }
+
+    int numThreads = theDomain->getRecorderThreads();
+    int numdata = 1;
+    if (OPS_SetIntOutput(&numdata, &numThreads) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_recordCache()
+{
+    // recordCache <dirName|off>, returns the cache directory
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* dirName = OPS_GetString();
+	if (strcmp(dirName, "off") == 0)
+	    dirName = 0;
+	OPS_SetRecordCache(dirName);
+    }
+
+    if (OPS_SetString(OPS_GetRecordCache()) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_record()
 {
     Domain* theDomain = OPS_GetDomain();
@@ -1356,6 +1442,7 @@ int OPS_addElementRayleigh()
 	opserr << "ERROR : setElementRayleighFactors: FAILED to add damping factors for element " << eleTag << "\n";
 	return -1;
     }
+    theDomain->propertiesChanged();
   
     return 0;
 }
@@ -25,6 +25,7 @@
 #include <elementAPI.h>
 #include <Domain.h>
 #include <Node.h>
+#include <NodalStateStore.h>
 #include <NodeIter.h>
 #include <Matrix.h>
 #include <LoadPattern.h>
@@ -32,6 +33,7 @@
 #include <ID.h>
 #include <Element.h>
 #include <ElementIter.h>
+#include <classTags.h>
 #include <map>
 #include <Recorder.h>
 #include <Pressure_Constraint.h>
@@ -40,6 +42,10 @@
 #include <ParameterIter.h>
 #include <DummyStream.h>
 #include <Response.h>
+#include <Profiler.h>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
 
 void* OPS_NodeRecorder();
 void* OPS_EnvelopeNodeRecorder();
@@ -47,6 +53,9 @@ void* OPS_ElementRecorder();
 void* OPS_EnvelopeElementRecorder();
 //void* OPS_DriftRecorder();
 //void* OPS_PatternRecorder();
+int OPS_SetDoubleDictOutput(const std::vector<std::string>& keys,
+			    const std::vector<double>& values);
+int OPS_SetDoubleArrayOutput(double *data, int numRows, int numCols);
 
 namespace {
 
@@ -2426,3 +2435,333 @@ int OPS_version()
 
     return 0;
 }
+
+int OPS_analysisProfile()
+{
+    // analysisProfile <on|off|reset> <-calls> <-json> <-file $fileName>
+    bool calls = false;
+    bool json = false;
+    const char* fileName = 0;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt, "on") == 0) {
+	    Profiler::setEnabled(true);
+	    return 0;
+	} else if (strcmp(opt, "off") == 0) {
+	    Profiler::setEnabled(false);
+	    return 0;
+	} else if (strcmp(opt, "reset") == 0) {
+	    Profiler::reset();
+	    return 0;
+	} else if (strcmp(opt, "-calls") == 0) {
+	    calls = true;
+	} else if (strcmp(opt, "-json") == 0) {
+	    json = true;
+	} else if (strcmp(opt, "-file") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1) {
+		opserr << "WARNING analysisProfile -file $fileName\n";
+		return -1;
+	    }
+	    fileName = OPS_GetString();
+	} else {
+	    opserr << "WARNING analysisProfile - unknown option " << opt << "\n";
+	    return -1;
+	}
+    }
+
+    if (fileName != 0) {
+	std::ofstream theFile(fileName);
+	if (!theFile) {
+	    opserr << "WARNING analysisProfile - could not open file " << fileName << "\n";
+	    return -1;
+	}
+	Profiler::writeJSON(theFile);
+	return 0;
+    }
+
+    if (json) {
+	std::ostringstream s;
+	Profiler::writeJSON(s);
+	if (OPS_SetString(s.str().c_str()) < 0) {
+	    opserr << "WARNING failed to set output\n";
+	    return -1;
+	}
+	return 0;
+    }
+
+    std::vector<std::string> paths;
+    std::vector<double> seconds, numCalls;
+    Profiler::getTotals(paths, seconds, numCalls);
+
+    if (OPS_SetDoubleDictOutput(paths, calls ? numCalls : seconds) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+// nodeDispArray, nodeVelArray, nodeAccelArray <nodeTag ...>
+//   return a copy of the trial response of the listed nodes, or of all the
+//   nodes in the order of getNodeTags, as a single numNodes x ndf array
+//   (rows padded with zeros up to the largest ndf). With no tags the array
+//   is copied in one block from the domain's NodalStateStore when all nodes
+//   share one ndf. The result does not follow the analysis; call the
+//   command again after each step.
+static int OPS_nodeResponseArray(NodeResponseType type, const char *cmd)
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    std::vector<Node *> nodes;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	int tag;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &tag) < 0) {
+	    opserr << "WARNING " << cmd << " <nodeTag ...> - invalid nodeTag\n";
+	    return -1;
+	}
+	Node *theNode = theDomain->getNode(tag);
+	if (theNode == 0) {
+	    opserr << "WARNING " << cmd << " - node " << tag << " does not exist\n";
+	    return -1;
+	}
+	nodes.push_back(theNode);
+    }
+
+    if (nodes.empty()) {
+	// single block copy when the store holds every node with the same ndf;
+	// the velocity and acceleration blocks only exist once a node uses them
+	NodalStateStore *theStore = theDomain->getNodalStateStore();
+	int block = NodalStateStore::TrialDisp;
+	if (type == Vel)
+	    block = NodalStateStore::TrialVel;
+	else if (type == Accel)
+	    block = NodalStateStore::TrialAccel;
+	if (theStore != 0 && theStore->isPacked() &&
+	    theStore->getUniformNDF() > 0 && theStore->getBlock(block) != 0) {
+	    int ndf = theStore->getUniformNDF();
+	    if (OPS_SetDoubleArrayOutput(theStore->getBlock(block),
+					 theStore->getNumDOF()/ndf, ndf) < 0) {
+		opserr << "WARNING " << cmd << " - failed to set output\n";
+		return -1;
+	    }
+	    return 0;
+	}
+
+	Node *theNode;
+	NodeIter &theNodes = theDomain->getNodes();
+	while ((theNode = theNodes()) != 0)
+	    nodes.push_back(theNode);
+    }
+
+    int numNodes = (int)nodes.size();
+    int numCols = 0;
+    for (int i=0; i<numNodes; i++)
+	if (nodes[i]->getNumberDOF() > numCols)
+	    numCols = nodes[i]->getNumberDOF();
+
+    std::vector<double> values(numNodes*numCols, 0.0);
+    for (int i=0; i<numNodes; i++) {
+	const Vector *theResponse;
+	if (type == Vel)
+	    theResponse = &nodes[i]->getTrialVel();
+	else if (type == Accel)
+	    theResponse = &nodes[i]->getTrialAccel();
+	else
+	    theResponse = &nodes[i]->getTrialDisp();
+	double *row = numCols > 0 ? &values[i*numCols] : 0;
+	for (int j=0; j<theResponse->Size(); j++)
+	    row[j] = (*theResponse)(j);
+    }
+
+    if (OPS_SetDoubleArrayOutput(numCols > 0 ? &values[0] : 0, numNodes, numCols) < 0) {
+	opserr << "WARNING " << cmd << " - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_nodeDispArray()
+{
+    return OPS_nodeResponseArray(Disp, "nodeDispArray");
+}
+
+int OPS_nodeVelArray()
+{
+    return OPS_nodeResponseArray(Vel, "nodeVelArray");
+}
+
+int OPS_nodeAccelArray()
+{
+    return OPS_nodeResponseArray(Accel, "nodeAccelArray");
+}
+
+// eleResponseArray <eleTag ...> -resp $arg1 $arg2 ...
+//   return the response of the listed elements, or of all the elements in
+//   the order of getEleTags, as a single numEle x size array; every element
+//   must return a response of the same size
+int OPS_eleResponseArray()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    std::vector<Element *> eles;
+    bool foundResp = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	int tag;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &tag) < 0) {
+	    OPS_ResetCurrentInputArg(-1);
+	    const char *opt = OPS_GetString();
+	    if (strcmp(opt, "-resp") == 0) {
+		foundResp = true;
+		break;
+	    }
+	    opserr << "WARNING eleResponseArray <eleTag ...> -resp args... - invalid input " << opt << "\n";
+	    return -1;
+	}
+	Element *theEle = theDomain->getElement(tag);
+	if (theEle == 0) {
+	    opserr << "WARNING eleResponseArray - element " << tag << " does not exist\n";
+	    return -1;
+	}
+	eles.push_back(theEle);
+    }
+
+    int argc = OPS_GetNumRemainingInputArgs();
+    if (foundResp == false || argc < 1) {
+	opserr << "WARNING want - eleResponseArray <eleTag ...> -resp args...\n";
+	return -1;
+    }
+    std::vector<const char *> argv(argc);
+    for (int i=0; i<argc; i++)
+	argv[i] = OPS_GetString();
+
+    if (eles.empty()) {
+	Element *theEle;
+	ElementIter &theEles = theDomain->getElements();
+	while ((theEle = theEles()) != 0)
+	    eles.push_back(theEle);
+    }
+
+    // gather the responses through setResponse, as eleResponse does
+    int numEle = (int)eles.size();
+    std::vector<double> data;
+    int numCols = -1;
+    DummyStream dummy;
+    for (int i=0; i<numEle; i++) {
+	int offset = (int)data.size();
+	Response *theResponse = eles[i]->setResponse(&argv[0], argc, dummy);
+	if (theResponse != 0) {
+	    if (theResponse->getResponse() >= 0) {
+		const Vector &theData = theResponse->getInformation().getData();
+		for (int j=0; j<theData.Size(); j++)
+		    data.push_back(theData(j));
+	    }
+	    delete theResponse;
+	}
+	int size = (int)data.size() - offset;
+	if (size == 0) {
+	    opserr << "WARNING eleResponseArray - element " << eles[i]->getTag()
+		   << " has no such response\n";
+	    return -1;
+	}
+	if (numCols < 0)
+	    numCols = size;
+	else if (size != numCols) {
+	    opserr << "WARNING eleResponseArray - element " << eles[i]->getTag()
+		   << " returned " << size << " values, expected " << numCols
+		   << "; query elements with the same response size together\n";
+	    return -1;
+	}
+    }
+    if (numCols < 0)
+	numCols = 0;
+
+    if (OPS_SetDoubleArrayOutput(numCols > 0 ? &data[0] : 0, numEle, numCols) < 0) {
+	opserr << "WARNING eleResponseArray - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+// iterationStats <-top $n>
+//   sum the local iteration statistics of the elements that record them
+//   (forceBeamColumn): numElements numUpdates numLocalIters numSubdivides
+//   numFailures; with -top the statistics of the $n elements with the most
+//   local iterations, as eleTag numUpdates numLocalIters numSubdivides
+//   numFailures for each
+int OPS_iterationStats()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int numTop = -1;
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	int numdata = 1;
+	if (strcmp(opt, "-top") != 0 || OPS_GetIntInput(&numdata, &numTop) < 0) {
+	    opserr << "WARNING iterationStats <-top $n> - invalid input\n";
+	    return -1;
+	}
+    }
+
+    // rows of eleTag and the four counters
+    std::vector<int> stats;
+    const char *argv[1] = {"iterationStats"};
+    DummyStream dummy;
+    Element *theEle;
+    ElementIter &theEles = theDomain->getElements();
+    while ((theEle = theEles()) != 0) {
+	// only the force-based elements record them; probing the others
+	// would have them warn about an unknown response
+	int classTag = theEle->getClassTag();
+	if (classTag != ELE_TAG_ForceBeamColumn2d &&
+	    classTag != ELE_TAG_ForceBeamColumn3d)
+	    continue;
+	Response *theResponse = theEle->setResponse(argv, 1, dummy);
+	if (theResponse == 0)
+	    continue;
+	if (theResponse->getResponse() >= 0) {
+	    const Vector &theData = theResponse->getInformation().getData();
+	    if (theData.Size() == 4) {
+		stats.push_back(theEle->getTag());
+		for (int j=0; j<4; j++)
+		    stats.push_back((int)theData(j));
+	    }
+	}
+	delete theResponse;
+    }
+    int numEle = (int)stats.size()/5;
+
+    std::vector<int> data;
+    if (numTop < 0) {
+	data.assign(5, 0);
+	data[0] = numEle;
+	for (int i=0; i<numEle; i++)
+	    for (int j=1; j<5; j++)
+		data[j] += stats[5*i+j];
+    } else {
+	std::vector<std::pair<int,int> > order(numEle);
+	for (int i=0; i<numEle; i++)
+	    order[i] = std::make_pair(-stats[5*i+2], i);
+	if (numTop > numEle)
+	    numTop = numEle;
+	std::partial_sort(order.begin(), order.begin()+numTop, order.end());
+	for (int i=0; i<numTop; i++)
+	    for (int j=0; j<5; j++)
+		data.push_back(stats[5*order[i].second+j]);
+    }
+
+    int size = (int)data.size();
+    if (OPS_SetIntOutput(&size, size > 0 ? &data[0] : 0) < 0) {
+	opserr << "WARNING iterationStats - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
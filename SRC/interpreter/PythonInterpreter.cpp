@@ -858,3 +858,17 @@ PythonInterpreter::setString(const char* str)
     return 0;
 }
 
+int
+PythonInterpreter::setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values)
+{
+    wrapper.setOutputs(keys, values);
+    return 0;
+}
+
+int
+PythonInterpreter::setDoubleArray(double *data, int numRows, int numCols)
+{
+    return wrapper.setOutputs(data, numRows, numCols);
+}
+
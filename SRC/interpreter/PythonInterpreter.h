@@ -59,6 +59,9 @@ class PythonInterpreter: public DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual int setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values);
+    virtual int setDoubleArray(double *data, int numRows, int numCols);
 
   private:
     PythonWrapper wrapper;
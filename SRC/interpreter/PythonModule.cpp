@@ -167,6 +167,14 @@ PythonModule::setString(const char* str)
     return 0;
 }
 
+int
+PythonModule::setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values)
+{
+    wrapper.setOutputs(keys, values);
+    return 0;
+}
+
 int
 PythonModule::runCommand(const char* cmd)
 {
@@ -64,6 +64,8 @@ class PythonModule: public DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual int setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values);
 
     // methods to run a command in the interpreter
     virtual int runCommand(const char*);
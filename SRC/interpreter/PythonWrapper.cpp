@@ -111,6 +111,46 @@ PythonWrapper::setOutputs(const char* str)
     currentResult = Py_BuildValue("s", str);
 }
 
+void
+PythonWrapper::setOutputs(const std::vector<std::string>& keys,
+			  const std::vector<double>& values)
+{
+    currentResult = PyDict_New();
+    for (int i=0; i<(int)keys.size() && i<(int)values.size(); i++) {
+	PyObject* value = PyFloat_FromDouble(values[i]);
+	PyDict_SetItemString(currentResult, keys[i].c_str(), value);
+	Py_DECREF(value);
+    }
+}
+
+int
+PythonWrapper::setOutputs(double* data, int numRows, int numCols)
+{
+    // the result is a memoryview of format 'd' and shape (numRows,numCols)
+    // so numpy.asarray() wraps it without copying; data is copied once into
+    // a bytearray owned by the result, so the result stays valid whatever
+    // later happens to the domain
+    Py_ssize_t len = (Py_ssize_t)numRows*numCols*sizeof(double);
+    PyObject* result = 0;
+
+    PyObject* owner = PyByteArray_FromStringAndSize((const char*)data, len);
+    if (owner == 0) return -1;
+    PyObject* bytes = PyMemoryView_FromObject(owner);
+    Py_DECREF(owner);
+    if (bytes == 0) return -1;
+    if (len == 0)
+	result = PyObject_CallMethod(bytes, (char*)"cast", (char*)"s", "d");
+    else
+	result = PyObject_CallMethod(bytes, (char*)"cast", (char*)"s(nn)", "d",
+				     (Py_ssize_t)numRows, (Py_ssize_t)numCols);
+    Py_DECREF(bytes);
+
+    if (result == 0) return -1;
+
+    currentResult = result;
+    return 0;
+}
+
 PyObject*
 PythonWrapper::getResults()
 {
@@ -218,6 +258,15 @@ static PyObject *Py_ops_node(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_nodes(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_Nodes() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_fix(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -236,6 +285,15 @@ static PyObject *Py_ops_element(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_elements(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_Elements() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_timeSeries(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -596,6 +654,15 @@ static PyObject *Py_ops_initialize(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_linearCache(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_linearCache() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_getLoadFactor(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -938,6 +1005,42 @@ static PyObject *Py_ops_domainChange(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_materialBatch(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_materialBatch() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_recorderThreads(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_recorderThreads() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_groundMotionBatch(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_groundMotionBatch() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_recordCache(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_recordCache() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_record(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1019,6 +1122,51 @@ static PyObject *Py_ops_getNodeTags(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_nodeDispArray(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_nodeDispArray() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_nodeVelArray(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_nodeVelArray() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_nodeAccelArray(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_nodeAccelArray() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_eleResponseArray(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_eleResponseArray() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_iterationStats(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_iterationStats() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_getParamTags(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1191,6 +1339,15 @@ static PyObject *Py_ops_version(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_analysisProfile(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_analysisProfile() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_setMaxOpenFiles(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1209,6 +1366,15 @@ static PyObject *Py_ops_background(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_contactSearch(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_ContactSearch() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_limitCurve(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1315,8 +1481,10 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("wipe", &Py_ops_wipe);
     addCommand("model", &Py_ops_model);
     addCommand("node", &Py_ops_node);
+    addCommand("nodes", &Py_ops_nodes);
     addCommand("fix", &Py_ops_fix);
     addCommand("element", &Py_ops_element);
+    addCommand("elements", &Py_ops_elements);
     addCommand("timeSeries", &Py_ops_timeSeries);
     addCommand("pattern", &Py_ops_pattern);
     addCommand("load", &Py_ops_nodalLoad);
@@ -1357,6 +1525,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("fixZ", &Py_ops_fixZ);
     addCommand("reset", &Py_ops_reset);
     addCommand("initialize", &Py_ops_initialize);
+    addCommand("linearCache", &Py_ops_linearCache);
     addCommand("getLoadFactor", &Py_ops_getLoadFactor);
     addCommand("build", &Py_ops_build);
     addCommand("printModel", &Py_ops_print);
@@ -1395,6 +1564,10 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("setPrecision", &Py_ops_setPrecision);
     addCommand("searchPeerNGA", &Py_ops_searchPeerNGA);
     addCommand("domainChange", &Py_ops_domainChange);
+    addCommand("materialBatch", &Py_ops_materialBatch);
+    addCommand("recorderThreads", &Py_ops_recorderThreads);
+    addCommand("groundMotionBatch", &Py_ops_groundMotionBatch);
+    addCommand("recordCache", &Py_ops_recordCache);
     addCommand("record", &Py_ops_record);
     addCommand("metaData", &Py_ops_metaData);
     addCommand("defaultUnits", &Py_ops_defaultUnits);
@@ -1404,6 +1577,11 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("convertTextToBinary", &Py_ops_convertTextToBinary);
     addCommand("getEleTags", &Py_ops_getEleTags);
     addCommand("getNodeTags", &Py_ops_getNodeTags);
+    addCommand("nodeDispArray", &Py_ops_nodeDispArray);
+    addCommand("nodeVelArray", &Py_ops_nodeVelArray);
+    addCommand("nodeAccelArray", &Py_ops_nodeAccelArray);
+    addCommand("eleResponseArray", &Py_ops_eleResponseArray);
+    addCommand("iterationStats", &Py_ops_iterationStats);
     addCommand("getParamTags", &Py_ops_getParamTags);
     addCommand("getParamValue", &Py_ops_getParamValue);
     addCommand("sectionForce", &Py_ops_sectionForce);
@@ -1423,8 +1601,10 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("numIter", &Py_ops_numIter);
     addCommand("systemSize", &Py_ops_systemSize);
     addCommand("version", &Py_ops_version);
+    addCommand("analysisProfile", &Py_ops_analysisProfile);
     addCommand("setMaxOpenFiles", &Py_ops_setMaxOpenFiles);
     addCommand("background", &Py_ops_background);
+    addCommand("contactSearch", &Py_ops_contactSearch);
     addCommand("limitCurve", &Py_ops_limitCurve);
     addCommand("imposedMotion", &Py_ops_imposedMotion);
     addCommand("imposedSupportMotion", &Py_ops_imposedMotion);
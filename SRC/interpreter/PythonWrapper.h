@@ -34,6 +34,7 @@
 #endif
 
 #include <vector>
+#include <string>
 
 class PythonWrapper
 {
@@ -61,6 +62,9 @@ public:
     void setOutputs(int* data, int numArgs);
     void setOutputs(double* data, int numArgs);
     void setOutputs(const char* str);
+    void setOutputs(const std::vector<std::string>& keys,
+		    const std::vector<double>& values);
+    int setOutputs(double* data, int numRows, int numCols);
     PyObject* getResults();
 
 private:
@@ -579,3 +579,11 @@ TclInterpreter::setString(const char* str)
     wrapper.setOutputs(interp, str);
     return 0;
 }
+
+int
+TclInterpreter::setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values)
+{
+    wrapper.setOutputs(interp, keys, values);
+    return 0;
+}
@@ -60,6 +60,8 @@ class TclInterpreter: public DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual int setDoubleDict(const std::vector<std::string> &keys,
+			      const std::vector<double> &values);
     
   private:
     Tcl_Obj *resultPtr;
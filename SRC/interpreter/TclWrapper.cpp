@@ -90,6 +90,18 @@ TclWrapper::setOutputs(Tcl_Interp* interp, const char* str)
     Tcl_SetResult(interp, (char*)str, TCL_VOLATILE);
 }
 
+void
+TclWrapper::setOutputs(Tcl_Interp* interp, const std::vector<std::string>& keys,
+		       const std::vector<double>& values)
+{
+    Tcl_Obj* dict = Tcl_NewDictObj();
+    for (int i=0; i<(int)keys.size() && i<(int)values.size(); i++) {
+	Tcl_DictObjPut(interp, dict, Tcl_NewStringObj(keys[i].c_str(), -1),
+		       Tcl_NewDoubleObj(values[i]));
+    }
+    Tcl_SetObjResult(interp, dict);
+}
+
 ///////////////////////////////////////////
 /////// Tcl wrapper functions  ////////////
 ///////////////////////////////////////////
@@ -173,6 +185,14 @@ static int Tcl_ops_node(ClientData clientData, Tcl_Interp *interp, int argc,   T
     return TCL_OK;
 }
 
+static int Tcl_ops_nodes(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_Nodes() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_fix(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -189,6 +209,14 @@ static int Tcl_ops_element(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_elements(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_Elements() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_timeSeries(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -517,6 +545,14 @@ static int Tcl_ops_initialize(ClientData clientData, Tcl_Interp *interp, int arg
     return TCL_OK;
 }
 
+static int Tcl_ops_linearCache(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_linearCache() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_getLoadFactor(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -797,6 +833,38 @@ static int Tcl_ops_domainChange(ClientData clientData, Tcl_Interp *interp, int a
     return TCL_OK;
 }
 
+static int Tcl_ops_materialBatch(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_materialBatch() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_recorderThreads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_recorderThreads() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_groundMotionBatch(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_groundMotionBatch() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_recordCache(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_recordCache() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_metaData(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -853,6 +921,46 @@ static int Tcl_ops_getNodeTags(ClientData clientData, Tcl_Interp *interp, int ar
     return TCL_OK;
 }
 
+static int Tcl_ops_nodeDispArray(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_nodeDispArray() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_nodeVelArray(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_nodeVelArray() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_nodeAccelArray(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_nodeAccelArray() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_eleResponseArray(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_eleResponseArray() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_iterationStats(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_iterationStats() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_getParamTags(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1005,6 +1113,14 @@ static int Tcl_ops_version(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_analysisProfile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_analysisProfile() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_setMaxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1021,6 +1137,14 @@ static int Tcl_ops_background(ClientData clientData, Tcl_Interp *interp, int arg
     return TCL_OK;
 }
 
+static int Tcl_ops_contactSearch(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_ContactSearch() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_limitCurve(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1117,8 +1241,10 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"wipe", &Tcl_ops_wipe);
     addCommand(interp,"model", &Tcl_ops_model);
     addCommand(interp,"node", &Tcl_ops_node);
+    addCommand(interp,"nodes", &Tcl_ops_nodes);
     addCommand(interp,"fix", &Tcl_ops_fix);
     addCommand(interp,"element", &Tcl_ops_element);
+    addCommand(interp,"elements", &Tcl_ops_elements);
     addCommand(interp,"timeSeries", &Tcl_ops_timeSeries);
     addCommand(interp,"pattern", &Tcl_ops_pattern);
     addCommand(interp,"load", &Tcl_ops_nodalLoad);
@@ -1160,6 +1286,7 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"fixZ", &Tcl_ops_fixZ);
     addCommand(interp,"reset", &Tcl_ops_reset);
     addCommand(interp,"initialize", &Tcl_ops_initialize);
+    addCommand(interp,"linearCache", &Tcl_ops_linearCache);
     addCommand(interp,"getLoadFactor", &Tcl_ops_getLoadFactor);
     addCommand(interp,"build", &Tcl_ops_build);
     addCommand(interp,"Print", &Tcl_ops_print);
@@ -1195,6 +1322,10 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"setPrecision", &Tcl_ops_setPrecision);
     addCommand(interp,"searchPeerNGA", &Tcl_ops_searchPeerNGA);
     addCommand(interp,"domainChange", &Tcl_ops_domainChange);
+    addCommand(interp,"materialBatch", &Tcl_ops_materialBatch);
+    addCommand(interp,"recorderThreads", &Tcl_ops_recorderThreads);
+    addCommand(interp,"groundMotionBatch", &Tcl_ops_groundMotionBatch);
+    addCommand(interp,"recordCache", &Tcl_ops_recordCache);
     addCommand(interp,"metaData", &Tcl_ops_metaData);
     addCommand(interp,"neesUpload", &Tcl_ops_neesUpload);
     addCommand(interp,"stripXML", &Tcl_ops_stripXML);
@@ -1202,6 +1333,11 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"convertTextToBinary", &Tcl_ops_convertTextToBinary);
     addCommand(interp,"getEleTags", &Tcl_ops_getEleTags);
     addCommand(interp,"getNodeTags", &Tcl_ops_getNodeTags);
+    addCommand(interp,"nodeDispArray", &Tcl_ops_nodeDispArray);
+    addCommand(interp,"nodeVelArray", &Tcl_ops_nodeVelArray);
+    addCommand(interp,"nodeAccelArray", &Tcl_ops_nodeAccelArray);
+    addCommand(interp,"eleResponseArray", &Tcl_ops_eleResponseArray);
+    addCommand(interp,"iterationStats", &Tcl_ops_iterationStats);
     addCommand(interp,"getParamTags", &Tcl_ops_getParamTags);
     addCommand(interp,"getParamValue", &Tcl_ops_getParamValue);
     addCommand(interp,"sectionForce", &Tcl_ops_sectionForce);
@@ -1221,8 +1357,10 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"numIter", &Tcl_ops_numIter);
     addCommand(interp,"systemSize", &Tcl_ops_systemSize);
     addCommand(interp,"version", &Tcl_ops_version);
+    addCommand(interp,"analysisProfile", &Tcl_ops_analysisProfile);
     addCommand(interp,"setMaxOpenFiles", &Tcl_ops_setMaxOpenFiles);
     addCommand(interp,"background", &Tcl_ops_background);
+    addCommand(interp,"contactSearch", &Tcl_ops_contactSearch);
     addCommand(interp,"limitCurve", &Tcl_ops_limitCurve);
     addCommand(interp,"imposedMotion", &Tcl_ops_imposedMotion);
     addCommand(interp,"imposedSupportMotion", &Tcl_ops_imposedMotion);
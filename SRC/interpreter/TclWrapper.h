@@ -27,6 +27,8 @@
 
 #include <OPS_Globals.h>
 #include <tcl.h>
+#include <string>
+#include <vector>
 
 class TclWrapper
 {
@@ -53,6 +55,8 @@ public:
     void setOutputs(Tcl_Interp* interp, int* data, int numArgs);
     void setOutputs(Tcl_Interp* interp, double* data, int numArgs);
     void setOutputs(Tcl_Interp* interp, const char* str);
+    void setOutputs(Tcl_Interp* interp, const std::vector<std::string>& keys,
+		    const std::vector<double>& values);
 
 private:
 
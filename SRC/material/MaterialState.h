@@ -0,0 +1,94 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class template definition for
+// MaterialState. A MaterialState<N> holds N history variables of a
+// material twice, in two contiguous blocks stored inside the material
+// object. One block is the trial state and one the committed state; they
+// are selected by an index, so commitState() and revertToLastCommit()
+// are an index assignment instead of a copy of every variable.
+//
+// After commit() or revert() both indices refer to the same block. The
+// first beginTrial() after that moves the trial state to the other block,
+// copying the committed values into it unless the material sets every
+// trial variable itself (copyCommitted = false).
+//
+// It is opt-in: a material keeps its variables at fixed offsets into the
+// blocks instead of in separate trial and committed data members.
+
+#ifndef MaterialState_h
+#define MaterialState_h
+
+template <int N>
+class MaterialState
+{
+  public:
+    MaterialState();
+
+    inline const double *getTrial(void) const {return data[trial];}
+    inline const double *getCommitted(void) const {return data[committed];}
+
+    // start modifying the trial state
+    inline double *beginTrial(bool copyCommitted = true);
+
+    // the trial state becomes the committed state
+    inline void commit(void) {committed = trial;}
+
+    // the trial state goes back to the committed state
+    inline void revert(void) {trial = committed;}
+
+    // the committed state, for revertToStart() and recvSelf(); the trial
+    // state is set back to it
+    inline double *setCommitted(void) {trial = committed; return data[committed];}
+
+  private:
+    double data[2][N];
+    int trial, committed;
+};
+
+
+template <int N>
+MaterialState<N>::MaterialState()
+:trial(0), committed(0)
+{
+  for (int i=0; i<N; i++) {
+    data[0][i] = 0.0;
+    data[1][i] = 0.0;
+  }
+}
+
+
+template <int N>
+inline double *
+MaterialState<N>::beginTrial(bool copyCommitted)
+{
+  if (trial == committed) {
+    trial = 1 - committed;
+    if (copyCommitted) {
+      const double *c = data[committed];
+      double *t = data[trial];
+      for (int i=0; i<N; i++)
+	t[i] = c[i];
+    }
+  }
+  return data[trial];
+}
+
+#endif
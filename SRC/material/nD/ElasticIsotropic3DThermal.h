@@ -55,6 +55,7 @@ class ElasticIsotropic3DThermal : public ElasticIsotropicMaterialThermal
     int setTrialStrainIncr (const Vector &v, const Vector &r);
     const Matrix &getTangent (void);
     const Matrix &getInitialTangent (void);
+    bool isLinear(void) {return false;};
 
 	double setThermalTangentAndElongation(double &TempT, double &, double &);//J.Jiang add
     const Vector& getTempAndElong( void);
@@ -67,6 +67,7 @@ class ElasticIsotropicMaterial : public NDMaterial
     virtual int setTrialStrainIncr (const Vector &v, const Vector &r);
     virtual const Matrix &getTangent (void);
     virtual const Matrix &getInitialTangent (void);
+    virtual bool isLinear(void) {return true;};
     virtual const Vector &getStress (void);
     virtual const Vector &getStrain (void);
 
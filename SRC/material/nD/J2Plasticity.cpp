@@ -120,10 +120,6 @@ void J2Plasticity :: zero ( )
 //null constructor
 J2Plasticity ::  J2Plasticity( ) : 
 NDMaterial( ),
-epsilon_p_n(3,3),
-epsilon_p_nplus1(3,3),
-stress(3,3),
-strain(3,3),
 parameterID(0)
 { 
   bulk        = 0.0 ;
@@ -208,10 +204,6 @@ J2Plasticity :: J2Plasticity(int    tag,
 			     double r) 
 : 
   NDMaterial(tag, classTag),
-  epsilon_p_n(3,3),
-  epsilon_p_nplus1(3,3),
-  stress(3,3),
-  strain(3,3),
   parameterID(0)
 {
   bulk        = K ;
@@ -290,10 +282,6 @@ J2Plasticity(   int    tag,
                 double K, 
                 double G ) :
 NDMaterial(tag, classTag),
-epsilon_p_n(3,3),
-epsilon_p_nplus1(3,3),
-stress(3,3),
-strain(3,3),
 parameterID(0)
 {
   bulk        = K ;
@@ -443,11 +431,11 @@ void J2Plasticity :: plastic_integrator( )
 
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  static MatrixN<3,3> dev_strain ; //deviatoric strain
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static MatrixN<3,3> dev_stress ; //deviatoric stress
  
-  static Matrix normal(3,3) ;     //normal to yield surface
+  static MatrixN<3,3> normal ;     //normal to yield surface
 
   double NbunN ; //normal bun normal 
 
@@ -503,7 +491,8 @@ void J2Plasticity :: plastic_integrator( )
 
   if ( norm_tau > tolerance ) {
     inv_norm_tau = 1.0 / norm_tau ;
-    normal =  inv_norm_tau * dev_stress ;
+    normal = dev_stress ;
+    normal *= inv_norm_tau ;
   }
   else {
     normal.Zero( ) ;
@@ -549,13 +538,17 @@ void J2Plasticity :: plastic_integrator( )
 
      //update plastic internal variables
 
-     epsilon_p_nplus1 = epsilon_p_n + gamma*normal ;
+     //   epsilon_p_nplus1 = epsilon_p_n + gamma*normal ;
+     epsilon_p_nplus1 = epsilon_p_n ;
+     epsilon_p_nplus1.addMatrix( 1.0, normal, gamma ) ;
 
      xi_nplus1 = xi_n + root23*gamma ;
 
      //recompute deviatoric stresses 
 
-     dev_stress = (2.0*shear) * ( dev_strain - epsilon_p_nplus1 ) ;
+     //   dev_stress = (2.0*shear) * ( dev_strain - epsilon_p_nplus1 ) ;
+     dev_stress = dev_strain ;
+     dev_stress.addMatrix( 2.0*shear, epsilon_p_nplus1, -2.0*shear ) ;
 
      //compute the terms for plastic part of tangent
 
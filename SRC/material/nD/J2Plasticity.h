@@ -53,6 +53,7 @@
 
 #include <Vector.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 #include <NDMaterial.h>
 
 
@@ -126,20 +127,20 @@ class J2Plasticity : public NDMaterial {
   double eta ;         //viscosity
 
   //internal variables
-  Matrix epsilon_p_n ;       // plastic strain time n
-  Matrix epsilon_p_nplus1 ;  // plastic strain time n+1
+  MatrixN<3,3> epsilon_p_n ;       // plastic strain time n
+  MatrixN<3,3> epsilon_p_nplus1 ;  // plastic strain time n+1
   double xi_n ;              // xi time n
   double xi_nplus1 ;         // xi time n+1
 
   //material response 
-  Matrix stress ;                //stress tensor
+  MatrixN<3,3> stress ;                //stress tensor
   double tangent[3][3][3][3] ;   //material tangent
   static double initialTangent[3][3][3][3] ;   //material tangent
   static double IIdev[3][3][3][3] ; //rank 4 deviatoric 
   static double IbunI[3][3][3][3] ; //rank 4 I bun I 
 
   //material input
-  Matrix strain ;               //strain tensor
+  MatrixN<3,3> strain ;               //strain tensor
 
   //parameters
   static const double one3 ;
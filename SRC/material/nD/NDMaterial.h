@@ -62,6 +62,7 @@ class NDMaterial : public Material
     virtual int setTrialStrainIncr(const Vector &v, const Vector &r);
     virtual const Matrix &getTangent(void);
     virtual const Matrix &getInitialTangent(void) {return this->getTangent();};
+    virtual bool isLinear(void) {return false;};  // tangent independent of state
 
 	//Added by L.Jiang, [SIF]
 	virtual double getThermalTangentAndElongation(double &TempT, double &, double &);
@@ -55,6 +55,7 @@ class PressureDependentElastic3D : public ElasticIsotropicMaterial
     int setTrialStrainIncr (const Vector &v, const Vector &r);
     const Matrix &getTangent (void);
     const Matrix &getInitialTangent (void);
+    bool isLinear(void) {return false;};
 
     const Vector &getStress (void);
     const Vector &getStrain (void);
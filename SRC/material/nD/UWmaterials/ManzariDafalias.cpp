@@ -309,7 +309,7 @@ ManzariDafalias::getCopy(const char *type)
 int 
 ManzariDafalias::commitState(void)
 {
-    Vector n(6), d(6), b(6), R(6);
+    VectorN<6> n, d, b, R;
     double cos3Theta, h, psi, aB, aD, b0, A, D, B, C;
 
     mAlpha_in_n = mAlpha_in;
@@ -699,7 +699,7 @@ void
 ManzariDafalias::initialize()
 {
     // set Initial Ce with p = p_atm
-    Vector mSig(6);
+    VectorN<6> mSig;
     mSig(0) = m_P_atm;
     mSig(1) = m_P_atm;
     mSig(2) = m_P_atm;
@@ -772,7 +772,7 @@ ManzariDafalias::getAlpha_in()
 void ManzariDafalias::integrate() 
 {
     // update alpha_in in case of unloading
-    Vector n_tr(6);
+    VectorN<6> n_tr;
     n_tr = GetNormalToYield(mSigma_n + mCe*(mEpsilon - mEpsilon_n), mAlpha_n);
 
     if (DoubleDot2_2_Contr(mAlpha_n - mAlpha_in_n,n_tr) < 0.0)
@@ -804,7 +804,7 @@ void ManzariDafalias::elastic_integrator(const Vector& CurStress, const Vector&
         const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
         double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
-    Vector dStrain(6);
+    VectorN<6> dStrain;
     
     // calculate elastic response
     dStrain               = NextStrain - CurStrain;
@@ -861,7 +861,7 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
             break;
     }
     double elasticRatio, p, pn, f, fn;
-    Vector dSigma(6), dStrain(6);
+    VectorN<6> dSigma, dStrain;
     bool   p_tr_pos = true;
 
     NextVoidRatio        = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
@@ -954,7 +954,7 @@ void ManzariDafalias::MaxStrainInc(const Vector& CurStress, const Vector& CurStr
     
     NextDGamma = 0;
 
-    Vector StrainInc(6); StrainInc = NextStrain - CurStrain;
+    VectorN<6> StrainInc; StrainInc = NextStrain - CurStrain;
     double maxInc = StrainInc(0);
     for(int ii=1; ii < 6; ii++)
         if(fabs(StrainInc(ii)) > fabs(maxInc)) 
@@ -963,9 +963,9 @@ void ManzariDafalias::MaxStrainInc(const Vector& CurStress, const Vector& CurStr
         int numSteps = (int)floor(fabs(maxInc) / maxStrainInc) + 1;
         StrainInc = (NextStrain - CurStrain) / numSteps;    
     
-        Vector cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
-        Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6), nAlpha_in(6);
-        Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
+        VectorN<6> cStress, cStrain, cAlpha, cFabric, cAlpha_in, cEStrain;
+        VectorN<6> nStrain ,nEStrain, nStress, nAlpha, nFabric, nAlpha_in;
+        MatrixN<6,6> nCe, nCep, nCepC;
         double nDGamma, nVoidRatio, nG, nK;
                 
         // create temporary variables
@@ -988,7 +988,7 @@ void ManzariDafalias::MaxStrainInc(const Vector& CurStress, const Vector& CurStr
         NextAlpha            = nAlpha;
         NextFabric            = nFabric;
 
-        Vector n(6), d(6), b(6), R(6), dPStrain(6); 
+        VectorN<6> n, d, b, R, dPStrain; 
         double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
         GetStateDependent(NextStress, NextAlpha, NextFabric, NextVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, 
                 alphaDtheta, b0,A, D, B, C, R);
@@ -1048,14 +1048,14 @@ void ManzariDafalias::MaxEnergyInc(const Vector& CurStress, const Vector& CurStr
     if ((DoubleDot2_2_Mixed(NextStrain - CurStrain, NextStress - CurStress) > TolE))     // || (DoubleDot2_2_Mixed(NextStress - CurStress, NextStress - CurStress) > TolE))
     {
         if (debugFlag) opserr << "******* Energy Inc > tol --> use sub-stepping" << endln;
-        Vector StrainInc(6); StrainInc = NextStrain - CurStrain;
+        VectorN<6> StrainInc; StrainInc = NextStrain - CurStrain;
         StrainInc = (NextStrain - CurStrain) / 2;    
     
-        Vector cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
-        Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6), nAlpha_in(6);
-        Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
+        VectorN<6> cStress, cStrain, cAlpha, cFabric, cAlpha_in, cEStrain;
+        VectorN<6> nStrain ,nEStrain, nStress, nAlpha, nFabric, nAlpha_in;
+        MatrixN<6,6> nCe, nCep, nCepC;
         double nDGamma, nVoidRatio, nG, nK;
-        Vector n(6), d(6), b(6), R(6), dPStrain(6); 
+        VectorN<6> n, d, b, R, dPStrain; 
         //double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
                 
         // create temporary variables
@@ -1103,17 +1103,17 @@ void ManzariDafalias::ForwardEuler(const Vector& CurStress, const Vector& CurStr
     NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
     aC = GetStiffness(K, G);
-    Vector n(6), d(6), b(6), R(6), dPStrain(6); 
+    VectorN<6> n, d, b, R, dPStrain; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
     GetStateDependent(CurStress, CurAlpha, CurFabric, CurVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,
         A, D, B, C, R);
     double dVolStrain = GetTrace(NextStrain - CurStrain);
-    Vector dDevStrain = GetDevPart(NextStrain - CurStrain);
+    VectorN<6> dDevStrain = GetDevPart(NextStrain - CurStrain);
     double p = one3 * GetTrace(CurStress);
 
-    Vector r(6);
+    VectorN<6> r;
     if (p > small)
-        Vector r = GetDevPart(CurStress) / p;
+        VectorN<6> r = GetDevPart(CurStress) / p;
 
     double Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
     
@@ -1124,15 +1124,15 @@ void ManzariDafalias::ForwardEuler(const Vector& CurStress, const Vector& CurStr
     if (fabs(temp4) < small) temp4 = small;
 
     NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
-    Vector dSigma   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
+    VectorN<6> dSigma   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
               (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
-    Vector dAlpha   = Macauley(NextDGamma) * two3 * h * b;
-    Vector dFabric  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
+    VectorN<6> dAlpha   = Macauley(NextDGamma) * two3 * h * b;
+    VectorN<6> dFabric  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
            dPStrain = NextDGamma * ToCovariant(R);
 
-    Matrix temp1 = 2.0*G*mIIdevMix + K*mIIvol;
-    Vector temp2 = 2.0*G*n - DoubleDot2_2_Contr(n,r)*mI1;
-    Vector temp3 = 2.0*G*(B*n-C*(SingleDot(n,n)-one3*mI1)) + K*D*mI1;
+    MatrixN<6,6> temp1 = 2.0*G*mIIdevMix + K*mIIvol;
+    VectorN<6> temp2 = 2.0*G*n - DoubleDot2_2_Contr(n,r)*mI1;
+    VectorN<6> temp3 = 2.0*G*(B*n-C*(SingleDot(n,n)-one3*mI1)) + K*D*mI1;
 
     aCep = temp1 - MacauleyIndex(NextDGamma) * Dyadic2_2(temp3, temp2) / temp4;
     aCep_Consistent = aCep;
@@ -1152,15 +1152,15 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
     double dVolStrain;
-    Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
+    VectorN<6> n, d, b, R, dDevStrain, r; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,A, B, C, D, p, Kp;
 
     double T = 0.0, dT = 1.0, dT_min = 1e-6 , TolE = 1e-4;
     
-    Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
-    Vector dSigma1(6), dSigma2(6), dAlpha1(6), dAlpha2(6), dFabric1(6), dFabric2(6),
-           dPStrain1(6), dPStrain2(6);
-    Matrix aCep1(6,6), aCep2(6,6), aCep_thisStep(6,6), aD(6,6);
+    VectorN<6> nStress, nAlpha, nFabric, ndPStrain;
+    VectorN<6> dSigma1, dSigma2, dAlpha1, dAlpha2, dFabric1, dFabric2,
+           dPStrain1, dPStrain2;
+    MatrixN<6,6> aCep1, aCep2, aCep_thisStep, aD;
     double temp4, curStepError, q = 1.0;
 
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1358,15 +1358,15 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
     double CurVoidRatio, dVolStrain;
-    Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
+    VectorN<6> n, d, b, R, dDevStrain, r; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,A, B, C, D, p, Kp;
 
     double T = 0.0, dT = 1.0;
-    Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
-    Vector dSigma1(6), dSigma2(6), dSigma3(6), dSigma4(6), dSigma(6), 
-        dAlpha1(6), dAlpha2(6), dAlpha3(6), dAlpha4(6), dAlpha(6), 
-        dFabric1(6), dFabric2(6), dFabric3(6), dFabric4(6), dFabric(6),
-        dPStrain1(6), dPStrain2(6), dPStrain3(6), dPStrain4(6), dPStrain(6);
+    VectorN<6> nStress, nAlpha, nFabric, ndPStrain;
+    VectorN<6> dSigma1, dSigma2, dSigma3, dSigma4, dSigma, 
+        dAlpha1, dAlpha2, dAlpha3, dAlpha4, dAlpha, 
+        dFabric1, dFabric2, dFabric3, dFabric4, dFabric,
+        dPStrain1, dPStrain2, dPStrain3, dPStrain4, dPStrain;
     double temp4, q;
     
     CurVoidRatio      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
@@ -1542,8 +1542,8 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
         return -3;
     }
 
-    Vector TrialStress(6);
-    Matrix aC(6,6), aCep(6,6), aCepConsistent(6,6);
+    VectorN<6> TrialStress;
+    MatrixN<6,6> aC, aCep, aCepConsistent;
     double CurVoidRatio;
 
     CurVoidRatio      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
@@ -1658,9 +1658,9 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
                 if (errFlag == -1) SchemeControl = 3; // do an explicit integration
                 if (errFlag == -2) SchemeControl = 2; // do sub-stepping
 
-                Vector StrainInc(6), cStress(6), cStrain(6), cAlpha(6), cFabric(6), cAlpha_in(6), cEStrain(6);
-                Vector nStrain(6) ,nEStrain(6), nStress(6), nAlpha(6), nFabric(6);
-                Matrix nCe(6,6), nCep(6,6), nCepC(6,6);
+                VectorN<6> StrainInc, cStress, cStrain, cAlpha, cFabric, cAlpha_in, cEStrain;
+                VectorN<6> nStrain ,nEStrain, nStress, nAlpha, nFabric;
+                MatrixN<6,6> nCe, nCep, nCepC;
                 double nDGamma, nVoidRatio, nG, nK;
                 int numSteps;
 
@@ -1774,7 +1774,7 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
         }
 
 
-        Vector n(6), d(6), b(6), R(6), dPStrain(6); 
+        VectorN<6> n, d, b, R, dPStrain; 
         double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
         GetStateDependent(NextStress, NextAlpha, NextFabric, NextVoidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, 
                 alphaDtheta, b0, A, D, B, C, R);
@@ -1800,7 +1800,7 @@ ManzariDafalias::IntersectionFactor(const Vector& CurStress, const Vector& CurSt
 {
     double a = a0;
     double G, K, vR, f, f0, f1;
-    Vector dSigma(6), dSigma0(6), dSigma1(6), strainInc(6);
+    VectorN<6> dSigma, dSigma0, dSigma1, strainInc;
 
     strainInc = NextStrain - CurStrain;
 
@@ -1853,7 +1853,7 @@ ManzariDafalias::IntersectionFactor_Unloading(const Vector& CurStress, const Vec
     double a = 0.0, a0 = 0.0 , a1 = 1.0, da;
     double G, K, vR, f;
     int nSub = 20;
-    Vector dSigma(6), dSigma0(6), dSigma1(6), strainInc(6);
+    VectorN<6> dSigma, dSigma0, dSigma1, strainInc;
 
     strainInc = NextStrain - CurStrain;
     
@@ -1898,8 +1898,8 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
 {
 
-    Vector n(6), d(6), b(6), dPStrain(6), R(6), devStress(6), dSigma(6), dAlpha(6), dSigmaP(6), aBar(6), zBar(6);
-    Vector r(6), dfrOverdSigma(6), dfrOverdAlpha(6);
+    VectorN<6> n, d, b, dPStrain, R, devStress, dSigma, dAlpha, dSigmaP, aBar, zBar;
+    VectorN<6> r, dfrOverdSigma, dfrOverdAlpha;
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0;
     double A, B, C, D, p, fr, lambda, NextDLambda;
     int maxIter = 50;
@@ -1926,7 +1926,7 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
             NextDGamma  = 0.0;
             NextDLambda = 0.0;
 
-            Vector N(6); N = GetDevPart(NextStress) - p*NextAlpha;
+            VectorN<6> N; N = GetDevPart(NextStress) - p*NextAlpha;
             double fr1  = GetNorm_Contr(N)-root23*m_m*p;
             double fr2  = m_Pmin - p;
             double J11, J12, J21, J22;
@@ -1960,7 +1960,7 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
 
             p = one3 * GetTrace(NextStress);
 
-            Vector dPStrain(6);
+            VectorN<6> dPStrain;
             dPStrain = ToCovariant(NextDGamma * R + one3*(NextDGamma*D - NextDLambda) * mI1);
             NextElasticStrain -= dPStrain;
             NextStress -= aC * dPStrain;
@@ -2179,7 +2179,7 @@ ManzariDafalias::NewtonIter2(const Vector& xo, const Vector& inVar, Vector& sol,
     int errFlag = 0;
     
     // residuals and incremenets
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     Vector del(19), res(19), res2(19);
     double normR1 = 1.0, alpha = 1.0;
     double aNormR1 = 1.0, aNormR2 = 1.0;
@@ -2352,17 +2352,17 @@ ManzariDafalias::NewtonIter2(const Vector& xo, const Vector& inVar, Vector& sol,
 Vector
 ManzariDafalias::NewtonRes(const Vector& x, const Vector& inVar)
 {
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, voidRatio;
     // state dependent variables
-    Matrix aD(6,6);
-    Vector n(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+    MatrixN<6,6> aD;
+    VectorN<6> n, d, b, R, devStress, r, aBar, zBar; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
         
     // residuals
-    Vector R1(6); Vector R2(6); Vector R3(6); double R4;
+    VectorN<6> R1, R2, R3; double R4;
     
     // read the trial values
     stress.Extract(x, 0, 1.0);
@@ -2418,41 +2418,41 @@ ManzariDafalias::NewtonRes(const Vector& x, const Vector& inVar)
 int 
 ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, Matrix& Cep)
 {
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, voidRatio;
     // state dependent variables
-    Matrix aD(6,6), aC(6,6);
-    Vector n(6), n2(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+    MatrixN<6,6> aD, aC;
+    VectorN<6> n, n2, d, b, R, devStress, r, aBar, zBar; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D, p, normR, gc;
         
     // analytical Jacobian
     double AlphaAlphaInDotN;
     // Differentials of quantities with respect to Sigma
-    Matrix dnOverdSigma(6,6), dAbarOverdSigma(6,6), dROverdSigma(6,6), dZbarOverdSigma(6,6);
-    Vector dPsiOverdSigma(6), db0OverdSigma(6), dCos3ThetaOverdSigma(6), dAdOverdSigma(6), dhOverdSigma(6),
-        dgOverdSigma(6), dAlphaDOverdSigma(6), dCOverdSigma(6), dBOverdSigma(6), dAlphaBOverdSigma(6), dDOverdSigma(6);
+    MatrixN<6,6> dnOverdSigma, dAbarOverdSigma, dROverdSigma, dZbarOverdSigma;
+    VectorN<6> dPsiOverdSigma, db0OverdSigma, dCos3ThetaOverdSigma, dAdOverdSigma, dhOverdSigma,
+        dgOverdSigma, dAlphaDOverdSigma, dCOverdSigma, dBOverdSigma, dAlphaBOverdSigma, dDOverdSigma;
     // Differentials of quantities with respect to Alpha
-    Matrix dnOverdAlpha(6,6), dAbarOverdAlpha(6,6), dROverdAlpha(6,6), dZbarOverdAlpha(6,6);
-    Vector dCos3ThetaOverdAlpha(6), dAdOverdAlpha(6), dhOverdAlpha(6), dgOverdAlpha(6), dAlphaDOverdAlpha(6), 
-        dCOverdAlpha(6), dBOverdAlpha(6), dAlphaBOverdAlpha(6), dDOverdAlpha(6);
+    MatrixN<6,6> dnOverdAlpha, dAbarOverdAlpha, dROverdAlpha, dZbarOverdAlpha;
+    VectorN<6> dCos3ThetaOverdAlpha, dAdOverdAlpha, dhOverdAlpha, dgOverdAlpha, dAlphaDOverdAlpha, 
+        dCOverdAlpha, dBOverdAlpha, dAlphaBOverdAlpha, dDOverdAlpha;
     // Differentials of quantities with respect to Fabric
-    Matrix dZbarOverdFabric(6,6), dROverdFabric(6,6);
-    Vector dAdOverdFabric(6), dDOverdFabric(6), dfOverdSigma(6), dfOverdAlpha(6);
+    MatrixN<6,6> dZbarOverdFabric, dROverdFabric;
+    VectorN<6> dAdOverdFabric, dDOverdFabric, dfOverdSigma, dfOverdAlpha;
 
     // Variables needed to solve the system of equations
-    Matrix    DAlpha(6,6), DFabric(6,6), DSigma(6,6);
-    Matrix    CAlpha(6,6), CFabric(6,6), CSigma(6,6), ASigma(6,6), ZSigma(6,6);
-    Vector    ALambda(6), AConstant(6), ZLambda(6), ZConstant(6), LSigma(6), 
-            SLambda(6), SConstant(6);
+    MatrixN<6,6> DAlpha, DFabric, DSigma;
+    MatrixN<6,6> CAlpha, CFabric, CSigma, ASigma, ZSigma;
+    VectorN<6>    ALambda, AConstant, ZLambda, ZConstant, LSigma, 
+            SLambda, SConstant;
     double    LConstant;
 
     // Flags to consider the threshold values
     double dpFlag = 1.0, dnFlag = 1.0, dhFlag = 1.0;
     
     // residuals
-    Vector R1(6); Vector R2(6); Vector R3(6); double R4;
+    VectorN<6> R1, R2, R3; double R4;
     
     // read the trial values
     stress.Extract(xo, 0, 1.0);
@@ -2603,13 +2603,13 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     // -------------------------------------------------------------------------
         
     // Jacobian
-    Matrix J11(6,6), J12(6,6), J13(6,6); Vector J14(6);
-    Matrix J21(6,6), J22(6,6);           Vector J24(6);
-    Matrix J31(6,6), J32(6,6), J33(6,6); Vector J34(6);
-    Vector J41(6), J42(6);
+    MatrixN<6,6> J11, J12, J13; VectorN<6> J14;
+    MatrixN<6,6> J21, J22;           VectorN<6> J24;
+    MatrixN<6,6> J31, J32, J33; VectorN<6> J34;
+    VectorN<6> J41, J42;
     
     // inv(J22), inv(J33)
-    Matrix J22_1(6,6), J33_1(6,6);
+    MatrixN<6,6> J22_1, J33_1;
     
     J11        = aD + dGamma * ToCovariant(dROverdSigma) * mIIco;
     J12        = dGamma * ToCovariant(dROverdAlpha)  * mIIco;
@@ -2670,7 +2670,7 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     } else
         CSigma = CSigma * aC;
 
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     double delGamma;
     delSig        = -1.0 *  CSigma * SConstant;
     delGamma    = (LSigma ^ delSig) + LConstant;
@@ -2753,7 +2753,7 @@ ManzariDafalias::NewtonIter3(const Vector& xo, const Vector& inVar, Vector& sol,
     int errFlag = 0;
     
     // residuals and incremenets
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     Vector del(19), res(19), res2(19), JRes(19), sol2(19);
     double normR1 = 1.0, alpha = 1.0;
     double aNormR1 = 1.0, aNormR2 = 1.0;
@@ -2829,41 +2829,41 @@ ManzariDafalias::NewtonIter3(const Vector& xo, const Vector& inVar, Vector& sol,
 int 
 ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res, Vector& JRes, Vector& del, Matrix& Cep)
 {
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, voidRatio;
     // state dependent variables
-    Matrix aD(6,6), aC(6,6);
-    Vector n(6), n2(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+    MatrixN<6,6> aD, aC;
+    VectorN<6> n, n2, d, b, R, devStress, r, aBar, zBar; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D, p, normR, gc;
         
     // analytical Jacobian
     double AlphaAlphaInDotN;
     // Differentials of quantities with respect to Sigma
-    Matrix dnOverdSigma(6,6), dAbarOverdSigma(6,6), dROverdSigma(6,6), dZbarOverdSigma(6,6);
-    Vector dPsiOverdSigma(6), db0OverdSigma(6), dCos3ThetaOverdSigma(6), dAdOverdSigma(6), dhOverdSigma(6),
-        dgOverdSigma(6), dAlphaDOverdSigma(6), dCOverdSigma(6), dBOverdSigma(6), dAlphaBOverdSigma(6), dDOverdSigma(6);
+    MatrixN<6,6> dnOverdSigma, dAbarOverdSigma, dROverdSigma, dZbarOverdSigma;
+    VectorN<6> dPsiOverdSigma, db0OverdSigma, dCos3ThetaOverdSigma, dAdOverdSigma, dhOverdSigma,
+        dgOverdSigma, dAlphaDOverdSigma, dCOverdSigma, dBOverdSigma, dAlphaBOverdSigma, dDOverdSigma;
     // Differentials of quantities with respect to Alpha
-    Matrix dnOverdAlpha(6,6), dAbarOverdAlpha(6,6), dROverdAlpha(6,6), dZbarOverdAlpha(6,6);
-    Vector dCos3ThetaOverdAlpha(6), dAdOverdAlpha(6), dhOverdAlpha(6), dgOverdAlpha(6), dAlphaDOverdAlpha(6), 
-        dCOverdAlpha(6), dBOverdAlpha(6), dAlphaBOverdAlpha(6), dDOverdAlpha(6);
+    MatrixN<6,6> dnOverdAlpha, dAbarOverdAlpha, dROverdAlpha, dZbarOverdAlpha;
+    VectorN<6> dCos3ThetaOverdAlpha, dAdOverdAlpha, dhOverdAlpha, dgOverdAlpha, dAlphaDOverdAlpha, 
+        dCOverdAlpha, dBOverdAlpha, dAlphaBOverdAlpha, dDOverdAlpha;
     // Differentials of quantities with respect to Fabric
-    Matrix dZbarOverdFabric(6,6), dROverdFabric(6,6);
-    Vector dAdOverdFabric(6), dDOverdFabric(6), dfOverdSigma(6), dfOverdAlpha(6);
+    MatrixN<6,6> dZbarOverdFabric, dROverdFabric;
+    VectorN<6> dAdOverdFabric, dDOverdFabric, dfOverdSigma, dfOverdAlpha;
 
     // Variables needed to solve the system of equations
-    Matrix    DAlpha(6,6), DFabric(6,6), DSigma(6,6);
-    Matrix    CAlpha(6,6), CFabric(6,6), CSigma(6,6), ASigma(6,6), ZSigma(6,6);
-    Vector    ALambda(6), AConstant(6), ZLambda(6), ZConstant(6), LSigma(6), 
-            SLambda(6), SConstant(6);
+    MatrixN<6,6> DAlpha, DFabric, DSigma;
+    MatrixN<6,6> CAlpha, CFabric, CSigma, ASigma, ZSigma;
+    VectorN<6>    ALambda, AConstant, ZLambda, ZConstant, LSigma, 
+            SLambda, SConstant;
     double    LConstant;
 
     // Flags to consider the threshold values
     double dpFlag = 1.0, dnFlag = 1.0, dhFlag = 1.0;
     
     // residuals
-    Vector R1(6); Vector R2(6); Vector R3(6); double R4;
+    VectorN<6> R1, R2, R3; double R4;
     
     // read the trial values
     stress.Extract(xo, 0, 1.0);
@@ -3019,13 +3019,13 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     // -------------------------------------------------------------------------
         
     // Jacobian
-    Matrix J11(6,6), J12(6,6), J13(6,6); Vector J14(6);
-    Matrix J21(6,6), J22(6,6);           Vector J24(6);
-    Matrix J31(6,6), J32(6,6), J33(6,6); Vector J34(6);
-    Vector J41(6), J42(6);
+    MatrixN<6,6> J11, J12, J13; VectorN<6> J14;
+    MatrixN<6,6> J21, J22;           VectorN<6> J24;
+    MatrixN<6,6> J31, J32, J33; VectorN<6> J34;
+    VectorN<6> J41, J42;
     
     // inv(J22), inv(J33)
-    Matrix J22_1(6,6), J33_1(6,6);
+    MatrixN<6,6> J22_1, J33_1;
     
     J11        = aD + dGamma * ToCovariant(dROverdSigma) * mIIco;
     J12        = dGamma * ToCovariant(dROverdAlpha)  * mIIco;
@@ -3045,7 +3045,7 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     J42        = ToCovariant(dfOverdAlpha);
 
     // JRes
-    Vector temp(6); double temp2;
+    VectorN<6> temp; double temp2;
     temp = (J11^R1) + (J21^R2) + (J31^R3) + R4 * J41;
     JRes.Assemble(temp, 0, 1.0);
     temp = (J12^R1) + (J22^R2) + (J32^R3) + R4 * J42;
@@ -3095,7 +3095,7 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     } else
         CSigma = CSigma * aC;
 
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     double delGamma;
     delSig        = -1.0 *  CSigma * SConstant;
     delGamma    = (LSigma ^ delSig) + LConstant;
@@ -3134,7 +3134,7 @@ ManzariDafalias::NewtonIter2_negP(const Vector& xo, const Vector& inVar, Vector&
     int errFlag = 0;
     
     // residuals and incremenets
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     Vector del(20), res(20), res2(20);
     double normR1 = 1.0, alpha = 1.0;
     double aNormR1 = 1.0, aNormR2 = 1.0;
@@ -3223,41 +3223,41 @@ ManzariDafalias::NewtonIter2_negP(const Vector& xo, const Vector& inVar, Vector&
 int 
 ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& del, Matrix& Cep)
 {
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, dLambda, voidRatio;
     // state dependent variables
-    Matrix aD(6,6), aC(6,6);
-    Vector n(6), n2(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+    MatrixN<6,6> aD, aC;
+    VectorN<6> n, n2, d, b, R, devStress, r, aBar, zBar; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D, p, normR, gc;
         
     // analytical Jacobian
     double AlphaAlphaInDotN;
     // Differentials of quantities with respect to Sigma
-    Matrix dnOverdSigma(6,6), dAbarOverdSigma(6,6), dROverdSigma(6,6), dZbarOverdSigma(6,6);
-    Vector dPsiOverdSigma(6), db0OverdSigma(6), dCos3ThetaOverdSigma(6), dAdOverdSigma(6), dhOverdSigma(6),
-        dgOverdSigma(6), dAlphaDOverdSigma(6), dCOverdSigma(6), dBOverdSigma(6), dAlphaBOverdSigma(6), dDOverdSigma(6);
+    MatrixN<6,6> dnOverdSigma, dAbarOverdSigma, dROverdSigma, dZbarOverdSigma;
+    VectorN<6> dPsiOverdSigma, db0OverdSigma, dCos3ThetaOverdSigma, dAdOverdSigma, dhOverdSigma,
+        dgOverdSigma, dAlphaDOverdSigma, dCOverdSigma, dBOverdSigma, dAlphaBOverdSigma, dDOverdSigma;
     // Differentials of quantities with respect to Alpha
-    Matrix dnOverdAlpha(6,6), dAbarOverdAlpha(6,6), dROverdAlpha(6,6), dZbarOverdAlpha(6,6);
-    Vector dCos3ThetaOverdAlpha(6), dAdOverdAlpha(6), dhOverdAlpha(6), dgOverdAlpha(6), dAlphaDOverdAlpha(6), 
-        dCOverdAlpha(6), dBOverdAlpha(6), dAlphaBOverdAlpha(6), dDOverdAlpha(6);
+    MatrixN<6,6> dnOverdAlpha, dAbarOverdAlpha, dROverdAlpha, dZbarOverdAlpha;
+    VectorN<6> dCos3ThetaOverdAlpha, dAdOverdAlpha, dhOverdAlpha, dgOverdAlpha, dAlphaDOverdAlpha, 
+        dCOverdAlpha, dBOverdAlpha, dAlphaBOverdAlpha, dDOverdAlpha;
     // Differentials of quantities with respect to Fabric
-    Matrix dZbarOverdFabric(6,6), dROverdFabric(6,6);
-    Vector dAdOverdFabric(6), dDOverdFabric(6), dfOverdSigma(6), dfOverdAlpha(6);
+    MatrixN<6,6> dZbarOverdFabric, dROverdFabric;
+    VectorN<6> dAdOverdFabric, dDOverdFabric, dfOverdSigma, dfOverdAlpha;
 
     // Variables needed to solve the system of equations
-    Matrix    DAlpha(6,6), DFabric(6,6), DSigma(6,6);
-    Matrix    CAlpha(6,6), CFabric(6,6), CSigma(6,6), ASigma(6,6), ZSigma(6,6);
-    Vector    ALambda(6), AConstant(6), ZLambda(6), ZConstant(6), LSigma(6), 
-            SLambda(6), SConstant(6);
+    MatrixN<6,6> DAlpha, DFabric, DSigma;
+    MatrixN<6,6> CAlpha, CFabric, CSigma, ASigma, ZSigma;
+    VectorN<6>    ALambda, AConstant, ZLambda, ZConstant, LSigma, 
+            SLambda, SConstant;
     double    LConstant;
 
     // Flags to consider the threshold values
     double dpFlag = 1.0, dnFlag = 1.0, dhFlag = 1.0;
     
     // residuals
-    Vector R1(6); Vector R2(6); Vector R3(6); double R4, R5;
+    VectorN<6> R1, R2, R3; double R4, R5;
     
     // read the trial values
     stress.Extract(xo, 0, 1.0);
@@ -3410,14 +3410,14 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     // -------------------------------------------------------------------------
         
     // Jacobian
-    Matrix J11(6,6), J12(6,6), J13(6,6); Vector J14(6); Vector J15(6);
-    Matrix J21(6,6), J22(6,6);           Vector J24(6);
-    Matrix J31(6,6), J32(6,6), J33(6,6); Vector J34(6);
-    Vector J41(6), J42(6);
+    MatrixN<6,6> J11, J12, J13; VectorN<6> J14, J15;
+    MatrixN<6,6> J21, J22;           VectorN<6> J24;
+    MatrixN<6,6> J31, J32, J33; VectorN<6> J34;
+    VectorN<6> J41, J42;
     Vector J51(5);
     
     // inv(J22), inv(J33)
-    Matrix J22_1(6,6), J33_1(6,6);
+    MatrixN<6,6> J22_1, J33_1;
     
     J11        = aD + dGamma * ToCovariant(dROverdSigma) * mIIco;
     J12        = dGamma * ToCovariant(dROverdAlpha)  * mIIco;
@@ -3480,7 +3480,7 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     } else
         CSigma = CSigma * aC;
 
-    Vector delSig(6), delAlph(6), delZ(6);
+    VectorN<6> delSig, delAlph, delZ;
     double delGamma, delLambda;
     delLambda   = (3.0*(mI1^(CSigma * SConstant)) + 9.0*R5) / (mI1^( CSigma * mI1));
     delSig        = CSigma * (one3 * delLambda * mI1 - SConstant);
@@ -3550,17 +3550,17 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
 Vector
 ManzariDafalias::NewtonRes_negP(const Vector& x, const Vector& inVar)
 {
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, dLambda, voidRatio;
     // state dependent variables
-    Matrix aD(6,6);
-    Vector n(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+    MatrixN<6,6> aD;
+    VectorN<6> n, d, b, R, devStress, r, aBar, zBar; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
         
     // residuals
-    Vector R1(6); Vector R2(6); Vector R3(6); double R4, R5;
+    VectorN<6> R1, R2, R3; double R4, R5;
     
     // read the trial values
     stress.Extract(x, 0, 1.0);
@@ -3641,9 +3641,9 @@ ManzariDafalias::GetResidual(const Vector& x, const Vector& inVar)
     // stress: NextStress, also for other variables
 
     Vector Res(19);   // Residual Vector
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6); // Stress and Hardening
-    Vector fabric(6), curFabric(6); // Fabric
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in; // Stress and Hardening
+    VectorN<6> fabric, curFabric; // Fabric
     double dGamma, voidRatio;
 
     // read the trial variables from newton iterations
@@ -3668,23 +3668,23 @@ ManzariDafalias::GetResidual(const Vector& x, const Vector& inVar)
     TrialElasticStrain = curEStrain + (strain - curStrain);
     
     // state dependent variables
-    Vector n(6), d(6), b(6), R(6); 
+    VectorN<6> n, d, b, R; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
     GetStateDependent(stress, alpha, fabric, voidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
         b0, A, D, B, C, R);
-    Vector devStress = GetDevPart(stress);
+    VectorN<6> devStress = GetDevPart(stress);
     double p = one3 * GetTrace(stress);
     p = p < small ? small : p;
-    Vector aBar(6); aBar = two3 * h * b;
-    Vector zBar(6); zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    VectorN<6> aBar; aBar = two3 * h * b;
+    VectorN<6> zBar; zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
 
-    Matrix De = GetCompliance(mK, mG);
-    Vector dEstrain(6);
+    MatrixN<6,6> De = GetCompliance(mK, mG);
+    VectorN<6> dEstrain;
     dEstrain = De * (stress - curStress);
     eStrain = curEStrain + dEstrain;
 
     // residuals
-    Vector g1(6); Vector g2(6); Vector g3(6); double g4;
+    VectorN<6> g1, g2, g3; double g4;
 
     g1 = eStrain - TrialElasticStrain + dGamma * ToCovariant(R);
     g2 = alpha   - curAlpha           - dGamma * aBar;
@@ -3706,9 +3706,9 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     // This function returns the full 19x19 Jacobian matrix (needs to be checked)
     // note: stress: NextStress, also for other variables
 
-    Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6); // Strain
-    Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-    Vector fabric(6), curFabric(6);
+    VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain; // Strain
+    VectorN<6> stress, alpha, curStress, curAlpha, alpha_in;
+    VectorN<6> fabric, curFabric;
     double dGamma, voidRatio;
     double AlphaAlphaInDotN;
     
@@ -3736,7 +3736,7 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     TrialElasticStrain = curEStrain + (strain - curStrain);
     
     // state dependent variables
-    Vector n(6), n2(6), d(6), b(6), R(6); 
+    VectorN<6> n, n2, d, b, R; 
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
     GetStateDependent(stress, alpha, fabric, voidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
         b0, A, D, B, C, R);
@@ -3751,33 +3751,33 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     }
     
     n2 = SingleDot(n,n);
-    Vector devStress = GetDevPart(stress);
+    VectorN<6> devStress = GetDevPart(stress);
     double p = one3 * GetTrace(stress);
     p = p < small ? m_Pmin : p;
     dpFlag = p < small ? 0.0 : 1.0;
-    Vector r(6); r = devStress - p * alpha;
+    VectorN<6> r; r = devStress - p * alpha;
     double normR = GetNorm_Contr(r);
     dnFlag = normR == 0 ? 0.0 : 1.0;
     double gc = g(Cos3Theta, m_c);
-    Vector aBar(6); aBar = two3 * h * b;
-    Vector zBar(6); zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    VectorN<6> aBar; aBar = two3 * h * b;
+    VectorN<6> zBar; zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
 
     //double G, K;
     //GetElasticModuli(curStress, curVoidRatio, voidRatio, TrialElasticStrain, curEStrain, K, G);
-    Matrix aD(6,6);    aD = GetCompliance(mK, mG);
+    MatrixN<6,6> aD;    aD = GetCompliance(mK, mG);
     
 // analytical Jacobian
     // Differentials of quantities with respect to Sigma
-    Matrix dnOverdSigma(6,6), dAbarOverdSigma(6,6), dROverdSigma(6,6), dZbarOverdSigma(6,6);
-    Vector dPsiOverdSigma(6), db0OverdSigma(6), dCos3ThetaOverdSigma(6), dAdOverdSigma(6), dhOverdSigma(6),
-        dgOverdSigma(6), dAlphaDOverdSigma(6), dCOverdSigma(6), dBOverdSigma(6), dAlphaBOverdSigma(6), dDOverdSigma(6);
+    MatrixN<6,6> dnOverdSigma, dAbarOverdSigma, dROverdSigma, dZbarOverdSigma;
+    VectorN<6> dPsiOverdSigma, db0OverdSigma, dCos3ThetaOverdSigma, dAdOverdSigma, dhOverdSigma,
+        dgOverdSigma, dAlphaDOverdSigma, dCOverdSigma, dBOverdSigma, dAlphaBOverdSigma, dDOverdSigma;
     // Differentials of quantities with respect to Alpha
-    Matrix dnOverdAlpha(6,6), dAbarOverdAlpha(6,6), dROverdAlpha(6,6), dZbarOverdAlpha(6,6);
-    Vector dCos3ThetaOverdAlpha(6), dAdOverdAlpha(6), dhOverdAlpha(6), dgOverdAlpha(6), dAlphaDOverdAlpha(6), 
-        dCOverdAlpha(6), dBOverdAlpha(6), dAlphaBOverdAlpha(6), dDOverdAlpha(6);
+    MatrixN<6,6> dnOverdAlpha, dAbarOverdAlpha, dROverdAlpha, dZbarOverdAlpha;
+    VectorN<6> dCos3ThetaOverdAlpha, dAdOverdAlpha, dhOverdAlpha, dgOverdAlpha, dAlphaDOverdAlpha, 
+        dCOverdAlpha, dBOverdAlpha, dAlphaBOverdAlpha, dDOverdAlpha;
     // Differentials of quantities with respect to Fabric
-    Matrix dZbarOverdFabric(6,6), dROverdFabric(6,6);
-    Vector dAdOverdFabric(6), dDOverdFabric(6);
+    MatrixN<6,6> dZbarOverdFabric, dROverdFabric;
+    VectorN<6> dAdOverdFabric, dDOverdFabric;
 
     // d...OverdSigma : Arranged by order of dependence
     dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
@@ -3848,10 +3848,10 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
         (-1.0*Dyadic2_2(m_z_max * n + fabric, dDOverdFabric) - D * mIIcon);
 
     // Derivatives of residuals
-    Matrix dR1OverdSigma(6,6), dR2OverdSigma(6,6), dR3OverdSigma(6,6); Vector dR1OverdDGamma(6);
-    Matrix dR1OverdAlpha(6,6), dR2OverdAlpha(6,6), dR3OverdAlpha(6,6); Vector dR2OverdDGamma(6);
-    Matrix dR1OverdFabric(6,6), dR2OverdFabric(6,6), dR3OverdFabric(6,6); Vector dR3OverdDGamma(6);
-    Vector dR4OverdSigma(6), dR4OverdAlpha(6), dR4OverdFabric(6);
+    MatrixN<6,6> dR1OverdSigma, dR2OverdSigma, dR3OverdSigma; VectorN<6> dR1OverdDGamma;
+    MatrixN<6,6> dR1OverdAlpha, dR2OverdAlpha, dR3OverdAlpha; VectorN<6> dR2OverdDGamma;
+    MatrixN<6,6> dR1OverdFabric, dR2OverdFabric, dR3OverdFabric; VectorN<6> dR3OverdDGamma;
+    VectorN<6> dR4OverdSigma, dR4OverdAlpha, dR4OverdFabric;
     double dR4OverdDGamma;
     
     dR1OverdSigma        = aD + dGamma * ToCovariant(dROverdSigma) * mIIco;
@@ -4004,7 +4004,7 @@ double
 ManzariDafalias::GetF(const Vector& nStress, const Vector& nAlpha)
 {
     // Manzari's yield function
-    Vector s(6); s = GetDevPart(nStress);
+    VectorN<6> s; s = GetDevPart(nStress);
     double p = one3 * GetTrace(nStress);
     s = s - p * nAlpha;
     return GetNorm_Contr(s) - root23 * m_m * p;
@@ -4090,11 +4090,11 @@ ManzariDafalias::GetElasticModuli(const Vector& sigma, const double& en, double
 }
 
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
-    Matrix C(6,6);
+    MatrixN<6,6> C;
     double a = K + 4.0*one3 * G;
     double b = K - 2.0*one3 * G;
     C(0,0) = C(1,1) = C(2,2) = a;
@@ -4105,11 +4105,11 @@ ManzariDafalias::GetStiffness(const double& K, const double& G)
 }
 
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
-    Matrix D(6,6);
+    MatrixN<6,6> D;
     double a = 1 / (9*K) + 1 / (3*G);
     double b = 1 / (9*K) - 1 / (6*G);
     double c = 1 / G;
@@ -4121,7 +4121,7 @@ ManzariDafalias::GetCompliance(const double& K, const double& G)
 }
 
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double& NextDGamma, 
                     const Vector& CurStrain, const Vector& NextStrain,
                     const double& G, const double& K, const double& B, 
@@ -4130,11 +4130,11 @@ ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double&
 {    
     double p = one3 * GetTrace(NextStress);
     p = (p < small) ? small : p;
-    Vector r = GetDevPart(NextStress) / p;
+    VectorN<6> r = GetDevPart(NextStress) / p;
     double Kp = two3 * p * h * DoubleDot2_2_Contr(b, n);
     
-    Matrix aC(6,6), aCep(6,6);
-    Vector temp1(6), temp2(6), R(6);
+    MatrixN<6,6> aC, aCep;
+    VectorN<6> temp1, temp2, R;
     double temp3;
 
     aC  = GetStiffness(K, G);
@@ -4149,14 +4149,14 @@ ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double&
 }
 
 
-Vector
+VectorN<6>
 ManzariDafalias::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-    Vector devStress(6); devStress = GetDevPart(stress);
+    VectorN<6> devStress; devStress = GetDevPart(stress);
 
     double p = one3 * GetTrace(stress);
 
-    Vector n(6); 
+    VectorN<6> n; 
     if (fabs(p) < small)
     {
         n.Zero();
@@ -4184,8 +4184,8 @@ ManzariDafalias::Check(const Vector& TrialStress, const Vector& stress, const Ve
         //result = -2;
     }
     
-    Vector n(6);    n    = GetNormalToYield(stress, CurAlpha);
-    Vector n_tr(6); n_tr = GetNormalToYield(TrialStress, CurAlpha);
+    VectorN<6> n;    n    = GetNormalToYield(stress, CurAlpha);
+    VectorN<6> n_tr; n_tr = GetNormalToYield(TrialStress, CurAlpha);
     
     // check the direction of stress and trial stress
     if (DoubleDot2_2_Contr(n, n_tr) < 0) 
@@ -4292,14 +4292,14 @@ ManzariDafalias::GetTrace(const Vector& v)
     return (v(0) + v(1) + v(2));
 }
 
-Vector 
+VectorN<6> 
 ManzariDafalias::GetDevPart(const Vector& aV)
 // computes the deviatoric part of the input tensor
 {
     if (aV.Size() != 6)
         opserr << "\n ERROR! ManzariDafalias::GetDevPart requires vector of size(6)!" << endln;
 
-    Vector result(6);
+    VectorN<6> result;
     double p = GetTrace(aV);
     result = aV;
     result(0) -= one3 * p;
@@ -4309,14 +4309,14 @@ ManzariDafalias::GetDevPart(const Vector& aV)
     return result;
 }
 
-Vector 
+VectorN<6> 
 ManzariDafalias::SingleDot(const Vector& v1, const Vector& v2)
 // computes v1.v2, v1 and v2 should be both in their "contravariant" form
 {
     if ((v1.Size() != 6) || (v2.Size() != 6))
         opserr << "\n ERROR! ManzariDafalias::SingleDot requires vector of size(6)!" << endln;
 
-    Vector result(6);
+    VectorN<6> result;
     result(0) = v1(0)*v2(0) + v1(3)*v2(3) + v1(5)*v2(5);
     result(1) = v1(3)*v2(3) + v1(1)*v2(1) + v1(4)*v2(4);
     result(2) = v1(5)*v2(5) + v1(4)*v2(4) + v1(2)*v2(2);
@@ -4397,7 +4397,7 @@ ManzariDafalias::GetNorm_Cov(const Vector& v)
     return result;
 }
 
-Matrix 
+MatrixN<6,6> 
 ManzariDafalias::Dyadic2_2(const Vector& v1, const Vector& v2)
 // computes dyadic product for two vector-storage arguments
 // the coordinate form of the result depends on the coordinate form of inputs
@@ -4405,7 +4405,7 @@ ManzariDafalias::Dyadic2_2(const Vector& v1, const Vector& v2)
     if ((v1.Size() != 6) || (v2.Size() != 6))
         opserr << "\n ERROR! ManzariDafalias::Dyadic2_2 requires vector of size(6)!" << endln;
 
-    Matrix result(6,6);
+    MatrixN<6,6> result;
 
     for (int i = 0; i < v1.Size(); i++) {
         for (int j = 0; j < v2.Size(); j++) 
@@ -4454,7 +4454,7 @@ ManzariDafalias::DoubleDot4_4(const Matrix& m1, const Matrix& m2)
     return m1*m2;
 }
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::SingleDot4_2(const Matrix& m1, const Vector& v1)
 // computes singledot product for matrix-vector arguments
 // caution: this implementation is specific for contravariant forms
@@ -4464,7 +4464,7 @@ ManzariDafalias::SingleDot4_2(const Matrix& m1, const Vector& v1)
     if ((m1.noCols() != 6) || (m1.noRows() != 6)) 
         opserr << "\n ERROR! ManzariDafalias::SingleDot4_2 requires 6-by-6 matrix " << endln;
 
-    Matrix result(6,6);
+    MatrixN<6,6> result;
     for (int i = 0; i < 6; i++){
         result(i,0) = m1(i,0) * v1(0) + m1(i,3) * v1(3) + m1(i,5) * v1(5);
         result(i,1) = m1(i,3) * v1(3) + m1(i,1) * v1(1) + m1(i,4) * v1(4);
@@ -4480,7 +4480,7 @@ ManzariDafalias::SingleDot4_2(const Matrix& m1, const Vector& v1)
     return result;
 }
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::SingleDot2_4(const Vector& v1, const Matrix& m1)
 // computes singledot product for vector-matrix arguments
 // caution: this implementation is specific for contravariant forms
@@ -4490,7 +4490,7 @@ ManzariDafalias::SingleDot2_4(const Vector& v1, const Matrix& m1)
     if ((m1.noCols() != 6) || (m1.noRows() != 6)) 
         opserr << "\n ERROR! ManzariDafalias::SingleDot2_4 requires 6-by-6 matrix " << endln;
 
-    Matrix result(6,6);
+    MatrixN<6,6> result;
     for (int i = 0; i < 6; i++){
         result(0,i) = m1(0,i) * v1(0) + m1(3,i) * v1(3) + m1(5,i) * v1(5);
         result(1,i) = m1(3,i) * v1(3) + m1(1,i) * v1(1) + m1(4,i) * v1(4);
@@ -4505,7 +4505,7 @@ ManzariDafalias::SingleDot2_4(const Vector& v1, const Matrix& m1)
     return result;
 }
 
-Matrix
+MatrixN<6,6>
 ManzariDafalias::Trans_SingleDot4T_2(const Matrix& m1, const Vector& v1)
 // computes singledot product for matrix-vector arguments
 // caution: this implementation is specific for contravariant forms
@@ -4514,7 +4514,7 @@ ManzariDafalias::Trans_SingleDot4T_2(const Matrix& m1, const Vector& v1)
     opserr << "\n ERROR! ManzariDafalias::SingleDot4_2 requires vector of size(6)!" << endln;
     if ((m1.noCols() != 6) || (m1.noRows() != 6)) 
     opserr << "\n ERROR! ManzariDafalias::SingleDot4_2 requires 6-by-6 matrix " << endln;
-    Matrix result(6,6);
+    MatrixN<6,6> result;
     for (int i = 0; i < 6; i++){
         result(0,i) = m1(0,i) * v1(0) + m1(3,i) * v1(3) + m1(5,i) * v1(5);
         result(1,i) = m1(3,i) * v1(3) + m1(1,i) * v1(1) + m1(4,i) * v1(4);
@@ -4541,7 +4541,7 @@ double ManzariDafalias::Det(const Vector& aV)
              -   aV[1] * aV[4] * aV[4]);
 }
 
-Vector ManzariDafalias::Inv(const Vector& aV)
+VectorN<6> ManzariDafalias::Inv(const Vector& aV)
 {
     if (aV.Size() != 6)
         opserr << "\n ERROR! ManzariDafalias::Inv requires vector of size(6)!" << endln;
@@ -4552,7 +4552,7 @@ Vector ManzariDafalias::Inv(const Vector& aV)
         opserr << "\n Error! ManzariDafalias::Inv - Singular tensor - return 0 tensor" << endln;
         return aV;
     }
-    Vector res(6);
+    VectorN<6> res;
     res(0) = aV(1)*aV(2)-aV(4)*aV(4);
     res(1) = aV(0)*aV(2)-aV(5)*aV(5);
     res(2) = aV(0)*aV(1)-aV(3)*aV(3);
@@ -4564,12 +4564,12 @@ Vector ManzariDafalias::Inv(const Vector& aV)
     return res;
 }
 
-Vector ManzariDafalias::ToContraviant(const Vector& v1)
+VectorN<6> ManzariDafalias::ToContraviant(const Vector& v1)
 {
     if (v1.Size() != 6)
         opserr << "\n ERROR! ManzariDafalias::ToContraviant requires vector of size(6)!" << endln;
     // aV(i) -> T(i,j) 1 = 11, 2=22, 3=33, 4=12, 5=23, 6=13
-    Vector res = v1;
+    VectorN<6> res = v1;
     res(3) *= 0.5;
     res(4) *= 0.5;
     res(5) *= 0.5;
@@ -4577,12 +4577,12 @@ Vector ManzariDafalias::ToContraviant(const Vector& v1)
     return res;
 }
 
-Vector ManzariDafalias::ToCovariant(const Vector& v1)
+VectorN<6> ManzariDafalias::ToCovariant(const Vector& v1)
 {
     if (v1.Size() != 6)
         opserr << "\n ERROR! ManzariDafalias::ToCovariant requires vector of size(6)!" << endln;
     // aV(i) -> T(i,j) 1 = 11, 2=22, 3=33, 4=12, 5=23, 6=13
-    Vector res = v1;
+    VectorN<6> res = v1;
     res(3) *= 2.0;
     res(4) *= 2.0;
     res(5) *= 2.0;
@@ -4590,12 +4590,12 @@ Vector ManzariDafalias::ToCovariant(const Vector& v1)
     return res;
 }
 
-Matrix ManzariDafalias::ToContraviant(const Matrix& m1)
+MatrixN<6,6> ManzariDafalias::ToContraviant(const Matrix& m1)
 {
     if ((m1.noCols() != 6) || (m1.noRows() != 6)) 
         opserr << "\n ERROR! ManzariDafalias::ToContraviant requires 6-by-6 matrix " << endln;
     // aV(i) -> T(i,j) 1 = 11, 2=22, 3=33, 4=12, 5=23, 6=13
-    Matrix res = m1;
+    MatrixN<6,6> res = m1;
     for (int ii = 0; ii < 6; ii++)
     {
         res(3,ii) *= 0.5;
@@ -4606,12 +4606,12 @@ Matrix ManzariDafalias::ToContraviant(const Matrix& m1)
     return res;
 }
 
-Matrix ManzariDafalias::ToCovariant(const Matrix& m1)
+MatrixN<6,6> ManzariDafalias::ToCovariant(const Matrix& m1)
 {
     if ((m1.noCols() != 6) || (m1.noRows() != 6)) 
         opserr << "\n ERROR! ManzariDafalias::ToCovariant requires 6-by-6 matrix " << endln;
     // aV(i) -> T(i,j) 1 = 11, 2=22, 3=33, 4=12, 5=23, 6=13
-    Matrix res = m1;
+    MatrixN<6,6> res = m1;
     for (int ii = 0; ii < 6; ii++)
     {
         res(3,ii) *= 2.0;
@@ -35,6 +35,8 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
+#include <VectorN.h>
 
 #include <Information.h>
 //#include <MaterialResponse.h>
@@ -285,41 +287,41 @@ class ManzariDafalias : public NDMaterial
 				double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G, const double& D);
-	Matrix	GetStiffness(const double& K, const double& G);
-	Matrix	GetCompliance(const double& K, const double& G);
+	MatrixN<6,6>	GetStiffness(const double& K, const double& G);
+	MatrixN<6,6>	GetCompliance(const double& K, const double& G);
 	void	GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &fabric
 				, const double &e, const Vector &alpha_in, Vector &n, Vector &d, Vector &b
 				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
 				, double &alphaDtheta, double &b0, double& A, double& D, double& B
 				, double& C, Vector& R);
-	Matrix	GetElastoPlasticTangent(const Vector& NextStress, const double& NextDGamma, const Vector& CurStrain, const Vector& NextStrain,
+	MatrixN<6,6>	GetElastoPlasticTangent(const Vector& NextStress, const double& NextDGamma, const Vector& CurStrain, const Vector& NextStrain,
 				const double& G, const double& K, const double& B, const double& C,const double& D, const double& h, 
 				const Vector& n, const Vector& d, const Vector& b) ;
-	Vector	GetNormalToYield(const Vector &stress, const Vector &alpha);
+	VectorN<6>	GetNormalToYield(const Vector &stress, const Vector &alpha);
 	int	Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha);
 
 	// Symmetric Tensor Operations
 	double GetTrace(const Vector& v);
-	Vector GetDevPart(const Vector& aV);
-	Vector SingleDot(const Vector& v1, const Vector& v2);
+	VectorN<6> GetDevPart(const Vector& aV);
+	VectorN<6> SingleDot(const Vector& v1, const Vector& v2);
 	double DoubleDot2_2_Contr(const Vector& v1, const Vector& v2);
 	double DoubleDot2_2_Cov(const Vector& v1, const Vector& v2);
 	double DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2);
 	double GetNorm_Contr(const Vector& v);
 	double GetNorm_Cov(const Vector& v);
-	Matrix Dyadic2_2(const Vector& v1, const Vector& v2);
+	MatrixN<6,6> Dyadic2_2(const Vector& v1, const Vector& v2);
 	Vector DoubleDot4_2(const Matrix& m1, const Vector& v1);
 	Vector DoubleDot2_4(const Vector& v1, const Matrix& m1);
 	Matrix DoubleDot4_4(const Matrix& m1, const Matrix& m2);
-	Matrix SingleDot4_2(const Matrix& m1, const Vector& v1);
-	Matrix SingleDot2_4(const Vector& v1, const Matrix& m1);
-	Matrix Trans_SingleDot4T_2(const Matrix& m1, const Vector& v1);
+	MatrixN<6,6> SingleDot4_2(const Matrix& m1, const Vector& v1);
+	MatrixN<6,6> SingleDot2_4(const Vector& v1, const Matrix& m1);
+	MatrixN<6,6> Trans_SingleDot4T_2(const Matrix& m1, const Vector& v1);
 	double Det(const Vector& aV);
-	Vector Inv(const Vector& aV);
-	Vector ToContraviant(const Vector& v1);
-	Vector ToCovariant(const Vector& v1);
-	Matrix ToContraviant(const Matrix& m1);
-	Matrix ToCovariant(const Matrix& m1);
+	VectorN<6> Inv(const Vector& aV);
+	VectorN<6> ToContraviant(const Vector& v1);
+	VectorN<6> ToCovariant(const Vector& v1);
+	MatrixN<6,6> ToContraviant(const Matrix& m1);
+	MatrixN<6,6> ToCovariant(const Matrix& m1);
 
 };
 
@@ -370,7 +370,7 @@ PM4Silt::getCopy(const char *type)
 int
 PM4Silt::commitState(void)
 {
-	Vector n(3), R(3), dFabric(3);
+	VectorN<3> n, R, dFabric;
 
 	mAlpha_in_n = mAlpha_in;
 	mAlpha_n = mAlpha;
@@ -712,7 +712,7 @@ PM4Silt::initialize(Vector initStress)
 	Mfin = Mfin / (p0 + mresidualP);
 	if (Mfin > Mcut)
 	{
-		Vector r = (mSigma_n - p0 * mI1) / (p0 + mresidualP) * Mcut / Mfin;
+		VectorN<3> r = (mSigma_n - p0 * mI1) / (p0 + mresidualP) * Mcut / Mfin;
 		mSigma_n = p0 * mI1 + r * (p0 + mresidualP);
 		mSigma_b = initStress - mSigma_n;
 		mAlpha_n = r * (Mcut - m_m) / Mcut;
@@ -744,7 +744,7 @@ int
 PM4Silt::initialize()
 {
 	// set Initial parameters with p = p_atm
-	Vector mSig(3);
+	VectorN<3> mSig;
 	m_Pmin = m_P_atm / 200.0;
 	mSig(0) = m_P_atm;
 	mSig(1) = m_P_atm;
@@ -874,7 +874,7 @@ PM4Silt::getElasticStrain() {
 void PM4Silt::integrate()
 {
 	// update alpha_in in case of unloading
-	Vector n_tr(3);
+	VectorN<3> n_tr;
 	n_tr = GetNormalToYield(mSigma_n + mCe*(mEpsilon - mEpsilon_n), mAlpha_n);
 
 	if (DoubleDot2_2_Contr(mAlpha_n - mAlpha_in_n, n_tr) < 0.0) {
@@ -946,7 +946,7 @@ void PM4Silt::elastic_integrator(const Vector& CurStress, const Vector& CurStrai
 	const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
 	double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
 {
-	Vector dStrain(3);
+	VectorN<3> dStrain;
 
 	// calculate elastic response
 	dStrain = NextStrain - CurStrain;
@@ -996,7 +996,7 @@ void PM4Silt::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 	}
 
 	double elasticRatio, f, fn, dVolStrain;
-	Vector dSigma(3), dDevStrain(3), n(3);
+	VectorN<3> dSigma, dDevStrain, n;
 
 	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
 	NextElasticStrain = CurElasticStrain + NextStrain - CurStrain;
@@ -1075,8 +1075,8 @@ void PM4Silt::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
 {
 	double CurVoidRatio, Cka, h, p, dVolStrain, D;
-	Vector n(3), R(3), alphaD(3), dPStrain(3), b(3), dDevStrain(3), r(3);
-	Vector dSigma(3), dAlpha(3), dFabric(3);
+	VectorN<3> n, R, alphaD, dPStrain, b, dDevStrain, r;
+	VectorN<3> dSigma, dAlpha, dFabric;
 
 	CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
 	p = 0.5 * GetTrace(CurStress) + mresidualP;
@@ -1158,7 +1158,7 @@ void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		exp_int = &PM4Silt::ForwardEuler;
 		break;
 	}
-	Vector StrainInc(3); StrainInc = NextStrain - CurStrain;
+	VectorN<3> StrainInc; StrainInc = NextStrain - CurStrain;
 	double maxInc = StrainInc(0);
 
 	for (int ii = 1; ii < 3; ii++)
@@ -1169,9 +1169,9 @@ void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		int numSteps = (int)floor(fabs(maxInc) / maxStrainInc) + 1;
 		StrainInc = (NextStrain - CurStrain) / (double)numSteps;
 
-		Vector cStress(3), cStrain(3), cAlpha(3), cFabric(3), cAlpha_in(3), cAlpha_in_p(3), cEStrain(3);
-		Vector nStrain(3);
-		Matrix nCe(3, 3), nCep(3, 3), nCepC(3, 3);
+		VectorN<3> cStress, cStrain, cAlpha, cFabric, cAlpha_in, cAlpha_in_p, cEStrain;
+		VectorN<3> nStrain;
+		MatrixN<3,3> nCe, nCep, nCepC;
 		double nL, nVoidRatio, nG, nK;
 
 		// create temporary variables
@@ -1206,9 +1206,9 @@ void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
 {
 	double dVolStrain, p, Cka, temp4, curStepError, q, stressNorm, h, D;
-	Vector n(3), R1(3), R2(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
-	Vector dSigma1(3), dSigma2(3), dAlpha1(3), dAlpha2(3), dAlpha(3), dFabric1(3), dFabric2(3), dPStrain1(3), dPStrain2(3);
+	VectorN<3> n, R1, R2, alphaD, dDevStrain, r, b;
+	VectorN<3> nStress, nAlpha, nFabric;
+	VectorN<3> dSigma1, dSigma2, dAlpha1, dAlpha2, dAlpha, dFabric1, dFabric2, dPStrain1, dPStrain2;
 	double T = 0.0, dT = 1.0, dT_min = 1e-4, TolE = 1e-5;
 
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1390,8 +1390,8 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
 {
 	double dVolStrain, p, Cka, D, K_p, temp4, h;
-	Vector n(3), R1(3), R2(3), R3(3), R4(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
+	VectorN<3> n, R1, R2, R3, R4, alphaD, dDevStrain, r, b;
+	VectorN<3> nStress, nAlpha, nFabric;
 	Vector dSigma1(3), dSigma2(3), dSigma3(3), dSigma4(3), dSigma(3), dAlpha1(3), dAlpha2(3),
 		dAlpha3(3), dAlpha4(3), dAlpha(3), dFabric1(3), dFabric2(3), dFabric3(3), dFabric4(3),
 		dFabric(3), dPStrain1(3), dPStrain2(3), dPStrain3(3), dPStrain4(3), dPStrain(3);
@@ -1607,7 +1607,7 @@ PM4Silt::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, co
 {
 	double a = a0;
 	double f, f0, f1;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VectorN<3> dSigma, dSigma0, dSigma1, strainInc;
 
 	strainInc = NextStrain - CurStrain;
 
@@ -1667,7 +1667,7 @@ PM4Silt::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& Cur
 	double a = 0.0, a0 = 0.0, a1 = 1.0, da;
 	double f, f0, f1, fs;
 	int nSub = 20;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VectorN<3> dSigma, dSigma0, dSigma1, strainInc;
 	bool flag = false;
 
 	strainInc = NextStrain - CurStrain;
@@ -1721,9 +1721,9 @@ void
 PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& alpha_in, const Vector& alpha_in_p,
 	const Vector& CurFabric, double& NextVoidRatio)
 {
-	Vector dSigmaP(3), dfrOverdSigma(3), dfrOverdAlpha(3), n(3), R(3), alphaD(3), b(3), aBar(3), r(3);
+	VectorN<3> dSigmaP, dfrOverdSigma, dfrOverdAlpha, n, R, alphaD, b, aBar, r;
 	double lambda, D, K_p, Cka, h, p, fr;
-	Matrix aC(3, 3);
+	MatrixN<3,3> aC;
 	// Vector CurStress = NextStress;
 
 	int maxIter = 25;
@@ -1750,8 +1750,8 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 			return;
 		}
 		else {
-			Vector nStress = NextStress;
-			Vector nAlpha = NextAlpha;
+			VectorN<3> nStress = NextStress;
+			VectorN<3> nAlpha = NextAlpha;
 			for (int i = 1; i <= maxIter; i++) {
 				r = GetDevPart(nStress) / p;
 				GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
@@ -1791,7 +1791,7 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 				opserr << "NextAlpha = " << NextAlpha;
 			}
 
-			Vector dSigma = NextStress - mSigma;
+			VectorN<3> dSigma = NextStress - mSigma;
 			double alpha_up = 1.0;
 			double alpha_mid = 0.5;
 			double alpha_down = 0.0;
@@ -1892,7 +1892,7 @@ void
 PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& dAlpha,
 	const double m, const Vector& R, const Vector& n, const Vector& r)
 {
-	Vector dfrOverdSigma(3);
+	VectorN<3> dfrOverdSigma;
 	double lambda;
 	int maxIter = 50;
 	double f = GetF(NextStress, NextAlpha);
@@ -1941,7 +1941,7 @@ double
 PM4Silt::GetF(const Vector& nStress, const Vector& nAlpha)
 {
 	// PM4Silt's yield function
-	Vector s(3); s = GetDevPart(nStress);
+	VectorN<3> s; s = GetDevPart(nStress);
 	double p = 0.5 * GetTrace(nStress) + mresidualP;
 	s = s - p * nAlpha;
 	double f = GetNorm_Contr(s) - root12 * m_m * p;
@@ -2004,11 +2004,11 @@ PM4Silt::GetElasticModuli(const Vector& sigma, double &K, double &G)
 }
 /*************************************************************/
 // GetStiffness() ---------------------------------------------
-Matrix
+MatrixN<3,3>
 PM4Silt::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
-	Matrix C(3, 3);
+	MatrixN<3,3> C;
 	double a = K + 4.0*one3 * G;
 	double b = K - 2.0*one3 * G;
 	C(0, 0) = C(1, 1) = a;
@@ -2018,11 +2018,11 @@ PM4Silt::GetStiffness(const double& K, const double& G)
 }
 /*************************************************************/
 // GetCompliance() ---------------------------------------------
-Matrix
+MatrixN<3,3>
 PM4Silt::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
-	Matrix D(3, 3);
+	MatrixN<3,3> D;
 	double a = (K + 4.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double b = (K - 2.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double c = 1 / G;
@@ -2033,17 +2033,17 @@ PM4Silt::GetCompliance(const double& K, const double& G)
 }
 /*************************************************************/
 // GetElastoPlasticTangent()---------------------------------------
-Matrix
+MatrixN<3,3>
 PM4Silt::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R,
 	const Vector& n, const double K_p)
 {
 	double p = 0.5 * GetTrace(NextStress) + mresidualP;
 	if (p < m_Pmin) p = m_Pmin;
-	Vector r = GetDevPart(NextStress) / p;
-	Matrix aCep(3, 3);
+	VectorN<3> r = GetDevPart(NextStress) / p;
+	MatrixN<3,3> aCep;
 	aCep.Zero();
-	Vector temp1 = DoubleDot4_2(aCe, R);
-	Vector temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
+	VectorN<3> temp1 = DoubleDot4_2(aCe, R);
+	VectorN<3> temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
 	double temp3 = DoubleDot2_2_Contr(temp2, R) + K_p;
 	if (temp3 < small) {
 		aCep = aCe;
@@ -2056,12 +2056,12 @@ PM4Silt::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, co
 }
 /*************************************************************/
 // GetNormalToYield() ----------------------------------------
-Vector
+VectorN<3>
 PM4Silt::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-	Vector devStress(3); devStress = GetDevPart(stress);
+	VectorN<3> devStress; devStress = GetDevPart(stress);
 	double p = 0.5 * GetTrace(stress) + mresidualP;
-	Vector n(3);
+	VectorN<3> n;
 	if (fabs(p) < small) {
 		n.Zero();
 	}
@@ -2107,7 +2107,7 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		mMb = m_Mc * exp(-1.0 * m_nbwet * ksi);
 	}
 
-	Vector alphaB = root12 * (mMb - m_m) * n;
+	VectorN<3> alphaB = root12 * (mMb - m_m) * n;
 	alphaD = root12 * (mMd - m_m) * n;
 	double Czpk1 = zpeak / (zcum + m_z_max / 5.0);
 	double Czpk2 = zpeak / (zcum + m_z_max / 100.0);
@@ -2137,7 +2137,7 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 	// rotated dilatancy surface
 	double Crot1 = fmax((1.0 + 2 * Macauley(DoubleDot2_2_Contr(-1.0 * fabric, n)) / (sqrt(2.0)*m_z_max)*(1 - Czin1)), 1.0);
 	double Mdr = mMd / Crot1;
-	Vector alphaDr = root12 * (Mdr - m_m) * n;
+	VectorN<3> alphaDr = root12 * (Mdr - m_m) * n;
 	// dilation
 	if (DoubleDot2_2_Contr(alphaDr - alpha, n) <= 0) {
 		double Cpzp = 1.0 / (1.0 + pow((2.5* p / mpzp), 5.0));
@@ -2202,14 +2202,14 @@ PM4Silt::GetTrace(const Vector& v)
 }
 /*************************************************************/
 //  GetDevPart() ---------------------------------------------
-Vector
+VectorN<3>
 PM4Silt::GetDevPart(const Vector& aV)
 // computes the deviatoric part of the input tensor
 {
 	if (aV.Size() != 3)
 		opserr << "\n ERROR! PM4Silt::GetDevPart requires vector of size(3)!" << endln;
 
-	Vector result(3);
+	VectorN<3> result;
 	double p = GetTrace(aV);
 	result = aV;
 	result(0) -= 0.5 * p;
@@ -2295,7 +2295,7 @@ PM4Silt::GetNorm_Cov(const Vector& v)
 }
 /*************************************************************/
 // Dyadic2_2() ---------------------------------------------
-Matrix
+MatrixN<3,3>
 PM4Silt::Dyadic2_2(const Vector& v1, const Vector& v2)
 // computes dyadic product for two vector-storage arguments
 // the coordinate form of the result depends on the coordinate form of inputs
@@ -2303,7 +2303,7 @@ PM4Silt::Dyadic2_2(const Vector& v1, const Vector& v2)
 	if ((v1.Size() != 3) || (v2.Size() != 3))
 		opserr << "\n ERROR! PM4Silt::Dyadic2_2 requires vector of size(3)!" << endln;
 
-	Matrix result(3, 3);
+	MatrixN<3,3> result;
 
 	for (int i = 0; i < v1.Size(); i++) {
 		for (int j = 0; j < v2.Size(); j++)
@@ -2356,24 +2356,24 @@ PM4Silt::DoubleDot4_4(const Matrix& m1, const Matrix& m2)
 }
 /*************************************************************/
 // ToContraviant() ---------------------------------------------
-Vector PM4Silt::ToContraviant(const Vector& v1)
+VectorN<3> PM4Silt::ToContraviant(const Vector& v1)
 {
 	if (v1.Size() != 3)
 		opserr << "\n ERROR! PM4Silt::ToContraviant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VectorN<3> res = v1;
 	res(2) *= 0.5;
 
 	return res;
 }
 /*************************************************************/
 // ToCovariant() ---------------------------------------------
-Vector PM4Silt::ToCovariant(const Vector& v1)
+VectorN<3> PM4Silt::ToCovariant(const Vector& v1)
 {
 	if (v1.Size() != 3)
 		opserr << "\n ERROR! PM4Silt::ToCovariant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VectorN<3> res = v1;
 	res(2) *= 2.0;
 
 	return res;
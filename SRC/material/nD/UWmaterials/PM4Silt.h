@@ -36,6 +36,8 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
+#include <VectorN.h>
 
 #include <Information.h>
 //#include <MaterialResponse.h>
@@ -294,30 +296,30 @@ protected:
 	double	GetKsi(const double& e, const double& p);
 	void	GetElasticModuli(const Vector& sigma, double &K, double &G);
 	void	GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcur, const double& zcum);
-	Matrix	GetStiffness(const double& K, const double& G);
-	Matrix	GetCompliance(const double& K, const double& G);
+	MatrixN<3,3>	GetStiffness(const double& K, const double& G);
+	MatrixN<3,3>	GetCompliance(const double& K, const double& G);
 	void	GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &alpha_in, const Vector& alpha_in_p
 		, const Vector &fabric, const Vector &fabric_in, const double &G, const double &zcum, const double &zpeak
 		, const double &pzp, const double &Mcur, const double &dr, Vector &n, double &D, Vector &R, double &K_p
 		, Vector &alphaD, double &Cka, double &h, Vector &b);
-	Matrix	GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R, const Vector& n, const double K_p);
-	Vector	GetNormalToYield(const Vector &stress, const Vector &alpha);
+	MatrixN<3,3>	GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R, const Vector& n, const double K_p);
+	VectorN<3>	GetNormalToYield(const Vector &stress, const Vector &alpha);
 	int	Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha);
 
 	// Symmetric Tensor Operations
 	double GetTrace(const Vector& v);
-	Vector GetDevPart(const Vector& aV);
+	VectorN<3> GetDevPart(const Vector& aV);
 	double DoubleDot2_2_Contr(const Vector& v1, const Vector& v2);
 	double DoubleDot2_2_Cov(const Vector& v1, const Vector& v2);
 	double DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2);
 	double GetNorm_Contr(const Vector& v);
 	double GetNorm_Cov(const Vector& v);
-	Matrix Dyadic2_2(const Vector& v1, const Vector& v2);
+	MatrixN<3,3> Dyadic2_2(const Vector& v1, const Vector& v2);
 	Vector DoubleDot4_2(const Matrix& m1, const Vector& v1);
 	Vector DoubleDot2_4(const Vector& v1, const Matrix& m1);
 	Matrix DoubleDot4_4(const Matrix& m1, const Matrix& m2);
-	Vector ToContraviant(const Vector& v1);
-	Vector ToCovariant(const Vector& v1);
+	VectorN<3> ToContraviant(const Vector& v1);
+	VectorN<3> ToCovariant(const Vector& v1);
 };
 
 #endif
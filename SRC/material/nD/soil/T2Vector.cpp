@@ -99,14 +99,14 @@ double delta(int i,int j){
 
 // T2Vector class methods
 T2Vector::T2Vector() 
-:theT2Vector(6), theDeviator(6), theVolume(0.0)
+:theVolume(0.0)
 {
 	
 }
 
 
 T2Vector::T2Vector(const Vector &init, int isEngrgStrain)
-:theT2Vector(6), theDeviator(6), theVolume(0)
+:theVolume(0)
 {
   if (init.Size() != 6) {
     opserr << "FATAL:T2Vector::T2Vector(Vector &): vector size not equal to 6" << endln;
@@ -128,7 +128,7 @@ T2Vector::T2Vector(const Vector &init, int isEngrgStrain)
 
 
 T2Vector::T2Vector(const Vector & deviat_init, double volume_init)
- : theT2Vector(6), theDeviator(6), theVolume(volume_init)
+ : theVolume(volume_init)
 {
   if (deviat_init.Size() != 6) {
     opserr << "FATAL:T2Vector::T2Vector(Vector &, double): vector size not equal 6" << endln;
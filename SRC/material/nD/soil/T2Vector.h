@@ -24,6 +24,7 @@
 #define _T2Vector_H_
 
 #include <Vector.h>
+#include <VectorN.h>
 #include <Channel.h>
 #include <float.h>
 
@@ -78,8 +79,8 @@ public:
 protected:
 
 private:
-  Vector theT2Vector;
-  Vector theDeviator;
+  VectorN<6> theT2Vector;
+  VectorN<6> theDeviator;
   double theVolume;
   static Vector engrgStrain;
 };
@@ -98,6 +98,9 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
     //send back the initial tangent 
     const Matrix& getInitialTangent( ) ;
 
+    //tangent is independent of the state
+    bool isLinear( ) {return true;} ;
+
     //print out data
     void Print( OPS_Stream &s, int flag ) ;
 
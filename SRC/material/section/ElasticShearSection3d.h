@@ -54,6 +54,7 @@ class ElasticShearSection3d : public SectionForceDeformation
   const Vector &getStressResultant(void);
   const Matrix &getSectionTangent(void);
   const Matrix &getInitialTangent(void);
+  bool isLinear(void) {return true;};
   const Matrix &getSectionFlexibility(void);
   const Matrix &getInitialFlexibility(void);
   
@@ -74,6 +74,7 @@ class SectionForceDeformation : public Material
   virtual const Matrix &getInitialFlexibility (void);
   
   virtual double getRho(void);
+  virtual bool isLinear(void) {return false;};  // tangent independent of state
   
   virtual int commitState (void) = 0;
   virtual int revertToLastCommit (void) = 0;
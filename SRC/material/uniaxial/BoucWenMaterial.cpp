@@ -249,6 +249,24 @@ BoucWenMaterial::setTrialStrain (double strain, double strainRate)
     return 0;
 }
 
+int
+BoucWenMaterial::setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+				const double *strain, const double *strainRate,
+				double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<numMat; i++) {
+    BoucWenMaterial *theMat = static_cast<BoucWenMaterial *>(theMats[i]);
+    if (theMat == 0)
+      continue;
+    res += theMat->BoucWenMaterial::setTrialStrain(strain[i], strainRate[i]);
+    stress[i] = theMat->Tstress;
+    tangent[i] = theMat->Ttangent;
+  }
+
+  return res;
+}
+
 double 
 BoucWenMaterial::getStress(void)
 {
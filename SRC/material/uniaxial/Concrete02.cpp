@@ -93,15 +93,7 @@ Concrete02::Concrete02(int tag, double _fc, double _epsc0, double _fcu,
   UniaxialMaterial(tag, MAT_TAG_Concrete02),
   fc(_fc), epsc0(_epsc0), fcu(_fcu), epscu(_epscu), rat(_rat), ft(_ft), Ets(_Ets)
 {
-  ecminP = 0.0;
-  deptP = 0.0;
-
-  eP = 2.0*fc/epsc0;
-  epsP = 0.0;
-  sigP = 0.0;
-  eps = 0.0;
-  sig = 0.0;
-  e = 2.0*fc/epsc0;
+  this->setInitialState();
 }
 
 Concrete02::Concrete02(void):
@@ -136,8 +128,18 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
 
   // retrieve concrete hitory variables
 
-  ecmin = ecminP;
-  dept = deptP;
+  const double *C = state.getCommitted();
+  double *T = state.beginTrial();
+  double &ecmin = T[ECMIN];
+  double &dept = T[DEPT];
+  double &sig = T[SIG];
+  double &e = T[E];
+  double &eps = T[EPS];
+  double epsP = C[EPS];
+  double sigP = C[SIG];
+
+  ecmin = C[ECMIN];
+  dept = C[DEPT];
 
   // calculate current strain
 
@@ -235,59 +237,53 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
 double 
 Concrete02::getStrain(void)
 {
-  return eps;
+  return state.getTrial()[EPS];
 }
 
 double 
 Concrete02::getStress(void)
 {
-  return sig;
+  return state.getTrial()[SIG];
 }
 
 double 
 Concrete02::getTangent(void)
 {
-  return e;
+  return state.getTrial()[E];
 }
 
 int 
 Concrete02::commitState(void)
 {
-  ecminP = ecmin;
-  deptP = dept;
-  
-  eP = e;
-  sigP = sig;
-  epsP = eps;
+  state.commit();
   return 0;
 }
 
 int 
 Concrete02::revertToLastCommit(void)
 {
-  ecmin = ecminP;;
-  dept = deptP;
-  
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  state.revert();
   return 0;
 }
 
 int 
 Concrete02::revertToStart(void)
 {
-  ecminP = 0.0;
-  deptP = 0.0;
+  this->setInitialState();
+  return 0;
+}
+
+void
+Concrete02::setInitialState(void)
+{
+  double *C = state.setCommitted();
 
-  eP = 2.0*fc/epsc0;
-  epsP = 0.0;
-  sigP = 0.0;
-  eps = 0.0;
-  sig = 0.0;
-  e = 2.0*fc/epsc0;
+  C[ECMIN] = 0.0;
+  C[DEPT] = 0.0;
 
-  return 0;
+  C[E] = 2.0*fc/epsc0;
+  C[EPS] = 0.0;
+  C[SIG] = 0.0;
 }
 
 int 
@@ -301,11 +297,12 @@ Concrete02::sendSelf(int commitTag, Channel &theChannel)
   data(4) =rat;   
   data(5) =ft;    
   data(6) =Ets;   
-  data(7) =ecminP;
-  data(8) =deptP; 
-  data(9) =epsP;  
-  data(10) =sigP; 
-  data(11) =eP;   
+  const double *C = state.getCommitted();
+  data(7) =C[ECMIN];
+  data(8) =C[DEPT];
+  data(9) =C[EPS];
+  data(10) =C[SIG];
+  data(11) =C[E];
   data(12) = this->getTag();
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
@@ -334,16 +331,13 @@ Concrete02::recvSelf(int commitTag, Channel &theChannel,
   rat = data(4);
   ft = data(5);
   Ets = data(6);
-  ecminP = data(7);
-  deptP = data(8);
-  epsP = data(9);
-  sigP = data(10);
-  eP = data(11);
+  double *C = state.setCommitted();
+  C[ECMIN] = data(7);
+  C[DEPT] = data(8);
+  C[EPS] = data(9);
+  C[SIG] = data(10);
+  C[E] = data(11);
   this->setTag(data(12));
-
-  e = eP;
-  sig = sigP;
-  eps = epsP;
   
   return 0;
 }
@@ -352,7 +346,8 @@ void
 Concrete02::Print(OPS_Stream &s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
-    s << "Concrete02:(strain, stress, tangent) " << eps << " " << sig << " " << e << endln;
+    const double *T = state.getTrial();
+    s << "Concrete02:(strain, stress, tangent) " << T[EPS] << " " << T[SIG] << " " << T[E] << endln;
   }
 
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
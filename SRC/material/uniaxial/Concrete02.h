@@ -41,6 +41,7 @@
 #define Concrete02_h
 
 #include <UniaxialMaterial.h>
+#include <MaterialState.h>
 
 class Concrete02 : public UniaxialMaterial
 {
@@ -76,6 +77,7 @@ class Concrete02 : public UniaxialMaterial
  protected:
     
  private:
+    void setInitialState(void);
     void Tens_Envlp (double epsc, double &sigc, double &Ect);
     void Compr_Envlp (double epsc, double &sigc, double &Ect);
 
@@ -88,19 +90,16 @@ class Concrete02 : public UniaxialMaterial
     double ft;    // concrete tensile strength               : mp(6)
     double Ets;   // tension stiffening slope                : mp(7)
 
-    // hstvP : Concerete HISTORY VARIABLES last committed step
-    double ecminP;  //  hstP(1)
-    double deptP;   //  hstP(2)
-    double epsP;  //  = strain at previous converged step
-    double sigP;  //  = stress at previous converged step
-    double eP;    //   stiffness modulus at last converged step;
-
-    // hstv : Concerete HISTORY VARIABLES  current step
-    double ecmin;  
-    double dept;   
-    double sig;   
-    double e;     
-    double eps;   
+    // hstv : Concerete HISTORY VARIABLES, offsets into the trial and
+    // committed blocks of state
+    enum {ECMIN,    // hstP(1)
+	  DEPT,     // hstP(2)
+	  SIG,      // stress
+	  E,        // stiffness modulus
+	  EPS,      // strain
+	  NUM_STATE};
+    MaterialState<NUM_STATE> state;
+
 };
 
 
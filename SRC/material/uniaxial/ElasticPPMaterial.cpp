@@ -174,6 +174,24 @@ ElasticPPMaterial::setTrialStrain(double strain, double strainRate)
     return 0;
 }
 
+int
+ElasticPPMaterial::setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+				const double *strain, const double *strainRate,
+				double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<numMat; i++) {
+    ElasticPPMaterial *theMat = static_cast<ElasticPPMaterial *>(theMats[i]);
+    if (theMat == 0)
+      continue;
+    res += theMat->ElasticPPMaterial::setTrialStrain(strain[i], strainRate[i]);
+    stress[i] = theMat->trialStress;
+    tangent[i] = theMat->trialTangent;
+  }
+
+  return res;
+}
+
 double 
 ElasticPPMaterial::getStrain(void)
 {
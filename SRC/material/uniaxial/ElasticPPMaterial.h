@@ -49,6 +49,9 @@ class ElasticPPMaterial : public UniaxialMaterial
     const char *getClassType(void) const {return "ElasticPPMaterial";};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+    			    const double *strain, const double *strainRate,
+    			    double *stress, double *tangent);
     double getStrain(void);          
     double getStress(void);
     double getTangent(void);
@@ -180,6 +180,25 @@ int Steel01::setTrialStrain (double strain, double strainRate)
    return 0;
 }
 
+int
+Steel01::setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+				const double *strain, const double *strainRate,
+				double *stress, double *tangent)
+{
+  // qualified calls, the batch group holds only Steel01 objects
+  int res = 0;
+  for (int i=0; i<numMat; i++) {
+    Steel01 *theMat = static_cast<Steel01 *>(theMats[i]);
+    if (theMat == 0)
+      continue;
+    res += theMat->Steel01::setTrialStrain(strain[i], strainRate[i]);
+    stress[i] = theMat->Tstress;
+    tangent[i] = theMat->Ttangent;
+  }
+
+  return res;
+}
+
 int Steel01::setTrial (double strain, double &stress, double &tangent, double strainRate)
 {
    // Reset history variables to last converged state
@@ -58,6 +58,9 @@ class Steel01 : public UniaxialMaterial
     const char *getClassType(void) const {return "Steel01";};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+    			    const double *strain, const double *strainRate,
+    			    double *stress, double *tangent);
     int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     double getStrain(void);              
     double getStress(void);
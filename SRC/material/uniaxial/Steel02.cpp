@@ -134,27 +134,7 @@ Steel02::Steel02(int tag,
   Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), a1(_a1), a2(_a2), a3(_a3), a4(_a4), 
   sigini(sigInit)
 {
-  konP = 0;
-  kon = 0;
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
-
-  if (sigini != 0.0) {
-    epsP = sigini/E0;
-    sigP = sigini;
-  } 
+  this->setInitialState();
 }
 
 Steel02::Steel02(int tag,
@@ -163,36 +143,19 @@ Steel02::Steel02(int tag,
   UniaxialMaterial(tag, MAT_TAG_Steel02),
   Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), sigini(0.0)
 {
-  konP = 0;
-
   // Default values for no isotropic hardening
   a1 = 0.0;
   a2 = 1.0;
   a3 = 0.0;
   a4 = 1.0;
 
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+  this->setInitialState();
 }
 
 Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
   Fy(_Fy), E0(_E0), b(_b), sigini(0.0)
 {
-  konP = 0;
-
   // Default values for elastic to hardening transitions
   R0 = 15.0;
   cR1 = 0.925;
@@ -204,26 +167,13 @@ Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
   a3 = 0.0;
   a4 = 1.0;
 
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+  this->setInitialState();
 }
 
 Steel02::Steel02(void):
   UniaxialMaterial(0, MAT_TAG_Steel02)
 {
-  konP = 0;
+
 }
 
 Steel02::~Steel02(void)
@@ -251,6 +201,23 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
   double Esh = b * E0;
   double epsy = Fy / E0;
 
+  // every trial variable is set below, so the committed ones are not copied
+  const double *C = state.getCommitted();
+  double *T = state.beginTrial(false);
+  double &epsmin = T[EPSMIN];
+  double &epsmax = T[EPSMAX];
+  double &epspl = T[EPSPL];
+  double &epss0 = T[EPSS0];
+  double &sigs0 = T[SIGS0];
+  double &epsr = T[EPSR];
+  double &sigr = T[SIGR];
+  double &kon = T[KON];
+  double &sig = T[SIG];
+  double &e = T[E];
+  double &eps = T[EPS];
+  double epsP = C[EPS];
+  double sigP = C[SIG];
+
   // modified C-P. Lamarche 2006
   if (sigini != 0.0) {
     double epsini = sigini/E0;
@@ -261,14 +228,14 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
   double deps = eps - epsP;
   
-  epsmax = epsmaxP;
-  epsmin = epsminP;
-  epspl  = epsplP;
-  epss0  = epss0P;  
-  sigs0  = sigs0P; 
-  epsr   = epssrP;  
-  sigr   = sigsrP;  
-  kon = konP;
+  epsmax = C[EPSMAX];
+  epsmin = C[EPSMIN];
+  epspl  = C[EPSPL];
+  epss0  = C[EPSS0];
+  sigs0  = C[SIGS0];
+  epsr   = C[EPSR];
+  sigr   = C[SIGR];
+  kon    = C[KON];
 
   if (kon == 0 || kon == 3) { // modified C-P. Lamarche 2006
 
@@ -367,83 +334,64 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 double 
 Steel02::getStrain(void)
 {
-  return eps;
+  return state.getTrial()[EPS];
 }
 
 double 
 Steel02::getStress(void)
 {
-  return sig;
+  return state.getTrial()[SIG];
 }
 
 double 
 Steel02::getTangent(void)
 {
-  return e;
+  return state.getTrial()[E];
 }
 
 int 
 Steel02::commitState(void)
 {
-  epsminP = epsmin;
-  epsmaxP = epsmax;
-  epsplP = epspl;
-  epss0P = epss0;
-  sigs0P = sigs0;
-  epssrP = epsr;
-  sigsrP = sigr;
-  konP = kon;
-  
-  eP = e;
-  sigP = sig;
-  epsP = eps;
-
+  state.commit();
   return 0;
 }
 
 int 
 Steel02::revertToLastCommit(void)
 {
-  epsmin = epsminP;
-  epsmax = epsmaxP;
-  epspl = epsplP;
-  epss0 = epss0P;
-  sigs0 = sigs0P;
-  epsr = epssrP;
-  sigr = sigsrP;
-  kon = konP;
-  
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  state.revert();
   return 0;
 }
 
 int 
 Steel02::revertToStart(void)
 {
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;  
-
-  konP = 0;
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+  this->setInitialState();
+  return 0;
+}
 
-  if (sigini != 0.0) {
-	  epsP = sigini/E0;
-	  sigP = sigini;
-   } 
+void
+Steel02::setInitialState(void)
+{
+  double *C = state.setCommitted();
 
-  return 0;
+  C[KON] = 0.0;
+  C[E] = E0;
+  C[EPS] = 0.0;
+  C[SIG] = 0.0;
+
+  C[EPSMAX] = Fy/E0;
+  C[EPSMIN] = -C[EPSMAX];
+  C[EPSPL] = 0.0;
+  C[EPSS0] = 0.0;
+  C[SIGS0] = 0.0;
+  C[EPSR] = 0.0;
+  C[SIGR] = 0.0;
+
+  if (sigini != 0.0) {
+    C[EPS] = sigini/E0;
+    C[SIG] = sigini;
+  }
 }
 
 int 
@@ -460,17 +408,18 @@ Steel02::sendSelf(int commitTag, Channel &theChannel)
   data(7) = a2;
   data(8) = a3;
   data(9) = a4;
-  data(10) = epsminP;
-  data(11) = epsmaxP;
-  data(12) = epsplP;
-  data(13) = epss0P;
-  data(14) = sigs0P;
-  data(15) = epssrP;
-  data(16) = sigsrP;
-  data(17) = konP;  
-  data(18) = epsP;  
-  data(19) = sigP;  
-  data(20) = eP;    
+  const double *C = state.getCommitted();
+  data(10) = C[EPSMIN];
+  data(11) = C[EPSMAX];
+  data(12) = C[EPSPL];
+  data(13) = C[EPSS0];
+  data(14) = C[SIGS0];
+  data(15) = C[EPSR];
+  data(16) = C[SIGR];
+  data(17) = C[KON];
+  data(18) = C[EPS];
+  data(19) = C[SIG];
+  data(20) = C[E];
   data(21) = this->getTag();
   data(22) = sigini;
 
@@ -502,23 +451,20 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
   a2 = data(7); 
   a3 = data(8); 
   a4 = data(9); 
-  epsminP = data(10);
-  epsmaxP = data(11);
-  epsplP = data(12); 
-  epss0P = data(13); 
-  sigs0P = data(14); 
-  epssrP = data(15); 
-  sigsrP = data(16); 
-  konP = int(data(17));   
-  epsP = data(18);   
-  sigP = data(19);   
-  eP   = data(20);   
+  double *C = state.setCommitted();
+  C[EPSMIN] = data(10);
+  C[EPSMAX] = data(11);
+  C[EPSPL] = data(12);
+  C[EPSS0] = data(13);
+  C[SIGS0] = data(14);
+  C[EPSR] = data(15);
+  C[SIGR] = data(16);
+  C[KON] = int(data(17));
+  C[EPS] = data(18);
+  C[SIG] = data(19);
+  C[E] = data(20);
   this->setTag(int(data(21)));
   sigini = data(22);
-
-  e = eP;
-  sig = sigP;
-  eps = epsP;
   
   return 0;
 }
@@ -40,6 +40,7 @@
 #define Steel02_h
 
 #include <UniaxialMaterial.h>
+#include <MaterialState.h>
 
 class Steel02 : public UniaxialMaterial
 {
@@ -85,6 +86,8 @@ class Steel02 : public UniaxialMaterial
  protected:
     
  private:
+    void setInitialState(void);
+
     // matpar : STEEL FIXED PROPERTIES
     double Fy;  //  = matpar(1)  : yield stress
     double E0;  //  = matpar(2)  : initial stiffness
@@ -97,31 +100,21 @@ class Steel02 : public UniaxialMaterial
     double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
     double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
     double sigini; // initial 
-    // hstvP : STEEL HISTORY VARIABLES
-    double epsminP; //  = hstvP(1) : max eps in compression
-    double epsmaxP; //  = hstvP(2) : max eps in tension
-    double epsplP;  //  = hstvP(3) : plastic excursion
-    double epss0P;  //  = hstvP(4) : eps at asymptotes intersection
-    double sigs0P;  //  = hstvP(5) : sig at asymptotes intersection
-    double epssrP;  //  = hstvP(6) : eps at last inversion point
-    double sigsrP;  //  = hstvP(7) : sig at last inversion point
-    int    konP;    //  = hstvP(8) : index for loading/unloading
-    // hstv : STEEL HISTORY VARIABLES   
-    double epsP;  //  = strain at previous converged step
-    double sigP;  //  = stress at previous converged step
-    double eP;    //   stiffness modulus at last converged step;
-
-    double epsmin; 
-    double epsmax; 
-    double epspl;  
-    double epss0;  
-    double sigs0; 
-    double epsr;  
-    double sigr;  
-    int    kon;    
-    double sig;   
-    double e;     
-    double eps;   //  = strain at current step
+    // hstv : STEEL HISTORY VARIABLES, offsets into the trial and
+    // committed blocks of state
+    enum {EPSMIN,   // max eps in compression
+	  EPSMAX,   // max eps in tension
+	  EPSPL,    // plastic excursion
+	  EPSS0,    // eps at asymptotes intersection
+	  SIGS0,    // sig at asymptotes intersection
+	  EPSR,     // eps at last inversion point
+	  SIGR,     // sig at last inversion point
+	  KON,      // index for loading/unloading
+	  SIG,      // stress
+	  E,        // stiffness modulus
+	  EPS,      // strain
+	  NUM_STATE};
+    MaterialState<NUM_STATE> state;
 };
 
 
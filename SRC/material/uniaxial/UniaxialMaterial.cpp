@@ -128,6 +128,22 @@ UniaxialMaterial::setTrial(double strain, double &stress, double &tangent, doubl
 }
 
 
+int
+UniaxialMaterial::setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+				      const double *strain, const double *strainRate,
+				      double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<numMat; i++) {
+    UniaxialMaterial *theMat = theMats[i];
+    if (theMat != 0)
+      res += theMat->setTrial(strain[i], stress[i], tangent[i], strainRate[i]);
+  }
+
+  return res;
+}
+
+
 int
 UniaxialMaterial::setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate)
 {
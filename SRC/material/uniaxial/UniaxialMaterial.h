@@ -61,6 +61,13 @@ class UniaxialMaterial : public Material
     virtual int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial (double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+    // sets the trial strains of numMat materials of the class of this
+    // object in one call, used by UniaxialMaterialBatch; null entries of
+    // theMats are skipped
+    virtual int setTrialStrainBatch (int numMat, UniaxialMaterial **theMats,
+				     const double *strain, const double *strainRate,
+				     double *stress, double *tangent);
+
     virtual double getStrain (void) = 0;
     virtual double getStrainRate (void);
     virtual double getStress (void) = 0;
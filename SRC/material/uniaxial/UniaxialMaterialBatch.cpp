@@ -0,0 +1,209 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// UniaxialMaterialBatch.
+
+#include <UniaxialMaterialBatch.h>
+#include <UniaxialMaterial.h>
+#include <OPS_Globals.h>
+#include <Domain.h>
+
+UniaxialMaterialBatch::UniaxialMaterialBatch()
+  :numMaterials(0), pending(false)
+{
+
+}
+
+UniaxialMaterialBatch::~UniaxialMaterialBatch()
+{
+
+}
+
+int
+UniaxialMaterialBatch::addMaterial(UniaxialMaterial *theMaterial)
+{
+  int classTag = theMaterial->getClassTag();
+
+  int g = 0;
+  int numGroups = (int)theGroups.size();
+  while (g < numGroups && theGroups[g].classTag != classTag)
+    g++;
+
+  if (g == numGroups) {
+    theGroups.push_back(Group());
+    theGroups[g].classTag = classTag;
+    theGroups[g].pending = false;
+  }
+
+  Group &theGroup = theGroups[g];
+  int i;
+  if (theGroup.freeSlots.empty() == false) {
+    i = theGroup.freeSlots.back();
+    theGroup.freeSlots.pop_back();
+  } else {
+    i = (int)theGroup.theMaterials.size();
+    if (i > SlotMask) {
+      opserr << "UniaxialMaterialBatch::addMaterial - too many materials of class "
+	     << theMaterial->getClassType() << endln;
+      return -1;
+    }
+    theGroup.theMaterials.push_back(0);
+    theGroup.strain.push_back(0.0);
+    theGroup.strainRate.push_back(0.0);
+    theGroup.stress.push_back(0.0);
+    theGroup.tangent.push_back(0.0);
+  }
+
+  theGroup.theMaterials[i] = theMaterial;
+  numMaterials++;
+
+  int slot = (g << SlotShift) | i;
+  this->refresh(slot);
+
+  return slot;
+}
+
+void
+UniaxialMaterialBatch::removeMaterial(int slot)
+{
+  if (slot < 0)
+    return;
+
+  Group &theGroup = theGroups[slot >> SlotShift];
+  int i = slot & SlotMask;
+  if (theGroup.theMaterials[i] == 0)
+    return;
+
+  theGroup.theMaterials[i] = 0;
+  theGroup.freeSlots.push_back(i);
+  numMaterials--;
+}
+
+void
+UniaxialMaterialBatch::refresh(int slot)
+{
+  Group &theGroup = theGroups[slot >> SlotShift];
+  int i = slot & SlotMask;
+  UniaxialMaterial *theMaterial = theGroup.theMaterials[i];
+
+  theGroup.strain[i] = theMaterial->getStrain();
+  theGroup.strainRate[i] = theMaterial->getStrainRate();
+  theGroup.stress[i] = theMaterial->getStress();
+  theGroup.tangent[i] = theMaterial->getTangent();
+}
+
+int
+UniaxialMaterialBatch::evaluate(void)
+{
+  if (pending == false)
+    return 0;
+
+  // clear the flag first, the materials may query the batch
+  pending = false;
+
+  int res = 0;
+
+  int numGroups = (int)theGroups.size();
+  for (int g=0; g<numGroups; g++) {
+    Group &theGroup = theGroups[g];
+    if (theGroup.pending == false)
+      continue;
+    theGroup.pending = false;
+
+    // any material of the group can evaluate the whole group
+    int numMat = (int)theGroup.theMaterials.size();
+    UniaxialMaterial **theMaterials = &theGroup.theMaterials[0];
+    int i = 0;
+    while (i < numMat && theMaterials[i] == 0)
+      i++;
+    if (i == numMat)
+      continue;
+
+    res += theMaterials[i]->setTrialStrainBatch(numMat, theMaterials,
+						&theGroup.strain[0],
+						&theGroup.strainRate[0],
+						&theGroup.stress[0],
+						&theGroup.tangent[0]);
+  }
+
+  if (res != 0)
+    opserr << "UniaxialMaterialBatch::evaluate - failed in setTrialStrainBatch\n";
+
+  return res;
+}
+
+void
+UniaxialMaterialBatch::Print(OPS_Stream &s, int flag)
+{
+  s << "UniaxialMaterialBatch, " << numMaterials << " materials\n";
+  for (int g=0; g<(int)theGroups.size(); g++) {
+    Group &theGroup = theGroups[g];
+    int numLive = (int)(theGroup.theMaterials.size() - theGroup.freeSlots.size());
+    s << "  class tag " << theGroup.classTag << ": " << numLive << " materials\n";
+  }
+}
+
+UniaxialMaterialBatchResponse::UniaxialMaterialBatchResponse(Domain *theDom,
+							     Response *theRes)
+  :Response(), theDomain(theDom), theResponse(theRes)
+{
+
+}
+
+UniaxialMaterialBatchResponse::~UniaxialMaterialBatchResponse()
+{
+  if (theResponse != 0)
+    delete theResponse;
+}
+
+int
+UniaxialMaterialBatchResponse::getResponse(void)
+{
+  UniaxialMaterialBatch *theBatch = theDomain->getMaterialBatch();
+  if (theBatch != 0)
+    theBatch->evaluate();
+
+  return theResponse->getResponse();
+}
+
+int
+UniaxialMaterialBatchResponse::getResponseSensitivity(int gradNumber)
+{
+  return theResponse->getResponseSensitivity(gradNumber);
+}
+
+Information &
+UniaxialMaterialBatchResponse::getInformation(void)
+{
+  return theResponse->getInformation();
+}
+
+void
+UniaxialMaterialBatchResponse::Print(OPS_Stream &s, int flag)
+{
+  theResponse->Print(s, flag);
+}
+
+void
+UniaxialMaterialBatchResponse::Print(ofstream &s, int flag)
+{
+  theResponse->Print(s, flag);
+}
@@ -0,0 +1,134 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef UniaxialMaterialBatch_h
+#define UniaxialMaterialBatch_h
+
+// Description: This file contains the class definition for
+// UniaxialMaterialBatch. A UniaxialMaterialBatch holds the uniaxial
+// materials of the elements of a Domain in groups of the same class. The
+// elements only gather the trial strains into the batch in update() and
+// read the stresses and tangents back; the materials of a group are then
+// set in a single call to UniaxialMaterial::setTrialStrainBatch(), in
+// which the material classes that provide it evaluate the whole group in
+// one loop without a virtual call per material.
+//
+// The batch is owned by the Domain and is evaluated at the end of
+// Domain::update(); reading a stress or tangent of a group with pending
+// strains evaluates the batch first, so elements updated outside of
+// Domain::update() are also handled.
+
+#include <vector>
+#include <Response.h>
+
+class UniaxialMaterial;
+class OPS_Stream;
+class Domain;
+
+class UniaxialMaterialBatch
+{
+  public:
+    UniaxialMaterialBatch();
+    ~UniaxialMaterialBatch();
+
+    // returns the slot of the material in the batch
+    int addMaterial(UniaxialMaterial *theMaterial);
+    void removeMaterial(int slot);
+
+    inline void setTrialStrain(int slot, double strain, double strainRate = 0.0);
+    double getStrain(int slot) const {return theGroups[slot >> SlotShift].strain[slot & SlotMask];}
+    inline double getStress(int slot);
+    inline double getTangent(int slot);
+
+    // copies the state of the material into the slot, to be invoked
+    // after the material is set other than through the batch
+    void refresh(int slot);
+
+    int evaluate(void);
+
+    int getNumMaterials(void) const {return numMaterials;}
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    // slot = group << SlotShift | index in group
+    enum {SlotShift = 24, SlotMask = (1 << 24) - 1};
+
+    struct Group {
+      int classTag;
+      std::vector<UniaxialMaterial *> theMaterials;
+      std::vector<double> strain, strainRate, stress, tangent;
+      std::vector<int> freeSlots;
+      bool pending;
+    };
+
+    std::vector<Group> theGroups;
+    int numMaterials;
+    bool pending;
+};
+
+// wraps a response obtained from a batched material; the response of
+// the material is read past the element, so the batch of the Domain is
+// evaluated first to have the material set to the latest trial strain
+class UniaxialMaterialBatchResponse : public Response
+{
+  public:
+    UniaxialMaterialBatchResponse(Domain *theDomain, Response *theResponse);
+    ~UniaxialMaterialBatchResponse();
+
+    int getResponse(void);
+    int getResponseSensitivity(int gradNumber);
+    Information &getInformation(void);
+
+    void Print(OPS_Stream &s, int flag = 0);
+    void Print(ofstream &s, int flag = 0);
+
+  private:
+    Domain *theDomain;
+    Response *theResponse;
+};
+
+inline void
+UniaxialMaterialBatch::setTrialStrain(int slot, double strain, double strainRate)
+{
+  Group &theGroup = theGroups[slot >> SlotShift];
+  int i = slot & SlotMask;
+  theGroup.strain[i] = strain;
+  theGroup.strainRate[i] = strainRate;
+  theGroup.pending = true;
+  pending = true;
+}
+
+inline double
+UniaxialMaterialBatch::getStress(int slot)
+{
+  if (pending == true)
+    this->evaluate();
+  return theGroups[slot >> SlotShift].stress[slot & SlotMask];
+}
+
+inline double
+UniaxialMaterialBatch::getTangent(int slot)
+{
+  if (pending == true)
+    this->evaluate();
+  return theGroups[slot >> SlotShift].tangent[slot & SlotMask];
+}
+
+#endif
@@ -257,6 +257,24 @@ ViscousDamper::setTrialStrain(double strain, double strainRate)
    return 0;
 }
 
+int
+ViscousDamper::setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+				const double *strain, const double *strainRate,
+				double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i=0; i<numMat; i++) {
+    ViscousDamper *theMat = static_cast<ViscousDamper *>(theMats[i]);
+    if (theMat == 0)
+      continue;
+    res += theMat->ViscousDamper::setTrialStrain(strain[i], strainRate[i]);
+    stress[i] = theMat->Tstress;
+    tangent[i] = 0.0;
+  }
+
+  return res;
+}
+
 double ViscousDamper::getStress(void)
 {
   return  Tstress;
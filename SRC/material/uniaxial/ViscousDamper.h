@@ -58,6 +58,9 @@ class ViscousDamper : public UniaxialMaterial
     const char *getClassType(void) const {return "ViscousDamper";};
 
     int setTrialStrain(double strain, double strainRate); 
+    int setTrialStrainBatch(int numMat, UniaxialMaterial **theMats,
+    			    const double *strain, const double *strainRate,
+    			    double *stress, double *tangent);
     double getStrain(void); 
     double getStrainRate(void);
     double getStress(void);
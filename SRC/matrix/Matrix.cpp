@@ -34,6 +34,7 @@
 #include "Matrix.h"
 #include "Vector.h"
 #include "ID.h"
+#include "SmallDenseKernels.h"
 
 #include <stdlib.h>
 #include <iostream>
@@ -190,6 +191,14 @@ Matrix::Matrix(const Matrix &other)
 Matrix::Matrix(Matrix &&other)
 :numRows(other.numRows), numCols(other.numCols), dataSize(other.dataSize), data(other.data), fromFree(0)
 {
+  // data not owned by other (e.g. a MatrixN) can not be taken, copy it
+  if (other.fromFree == 1) {
+    data = (dataSize != 0) ? new (nothrow) double[dataSize] : 0;
+    for (int i=0; i<dataSize; i++)
+      data[i] = other.data[i];
+    return;
+  }
+
   other.numRows = 0;
   other.numCols = 0;
   other.dataSize = 0;
@@ -383,6 +392,12 @@ Matrix::Solve(const Vector &b, Vector &x) const
       return -2;
     }
 #endif
+
+    // small systems are solved with the unrolled kernels, no work area needed
+    if (n > 0 && n <= MAX_SMALL_DENSE && numCols == n) {
+      x = b;
+      return -abs(smallDenseSolve(n, data, x.theData, 1));
+    }
     
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
@@ -479,6 +494,12 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     }
 #endif
 
+    // small systems are solved with the unrolled kernels, no work area needed
+    if (n > 0 && n <= MAX_SMALL_DENSE && numCols == n) {
+      x = b;
+      return -abs(smallDenseSolve(n, data, x.data, x.numCols));
+    }
+
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
 
@@ -578,6 +599,13 @@ Matrix::Invert(Matrix &theInverse) const
     }
 #endif
 
+    // small matrices are inverted with the unrolled kernels
+    if (n > 0 && n <= MAX_SMALL_DENSE && numCols == n) {
+      if (theInverse.numRows != n || theInverse.numCols != n)
+	theInverse = *this;
+      return -abs(smallDenseInvert(n, data, theInverse.data));
+    }
+
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
 
@@ -1186,8 +1214,9 @@ Matrix::operator=(const Matrix &other)
       opserr << "Matrix::operator=() - matrix dimensions do not match\n";
 #endif
 
-      if (this->data != 0)
+      if (this->data != 0 && fromFree == 0)
 	  delete [] this->data;
+      fromFree = 0;
       
       int theSize = other.numCols*other.numRows;
       
@@ -1219,6 +1248,9 @@ Matrix::operator=( Matrix &&other)
   if (this == &other) 
     return *this;
 
+  // if either side does not own its data fall back to a copy
+  if (fromFree == 1 || other.fromFree == 1)
+    return *this = static_cast<const Matrix &>(other);
 
   if (this->data != 0)
     delete [] this->data;
@@ -0,0 +1,222 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the class template definition for
+// MatrixN. MatrixN<R,C> is a Matrix of fixed size R x C whose data lives
+// inside the object, i.e. on the stack for local variables, so no heap
+// memory is allocated or freed when it is created or destroyed. As it is
+// a Matrix it can be passed wherever a Matrix& or const Matrix& is
+// expected. The data is stored column-wise, as for Matrix. The methods
+// redefined here have the sizes as compile time constants so that the
+// loops are unrolled by the compiler.
+//
+// A MatrixN must not be resized, and must not be assigned a Matrix of a
+// different size.
+
+#ifndef MatrixN_h
+#define MatrixN_h
+
+#include <Matrix.h>
+#include <VectorN.h>
+
+template <int R, int C>
+class MatrixN : public Matrix
+{
+  public:
+    // constructors
+    MatrixN();
+    MatrixN(const MatrixN<R,C> &other);
+    MatrixN(const Matrix &other);
+
+    // utility methods
+    inline void Zero(void);
+    inline int addMatrix(double factThis, const MatrixN<R,C> &other, double factOther);
+    template <int K>
+    int addMatrixProduct(double factThis, const MatrixN<R,K> &A, const MatrixN<K,C> &B, double factOther);
+
+    inline double *getData(void) {return theStore;}
+    inline const double *getData(void) const {return theStore;}
+
+    // overloaded operators
+    inline double operator()(int row, int col) const {return theStore[col*R + row];}
+    inline double &operator()(int row, int col) {return theStore[col*R + row];}
+
+    inline MatrixN<R,C> &operator=(const MatrixN<R,C> &other);
+    MatrixN<R,C> &operator=(const Matrix &other);
+    inline MatrixN<R,C> &operator+=(const MatrixN<R,C> &other);
+    inline MatrixN<R,C> &operator-=(const MatrixN<R,C> &other);
+    inline MatrixN<R,C> &operator*=(double fact);
+
+    using Matrix::addMatrix;
+    using Matrix::addMatrixProduct;
+    using Matrix::operator();
+    using Matrix::operator+=;
+    using Matrix::operator-=;
+
+  private:
+    double theStore[R*C];
+};
+
+
+/********* MATRIXN FUNCTIONS ***********/
+template <int R, int C>
+MatrixN<R,C>::MatrixN()
+:Matrix(theStore, R, C)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] = 0.0;
+}
+
+
+template <int R, int C>
+MatrixN<R,C>::MatrixN(const MatrixN<R,C> &other)
+:Matrix(theStore, R, C)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] = other.theStore[i];
+}
+
+
+template <int R, int C>
+MatrixN<R,C>::MatrixN(const Matrix &other)
+:Matrix(theStore, R, C)
+{
+  *this = other;
+}
+
+
+template <int R, int C>
+inline void
+MatrixN<R,C>::Zero(void)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] = 0.0;
+}
+
+
+template <int R, int C>
+inline int
+MatrixN<R,C>::addMatrix(double factThis, const MatrixN<R,C> &other, double factOther)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] = factThis*theStore[i] + factOther*other.theStore[i];
+  return 0;
+}
+
+
+template <int R, int C>
+template <int K>
+int
+MatrixN<R,C>::addMatrixProduct(double factThis, const MatrixN<R,K> &A, const MatrixN<K,C> &B, double factOther)
+{
+  const double *a = A.getData();
+  const double *b = B.getData();
+  for (int j=0; j<C; j++) {
+    double *col = &theStore[j*R];
+    for (int i=0; i<R; i++)
+      col[i] *= factThis;
+    for (int k=0; k<K; k++) {
+      double bkj = factOther*b[j*K + k];
+      const double *aCol = &a[k*R];
+      for (int i=0; i<R; i++)
+	col[i] += aCol[i]*bkj;
+    }
+  }
+  return 0;
+}
+
+
+template <int R, int C>
+inline MatrixN<R,C> &
+MatrixN<R,C>::operator=(const MatrixN<R,C> &other)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] = other.theStore[i];
+  return *this;
+}
+
+
+template <int R, int C>
+MatrixN<R,C> &
+MatrixN<R,C>::operator=(const Matrix &other)
+{
+  if (other.noRows() != R || other.noCols() != C) {
+    opserr << "MatrixN::operator=() - matrix of size " << other.noRows() << "x"
+	   << other.noCols() << " assigned to MatrixN<" << R << "," << C << ">\n";
+    return *this;
+  }
+
+  for (int j=0; j<C; j++)
+    for (int i=0; i<R; i++)
+      theStore[j*R + i] = other(i,j);
+  return *this;
+}
+
+
+template <int R, int C>
+inline MatrixN<R,C> &
+MatrixN<R,C>::operator+=(const MatrixN<R,C> &other)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] += other.theStore[i];
+  return *this;
+}
+
+
+template <int R, int C>
+inline MatrixN<R,C> &
+MatrixN<R,C>::operator-=(const MatrixN<R,C> &other)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] -= other.theStore[i];
+  return *this;
+}
+
+
+template <int R, int C>
+inline MatrixN<R,C> &
+MatrixN<R,C>::operator*=(double fact)
+{
+  for (int i=0; i<R*C; i++)
+    theStore[i] *= fact;
+  return *this;
+}
+
+
+// defined here as it needs the complete MatrixN
+template <int N>
+template <int C>
+int
+VectorN<N>::addMatrixVector(double factThis, const MatrixN<N,C> &m, const VectorN<C> &v, double factOther)
+{
+  const double *a = m.getData();
+  const double *x = v.getData();
+  for (int i=0; i<N; i++)
+    theStore[i] *= factThis;
+  for (int j=0; j<C; j++) {
+    double xj = factOther*x[j];
+    const double *aCol = &a[j*N];
+    for (int i=0; i<N; i++)
+      theStore[i] += aCol[i]*xj;
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,256 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains fixed-size dense LU and Cholesky
+// kernels used by Matrix::Solve() and Matrix::Invert() for matrices of
+// order 1 through MAX_SMALL_DENSE. At these sizes the copy into the work
+// area and the LAPACK call overhead cost more than the factorization
+// itself; with the order a template parameter the loops are unrolled by
+// the compiler. Symmetric matrices are first tried with Cholesky, falling
+// back to LU with partial pivoting if a pivot is not positive.
+//
+// All data is column-wise, as for Matrix. The return values follow the
+// LAPACK info convention: 0 if successful, k > 0 if the k'th pivot is
+// zero, -1 if the order is not handled here.
+
+#ifndef SmallDenseKernels_h
+#define SmallDenseKernels_h
+
+#include <math.h>
+
+#define MAX_SMALL_DENSE 12
+
+// true if the square matrix a is exactly symmetric
+template <int N>
+inline bool
+smallDenseIsSymmetric(const double *a)
+{
+  for (int j=1; j<N; j++)
+    for (int i=0; i<j; i++)
+      if (a[j*N+i] != a[i*N+j])
+	return false;
+  return true;
+}
+
+
+// Cholesky factorization A = LL' of the lower triangle of a into l,
+// returns 0 if successful or k+1 if the k'th pivot is not positive
+template <int N>
+inline int
+smallDenseCholesky(const double *a, double *l)
+{
+  for (int j=0; j<N; j++) {
+    double d = a[j*N+j];
+    for (int k=0; k<j; k++)
+      d -= l[k*N+j]*l[k*N+j];
+    if (d <= 0.0)
+      return j+1;
+    d = sqrt(d);
+    l[j*N+j] = d;
+    double dInv = 1.0/d;
+    for (int i=j+1; i<N; i++) {
+      double s = a[j*N+i];
+      for (int k=0; k<j; k++)
+	s -= l[k*N+i]*l[k*N+j];
+      l[j*N+i] = s*dInv;
+    }
+  }
+  return 0;
+}
+
+
+// overwrites b with the solution of LL'x = b
+template <int N>
+inline void
+smallDenseCholeskySolve(const double *l, double *b)
+{
+  for (int i=0; i<N; i++) {
+    double s = b[i];
+    for (int k=0; k<i; k++)
+      s -= l[k*N+i]*b[k];
+    b[i] = s/l[i*N+i];
+  }
+  for (int i=N-1; i>=0; i--) {
+    double s = b[i];
+    for (int k=i+1; k<N; k++)
+      s -= l[i*N+k]*b[k];
+    b[i] = s/l[i*N+i];
+  }
+}
+
+
+// in place LU factorization of a with partial pivoting, row i was
+// swapped with row piv[i]; returns 0 if successful or k+1 if the k'th
+// pivot is zero
+template <int N>
+inline int
+smallDenseLU(double *a, int *piv)
+{
+  for (int k=0; k<N; k++) {
+    int p = k;
+    double max = fabs(a[k*N+k]);
+    for (int i=k+1; i<N; i++) {
+      double v = fabs(a[k*N+i]);
+      if (v > max) {
+	max = v;
+	p = i;
+      }
+    }
+    piv[k] = p;
+    if (max == 0.0)
+      return k+1;
+
+    if (p != k)
+      for (int j=0; j<N; j++) {
+	double t = a[j*N+k];
+	a[j*N+k] = a[j*N+p];
+	a[j*N+p] = t;
+      }
+
+    double pInv = 1.0/a[k*N+k];
+    for (int i=k+1; i<N; i++)
+      a[k*N+i] *= pInv;
+
+    for (int j=k+1; j<N; j++) {
+      double f = a[j*N+k];
+      if (f != 0.0)
+	for (int i=k+1; i<N; i++)
+	  a[j*N+i] -= a[k*N+i]*f;
+    }
+  }
+  return 0;
+}
+
+
+// overwrites b with the solution of LUx = Pb
+template <int N>
+inline void
+smallDenseLUSolve(const double *lu, const int *piv, double *b)
+{
+  for (int i=0; i<N; i++) {
+    int p = piv[i];
+    if (p != i) {
+      double t = b[i];
+      b[i] = b[p];
+      b[p] = t;
+    }
+  }
+  for (int i=1; i<N; i++) {
+    double s = b[i];
+    for (int k=0; k<i; k++)
+      s -= lu[k*N+i]*b[k];
+    b[i] = s;
+  }
+  for (int i=N-1; i>=0; i--) {
+    double s = b[i];
+    for (int k=i+1; k<N; k++)
+      s -= lu[k*N+i]*b[k];
+    b[i] = s/lu[i*N+i];
+  }
+}
+
+
+// overwrites the N x nrhs matrix b with the solution of AX = B
+template <int N>
+int
+smallDenseSolve(const double *a, double *b, int nrhs)
+{
+  double f[N*N];
+
+  if (smallDenseIsSymmetric<N>(a) && smallDenseCholesky<N>(a, f) == 0) {
+    for (int j=0; j<nrhs; j++)
+      smallDenseCholeskySolve<N>(f, &b[j*N]);
+    return 0;
+  }
+
+  int piv[N];
+  for (int i=0; i<N*N; i++)
+    f[i] = a[i];
+  int info = smallDenseLU<N>(f, piv);
+  if (info != 0)
+    return info;
+
+  for (int j=0; j<nrhs; j++)
+    smallDenseLUSolve<N>(f, piv, &b[j*N]);
+  return 0;
+}
+
+
+// sets aInv to the inverse of a, solving for the columns of the identity;
+// a and aInv may be the same storage
+template <int N>
+int
+smallDenseInvert(const double *a, double *aInv)
+{
+  double aCopy[N*N];
+  for (int i=0; i<N*N; i++)
+    aCopy[i] = a[i];
+
+  for (int j=0; j<N; j++)
+    for (int i=0; i<N; i++)
+      aInv[j*N+i] = (i == j) ? 1.0 : 0.0;
+
+  return smallDenseSolve<N>(aCopy, aInv, N);
+}
+
+
+// dispatch on the order n; returns -1 if n is not handled here
+inline int
+smallDenseSolve(int n, const double *a, double *b, int nrhs)
+{
+  switch (n) {
+  case 1: return smallDenseSolve<1>(a, b, nrhs);
+  case 2: return smallDenseSolve<2>(a, b, nrhs);
+  case 3: return smallDenseSolve<3>(a, b, nrhs);
+  case 4: return smallDenseSolve<4>(a, b, nrhs);
+  case 5: return smallDenseSolve<5>(a, b, nrhs);
+  case 6: return smallDenseSolve<6>(a, b, nrhs);
+  case 7: return smallDenseSolve<7>(a, b, nrhs);
+  case 8: return smallDenseSolve<8>(a, b, nrhs);
+  case 9: return smallDenseSolve<9>(a, b, nrhs);
+  case 10: return smallDenseSolve<10>(a, b, nrhs);
+  case 11: return smallDenseSolve<11>(a, b, nrhs);
+  case 12: return smallDenseSolve<12>(a, b, nrhs);
+  default: return -1;
+  }
+}
+
+
+inline int
+smallDenseInvert(int n, const double *a, double *aInv)
+{
+  switch (n) {
+  case 1: return smallDenseInvert<1>(a, aInv);
+  case 2: return smallDenseInvert<2>(a, aInv);
+  case 3: return smallDenseInvert<3>(a, aInv);
+  case 4: return smallDenseInvert<4>(a, aInv);
+  case 5: return smallDenseInvert<5>(a, aInv);
+  case 6: return smallDenseInvert<6>(a, aInv);
+  case 7: return smallDenseInvert<7>(a, aInv);
+  case 8: return smallDenseInvert<8>(a, aInv);
+  case 9: return smallDenseInvert<9>(a, aInv);
+  case 10: return smallDenseInvert<10>(a, aInv);
+  case 11: return smallDenseInvert<11>(a, aInv);
+  case 12: return smallDenseInvert<12>(a, aInv);
+  default: return -1;
+  }
+}
+
+#endif
@@ -122,6 +122,15 @@ Vector::Vector(Vector &&other)
 : sz(other.sz),theData(other.theData),fromFree(0)
 {
   //opserr << "move ctor!\n";
+
+  // data not owned by other (e.g. a VectorN) can not be taken, copy it
+  if (other.fromFree == 1) {
+    theData = (sz != 0) ? new (nothrow) double[sz] : 0;
+    for (int i=0; i<sz; i++)
+      theData[i] = other.theData[i];
+    return;
+  }
+
   other.theData = 0;
   other.sz = 0;
 } 
@@ -731,8 +740,9 @@ Vector::operator=(const Vector &V)
 	  opserr << "Vector::operator=() - vectors of differing sizes\n";
 #endif
 
-	  // Check that we are not deleting an empty Vector
-	  if (this->theData != 0) delete [] this->theData;
+	  // Check that we are not deleting an empty Vector, or data we do not own
+	  if (this->theData != 0 && fromFree == 0) delete [] this->theData;
+	  fromFree = 0;
 
 	  this->sz = V.sz;
 	  
@@ -757,6 +767,10 @@ Vector::operator=(Vector &&V)
   // first check we are not trying v = v
   if (this != &V) {
     // opserr << "move assign!\n";
+    // if either side does not own its data fall back to a copy
+    if (fromFree == 1 || V.fromFree == 1)
+      return *this = static_cast<const Vector &>(V);
+
     if (this->theData != 0) delete [] this->theData;
     theData = V.theData;
     this->sz = V.sz;
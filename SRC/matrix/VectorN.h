@@ -0,0 +1,200 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the class template definition for
+// VectorN. VectorN<N> is a Vector of fixed size N whose data lives inside
+// the object, i.e. on the stack for local variables, so no heap memory is
+// allocated or freed when it is created or destroyed. As it is a Vector
+// it can be passed wherever a Vector& or const Vector& is expected. The
+// methods redefined here have the size as a compile time constant so that
+// the loops are unrolled by the compiler.
+//
+// A VectorN must not be resized, and must not be assigned a Vector of a
+// different size.
+
+#ifndef VectorN_h
+#define VectorN_h
+
+#include <Vector.h>
+#include <math.h>
+
+template <int R, int C> class MatrixN;
+
+template <int N>
+class VectorN : public Vector
+{
+  public:
+    // constructors
+    VectorN();
+    VectorN(const VectorN<N> &other);
+    VectorN(const Vector &other);
+
+    // utility methods
+    inline void Zero(void);
+    inline double Norm(void) const;
+    inline double dot(const VectorN<N> &other) const;
+    inline int addVector(double factThis, const VectorN<N> &other, double factOther);
+    template <int C>
+    int addMatrixVector(double factThis, const MatrixN<N,C> &m, const VectorN<C> &v, double factOther);
+
+    inline double *getData(void) {return theStore;}
+    inline const double *getData(void) const {return theStore;}
+
+    // overloaded operators
+    inline double operator()(int x) const {return theStore[x];}
+    inline double &operator()(int x) {return theStore[x];}
+
+    inline VectorN<N> &operator=(const VectorN<N> &other);
+    VectorN<N> &operator=(const Vector &other);
+    inline VectorN<N> &operator+=(const VectorN<N> &other);
+    inline VectorN<N> &operator-=(const VectorN<N> &other);
+    inline VectorN<N> &operator*=(double fact);
+
+    using Vector::addVector;
+    using Vector::operator();
+    using Vector::operator+=;
+    using Vector::operator-=;
+
+  private:
+    double theStore[N];
+};
+
+
+/********* VECTORN FUNCTIONS ***********/
+template <int N>
+VectorN<N>::VectorN()
+:Vector(theStore, N)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] = 0.0;
+}
+
+
+template <int N>
+VectorN<N>::VectorN(const VectorN<N> &other)
+:Vector(theStore, N)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] = other.theStore[i];
+}
+
+
+template <int N>
+VectorN<N>::VectorN(const Vector &other)
+:Vector(theStore, N)
+{
+  *this = other;
+}
+
+
+template <int N>
+inline void
+VectorN<N>::Zero(void)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] = 0.0;
+}
+
+
+template <int N>
+inline double
+VectorN<N>::Norm(void) const
+{
+  return sqrt(this->dot(*this));
+}
+
+
+template <int N>
+inline double
+VectorN<N>::dot(const VectorN<N> &other) const
+{
+  double result = 0.0;
+  for (int i=0; i<N; i++)
+    result += theStore[i]*other.theStore[i];
+  return result;
+}
+
+
+template <int N>
+inline int
+VectorN<N>::addVector(double factThis, const VectorN<N> &other, double factOther)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] = factThis*theStore[i] + factOther*other.theStore[i];
+  return 0;
+}
+
+
+template <int N>
+inline VectorN<N> &
+VectorN<N>::operator=(const VectorN<N> &other)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] = other.theStore[i];
+  return *this;
+}
+
+
+template <int N>
+VectorN<N> &
+VectorN<N>::operator=(const Vector &other)
+{
+  if (other.Size() != N) {
+    opserr << "VectorN::operator=() - vector of size " << other.Size()
+	   << " assigned to VectorN<" << N << ">\n";
+    return *this;
+  }
+
+  for (int i=0; i<N; i++)
+    theStore[i] = other(i);
+  return *this;
+}
+
+
+template <int N>
+inline VectorN<N> &
+VectorN<N>::operator+=(const VectorN<N> &other)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] += other.theStore[i];
+  return *this;
+}
+
+
+template <int N>
+inline VectorN<N> &
+VectorN<N>::operator-=(const VectorN<N> &other)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] -= other.theStore[i];
+  return *this;
+}
+
+
+template <int N>
+inline VectorN<N> &
+VectorN<N>::operator*=(double fact)
+{
+  for (int i=0; i<N; i++)
+    theStore[i] *= fact;
+  return *this;
+}
+
+#endif
@@ -0,0 +1,426 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: implementation of the bulk node and element commands.
+
+#include <BulkModelCommands.h>
+#include <elementAPI.h>
+#include <OPS_Globals.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <CrdTransf.h>
+#include <BeamIntegration.h>
+#include <SectionForceDeformation.h>
+#include <ForceBeamColumn2d.h>
+#include <ForceBeamColumn3d.h>
+#include <DispBeamColumn2d.h>
+#include <DispBeamColumn3d.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <algorithm>
+
+int
+OPS_ReadTableFile(const char *fileName, int numCols, bool binary,
+		  std::vector<double> &data)
+{
+  data.clear();
+  if (numCols < 1)
+    return -1;
+
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0) {
+    opserr << "WARNING could not open table file " << fileName << endln;
+    return -1;
+  }
+
+  fseek(theFile, 0, SEEK_END);
+  long size = ftell(theFile);
+  fseek(theFile, 0, SEEK_SET);
+
+  if (binary) {
+    long numValues = size / (long)sizeof(double);
+    if (numValues % numCols != 0) {
+      opserr << "WARNING table file " << fileName << " does not hold a whole number of rows of ";
+      opserr << numCols << " values\n";
+      fclose(theFile);
+      return -1;
+    }
+    data.resize(numValues);
+    if (numValues > 0 && fread(&data[0], sizeof(double), numValues, theFile) != (size_t)numValues) {
+      opserr << "WARNING failed to read table file " << fileName << endln;
+      fclose(theFile);
+      data.clear();
+      return -1;
+    }
+    fclose(theFile);
+    return (int)(numValues / numCols);
+  }
+
+  // text: read the whole file once and convert in place
+  std::vector<char> buffer(size + 1);
+  if (size > 0 && fread(&buffer[0], 1, size, theFile) != (size_t)size) {
+    opserr << "WARNING failed to read table file " << fileName << endln;
+    fclose(theFile);
+    return -1;
+  }
+  buffer[size] = '\0';
+  fclose(theFile);
+
+  data.reserve(size / 8);
+  char *p = &buffer[0];
+  char *end = p + size;
+  while (p < end) {
+    char c = *p;
+    if (c == '#') {
+      while (p < end && *p != '\n') p++;
+    } else if (c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\n' || c == '\r') {
+      p++;
+    } else {
+      char *next = 0;
+      double value = strtod(p, &next);
+      if (next == p) {
+	opserr << "WARNING invalid value in table file " << fileName << endln;
+	data.clear();
+	return -1;
+      }
+      data.push_back(value);
+      p = next;
+    }
+  }
+
+  if (data.size() % numCols != 0) {
+    opserr << "WARNING table file " << fileName << " does not hold a whole number of rows of ";
+    opserr << numCols << " values\n";
+    data.clear();
+    return -1;
+  }
+
+  return (int)(data.size() / numCols);
+}
+
+static int
+getTableArgs(const char *flag, const char *&fileName, bool &binary)
+{
+  if (OPS_GetNumRemainingInputArgs() < 2) {
+    opserr << "WARNING insufficient arguments, want: " << flag << " fileName? <-binary>\n";
+    return -1;
+  }
+
+  const char *type = OPS_GetString();
+  if (strcmp(type, flag) != 0) {
+    opserr << "WARNING expected " << flag << " but got " << type << endln;
+    return -1;
+  }
+  fileName = OPS_GetString();
+
+  binary = false;
+  if (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *opt = OPS_GetString();
+    if (strcmp(opt, "-binary") == 0)
+      binary = true;
+    else
+      OPS_ResetCurrentInputArg(-1);
+  }
+
+  return 0;
+}
+
+// true if a table value is a valid tag: a whole number in 0..INT_MAX
+static bool
+isTableTag(double value)
+{
+  return value >= 0.0 && value <= (double)INT_MAX && value == (double)(int)value;
+}
+
+// checks the tags in column 0 of the table are valid and unique within
+// the table; returns the first offending row or -1 if all are fine
+static int
+checkTableTags(const std::vector<double> &table, int numRows, int numCols,
+	       const char *cmd)
+{
+  std::vector<std::pair<int,int> > tags(numRows);
+  for (int i = 0; i < numRows; i++) {
+    double value = table[i*numCols];
+    if (!isTableTag(value)) {
+      opserr << "WARNING " << cmd << " - invalid tag " << value << " in row " << i+1 << endln;
+      return i;
+    }
+    tags[i] = std::make_pair((int)value, i);
+  }
+
+  std::sort(tags.begin(), tags.end());
+  for (int i = 1; i < numRows; i++)
+    if (tags[i].first == tags[i-1].first) {
+      opserr << "WARNING " << cmd << " - tag " << tags[i].first << " appears in rows ";
+      opserr << tags[i-1].second+1 << " and " << tags[i].second+1 << endln;
+      return tags[i].second;
+    }
+
+  return -1;
+}
+
+int
+OPS_Nodes()
+{
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return -1;
+
+  int ndm = OPS_GetNDM();
+  int ndf = OPS_GetNDF();
+  if (ndm < 1 || ndm > 3 || ndf < 1) {
+    opserr << "WARNING nodes - model ndm and ndf are not set\n";
+    return -1;
+  }
+
+  const char *fileName = 0;
+  bool binary = false;
+  if (getTableArgs("-file", fileName, binary) < 0)
+    return -1;
+
+  bool withMass = false;
+  int numData = 1;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *opt = OPS_GetString();
+    if (strcmp(opt, "-mass") == 0) {
+      withMass = true;
+    } else if (strcmp(opt, "-ndf") == 0) {
+      if (OPS_GetIntInput(&numData, &ndf) < 0 || ndf < 1) {
+	opserr << "WARNING nodes - invalid -ndf\n";
+	return -1;
+      }
+    } else if (strcmp(opt, "-binary") == 0) {
+      binary = true;
+    } else {
+      opserr << "WARNING nodes - unknown option " << opt << endln;
+      return -1;
+    }
+  }
+
+  int numCols = 1 + ndm + (withMass ? ndf : 0);
+  std::vector<double> table;
+  int numRows = OPS_ReadTableFile(fileName, numCols, binary, table);
+  if (numRows < 0)
+    return -1;
+
+  // check the tags before creating anything so the domain is left as is
+  // if the table is bad
+  if (checkTableTags(table, numRows, numCols, "nodes") >= 0)
+    return -1;
+  for (int i = 0; i < numRows; i++) {
+    int tag = (int)table[i*numCols];
+    if (theDomain->getNode(tag) != 0) {
+      opserr << "WARNING nodes - node " << tag << " already exists in the domain\n";
+      return -1;
+    }
+  }
+
+  theDomain->reserveNodesAndElements(theDomain->getNumNodes() + numRows, 0);
+
+  // the node constructors share the class-wide mass matrices, so the
+  // nodes are created and added one at a time
+  for (int i = 0; i < numRows; i++) {
+    const double *row = &table[i*numCols];
+    int tag = (int)row[0];
+    Node *theNode = 0;
+    if (ndm == 1)
+      theNode = new Node(tag, ndf, row[1]);
+    else if (ndm == 2)
+      theNode = new Node(tag, ndf, row[1], row[2]);
+    else
+      theNode = new Node(tag, ndf, row[1], row[2], row[3]);
+
+    if (withMass) {
+      Matrix mass(ndf, ndf);
+      for (int j = 0; j < ndf; j++)
+	mass(j,j) = row[1+ndm+j];
+      theNode->setMass(mass);
+    }
+
+    if (theDomain->addNode(theNode) == false) {
+      opserr << "WARNING nodes - failed to add node " << tag << " to the domain\n";
+      delete theNode;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+static Element *
+createBeam(int ndm, bool isForce, const double *row,
+	   int numSec, SectionForceDeformation **sec, BeamIntegration &bi,
+	   CrdTransf &theTransf, double mass, int maxIter, double tol)
+{
+  int tag = (int)row[0];
+  int nd1 = (int)row[1];
+  int nd2 = (int)row[2];
+
+  if (ndm == 2) {
+    if (isForce)
+      return new ForceBeamColumn2d(tag, nd1, nd2, numSec, sec, bi, theTransf, mass, maxIter, tol);
+    return new DispBeamColumn2d(tag, nd1, nd2, numSec, sec, bi, theTransf, mass);
+  }
+
+  if (isForce)
+    return new ForceBeamColumn3d(tag, nd1, nd2, numSec, sec, bi, theTransf, mass, maxIter, tol);
+  return new DispBeamColumn3d(tag, nd1, nd2, numSec, sec, bi, theTransf, mass);
+}
+
+int
+OPS_Elements()
+{
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return -1;
+
+  int ndm = OPS_GetNDM();
+  int ndf = OPS_GetNDF();
+
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING elements - no element type given\n";
+    return -1;
+  }
+  const char *type = OPS_GetString();
+
+  bool isForce = false;
+  if (strcmp(type, "forceBeamColumn") == 0)
+    isForce = true;
+  else if (strcmp(type, "dispBeamColumn") != 0) {
+    opserr << "WARNING elements - type " << type << " is not supported, ";
+    opserr << "use forceBeamColumn or dispBeamColumn\n";
+    return -1;
+  }
+
+  if (!((ndm == 2 && ndf == 3) || (ndm == 3 && ndf == 6))) {
+    opserr << "WARNING elements - " << type << " needs ndm 2 and ndf 3 or ndm 3 and ndf 6\n";
+    return -1;
+  }
+
+  const char *fileName = 0;
+  bool binary = false;
+  if (getTableArgs("-table", fileName, binary) < 0)
+    return -1;
+
+  // arguments shared by all the elements in the table
+  int iData[2];
+  int numData = 2;
+  if (OPS_GetNumRemainingInputArgs() < 2 || OPS_GetIntInput(&numData, iData) < 0) {
+    opserr << "WARNING elements - want: transfTag? integrationTag?\n";
+    return -1;
+  }
+
+  double mass = 0.0, tol = 1.0e-12;
+  int maxIter = 10;
+  numData = 1;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *opt = OPS_GetString();
+    if (strcmp(opt, "-iter") == 0) {
+      if (OPS_GetIntInput(&numData, &maxIter) < 0 || OPS_GetDoubleInput(&numData, &tol) < 0) {
+	opserr << "WARNING elements - invalid -iter\n";
+	return -1;
+      }
+    } else if (strcmp(opt, "-mass") == 0) {
+      if (OPS_GetDoubleInput(&numData, &mass) < 0) {
+	opserr << "WARNING elements - invalid -mass\n";
+	return -1;
+      }
+    } else {
+      opserr << "WARNING elements - unknown option " << opt << endln;
+      return -1;
+    }
+  }
+
+  CrdTransf *theTransf = OPS_getCrdTransf(iData[0]);
+  if (theTransf == 0) {
+    opserr << "WARNING elements - coord transformation " << iData[0] << " not found\n";
+    return -1;
+  }
+
+  BeamIntegrationRule *theRule = OPS_getBeamIntegrationRule(iData[1]);
+  if (theRule == 0 || theRule->getBeamIntegration() == 0) {
+    opserr << "WARNING elements - beam integration " << iData[1] << " not found\n";
+    return -1;
+  }
+  BeamIntegration &bi = *theRule->getBeamIntegration();
+
+  const ID &secTags = theRule->getSectionTags();
+  int numSec = secTags.Size();
+  std::vector<SectionForceDeformation *> sections(numSec);
+  for (int i = 0; i < numSec; i++) {
+    sections[i] = OPS_getSectionForceDeformation(secTags(i));
+    if (sections[i] == 0) {
+      opserr << "WARNING elements - section " << secTags(i) << " not found\n";
+      return -1;
+    }
+  }
+
+  std::vector<double> table;
+  int numRows = OPS_ReadTableFile(fileName, 3, binary, table);
+  if (numRows < 0)
+    return -1;
+  if (numRows == 0)
+    return 0;
+
+  // check the tags and end nodes before creating anything so the domain
+  // is left as is if the table is bad
+  if (checkTableTags(table, numRows, 3, "elements") >= 0)
+    return -1;
+  for (int i = 0; i < numRows; i++) {
+    const double *row = &table[3*i];
+    if (theDomain->getElement((int)row[0]) != 0) {
+      opserr << "WARNING elements - element " << (int)row[0] << " already exists in the domain\n";
+      return -1;
+    }
+    for (int j = 1; j < 3; j++)
+      if (!isTableTag(row[j]) || theDomain->getNode((int)row[j]) == 0) {
+	opserr << "WARNING elements - element " << (int)row[0] << " - node " << row[j];
+	opserr << " does not exist in the domain\n";
+	return -1;
+      }
+    if (row[1] == row[2]) {
+      opserr << "WARNING elements - element " << (int)row[0] << " has the same node at both ends\n";
+      return -1;
+    }
+  }
+
+  theDomain->reserveNodesAndElements(0, theDomain->getNumElements() + numRows);
+
+  // the element constructors copy the sections and the transformation,
+  // which use class-wide work arrays, so the elements are created and
+  // added one at a time
+  SectionForceDeformation **secPtrs = &sections[0];
+  for (int i = 0; i < numRows; i++) {
+    Element *theEle = createBeam(ndm, isForce, &table[3*i], numSec, secPtrs,
+				 bi, *theTransf, mass, maxIter, tol);
+    if (theEle == 0 || theDomain->addElement(theEle) == false) {
+      opserr << "WARNING elements - failed to add element " << (int)table[3*i] << " to the domain\n";
+      if (theEle != 0)
+	delete theEle;
+      return -1;
+    }
+  }
+
+  return 0;
+}
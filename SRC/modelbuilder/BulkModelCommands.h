@@ -0,0 +1,50 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef BulkModelCommands_h
+#define BulkModelCommands_h
+
+// Description: commands to create nodes and elements in bulk from a
+// table file in a single call, bypassing the per-component command
+// parsing of the interpreter:
+//
+//   nodes -file $fileName <-binary> <-mass> <-ndf $ndf>
+//      each row: tag x <y> <z> <ndf mass terms if -mass>
+//
+//   elements $type -table $fileName <-binary> $transfTag $integrationTag
+//            <-mass $massDens> <-iter $maxIters $tol>
+//      each row: eleTag iNode jNode
+//      $type is forceBeamColumn or dispBeamColumn
+//
+// Text tables are whitespace or comma separated, lines starting with #
+// are skipped. Binary tables are a flat array of native doubles, row by
+// row, with the number of rows given by the file size.
+
+#include <vector>
+
+int OPS_Nodes();
+int OPS_Elements();
+
+// reads a table with numCols columns into data, returns number of rows
+// or -1 on error
+int OPS_ReadTableFile(const char *fileName, int numCols, bool binary,
+		      std::vector<double> &data);
+
+#endif
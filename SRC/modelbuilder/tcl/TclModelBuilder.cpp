@@ -167,6 +167,14 @@ int
 TclCommand_addElement(ClientData clientData, Tcl_Interp *interp,  int argc, 
 		      TCL_Char **argv);
 
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int argc, 
+		    TCL_Char **argv);
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int argc, 
+		       TCL_Char **argv);
+
 int
 TclCommand_PFEM2D(ClientData clientData, Tcl_Interp *interp,  int argc, 
                   TCL_Char **argv);
@@ -185,6 +193,9 @@ TclCommand_remesh(ClientData clientData, Tcl_Interp *interp,  int argc,
 int 
 TclCommand_backgroundMesh(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+TclCommand_contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 TclCommand_addUniaxialMaterial(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -476,6 +487,12 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "element", TclCommand_addElement,
 		    (ClientData)NULL, NULL);
 
+  Tcl_CreateCommand(interp, "nodes", TclCommand_addNodes,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateCommand(interp, "elements", TclCommand_addElements,
+		    (ClientData)NULL, NULL);
+
   Tcl_CreateCommand(interp, "PFEM2D", TclCommand_PFEM2D,
 		    (ClientData)NULL, NULL);
 
@@ -490,6 +507,9 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "background", &TclCommand_backgroundMesh, 
 		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
 
+  Tcl_CreateCommand(interp, "contactSearch", &TclCommand_contactSearch, 
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
 
   Tcl_CreateCommand(interp, "uniaxialMaterial", TclCommand_addUniaxialMaterial,
 		    (ClientData)NULL, NULL);
@@ -1511,6 +1531,57 @@ TclCommand_backgroundMesh(ClientData clientData, Tcl_Interp *interp, int argc, T
     return TCL_OK;
 }
 
+extern int OPS_ContactSearch();
+
+#include <BulkModelCommands.h>
+
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int argc, 
+		    TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  OPS_ResetInput(clientData, interp, 1, argc, argv, theTclDomain, theTclBuilder);
+
+  if (OPS_Nodes() < 0) return TCL_ERROR;
+  return TCL_OK;
+}
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int argc, 
+		       TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  OPS_ResetInput(clientData, interp, 1, argc, argv, theTclDomain, theTclBuilder);
+
+  if (OPS_Elements() < 0) return TCL_ERROR;
+  return TCL_OK;
+}
+
+int 
+TclCommand_contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+    // ensure the destructor has not been called - 
+    if (theTclBuilder == 0) {
+	opserr << "WARNING builder has been destroyed" << endln;
+	return TCL_ERROR;
+    }
+    
+    OPS_ResetInput(clientData, interp, 1, argc, argv, theTclDomain, theTclBuilder);
+
+    if(OPS_ContactSearch() < 0) return TCL_ERROR;
+    return TCL_OK;
+}
+
 extern void* OPS_LobattoBeamIntegration(int& integrationTag, ID& secTags);
 extern void* OPS_LegendreBeamIntegration(int& integrationTag, ID& secTags);
 extern void* OPS_NewtonCotesBeamIntegration(int& integrationTag, ID& secTags);
@@ -229,7 +229,7 @@ DamageRecorder::record(int commitTag, double timeStamp)
     }
   }
 
-  theOutput->write(*data);
+  this->writeData(*theOutput, *data);
 
   // succesfull completion - return 0
   return result;
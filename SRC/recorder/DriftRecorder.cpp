@@ -163,7 +163,7 @@ DriftRecorder::record(int commitTag, double timeStamp)
 	(*data)(i+timeOffset) = 0.0;
     }
     
-    theOutputHandler->write(*data);
+    this->writeData(*theOutputHandler, *data);
   }
 
   return 0;
@@ -175,6 +175,19 @@ DriftRecorder::restart(void)
   return 0;
 }
 
+int 
+DriftRecorder::getRecordedNodes(ID &theNodeTags)
+{
+  if (ndI == 0 || ndJ == 0)
+    return -1;
+
+  for (int i=0; i<ndI->Size(); i++)
+    theNodeTags.insert((*ndI)(i));
+  for (int i=0; i<ndJ->Size(); i++)
+    theNodeTags.insert((*ndJ)(i));
+  return 0;
+}
+
 int 
 DriftRecorder::setDomain(Domain &theDom)
 {
@@ -59,6 +59,7 @@ class DriftRecorder: public Recorder
   int record(int commitTag, double timeStamp);
   int restart(void);    
 
+  int getRecordedNodes(ID &theNodeTags);
   int setDomain(Domain &theDomain);
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
@@ -437,7 +437,7 @@ ElementRecorder::record(int commitTag, double timeStamp)
     //
     // send the response vector to the output handler for o/p
     //
-    theOutputHandler->write(*data);
+    this->writeData(*theOutputHandler, *data);
   }
   
   // succesfull completion - return 0
@@ -283,7 +283,7 @@ EnvelopeElementRecorder::EnvelopeElementRecorder()
 :Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), theDomain(0),
  theHandler(0), deltaT(0), nextTimeStampToRecord(0.0), 
- data(0), currentData(0), first(true),
+ data(0), currentData(0), first(true), reducePending(false), reduceTime(0.0),
  initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(false), addColumnInfo(0)
 {
 
@@ -301,7 +301,7 @@ EnvelopeElementRecorder::EnvelopeElementRecorder(const ID *ele,
  :Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
   numEle(0), eleID(0), numDOF(0), dof(0), theResponses(0), theDomain(&theDom),
   theHandler(&theOutputHandler), deltaT(dT), nextTimeStampToRecord(0.0), 
-  data(0), currentData(0), first(true),
+  data(0), currentData(0), first(true), reducePending(false), reduceTime(0.0),
   initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(echoTime), addColumnInfo(0)
 {
 
@@ -396,8 +396,30 @@ EnvelopeElementRecorder::~EnvelopeElementRecorder()
 }
 
 
-int 
+int
 EnvelopeElementRecorder::record(int commitTag, double timeStamp)
+{
+  int result = this->gatherData(timeStamp);
+  if (this->reduceData() < 0)
+    result = -1;
+
+  return result;
+}
+
+int
+EnvelopeElementRecorder::stage(int commitTag, double timeStamp)
+{
+  return this->gatherData(timeStamp);
+}
+
+int
+EnvelopeElementRecorder::flush(void)
+{
+  return this->reduceData();
+}
+
+int
+EnvelopeElementRecorder::gatherData(double timeStamp)
 {
   // 
   // check that initialization has been done
@@ -447,79 +469,94 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
       }
     }
 
-    int sizeData = currentData->Size();
-    if (echoTimeFlag == false) {
+    reducePending = true;
+    reduceTime = timeStamp;
+  }
+
+  // succesfull completion - return 0
+  return result;
+}
 
-      bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  (*data)(0,i) = (*currentData)(i);
-	  (*data)(1,i) = (*currentData)(i);
-	  (*data)(2,i) = fabs((*currentData)(i));
-	  first = false;
+int
+EnvelopeElementRecorder::reduceData(void)
+{
+  // update the envelope with the data of the last gather
+  if (reducePending == false)
+    return 0;
+  reducePending = false;
+
+  int sizeData = currentData->Size();
+  if (echoTimeFlag == false) {
+
+    bool writeIt = false;
+    if (first == true) {
+      for (int i=0; i<sizeData; i++) {
+	(*data)(0,i) = (*currentData)(i);
+	(*data)(1,i) = (*currentData)(i);
+	(*data)(2,i) = fabs((*currentData)(i));
+	first = false;
+	writeIt = true;
+      } 
+    } else {
+      for (int i=0; i<sizeData; i++) {
+	double value = (*currentData)(i);
+	if ((*data)(0,i) > value) {
+	  (*data)(0,i) = value;
+	  double absValue = fabs(value);
+	  if ((*data)(2,i) < absValue) 
+	    (*data)(2,i) = absValue;
+	  writeIt = true;
+	} else if ((*data)(1,i) < value) {
+	  (*data)(1,i) = value;
+	  double absValue = fabs(value);
+	  if ((*data)(2,i) < absValue) 
+	    (*data)(2,i) = absValue;
 	  writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,i) > value) {
-	    (*data)(0,i) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i) < absValue) 
-	      (*data)(2,i) = absValue;
-	    writeIt = true;
-	  } else if ((*data)(1,i) < value) {
-	    (*data)(1,i) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i) < absValue) 
-	      (*data)(2,i) = absValue;
-	    writeIt = true;
-	  }
 	}
       }
+    }
+  } else {
+    sizeData /= 2;
+    bool writeIt = false;
+    if (first == true) {
+      for (int i=0; i<sizeData; i++) {
+	
+	(*data)(0,i*2) = reduceTime;
+	(*data)(1,i*2) = reduceTime;
+	(*data)(2,i*2) = reduceTime;
+	(*data)(0,i*2+1) = (*currentData)(i);
+	(*data)(1,i*2+1) = (*currentData)(i);
+	(*data)(2,i*2+1) = fabs((*currentData)(i));
+	first = false;
+	writeIt = true;
+      } 
     } else {
-      sizeData /= 2;
-      bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  
-	  (*data)(0,i*2) = timeStamp;
-	  (*data)(1,i*2) = timeStamp;
-	  (*data)(2,i*2) = timeStamp;
-	  (*data)(0,i*2+1) = (*currentData)(i);
-	  (*data)(1,i*2+1) = (*currentData)(i);
-	  (*data)(2,i*2+1) = fabs((*currentData)(i));
-	  first = false;
+      for (int i=0; i<sizeData; i++) {
+	double value = (*currentData)(i);
+	if ((*data)(0,2*i+1) > value) {
+	  (*data)(0,i*2) = reduceTime;
+	  (*data)(0,i*2+1) = value;
+	  double absValue = fabs(value);
+	  if ((*data)(2,i*2+1) < absValue) {
+	    (*data)(2,i*2+1) = absValue;
+	    (*data)(2,i*2) = reduceTime;
+	  }
 	  writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,2*i+1) > value) {
-	    (*data)(0,i*2) = timeStamp;
-	    (*data)(0,i*2+1) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i*2+1) < absValue) {
-	      (*data)(2,i*2+1) = absValue;
-	      (*data)(2,i*2) = timeStamp;
-	    }
-	    writeIt = true;
-	  } else if ((*data)(1,i*2+1) < value) {
-	    (*data)(1,i*2) = timeStamp;
-	    (*data)(1,i*2+1) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i*2+1) < absValue) { 
-	      (*data)(2,i*2) = timeStamp;
-	      (*data)(2,i*2+1) = absValue;
-	    }
-	    writeIt = true;
+	} else if ((*data)(1,i*2+1) < value) {
+	  (*data)(1,i*2) = reduceTime;
+	  (*data)(1,i*2+1) = value;
+	  double absValue = fabs(value);
+	  if ((*data)(2,i*2+1) < absValue) { 
+	    (*data)(2,i*2) = reduceTime;
+	    (*data)(2,i*2+1) = absValue;
 	  }
+	  writeIt = true;
 	}
       }
     }
-  }    
-  // succesfull completion - return 0
-  return result;
+  }
+
+  return 0;
 }
 
 int
@@ -527,6 +564,7 @@ EnvelopeElementRecorder::restart(void)
 {
   data->Zero();
   first = true;
+  reducePending = false;
   return 0;
 }
 
@@ -59,6 +59,8 @@ class EnvelopeElementRecorder: public Recorder
     ~EnvelopeElementRecorder();
 
     int record(int commitTag, double timeStamp);
+    int stage(int commitTag, double timeStamp);
+    int flush(void);
     int restart(void);    
 
     int setDomain(Domain &theDomain);
@@ -70,6 +72,8 @@ class EnvelopeElementRecorder: public Recorder
     
   private:	
     int initialize(void);
+    int gatherData(double timeStamp);
+    int reduceData(void);
 
     int numEle;
     int numDOF;
@@ -89,6 +93,10 @@ class EnvelopeElementRecorder: public Recorder
     Vector *currentData;
     bool first;
 
+    // currentData of the last gather, waiting to update the envelope
+    bool reducePending;
+    double reduceTime;
+
     bool initializationDone;
     char **responseArgs;
     int numArgs;
@@ -299,7 +299,7 @@ EnvelopeNodeRecorder::EnvelopeNodeRecorder()
  currentData(0), data(0), 
  theDomain(0), theHandler(0),
  deltaT(0.0), nextTimeStampToRecord(0.0), 
- first(true), initializationDone(false), 
+ first(true), reducePending(false), reduceTime(0.0), initializationDone(false), 
  numValidNodes(0), addColumnInfo(0), theTimeSeries(0), timeSeriesValues(0)
 {
 
@@ -318,7 +318,7 @@ EnvelopeNodeRecorder::EnvelopeNodeRecorder(const ID &dofs,
  currentData(0), data(0), 
  theDomain(&theDom), theHandler(&theOutputHandler),
  deltaT(dT), nextTimeStampToRecord(0.0), 
- first(true), initializationDone(false), numValidNodes(0), echoTimeFlag(echoTime), 
+ first(true), reducePending(false), reduceTime(0.0), initializationDone(false), numValidNodes(0), echoTimeFlag(echoTime), 
  addColumnInfo(0), theTimeSeries(theSeries), timeSeriesValues(0)
 {
   // verify dof are valid 
@@ -477,8 +477,30 @@ EnvelopeNodeRecorder::~EnvelopeNodeRecorder()
   }
 }
 
-int 
+int
 EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
+{
+  int result = this->gatherData(timeStamp);
+  if (this->reduceData() < 0)
+    result = -1;
+
+  return result;
+}
+
+int
+EnvelopeNodeRecorder::stage(int commitTag, double timeStamp)
+{
+  return this->gatherData(timeStamp);
+}
+
+int
+EnvelopeNodeRecorder::flush(void)
+{
+  return this->reduceData();
+}
+
+int
+EnvelopeNodeRecorder::gatherData(double timeStamp)
 {
   if (theDomain == 0 || theDofs == 0) {
     return 0;
@@ -685,6 +707,20 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
     }
   }
 
+  reducePending = true;
+  reduceTime = timeStamp;
+
+  return 0;
+}
+
+int
+EnvelopeNodeRecorder::reduceData(void)
+{
+  // update the envelope with the data of the last gather
+  if (reducePending == false)
+    return 0;
+  reducePending = false;
+
   // check if currentData modifies the saved data
   int sizeData = currentData->Size();
   if (echoTimeFlag == false) {
@@ -722,9 +758,9 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
     if (first == true) {
       for (int i=0; i<sizeData; i++) {
 
-	(*data)(0,i*2) = timeStamp;
-	(*data)(1,i*2) = timeStamp;
-	(*data)(2,i*2) = timeStamp;
+	(*data)(0,i*2) = reduceTime;
+	(*data)(1,i*2) = reduceTime;
+	(*data)(2,i*2) = reduceTime;
 	(*data)(0,i*2+1) = (*currentData)(i);
 	(*data)(1,i*2+1) = (*currentData)(i);
 	(*data)(2,i*2+1) = fabs((*currentData)(i));
@@ -735,20 +771,20 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
       for (int i=0; i<sizeData; i++) {
 	double value = (*currentData)(i);
 	if ((*data)(0,2*i+1) > value) {
-	  (*data)(0,i*2) = timeStamp;
+	  (*data)(0,i*2) = reduceTime;
 	  (*data)(0,i*2+1) = value;
 	  double absValue = fabs(value);
 	  if ((*data)(2,i*2+1) < absValue) {
 	    (*data)(2,i*2+1) = absValue;
-	    (*data)(2,i*2) = timeStamp;
+	    (*data)(2,i*2) = reduceTime;
 	  }
 	  writeIt = true;
 	} else if ((*data)(1,i*2+1) < value) {
-	  (*data)(1,i*2) = timeStamp;
+	  (*data)(1,i*2) = reduceTime;
 	  (*data)(1,i*2+1) = value;
 	  double absValue = fabs(value);
 	  if ((*data)(2,i*2+1) < absValue) { 
-	    (*data)(2,i*2) = timeStamp;
+	    (*data)(2,i*2) = reduceTime;
 	    (*data)(2,i*2+1) = absValue;
 	  }
 	  writeIt = true;
@@ -766,10 +802,22 @@ EnvelopeNodeRecorder::restart(void)
 {
   data->Zero();
   first = true;
+  reducePending = false;
   return 0;
 }
 
 
+int 
+EnvelopeNodeRecorder::getRecordedNodes(ID &theNodeTags)
+{
+  // only the nodal kinematics are recovered for part of the domain
+  if (theNodalTags == 0 || (dataFlag > 4 && dataFlag != 10000))
+    return -1;
+
+  theNodeTags = *theNodalTags;
+  return 0;
+}
+
 int 
 EnvelopeNodeRecorder::setDomain(Domain &theDom)
 {
@@ -64,8 +64,11 @@ class EnvelopeNodeRecorder: public Recorder
     ~EnvelopeNodeRecorder();
 
     int record(int commitTag, double timeStamp);
+    int stage(int commitTag, double timeStamp);
+    int flush(void);
     int restart(void);    
 
+    int getRecordedNodes(ID &theNodeTags);
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -75,6 +78,8 @@ class EnvelopeNodeRecorder: public Recorder
     
   private:	
     int initialize(void);
+    int gatherData(double timeStamp);
+    int reduceData(void);
 
     ID *theDofs;
     ID *theNodalTags;
@@ -92,6 +97,10 @@ class EnvelopeNodeRecorder: public Recorder
     double nextTimeStampToRecord;
 
     bool first;
+
+    // currentData of the last gather, waiting to update the envelope
+    bool reducePending;
+    double reduceTime;
     bool initializationDone;
     int numValidNodes;
 
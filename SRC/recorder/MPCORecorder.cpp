@@ -33,6 +33,16 @@ NDMaterial in setResponse gives unknownStress for stress components if type == P
 todo: add auto-component naming in case of duplicated components!
 in STKO components are assumed all different!
 
+note 6:
+options for the per-step result datasets (see mpco::WriteOptions):
+-layout step|append   one dataset DATA/STEP_<id> per step (default, read by STKO) or the extendible
+                      datasets DATA/VALUES (steps x rows x columns), DATA/STEPS and DATA/TIMES
+-chunk $rows <$steps> rows (and steps, append layout) of a chunk. 0 rows = chunks of about 1 MB
+-compress $level      deflate level (0-9), -shuffle adds the shuffle filter before deflate
+-sync                 write in record() instead of the writer thread
+-queue $mb            max memory (MB) of the buffers waiting for the writer thread (default 256)
+with MPCO_USE_WRITER_THREAD the link needs the thread library (-pthread) on some platforms.
+
 **************************************************************************************/
 
 // some definitions
@@ -66,6 +76,14 @@ while opensees is writing data. Warning: this is a new feature in hdf5 version 1
 */
 //#define MPCO_USE_SWMR
 
+/*
+writes the per-step result datasets from a writer thread, so that record()
+only buffers the responses and never waits for the file system. There is a single
+writer thread in the process, shared by all the MPCO recorders.
+If commented, the same writes are done synchronously in record().
+*/
+#define MPCO_USE_WRITER_THREAD
+
 // opensees
 #include "MPCORecorder.h"
 #include "Channel.h"
@@ -114,6 +132,17 @@ while opensees is writing data. Warning: this is a new feature in hdf5 version 1
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <deque>
+#include <string>
+#ifdef MPCO_USE_WRITER_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#ifndef _WIN32
+#include <pthread.h>
+#endif // _WIN32
+#endif // MPCO_USE_WRITER_THREAD
 
 /*************************************************************************************
 
@@ -160,6 +189,7 @@ typedef unsigned long long 	hsize_t;
 typedef int H5T_str_t; // enum (int) in hdf5
 typedef unsigned int H5F_libver_t; // enum (uint) in hdf5
 typedef unsigned int H5F_scope_t; // enum (uint) in hdf5
+typedef int H5S_seloper_t; // enum (int) in hdf5
 
 /*
 HDF5 version info
@@ -359,6 +389,7 @@ private:
 		MPCO_LIBLOADER_LOAD_SYM(H5open);
 		MPCO_LIBLOADER_LOAD_SYM(H5Screate_simple);
 		MPCO_LIBLOADER_LOAD_SYM(H5Sclose);
+		MPCO_LIBLOADER_LOAD_SYM(H5Sselect_hyperslab);
 		MPCO_LIBLOADER_LOAD_SYM(H5Acreate2);
 		MPCO_LIBLOADER_LOAD_SYM(H5Awrite);
 		MPCO_LIBLOADER_LOAD_SYM(H5Aclose);
@@ -370,10 +401,15 @@ private:
 		MPCO_LIBLOADER_LOAD_SYM(H5Dcreate2);
 		MPCO_LIBLOADER_LOAD_SYM(H5Dclose);
 		MPCO_LIBLOADER_LOAD_SYM(H5Dwrite);
+		MPCO_LIBLOADER_LOAD_SYM(H5Dset_extent);
+		MPCO_LIBLOADER_LOAD_SYM(H5Dget_space);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pcreate);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pclose);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pset_link_creation_order);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pset_libver_bounds);
+		MPCO_LIBLOADER_LOAD_SYM(H5Pset_chunk);
+		MPCO_LIBLOADER_LOAD_SYM(H5Pset_deflate);
+		MPCO_LIBLOADER_LOAD_SYM(H5Pset_shuffle);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fcreate);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fflush);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fclose);
@@ -390,6 +426,7 @@ private:
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_FILE_CREATE_ID_g);
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_FILE_ACCESS_ID_g);
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_GROUP_CREATE_ID_g);
+		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_DATASET_CREATE_ID_g);
 	}
 	~LibraryLoader() {
 		if (loaded) {
@@ -417,6 +454,7 @@ public:
 	herr_t (*ptr_H5open)(void);
 	hid_t  (*ptr_H5Screate_simple)(int rank, const hsize_t dims[], const hsize_t maxdims[]);
 	herr_t (*ptr_H5Sclose)(hid_t space_id);
+	herr_t (*ptr_H5Sselect_hyperslab)(hid_t space_id, H5S_seloper_t op, const hsize_t start[], const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
 	hid_t  (*ptr_H5Acreate2)(hid_t loc_id, const char *attr_name, hid_t type_id, hid_t space_id, hid_t acpl_id, hid_t aapl_id);
 	herr_t (*ptr_H5Awrite)(hid_t attr_id, hid_t type_id, const void *buf);
 	herr_t (*ptr_H5Aclose)(hid_t attr_id);
@@ -428,10 +466,15 @@ public:
 	hid_t  (*ptr_H5Dcreate2)(hid_t loc_id, const char *name, hid_t type_id, hid_t space_id, hid_t lcpl_id, hid_t dcpl_id, hid_t dapl_id);
 	herr_t (*ptr_H5Dclose)(hid_t dset_id);
 	herr_t (*ptr_H5Dwrite)(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t plist_id, const void *buf);
+	herr_t (*ptr_H5Dset_extent)(hid_t dset_id, const hsize_t size[]);
+	hid_t  (*ptr_H5Dget_space)(hid_t dset_id);
 	hid_t  (*ptr_H5Pcreate)(hid_t cls_id);
 	herr_t (*ptr_H5Pclose)(hid_t plist_id);
 	herr_t (*ptr_H5Pset_link_creation_order)(hid_t plist_id, unsigned crt_order_flags);
 	herr_t (*ptr_H5Pset_libver_bounds)(hid_t plist_id, H5F_libver_t low, H5F_libver_t high);
+	herr_t (*ptr_H5Pset_chunk)(hid_t plist_id, int ndims, const hsize_t dim[]);
+	herr_t (*ptr_H5Pset_deflate)(hid_t plist_id, unsigned aggression);
+	herr_t (*ptr_H5Pset_shuffle)(hid_t plist_id);
 	hid_t  (*ptr_H5Fcreate)(const char *filename, unsigned flags, hid_t create_plist, hid_t access_plist);
 	herr_t (*ptr_H5Fflush)(hid_t object_id, H5F_scope_t scope);
 	herr_t (*ptr_H5Fclose)(hid_t file_id);
@@ -448,6 +491,7 @@ public:
 	hid_t *ptr_H5P_CLS_FILE_CREATE_ID_g;
 	hid_t *ptr_H5P_CLS_FILE_ACCESS_ID_g;
 	hid_t *ptr_H5P_CLS_GROUP_CREATE_ID_g;
+	hid_t *ptr_H5P_CLS_DATASET_CREATE_ID_g;
 };
 
 /*
@@ -463,6 +507,7 @@ macros for loaded HDF5 functions
 
 #define H5Screate_simple (*LibraryLoader::instance().ptr_H5Screate_simple)
 #define H5Sclose (*LibraryLoader::instance().ptr_H5Sclose)
+#define H5Sselect_hyperslab (*LibraryLoader::instance().ptr_H5Sselect_hyperslab)
 
 #define H5Acreate2 (*LibraryLoader::instance().ptr_H5Acreate2)
 #define H5Acreate H5Acreate2
@@ -480,12 +525,17 @@ macros for loaded HDF5 functions
 #define H5Dcreate2 (*LibraryLoader::instance().ptr_H5Dcreate2)
 #define H5Dclose (*LibraryLoader::instance().ptr_H5Dclose)
 #define H5Dwrite (*LibraryLoader::instance().ptr_H5Dwrite)
+#define H5Dset_extent (*LibraryLoader::instance().ptr_H5Dset_extent)
+#define H5Dget_space (*LibraryLoader::instance().ptr_H5Dget_space)
 #define H5Dcreate H5Dcreate2
 
 #define H5Pcreate (*LibraryLoader::instance().ptr_H5Pcreate)
 #define H5Pclose (*LibraryLoader::instance().ptr_H5Pclose)
 #define H5Pset_link_creation_order (*LibraryLoader::instance().ptr_H5Pset_link_creation_order)
 #define H5Pset_libver_bounds (*LibraryLoader::instance().ptr_H5Pset_libver_bounds)
+#define H5Pset_chunk (*LibraryLoader::instance().ptr_H5Pset_chunk)
+#define H5Pset_deflate (*LibraryLoader::instance().ptr_H5Pset_deflate)
+#define H5Pset_shuffle (*LibraryLoader::instance().ptr_H5Pset_shuffle)
 
 #define H5Fcreate (*LibraryLoader::instance().ptr_H5Fcreate)
 #define H5Fflush (*LibraryLoader::instance().ptr_H5Fflush)
@@ -514,6 +564,8 @@ macros for loaded HDF5 global variables
 #define H5P_FILE_ACCESS (H5OPEN H5P_CLS_FILE_ACCESS_ID_g)
 #define H5P_CLS_GROUP_CREATE_ID_g (*LibraryLoader::instance().ptr_H5P_CLS_GROUP_CREATE_ID_g)
 #define H5P_GROUP_CREATE (H5OPEN H5P_CLS_GROUP_CREATE_ID_g)
+#define H5P_CLS_DATASET_CREATE_ID_g (*LibraryLoader::instance().ptr_H5P_CLS_DATASET_CREATE_ID_g)
+#define H5P_DATASET_CREATE (H5OPEN H5P_CLS_DATASET_CREATE_ID_g)
 
 /*
 some other useful things defined in HDF5 headers
@@ -523,6 +575,11 @@ some other useful things defined in HDF5 headers
 
 #define H5S_ALL (hid_t)0
 
+#define H5S_UNLIMITED ((hsize_t)(long long)(-1))
+
+// this is an enum in hdf5: H5S_seloper_t
+#define H5S_SELECT_SET 0
+
 #define H5P_DEFAULT (hid_t)0 
 
 #define H5P_CRT_ORDER_TRACKED           0x0001
@@ -1034,7 +1091,7 @@ namespace h5 {
 			status = H5Sclose(space);
 			return dset;
 		}
-		hid_t createAndWrited2(hid_t obj, const char *name, const double *data, hsize_t rows, hsize_t cols)
+		hid_t createAndWrited2(hid_t obj, const char *name, const double *data, hsize_t rows, hsize_t cols, hid_t dcpl_id = H5P_DEFAULT)
 		{
 			// error flags
 			herr_t status;
@@ -1042,7 +1099,7 @@ namespace h5 {
 			hsize_t dim[2] = { rows, cols };
 			hid_t space = H5Screate_simple(2, dim, NULL);
 			// create the dataset and write data to it.
-			hid_t dset = H5Dcreate(obj, name, H5T_IEEE_F64LE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+			hid_t dset = H5Dcreate(obj, name, H5T_IEEE_F64LE, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
 			status = H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
 			// close and release resources
 			status = H5Sclose(space);
@@ -1093,6 +1150,42 @@ namespace h5 {
 			status = H5Sclose(space);
 			return dset;
 		}
+		hid_t createExtendible(hid_t obj, const char *name, hid_t type_id, int rank, const hsize_t *dim, hid_t dcpl_id)
+		{
+			// the first dimension is unlimited, the other ones are fixed. dcpl_id must be chunked
+			hsize_t maxdim[3] = { H5S_UNLIMITED, 0, 0 };
+			for (int i = 1; i < rank; i++)
+				maxdim[i] = dim[i];
+			hid_t space = H5Screate_simple(rank, dim, maxdim);
+			hid_t dset = H5Dcreate(obj, name, type_id, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+			H5Sclose(space);
+			return dset;
+		}
+		herr_t append(hid_t dset, hid_t mem_type_id, hsize_t current_size, const void *data, int rank, const hsize_t *dim)
+		{
+			// error flags
+			herr_t status;
+			// grow the first (unlimited) dimension by one slab
+			hsize_t new_dim[3] = { current_size + 1, 0, 0 };
+			hsize_t start[3] = { current_size, 0, 0 };
+			hsize_t count[3] = { 1, 0, 0 };
+			for (int i = 1; i < rank; i++) {
+				new_dim[i] = dim[i];
+				count[i] = dim[i];
+			}
+			status = H5Dset_extent(dset, new_dim);
+			if (status < 0) return status;
+			// select the new slab in the file and write it
+			hid_t file_space = H5Dget_space(dset);
+			status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+			hid_t mem_space = H5Screate_simple(rank, count, NULL);
+			if (status >= 0)
+				status = H5Dwrite(dset, mem_type_id, mem_space, file_space, H5P_DEFAULT, data);
+			// close and release resources
+			H5Sclose(mem_space);
+			H5Sclose(file_space);
+			return status;
+		}
 
 		// higher level c++ utils
 
@@ -1107,10 +1200,10 @@ namespace h5 {
 			}
 			return HID_INVALID;
 		}
-		hid_t createAndWrite(hid_t obj, const char *name, const std::vector<double> &data, size_t rows, size_t cols)
+		hid_t createAndWrite(hid_t obj, const char *name, const std::vector<double> &data, size_t rows, size_t cols, hid_t dcpl_id = H5P_DEFAULT)
 		{
 			if (data.size() > 0 && data.size() == rows*cols) {
-				return createAndWrited2(obj, name, &data[0], rows, cols);
+				return createAndWrited2(obj, name, &data[0], rows, cols, dcpl_id);
 			}
 			return HID_INVALID;
 		}
@@ -1188,7 +1281,8 @@ namespace h5 {
 		enum CreateOptions {
 			FileCreate,
 			FileAccess,
-			GroupCreate
+			GroupCreate,
+			DatasetCreate
 		};
 
 		// low level functions for c interface
@@ -1205,6 +1299,8 @@ namespace h5 {
 				return H5Pcreate(H5P_FILE_ACCESS);
 			case GroupCreate:
 				return H5Pcreate(H5P_GROUP_CREATE);
+			case DatasetCreate:
+				return H5Pcreate(H5P_DATASET_CREATE);
 			default:
 				return HID_INVALID;
 			}
@@ -1215,6 +1311,15 @@ namespace h5 {
 		herr_t setLibVerBounds(hid_t plist_id, unsigned int minor, unsigned int major) {
 			return H5Pset_libver_bounds(plist_id, (H5F_libver_t)minor, (H5F_libver_t)major);
 		}
+		herr_t setChunk(hid_t plist_id, int rank, const hsize_t *dim) {
+			return H5Pset_chunk(plist_id, rank, dim);
+		}
+		herr_t setDeflate(hid_t plist_id, unsigned int level) {
+			return H5Pset_deflate(plist_id, level);
+		}
+		herr_t setShuffle(hid_t plist_id) {
+			return H5Pset_shuffle(plist_id);
+		}
 	}
 
 }
@@ -1397,6 +1502,390 @@ namespace mpco {
 		clock_t m_t1;
 	};
 
+	/*
+	user options for the datasets of the per-step results.
+	PerStep: one dataset DATA/STEP_<id> (rows x columns) for each recorded step. This is the
+	layout read by STKO.
+	Append: all the steps of a result go in the extendible datasets DATA/VALUES (steps x rows x columns),
+	DATA/STEPS and DATA/TIMES, so the time history of a node or element is a single hyperslab read.
+	Chunking and compression are used in both layouts when requested (the Append layout is always chunked)
+	*/
+	struct WriteOptions {
+		enum Layout {
+			PerStep,
+			Append
+		};
+
+		Layout layout;
+		int chunk_rows; // 0 = automatic, chunks of about 1 MB
+		int chunk_steps; // Append layout only
+		int deflate; // 0 = no compression, 1 to 9 = deflate level
+		bool shuffle;
+		bool async; // write from the writer thread
+		int max_queued_mb; // max memory of the buffers waiting for the writer thread
+
+		WriteOptions() : layout(PerStep), chunk_rows(0), chunk_steps(16), deflate(0), shuffle(false), async(true), max_queued_mb(256) {}
+		bool isChunked() const {
+			return layout == Append || chunk_rows > 0 || deflate > 0 || shuffle;
+		}
+	};
+
+	/*
+	writes the per-step result datasets.
+	record() buffers the responses of a result and hands the buffer to writeStep(). With the
+	writer thread the buffer is queued and the HDF5 calls are made by the writer thread, otherwise
+	they are made immediately.
+	The HDF5 library is not thread-safe process-wide, so all the recorders share one writer
+	thread and one queue, and every other HDF5 call made by a recorder must be preceded by a
+	call to sync(), which waits until the queue of all the recorders is empty.
+	The writer is fork safe: before a fork the queue is emptied, and in the child, which has no
+	writer thread, the writes are made immediately.
+	*/
+	class DataWriter
+	{
+	private:
+		struct Job {
+			enum Type {
+				WriteStep,
+				Flush
+			};
+			Type type;
+			std::string path;
+			int step;
+			double time;
+			std::vector<double> data;
+			size_t rows;
+			size_t cols;
+			Job() : type(WriteStep), path(), step(0), time(0.0), data(), rows(0), cols(0) {}
+			void swap(Job &other) {
+				std::swap(type, other.type);
+				path.swap(other.path);
+				std::swap(step, other.step);
+				std::swap(time, other.time);
+				data.swap(other.data);
+				std::swap(rows, other.rows);
+				std::swap(cols, other.cols);
+			}
+		};
+
+		struct AppendedResult {
+			hid_t h_values;
+			hid_t h_steps;
+			hid_t h_times;
+			hsize_t num_steps;
+			size_t rows;
+			size_t cols;
+		};
+
+#ifdef MPCO_USE_WRITER_THREAD
+		/*
+		the queue and the writer thread shared by all the DataWriters of the process.
+		it is never destroyed, so that a writer still running at exit is not destroyed while joinable
+		*/
+		struct SharedQueue {
+			std::deque<std::pair<DataWriter*, Job> > jobs;
+			size_t queued_bytes;
+			bool busy;
+			bool stop;
+			bool forked; // in a forked child, with no writer thread
+			int num_users;
+			std::mutex mutex;
+			std::condition_variable cv_work;
+			std::condition_variable cv_done;
+			std::thread thread;
+			SharedQueue() : jobs(), queued_bytes(0), busy(false), stop(false), forked(false), num_users(0) {}
+		};
+		static SharedQueue &sharedQueue() {
+			static SharedQueue *queue = new SharedQueue();
+			return *queue;
+		}
+#endif // MPCO_USE_WRITER_THREAD
+
+	public:
+		DataWriter()
+			: m_file_id(HID_INVALID)
+			, m_options()
+			, m_async(false)
+			, m_failed(false)
+			, m_appended()
+		{}
+		~DataWriter() {
+			stop();
+		}
+
+	private:
+		DataWriter(const DataWriter &other);
+		DataWriter &operator = (const DataWriter &other);
+
+	public:
+		void start(hid_t file_id, const WriteOptions &options) {
+			m_file_id = file_id;
+			m_options = options;
+#ifdef MPCO_USE_WRITER_THREAD
+			m_async = options.async;
+			if (m_async) {
+				SharedQueue &queue = sharedQueue();
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				queue.num_users++;
+				if (!queue.forked && !queue.thread.joinable()) {
+					queue.stop = false;
+					queue.thread = std::thread(&DataWriter::run);
+#ifndef _WIN32
+					static bool handlers_set = false;
+					if (!handlers_set) {
+						pthread_atfork(&DataWriter::prepareFork, &DataWriter::parentFork, &DataWriter::childFork);
+						handlers_set = true;
+					}
+#endif // _WIN32
+				}
+			}
+#endif // MPCO_USE_WRITER_THREAD
+		}
+		void writeStep(const std::string &path, int step, double time, std::vector<double> &buffer, size_t rows, size_t cols) {
+			Job job;
+			job.type = Job::WriteStep;
+			job.path = path;
+			job.step = step;
+			job.time = time;
+			job.data.swap(buffer);
+			job.rows = rows;
+			job.cols = cols;
+			submit(job);
+		}
+		void flush() {
+			Job job;
+			job.type = Job::Flush;
+			submit(job);
+		}
+		int sync() {
+#ifdef MPCO_USE_WRITER_THREAD
+			// waits for the writes of all the recorders, not only these
+			waitIdle();
+#endif // MPCO_USE_WRITER_THREAD
+			return takeStatus();
+		}
+		int takeStatus() {
+			// returns -1 if a write failed since the last call
+#ifdef MPCO_USE_WRITER_THREAD
+			std::lock_guard<std::mutex> lock(sharedQueue().mutex);
+#endif // MPCO_USE_WRITER_THREAD
+			int retval = m_failed ? -1 : 0;
+			m_failed = false;
+			return retval;
+		}
+		int closeResults() {
+			int retval = sync();
+			for (std::map<std::string, AppendedResult>::iterator it = m_appended.begin(); it != m_appended.end(); ++it) {
+				h5::dataset::close(it->second.h_values);
+				h5::dataset::close(it->second.h_steps);
+				h5::dataset::close(it->second.h_times);
+			}
+			m_appended.clear();
+			return retval;
+		}
+		void stop() {
+#ifdef MPCO_USE_WRITER_THREAD
+			if (m_async) {
+				// write the pending steps, the last user stops the writer thread
+				int status = sync();
+				if (status < 0)
+					m_failed = true;
+				SharedQueue &queue = sharedQueue();
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				queue.num_users--;
+				if (queue.num_users == 0 && queue.thread.joinable()) {
+					queue.stop = true;
+					lock.unlock();
+					queue.cv_work.notify_one();
+					queue.thread.join();
+				}
+			}
+			m_async = false;
+#endif // MPCO_USE_WRITER_THREAD
+		}
+
+	private:
+		void submit(Job &job) {
+#ifdef MPCO_USE_WRITER_THREAD
+			if (m_async && !sharedQueue().forked) {
+				// wait for the writer thread if too much memory is already queued
+				SharedQueue &queue = sharedQueue();
+				size_t max_bytes = static_cast<size_t>(m_options.max_queued_mb) << 20;
+				size_t bytes = job.data.size() * sizeof(double);
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				queue.cv_done.wait(lock, [&] { return queue.queued_bytes == 0 || queue.queued_bytes + bytes <= max_bytes; });
+				queue.jobs.push_back(std::make_pair(this, Job()));
+				queue.jobs.back().second.swap(job);
+				queue.queued_bytes += bytes;
+				lock.unlock();
+				queue.cv_work.notify_one();
+				return;
+			}
+			// written here, after the queued writes of the other recorders
+			waitIdle();
+#endif // MPCO_USE_WRITER_THREAD
+			if (execute(job) < 0)
+				m_failed = true;
+		}
+#ifdef MPCO_USE_WRITER_THREAD
+		static void waitIdle() {
+			SharedQueue &queue = sharedQueue();
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			queue.cv_done.wait(lock, [&queue] { return queue.jobs.empty() && !queue.busy; });
+		}
+		static void run() {
+			SharedQueue &queue = sharedQueue();
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			while (true) {
+				queue.cv_work.wait(lock, [&queue] { return queue.stop || !queue.jobs.empty(); });
+				if (queue.jobs.empty())
+					break;
+				DataWriter *owner = queue.jobs.front().first;
+				Job job;
+				job.swap(queue.jobs.front().second);
+				queue.jobs.pop_front();
+				queue.busy = true;
+				lock.unlock();
+				herr_t status = owner->execute(job);
+				lock.lock();
+				queue.busy = false;
+				queue.queued_bytes -= job.data.size() * sizeof(double);
+				if (status < 0)
+					owner->m_failed = true;
+				queue.cv_done.notify_all();
+			}
+		}
+		/*
+		fork handlers: the queue is emptied and stays locked while the process is copied.
+		the child has no writer thread, so its writes are made immediately
+		*/
+		static void prepareFork() {
+			SharedQueue &queue = sharedQueue();
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			queue.cv_done.wait(lock, [&queue] { return queue.jobs.empty() && !queue.busy; });
+			lock.release();
+		}
+		static void parentFork() {
+			sharedQueue().mutex.unlock();
+		}
+		static void childFork() {
+			SharedQueue &queue = sharedQueue();
+			queue.forked = true;
+			if (queue.thread.joinable())
+				new std::thread(std::move(queue.thread)); // not joinable here, released
+			queue.mutex.unlock();
+		}
+#endif // MPCO_USE_WRITER_THREAD
+		herr_t execute(Job &job) {
+			if (job.type == Job::Flush)
+				return h5::file::flush(m_file_id);
+			if (job.rows == 0 || job.cols == 0 || job.data.size() != job.rows * job.cols)
+				return 0;
+			if (m_options.layout == WriteOptions::Append)
+				return appendStep(job);
+			return writeStepDataset(job);
+		}
+		hid_t createDatasetProplist(int rank, size_t rows, size_t cols) const {
+			/*
+			rank 2 = one step (PerStep layout), rank 3 = steps x rows x columns, rank 1 = steps.
+			automatic chunk rows keep a chunk within the 1 MB default chunk cache of HDF5
+			*/
+			if (!m_options.isChunked())
+				return H5P_DEFAULT;
+			hsize_t steps = rank == 2 ? 1 : static_cast<hsize_t>(std::max(1, m_options.chunk_steps));
+			hsize_t chunk_rows = m_options.chunk_rows > 0 ?
+				static_cast<hsize_t>(m_options.chunk_rows) :
+				std::max<hsize_t>(1, (1 << 20) / (sizeof(double) * cols * steps));
+			chunk_rows = std::min<hsize_t>(chunk_rows, rows);
+			hsize_t chunk[3];
+			if (rank == 1) {
+				chunk[0] = steps;
+			}
+			else if (rank == 2) {
+				chunk[0] = chunk_rows;
+				chunk[1] = cols;
+			}
+			else {
+				chunk[0] = steps;
+				chunk[1] = chunk_rows;
+				chunk[2] = cols;
+			}
+			hid_t dcpl = h5::plist::crate(h5::plist::DatasetCreate);
+			h5::plist::setChunk(dcpl, rank, chunk);
+			if (m_options.shuffle)
+				h5::plist::setShuffle(dcpl);
+			if (m_options.deflate > 0)
+				h5::plist::setDeflate(dcpl, static_cast<unsigned int>(m_options.deflate));
+			return dcpl;
+		}
+		herr_t writeStepDataset(Job &job) {
+			herr_t status = 0;
+			std::stringstream ss_dset_name;
+			ss_dset_name << job.path << "/DATA/STEP_" << job.step;
+			std::string dset_name = ss_dset_name.str();
+			hid_t dcpl = createDatasetProplist(2, job.rows, job.cols);
+			hid_t h_dset_data = h5::dataset::createAndWrite(m_file_id, dset_name.c_str(), job.data, job.rows, job.cols, dcpl);
+			if (dcpl != H5P_DEFAULT)
+				h5::plist::close(dcpl);
+			if (h_dset_data < 0)
+				return -1;
+			status = h5::attribute::write(h_dset_data, "STEP", job.step);
+			status = h5::attribute::write(h_dset_data, "TIME", job.time);
+			status = h5::dataset::close(h_dset_data);
+			return status;
+		}
+		herr_t appendStep(Job &job) {
+			herr_t status = 0;
+			std::map<std::string, AppendedResult>::iterator it = m_appended.find(job.path);
+			if (it == m_appended.end()) {
+				/*
+				first step of this result in this model stage: create the extendible datasets
+				*/
+				std::string prefix = job.path + "/DATA/";
+				AppendedResult res;
+				res.num_steps = 0;
+				res.rows = job.rows;
+				res.cols = job.cols;
+				hsize_t dim_values[3] = { 0, job.rows, job.cols };
+				hid_t dcpl = createDatasetProplist(3, job.rows, job.cols);
+				res.h_values = h5::dataset::createExtendible(m_file_id, (prefix + "VALUES").c_str(), H5T_IEEE_F64LE, 3, dim_values, dcpl);
+				h5::plist::close(dcpl);
+				hsize_t dim_steps[1] = { 0 };
+				dcpl = createDatasetProplist(1, 1, 1);
+				res.h_steps = h5::dataset::createExtendible(m_file_id, (prefix + "STEPS").c_str(), H5T_STD_I32LE, 1, dim_steps, dcpl);
+				res.h_times = h5::dataset::createExtendible(m_file_id, (prefix + "TIMES").c_str(), H5T_IEEE_F64LE, 1, dim_steps, dcpl);
+				h5::plist::close(dcpl);
+				if (res.h_values < 0 || res.h_steps < 0 || res.h_times < 0) {
+					if (res.h_values >= 0) h5::dataset::close(res.h_values);
+					if (res.h_steps >= 0) h5::dataset::close(res.h_steps);
+					if (res.h_times >= 0) h5::dataset::close(res.h_times);
+					return -1;
+				}
+				it = m_appended.insert(std::make_pair(job.path, res)).first;
+			}
+			AppendedResult &res = it->second;
+			if (job.rows != res.rows || job.cols != res.cols)
+				return -1;
+			hsize_t dim_values[3] = { 1, job.rows, job.cols };
+			hsize_t dim_steps[1] = { 1 };
+			status = h5::dataset::append(res.h_values, H5T_NATIVE_DOUBLE, res.num_steps, &job.data[0], 3, dim_values);
+			if (status < 0) return status;
+			status = h5::dataset::append(res.h_steps, H5T_NATIVE_INT, res.num_steps, &job.step, 1, dim_steps);
+			if (status < 0) return status;
+			status = h5::dataset::append(res.h_times, H5T_NATIVE_DOUBLE, res.num_steps, &job.time, 1, dim_steps);
+			if (status < 0) return status;
+			res.num_steps++;
+			return status;
+		}
+
+	private:
+		hid_t m_file_id;
+		WriteOptions m_options;
+		bool m_async;
+		bool m_failed;
+		std::map<std::string, AppendedResult> m_appended; // only used by the thread calling execute()
+	};
+
 	/*
 	holds current informations
 	*/
@@ -1415,6 +1904,7 @@ namespace mpco {
 			, h_file_acc_proplist(HID_INVALID)
 #endif // MPCO_USE_SWMR
 			, h_group_proplist(HID_INVALID)
+			, writer(0)
 			// time step info
 			, current_time_step_id(0)
 			, current_time_step(0.0)
@@ -1436,6 +1926,8 @@ namespace mpco {
 		hid_t h_file_acc_proplist;
 #endif // MPCO_USE_SWMR
 		hid_t h_group_proplist;
+		// writer of the per-step datasets
+		DataWriter *writer;
 		// time step info
 		int current_time_step_id;
 		double current_time_step;
@@ -1489,6 +1981,7 @@ namespace mpco {
 					/*
 					create result group
 					*/
+					info.writer->sync();
 					hid_t h_gp_result = h5::group::createResultGroup(info.h_file_id, info.h_group_proplist,
 						m_result_name, m_result_display_name,
 						m_components_name, m_num_components, m_dimension, m_description,
@@ -1513,17 +2006,12 @@ namespace mpco {
 					m_initialized = true;
 				}
 				/*
-				create the dataset for this timestep
+				buffer the data of this timestep and send it to the writer
 				*/
 				std::vector<double> buffer_data(nodes.size() * m_num_components);
 				bufferResponse(info, nodes, buffer_data);
-				std::stringstream ss_dset_name;
-				ss_dset_name << m_result_name << "/DATA/STEP_" << info.current_time_step_id;
-				std::string dset_name = ss_dset_name.str();
-				hid_t h_dset_data = h5::dataset::createAndWrite(info.h_file_id, dset_name.c_str(), buffer_data, nodes.size(), m_num_components);
-				status = h5::attribute::write(h_dset_data, "STEP", info.current_time_step_id);
-				status = h5::attribute::write(h_dset_data, "TIME", info.current_time_step);
-				status = h5::dataset::close(h_dset_data);
+				info.writer->writeStep(m_result_name, info.current_time_step_id, info.current_time_step,
+					buffer_data, nodes.size(), m_num_components);
 				/*
 				return
 				*/
@@ -1979,6 +2467,7 @@ namespace mpco {
 					/*
 					create result group
 					*/
+					info.writer->sync();
 					hid_t h_gp_result = h5::group::createResultGroup(info.h_file_id, info.h_group_proplist,
 						m_result_name, m_result_display_name,
 						m_components_name, m_num_components, m_dimension, m_description,
@@ -2003,8 +2492,10 @@ namespace mpco {
 					m_initialized = true;
 				}
 				/*
-				create the timestep group
+				create the timestep group.
+				modes are written directly, wait for the writer
 				*/
+				info.writer->sync();
 				std::stringstream ss_gp_step_name;
 				ss_gp_step_name << m_result_name << "/DATA/STEP_" << info.current_time_step_id;
 				std::string gp_step_name = ss_gp_step_name.str();
@@ -3984,6 +4475,8 @@ public:
 		, first_domain_changed_done(false)
 		, info()
 		, output_freq()
+		, write_options()
+		, writer()
 		, has_region(false)
 		, node_set()
 		, elem_set()
@@ -3998,7 +4491,9 @@ public:
 		, elem_ngauss_nfiber_info()
 		, send_self_count(0)
 		, p_id(0)
-	{}
+	{
+		info.writer = &writer;
+	}
 public:
 	// misc
 	std::string filename;
@@ -4014,6 +4509,10 @@ public:
 	// output frequency
 	mpco::OutputFrequency output_freq;
 
+	// layout of the per-step datasets and their writer
+	mpco::WriteOptions write_options;
+	mpco::DataWriter writer;
+
 	// nodes and elements
 	bool has_region;
 	std::vector<int> node_set;
@@ -4064,6 +4563,13 @@ MPCORecorder::~MPCORecorder()
 		*/
 		herr_t status;
 		/*
+		write the pending steps and stop the writer
+		*/
+		m_data->writer.stop();
+		if (m_data->writer.closeResults() < 0) {
+			opserr << "MPCORecorder Error: cannot write results on destructor\n";
+		}
+		/*
 		close file
 		*/
 		status = h5::file::close(m_data->info.h_file_id);
@@ -4179,11 +4685,12 @@ int MPCORecorder::record(int commitTag, double timeStamp)
 		return retval;
 	}
 	/*
-	flush file
+	flush file (after the pending writes)
 	*/ 
-	status = h5::file::flush(m_data->info.h_file_id);
+	m_data->writer.flush();
+	status = m_data->writer.takeStatus();
 	if (status < 0) {
-		opserr << "MPCORecorder Error: cannot flush file on record()\n";
+		opserr << "MPCORecorder Error: cannot write or flush file on record()\n";
 		retval = -1;
 		return retval;
 	}
@@ -4282,6 +4789,22 @@ int MPCORecorder::sendSelf(int commitTag, Channel &theChannel)
 		}
 	}
 
+	// send write options
+	{
+		ID aux(7);
+		aux(0) = static_cast<int>(m_data->write_options.layout);
+		aux(1) = m_data->write_options.chunk_rows;
+		aux(2) = m_data->write_options.chunk_steps;
+		aux(3) = m_data->write_options.deflate;
+		aux(4) = static_cast<int>(m_data->write_options.shuffle);
+		aux(5) = static_cast<int>(m_data->write_options.async);
+		aux(6) = m_data->write_options.max_queued_mb;
+		if (theChannel.sendID(0, commitTag, aux) < 0) {
+			opserr << "MPCORecorder::sendSelf() - failed to send write options\n";
+			return -1;
+		}
+	}
+
 	// send node result requests
 	if (m_data->nodal_results_requests.size() > 0) {
 		ID aux(static_cast<int>(m_data->nodal_results_requests.size()));
@@ -4401,6 +4924,22 @@ int MPCORecorder::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 		m_data->output_freq.nsteps = static_cast<int>(aux(2));
 	}
 
+	// recv write options
+	{
+		ID aux(7);
+		if (theChannel.recvID(0, commitTag, aux) < 0) {
+			opserr << "MPCORecorder::sendSelf() - failed to recv write options\n";
+			return -1;
+		}
+		m_data->write_options.layout = static_cast<mpco::WriteOptions::Layout>(aux(0));
+		m_data->write_options.chunk_rows = aux(1);
+		m_data->write_options.chunk_steps = aux(2);
+		m_data->write_options.deflate = aux(3);
+		m_data->write_options.shuffle = aux(4) != 0;
+		m_data->write_options.async = aux(5) != 0;
+		m_data->write_options.max_queued_mb = aux(6);
+	}
+
 	// recv node result requests
 	if (aux_node_res_size > 0) {
 		ID aux(static_cast<int>(aux_node_res_size));
@@ -4560,6 +5099,10 @@ int MPCORecorder::initialize()
 		}
 	}
 	/*
+	the writes of the other recorders must be done before this one calls HDF5
+	*/
+	m_data->writer.sync();
+	/*
 	create property lists (enable link creation order tracking)
 	*/
 	m_data->info.h_file_proplist = h5::plist::crate(h5::plist::FileCreate);
@@ -4598,6 +5141,7 @@ int MPCORecorder::initialize()
 		opserr << "MPCORecorder Error: cannot create or open file: \"" << the_filename.c_str() << "\"";
 		exit(-1);
 	}
+	m_data->writer.start(m_data->info.h_file_id, m_data->write_options);
 	/*
 	create info group and metadata
 	*/
@@ -4620,6 +5164,12 @@ int MPCORecorder::writeModel()
 	int retval = 0;
 	herr_t status;
 	/*
+	the datasets of the previous stage are complete
+	*/
+	if (m_data->writer.closeResults() < 0) {
+		opserr << "MPCORecorder Error: cannot write results of the previous model stage\n";
+	}
+	/*
 	create model and results groups
 	*/
 	std::stringstream ss_current_model_stage_name;
@@ -6120,6 +6670,7 @@ int MPCORecorder::recordResultsOnElements()
 			/*
 			\todo all attributes are temporary, we need a user-defined metadata for elemental results...
 			*/
+			m_data->writer.sync();
 			hid_t h_gp_result = h5::group::createResultGroup(m_data->info.h_file_id, m_data->info.h_group_proplist,
 				result_name, result_display_name, "", 0, "", "",
 				(int)mpco::ResultType::Generic, (int)mpco::ResultDataType::Scalar);
@@ -6165,6 +6716,7 @@ int MPCORecorder::recordResultsOnElements()
 							/*
 							create the header group
 							*/
+							m_data->writer.sync();
 							hid_t h_gp_header = h5::group::create(m_data->info.h_file_id, header_dir_name.c_str(), H5P_DEFAULT, m_data->info.h_group_proplist, H5P_DEFAULT);
 							status = h5::attribute::write(h_gp_header, "NUM_COLUMNS", header.num_columns);
 							/*
@@ -6214,11 +6766,8 @@ int MPCORecorder::recordResultsOnElements()
 							eo_by_header.initialized = true;
 						}
 						/*
-						create the dataset for this timestep
+						buffer the data of this timestep and send it to the writer
 						*/
-						std::stringstream ss_dset_name;
-						ss_dset_name << header_dir_name << "/DATA/STEP_" << m_data->info.current_time_step_id;
-						std::string dset_name = ss_dset_name.str();
 						std::vector<double> buffer_data(num_rows * header.num_columns);
 						for (size_t i = 0; i < num_rows; i++) {
 							mpco::element::OutputResponse &current_response = eo_by_header.items[i];
@@ -6232,10 +6781,8 @@ int MPCORecorder::recordResultsOnElements()
 							for (size_t j = 0; j < header.num_columns; j++)
 								buffer_data[offset + j] = current_data[(int)j];
 						}
-						hid_t h_dset_data = h5::dataset::createAndWrite(m_data->info.h_file_id, dset_name.c_str(), buffer_data, num_rows, header.num_columns);
-						status = h5::attribute::write(h_dset_data, "STEP", m_data->info.current_time_step_id);
-						status = h5::attribute::write(h_dset_data, "TIME", m_data->info.current_time_step);
-						status = h5::dataset::close(h_dset_data);
+						m_data->writer.writeStep(header_dir_name, m_data->info.current_time_step_id, m_data->info.current_time_step,
+							buffer_data, num_rows, header.num_columns);
 					}
 				}
 			}
@@ -6305,6 +6852,7 @@ void* OPS_MPCORecorder()
 	std::vector<std::vector<std::string> > elemental_results_requests;
 	std::vector<std::string> tokens;
 	mpco::OutputFrequency output_freq;
+	mpco::WriteOptions write_options;
 	bool has_region = false;
 	std::set<int> node_set;
 	std::set<int> elem_set;
@@ -6354,6 +6902,71 @@ void* OPS_MPCORecorder()
 			}
 			has_region = true;
 		}
+		else if (strcmp(data, "-layout") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			if (numdata < 1) {
+				opserr << "MPCORecorder error: option -layout requires an extra argument (step or append)\n";
+				return 0;
+			}
+			const char *layout = OPS_GetString();
+			numdata--;
+			if (strcmp(layout, "step") == 0) {
+				write_options.layout = mpco::WriteOptions::PerStep;
+			}
+			else if (strcmp(layout, "append") == 0) {
+				write_options.layout = mpco::WriteOptions::Append;
+			}
+			else {
+				opserr << "MPCORecorder error: option -layout with unknown layout (" << layout << "), expected step or append\n";
+				return 0;
+			}
+		}
+		else if (strcmp(data, "-chunk") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			if (numdata < 1 || OPS_GetInt(&one_item, &write_options.chunk_rows) != 0) {
+				opserr << "MPCORecorder error: option -chunk requires an extra parameter (int) for the number of rows in a chunk\n";
+				return 0;
+			}
+			numdata--;
+			if (write_options.chunk_rows < 0) write_options.chunk_rows = 0;
+			// optional number of steps in a chunk
+			if (numdata > 0) {
+				int chunk_steps;
+				if (OPS_GetInt(&one_item, &chunk_steps) == 0) {
+					write_options.chunk_steps = chunk_steps > 0 ? chunk_steps : 1;
+					numdata--;
+				}
+				else {
+					OPS_ResetCurrentInputArg(-1);
+				}
+			}
+		}
+		else if (strcmp(data, "-compress") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			if (numdata < 1 || OPS_GetInt(&one_item, &write_options.deflate) != 0) {
+				opserr << "MPCORecorder error: option -compress requires an extra parameter (int) for the deflate level (0-9)\n";
+				return 0;
+			}
+			numdata--;
+			write_options.deflate = std::max(0, std::min(9, write_options.deflate));
+		}
+		else if (strcmp(data, "-shuffle") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			write_options.shuffle = true;
+		}
+		else if (strcmp(data, "-sync") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			write_options.async = false;
+		}
+		else if (strcmp(data, "-queue") == 0) {
+			curr_opt = utils::parsing::opt_none;
+			if (numdata < 1 || OPS_GetInt(&one_item, &write_options.max_queued_mb) != 0) {
+				opserr << "MPCORecorder error: option -queue requires an extra parameter (int) for the max memory (MB) of the writer queue\n";
+				return 0;
+			}
+			numdata--;
+			if (write_options.max_queued_mb < 1) write_options.max_queued_mb = 1;
+		}
 		else {
 			switch (curr_opt)
 			{
@@ -6485,6 +7098,7 @@ void* OPS_MPCORecorder()
 	MPCORecorder *new_recorder = new MPCORecorder();
 	new_recorder->m_data->filename = filename;
 	new_recorder->m_data->output_freq = output_freq;
+	new_recorder->m_data->write_options = write_options;
 	new_recorder->m_data->nodal_results_requests.swap(nodal_results_requests);
 	new_recorder->m_data->sens_grad_indices.swap(sens_grad_indices);
 	new_recorder->m_data->elemental_results_requests.swap(elemental_results_requests);
@@ -762,7 +762,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
       }
       
       // insert the data into the database
-      theOutputHandler->write(response);
+      this->writeData(*theOutputHandler, response);
     
     } else { // output all eigenvalues
 
@@ -790,7 +790,7 @@ NodeRecorder::record(int commitTag, double timeStamp)
 	    }
 	  }
 	}
-	theOutputHandler->write(response);
+	this->writeData(*theOutputHandler, response);
       }
     }
   }
@@ -799,6 +799,17 @@ NodeRecorder::record(int commitTag, double timeStamp)
 }
 
 
+int 
+NodeRecorder::getRecordedNodes(ID &theNodeTags)
+{
+  // only the nodal kinematics are recovered for part of the domain
+  if (theNodalTags == 0 || (dataFlag > 4 && dataFlag != 10000))
+    return -1;
+
+  theNodeTags = *theNodalTags;
+  return 0;
+}
+
 int 
 NodeRecorder::setDomain(Domain &theDom)
 {
@@ -64,6 +64,7 @@ class NodeRecorder: public Recorder
     int record(int commitTag, double timeStamp);
 
     int domainChanged(void);    
+    int getRecordedNodes(ID &theNodeTags);
     int setDomain(Domain &theDomain);
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
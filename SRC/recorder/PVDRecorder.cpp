@@ -24,6 +24,8 @@
 
 #include "PVDRecorder.h"
 #include <sstream>
+#include <cstring>
+#include <algorithm>
 #include <elementAPI.h>
 #include <OPS_Globals.h>
 #include <Domain.h>
@@ -36,11 +38,20 @@
 #include <classTags.h>
 #include <NodeIter.h>
 #include <BackgroundMesh.h>
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 extern BackgroundMesh& OPS_GetBackgroundMesh();
 
 std::map<int,PVDRecorder::VtkType> PVDRecorder::vtktypes;
 
+// the values of the data arrays of a vtu piece are at the fifth level
+static const int DATA_LEVEL = 5;
+
 void* OPS_PVDRecorder()
 {
     int numdata = OPS_GetNumRemainingInputArgs();
@@ -58,6 +69,8 @@ void* OPS_PVDRecorder()
     numdata = OPS_GetNumRemainingInputArgs();
     int indent=2;
     int precision = 10;
+    int format = PVDRecorder::ASCII_FORMAT;
+    bool compress = false;
     PVDRecorder::NodeData nodedata;
     std::vector<PVDRecorder::EleData> eledata;
     while(numdata > 0) {
@@ -94,6 +107,12 @@ void* OPS_PVDRecorder()
 	    }
 	    numdata = 1;
 	    if(OPS_GetIntInput(&numdata,&precision) < 0) return 0;
+	} else if(type=="-binary") {
+	    format = PVDRecorder::BINARY_FORMAT;
+	} else if(type=="-appended") {
+	    format = PVDRecorder::APPENDED_FORMAT;
+	} else if(type=="-compress") {
+	    compress = true;
 	} else if(type=="eleResponse") {
 	    numdata = OPS_GetNumRemainingInputArgs();
 	    if(numdata < 1) {
@@ -112,16 +131,30 @@ void* OPS_PVDRecorder()
     }
 
     // create recorder
-    return new PVDRecorder(name,nodedata,eledata,indent,precision);
+    return new PVDRecorder(name,nodedata,eledata,indent,precision,format,compress);
 }
 
 PVDRecorder::PVDRecorder(const char *name, const NodeData& ndata,
-			 const std::vector<EleData>& edata, int ind, int pre)
+			 const std::vector<EleData>& edata, int ind, int pre,
+			 int format, bool zlib)
     :Recorder(RECORDER_TAGS_PVDRecorder), indentsize(ind), precision(pre),
      indentlevel(0), filename(name),
      timestep(), timeparts(), theFile(), quota('\"'), parts(),
-     nodedata(ndata), eledata(edata), theDomain(0), partnum()
+     nodedata(ndata), eledata(edata), theDomain(0), partnum(),
+     dataformat(format), compress(zlib), partcache(),
+     partstamp(-1), partnodes(-1), parteles(-1), partndf(3),
+     steparrays(), appended(), appendedoffset(0),
+     pvdFile(), pvdfooter(), pvdsteps(0)
 {
+#ifndef _ZLIB
+    if (compress) {
+	opserr<<"WARNING: PVDRecorder is built without zlib, -compress is ignored\n";
+	compress = false;
+    }
+#endif
+    if (dataformat == ASCII_FORMAT) {
+	compress = false;
+    }
 }
 
 PVDRecorder::~PVDRecorder()
@@ -148,6 +181,7 @@ PVDRecorder::restart()
 {
     timestep.clear();
     timeparts.clear();
+    pvdFile.close();
     return 0;
 }
 
@@ -161,62 +195,66 @@ int
 PVDRecorder::setDomain(Domain& domain)
 {
     theDomain = &domain;
+    partcache.clear();
+    partstamp = -1;
     return 0;
 }
 
 int
 PVDRecorder::pvd()
 {
-    // open pvd file
-    theFile.close();
     std::string pvdname = filename+".pvd";
+    std::string ind1(indentsize, ' ');
+    std::string ind2(2*indentsize, ' ');
+
+    // header, only once
+    if (!pvdFile.is_open()) {
+	pvdFile.open(pvdname.c_str(), std::ios::trunc|std::ios::out);
+	if(pvdFile.fail()) {
+	    opserr<<"WARNING: Failed to open file "<<pvdname.c_str()<<"\n";
+	    return -1;
+	}
+	pvdFile.precision(precision);
+	pvdFile << std::scientific;
 
-    theFile.open(pvdname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<pvdname.c_str()<<"\n";
-	return -1;
+	pvdFile<<"<?xml version="<<quota<<"1.0"<<quota<<"?>\n";
+	pvdFile<<"<VTKFile type="<<quota<<"Collection"<<quota;
+	if (compress) {
+	    pvdFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+	}
+	pvdFile<<">\n";
+	pvdFile<<ind1<<"<Collection>\n";
+	pvdsteps = 0;
+    } else {
+	// overwrite the footer
+	pvdFile.seekp(pvdfooter);
     }
-    theFile.precision(precision);
-    theFile << std::scientific;
-
-    // header
-    theFile<<"<?xml version="<<quota<<"1.0"<<quota<<"?>\n";
-    theFile<<"<VTKFile type="<<quota<<"Collection"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
-
-    // collection
-    this->incrLevel();
-    this->indent();
-    theFile<<"<Collection>\n";
 
-    // all data files
-    this->incrLevel();
-    for(int i=0; i<(int)timestep.size(); i++) {
+    // the new data files
+    for(int i=pvdsteps; i<(int)timestep.size(); i++) {
 	double t = timestep[i];
 	const ID& partno = timeparts[i];
 	for(int j=0; j<partno.Size(); j++) {
-	    this->indent();
-	    theFile<<"<DataSet timestep="<<quota<<t<<quota;
-	    theFile<<" group="<<quota<<quota;
-	    theFile<<" part="<<quota<<partno(j)<<quota;
-	    theFile<<" file="<<quota<<filename.c_str()<<'/'<<filename.c_str()<<"_T"<<t<<"_P";
-	    theFile<<partno(j)<<".vtu"<<quota;
-	    theFile<<"/>\n";
+	    pvdFile<<ind2;
+	    pvdFile<<"<DataSet timestep="<<quota<<t<<quota;
+	    pvdFile<<" group="<<quota<<quota;
+	    pvdFile<<" part="<<quota<<partno(j)<<quota;
+	    pvdFile<<" file="<<quota<<filename.c_str()<<'/'<<filename.c_str()<<"_T"<<t<<"_P";
+	    pvdFile<<partno(j)<<".vtu"<<quota;
+	    pvdFile<<"/>\n";
 	}
     }
+    pvdsteps = (int)timestep.size();
 
-    // end colloection
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Collection>\n";
-
-    // end VTKFile
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
+    // footer
+    pvdfooter = pvdFile.tellp();
+    pvdFile<<ind1<<"</Collection>\n";
+    pvdFile<<"</VTKFile>\n";
+    pvdFile.flush();
+    if(pvdFile.fail()) {
+	opserr<<"WARNING: Failed to write file "<<pvdname.c_str()<<"\n";
+	return -1;
+    }
 
     return 0;
 }
@@ -224,21 +262,9 @@ PVDRecorder::pvd()
 int
 PVDRecorder::vtu()
 {
-    // get node ndf
-    NodeIter& theNodes = theDomain->getNodes();
-    Node* theNode = 0;
-    int nodendf = 0;
-    while ((theNode = theNodes()) != 0) {
-	if(nodendf < theNode->getNumberDOF()) {
-	    nodendf = theNode->getNumberDOF();
-	}
-    }
-    if (nodendf < 3) {
-	nodendf = 3;
-    }
-    
-    // get parts
-    this->getParts();
+    // get parts, node ndf and the geometry of the parts
+    this->updateParts();
+    int nodendf = partndf;
 
     // part 0
     ID partno(0, (int)parts.size()+2);
@@ -257,26 +283,54 @@ PVDRecorder::vtu()
     }
 
     // save other parts
-    // int index = 1;
     for(std::map<int,ID>::iterator it=parts.begin(); it!=parts.end(); it++) {
-	// int& no = partnum[it->first];
-	// if (no == 0) {
-	//     no = (int)partnum.size();
-	// }
 	int no = partno.Size();
 	partno[no] = no;
 	if(this->savePart(no,it->first,nodendf) < 0) return -1;
     }
-
     
     timeparts.push_back(partno);
     
-    // clear parts
-    parts.clear();
-    
     return 0;
 }
 
+void
+PVDRecorder::updateParts()
+{
+    if (theDomain == 0) {
+	return;
+    }
+
+    // the parts are kept until the domain changes
+    int stamp = theDomain->getDomainChangeStamp();
+    int numnodes = theDomain->getNumNodes();
+    int numeles = theDomain->getNumElements();
+    if (stamp == partstamp && numnodes == partnodes && numeles == parteles) {
+	return;
+    }
+    partstamp = stamp;
+    partnodes = numnodes;
+    parteles = numeles;
+    partcache.clear();
+
+    // get node ndf
+    NodeIter& theNodes = theDomain->getNodes();
+    Node* theNode = 0;
+    partndf = 0;
+    while ((theNode = theNodes()) != 0) {
+	if(partndf < theNode->getNumberDOF()) {
+	    partndf = theNode->getNumberDOF();
+	}
+    }
+    if (partndf < 3) {
+	partndf = 3;
+    }
+
+    // get parts
+    parts.clear();
+    this->getParts();
+}
+
 void
 PVDRecorder::getParts()
 {
@@ -295,25 +349,21 @@ PVDRecorder::getParts()
 }
 
 int
-PVDRecorder::savePart0(int nodendf)
+PVDRecorder::openVTU(int partno)
 {
-    if (theDomain == 0) {
-	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
-	return -1;
-    }
-    
     // get time and part
     std::stringstream ss;
     ss.precision(precision);
     ss << std::scientific;
-    ss << 0 << ' ' << timestep.back();
+    ss << partno << ' ' << timestep.back();
     std::string stime, spart;
     ss >> spart >> stime;
     
     // open file
     theFile.close();
+    indentlevel = 0;
     std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
+    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out|std::ios::binary);
     if(theFile.fail()) {
 	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
 	return -1;
@@ -322,1221 +372,824 @@ PVDRecorder::savePart0(int nodendf)
     theFile << std::scientific;
 
     // header
+    int one = 1;
+    bool little = *(char*)&one == 1;
     theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
     theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+    theFile<<" byte_order="<<quota<<(little ? "LittleEndian" : "BigEndian")<<quota;
+    if (dataformat != ASCII_FORMAT) {
+	theFile<<" header_type="<<quota<<"UInt64"<<quota;
+    }
+    if (compress) {
+	theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+    }
     theFile<<">\n";
     this->incrLevel();
     this->indent();
     theFile<<"<UnstructuredGrid>\n";
 
-    // get pressure nodes
-    ID ptags(0,theDomain->getNumPCs());
-    Pressure_ConstraintIter& thePCs = theDomain->getPCs();
-    Pressure_Constraint* thePC = 0;
-    while ((thePC = thePCs()) != 0) {
-	Node* pnode = thePC->getPressureNode();
-	if (pnode != 0) {
-	    ptags.insert(pnode->getTag());
-	}
-    }
+    steparrays.clear();
+    appended.clear();
+    appendedoffset = 0;
 
-    // get all nodes except pressure nodes
-    std::vector<Node*> nodes;
-    NodeIter& theNodes = theDomain->getNodes();
-    Node* theNode = 0;
-    while ((theNode = theNodes()) != 0) {
-	int nd = theNode->getTag();
-	if (ptags.getLocationOrdered(nd) < 0) {
-	    nodes.push_back(theNode);
-	}
-    }
+    return 0;
+}
 
-    // Piece
-    this->incrLevel();
-    this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<(int)nodes.size()<<quota;
-    theFile<<" NumberOfCells="<<quota<<1<<quota<<">\n";
-        
-    // points
-    this->incrLevel();
+void
+PVDRecorder::closeVTU()
+{
+    // footer
+    this->decrLevel();
     this->indent();
-    theFile<<"<Points>\n";
+    theFile<<"</Piece>\n";
 
-    // points header
-    this->incrLevel();
+    this->decrLevel();
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"</UnstructuredGrid>\n";
 
-    // points coordinates
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	const Vector& crds = nodes[i]->getCrds();
+    // appended data
+    if (dataformat == APPENDED_FORMAT) {
 	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
+	theFile<<"<AppendedData encoding="<<quota<<"raw"<<quota<<">\n";
+	this->indent();
+	theFile<<'_';
+	for (int i=0; i<(int)appended.size(); i++) {
+	    theFile.write(appended[i]->data(), appended[i]->size());
 	}
-	theFile<<std::endl;
+	theFile<<'\n';
+	this->indent();
+	theFile<<"</AppendedData>\n";
     }
 
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
     this->decrLevel();
     this->indent();
-    theFile<<"</Points>\n";
-
-    // cells
-    this->indent();
-    theFile<<"<Cells>\n";
+    theFile<<"</VTKFile>\n";
 
-    // connectivity
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    theFile.close();
 
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<(int)nodes.size()<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    appended.clear();
+    steparrays.clear();
+}
 
-    // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+PVDRecorder::DataArray&
+PVDRecorder::stepArray(const char* type, const std::string& name,
+		       int numcomp, bool showcomp)
+{
+    // arrays of this vtu file, kept until closeVTU
+    steparrays.push_back(DataArray());
+    DataArray& arr = steparrays.back();
+    arr.type = type;
+    arr.name = name;
+    arr.numcomp = numcomp;
+    arr.showcomp = showcomp;
+    return arr;
+}
 
-    // cells footer
-    this->decrLevel();
+void
+PVDRecorder::writeArray(DataArray& arr)
+{
     this->indent();
-    theFile<<"</Cells>\n";
+    theFile<<"<DataArray type="<<quota<<arr.type<<quota;
+    theFile<<" Name="<<quota<<arr.name<<quota;
+    if (arr.showcomp) {
+	theFile<<" NumberOfComponents="<<quota<<arr.numcomp<<quota;
+    }
 
-    // point data
-    this->indent();
-    theFile<<"<PointData>\n";
+    // appended: only the offset of the block
+    if (dataformat == APPENDED_FORMAT) {
+	theFile<<" format="<<quota<<"appended"<<quota;
+	theFile<<" offset="<<quota<<appendedoffset<<quota<<"/>\n";
+	appended.push_back(&arr.data);
+	appendedoffset += arr.data.size();
+	return;
+    }
 
-    // node tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
+    if (dataformat == BINARY_FORMAT) {
+	theFile<<" format="<<quota<<"binary"<<quota<<">\n";
+	this->incrLevel();
 	this->indent();
-	theFile<<nodes[i]->getTag()<<std::endl;
+	theFile<<arr.data<<'\n';
+	this->decrLevel();
+    } else {
+	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+	theFile<<arr.data;
     }
-    this->decrLevel();
     this->indent();
     theFile<<"</DataArray>\n";
+}
 
-    // node velocity
-    if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
+// ascii rows of numcomp values, formatted in parallel blocks of rows
+template<class T> static void
+formatRows(std::string& text, const std::vector<T>& values, int numcomp,
+	   int precision, const std::string& ind)
+{
+    if (numcomp < 1) numcomp = 1;
+    int numrows = (int)values.size()/numcomp;
+    const int blocksize = 4096;
+    int numblocks = (numrows+blocksize-1)/blocksize;
+    std::vector<std::string> blocks(numblocks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int b=0; b<numblocks; b++) {
+	std::ostringstream ss;
+	ss.precision(precision);
+	ss << std::scientific;
+	int end = std::min(numrows, (b+1)*blocksize);
+	for (int i=b*blocksize; i<end; i++) {
+	    ss<<ind;
+	    if (numcomp == 1) {
+		ss<<values[i];
+	    } else {
+		for (int j=0; j<numcomp; j++) {
+		    ss<<values[i*numcomp+j]<<' ';
 		}
 	    }
-	    theFile<<std::endl;
+	    ss<<'\n';
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	blocks[b] = ss.str();
     }
 
-    // node displacement
-    if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+    text.clear();
+    for (int b=0; b<numblocks; b++) {
+	text += blocks[b];
     }
+}
 
-    // node incr displacement
-    if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+void
+PVDRecorder::encode(DataArray& arr, const std::vector<double>& values)
+{
+    if (dataformat == ASCII_FORMAT) {
+	std::string ind(DATA_LEVEL*indentsize, ' ');
+	formatRows(arr.data, values, arr.numcomp, precision, ind);
+	return;
     }
 
-    // node acceleration
-    if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+    // Float32 binary
+    int num = (int)values.size();
+    std::vector<float> data(num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i=0; i<num; i++) {
+	data[i] = (float)values[i];
     }
+    this->encodeBinary(arr, num > 0 ? (const char*)&data[0] : 0, num*sizeof(float));
+}
 
-    // node pressure
-    if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    double pressure = 0.0;
-	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(nodes[i]->getTag());
-	    if(thePC != 0) {
-		pressure = thePC->getPressure();
-	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+void
+PVDRecorder::encode(DataArray& arr, const std::vector<int>& values)
+{
+    if (dataformat == ASCII_FORMAT) {
+	std::string ind(DATA_LEVEL*indentsize, ' ');
+	formatRows(arr.data, values, arr.numcomp, precision, ind);
+	return;
     }
 
-    // node reaction
-    if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+    // Int32 binary
+    int num = (int)values.size();
+    this->encodeBinary(arr, num > 0 ? (const char*)&values[0] : 0, num*sizeof(int));
+}
+
+static void
+base64(std::string& text, const std::string& bytes)
+{
+    static const char table[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t num = bytes.size();
+    const unsigned char* in = (const unsigned char*)bytes.data();
+    size_t start = text.size();
+    text.resize(start + 4*((num+2)/3));
+    char* out = &text[start];
+    size_t i = 0;
+    for (; i+2<num; i+=3) {
+	*out++ = table[in[i]>>2];
+	*out++ = table[((in[i]&0x03)<<4) | (in[i+1]>>4)];
+	*out++ = table[((in[i+1]&0x0f)<<2) | (in[i+2]>>6)];
+	*out++ = table[in[i+2]&0x3f];
+    }
+    if (i < num) {
+	*out++ = table[in[i]>>2];
+	if (i+1 < num) {
+	    *out++ = table[((in[i]&0x03)<<4) | (in[i+1]>>4)];
+	    *out++ = table[(in[i+1]&0x0f)<<2];
+	} else {
+	    *out++ = table[(in[i]&0x03)<<4];
+	    *out++ = '=';
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	*out++ = '=';
     }
-    
-    // node unbalanced load
-    if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+}
+
+void
+PVDRecorder::encodeBinary(DataArray& arr, const char* bytes, size_t numbytes)
+{
+    // a block is a UInt64 header with the number of bytes and the data,
+    // or, compressed, the vtkZLibDataCompressor header
+    // [#blocks, block size, last block size, compressed sizes] and the
+    // compressed blocks
+    std::string header, data;
+    if (!compress) {
+	unsigned long long size = numbytes;
+	header.assign((const char*)&size, sizeof(size));
+	if (numbytes > 0) {
+	    data.assign(bytes, numbytes);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
     }
+#ifdef _ZLIB
+    else {
+	const size_t blocksize = 1 << 15;
+	int numblocks = (int)((numbytes+blocksize-1)/blocksize);
+	std::vector<std::string> blocks(numblocks);
+	std::vector<unsigned long long> head(3+numblocks);
+	head[0] = numblocks;
+	head[1] = blocksize;
+	head[2] = numbytes % blocksize;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int b=0; b<numblocks; b++) {
+	    size_t start = b*blocksize;
+	    uLong size = (uLong)std::min(blocksize, numbytes-start);
+	    uLongf csize = compressBound(size);
+	    blocks[b].resize(csize);
+	    compress2((Bytef*)&blocks[b][0], &csize,
+		      (const Bytef*)(bytes+start), size, Z_DEFAULT_COMPRESSION);
+	    blocks[b].resize(csize);
+	}
 
-    // node mass
-    if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	for (int b=0; b<numblocks; b++) {
+	    head[3+b] = blocks[b].size();
+	    data += blocks[b];
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	header.assign((const char*)&head[0], head.size()*sizeof(unsigned long long));
+    }
+#endif
+
+    arr.data.clear();
+    if (dataformat == APPENDED_FORMAT) {
+	arr.data = header;
+	arr.data += data;
+    } else if (compress) {
+	// header and compressed data are encoded separately
+	base64(arr.data, header);
+	base64(arr.data, data);
+    } else {
+	header += data;
+	base64(arr.data, header);
     }
+}
 
-    // node eigen vector
-    for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Matrix& eigens = nodes[i]->getEigenvectors();
-	    if(k >= eigens.noCols()) {
-		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
-		return -1;
-	    }
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+void
+PVDRecorder::writePoints(PartCache& part, const std::vector<double>& crds)
+{
+    // the points are encoded again only if the coordinates have changed
+    if (part.points.name.empty() || crds != part.crds) {
+	part.crds = crds;
+	part.points.type = "Float32";
+	part.points.name = "Points";
+	part.points.numcomp = 3;
+	part.points.showcomp = true;
+	this->encode(part.points, part.crds);
     }
 
-    // point data footer
+    this->indent();
+    theFile<<"<Points>\n";
+    this->incrLevel();
+    this->writeArray(part.points);
     this->decrLevel();
     this->indent();
-    theFile<<"</PointData>\n";
-
-    // cell data
-    this->indent();
-    theFile<<"<CellData>\n";
+    theFile<<"</Points>\n";
+}
 
-    // element tags
-    this->incrLevel();
+void
+PVDRecorder::writeCells(PartCache& part)
+{
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<Cells>\n";
     this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cell data footer
+    this->writeArray(part.connectivity);
+    this->writeArray(part.offsets);
+    this->writeArray(part.types);
     this->decrLevel();
     this->indent();
-    theFile<<"</CellData>\n";
-
-    // footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Piece>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</UnstructuredGrid>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
-
-    return 0;
+    theFile<<"</Cells>\n";
 }
 
 int
-PVDRecorder::savePartParticle(int nodendf)
+PVDRecorder::savePart0(int nodendf)
 {
     if (theDomain == 0) {
 	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
 	return -1;
     }
     
-    // get time and part
-    std::stringstream ss;
-    ss.precision(precision);
-    ss << std::scientific;
-    ss << 1 << ' ' << timestep.back();
-    std::string stime, spart;
-    ss >> spart >> stime;
-    
     // open file
-    theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openVTU(0) < 0) {
 	return -1;
     }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
-    // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<"<UnstructuredGrid>\n";
+    // the part of all nodes, key -1
+    std::map<int,PartCache>::iterator cache = partcache.find(-1);
+    bool encodecells = false;
+    if (cache == partcache.end()) {
+	cache = partcache.insert(std::make_pair(-1, PartCache())).first;
+	PartCache& part = cache->second;
+
+	// get pressure nodes
+	ID ptags(0,theDomain->getNumPCs());
+	Pressure_ConstraintIter& thePCs = theDomain->getPCs();
+	Pressure_Constraint* thePC = 0;
+	while ((thePC = thePCs()) != 0) {
+	    Node* pnode = thePC->getPressureNode();
+	    if (pnode != 0) {
+		ptags.insert(pnode->getTag());
+	    }
+	}
 
-    // get all particles
-    std::vector<Particle*> particles;
-    BackgroundMesh& background = OPS_GetBackgroundMesh();
-    for(int i=0; i<background.numParticleGroups(); i++) {
-	ParticleGroup* group = background.getParticleGroup(i);
-	if(group == 0) continue;
-	for(int j=0; j<group->numParticles(); j++) {
-	    Particle* p = group->getParticle(j);
-	    if(p == 0) continue;
-	    particles.push_back(p);
+	// get all nodes except pressure nodes
+	NodeIter& theNodes = theDomain->getNodes();
+	Node* theNode = 0;
+	while ((theNode = theNodes()) != 0) {
+	    int nd = theNode->getTag();
+	    if (ptags.getLocationOrdered(nd) < 0) {
+		part.nodes.push_back(theNode);
+	    }
 	}
+	encodecells = true;
     }
+    PartCache& part = cache->second;
+    const std::vector<Node*>& nodes = part.nodes;
+    int numnodes = (int)nodes.size();
 
     // Piece
     this->incrLevel();
     this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<(int)particles.size()<<quota;
+    theFile<<"<Piece NumberOfPoints="<<quota<<numnodes<<quota;
     theFile<<" NumberOfCells="<<quota<<1<<quota<<">\n";
         
     // points
     this->incrLevel();
-    this->indent();
-    theFile<<"<Points>\n";
-
-    // points header
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-
-    // points coordinates
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	const Vector& crds = particles[i]->getCrds();
-	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
+    std::vector<double> crds(3*numnodes, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int i=0; i<numnodes; i++) {
+	const Vector& crd = nodes[i]->getCrds();
+	for(int j=0; j<3 && j<crd.Size(); j++) {
+	    crds[3*i+j] = crd(j);
 	}
-	theFile<<std::endl;
     }
+    this->writePoints(part, crds);
 
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Points>\n";
-
-    // cells
-    this->indent();
-    theFile<<"<Cells>\n";
+    // cells, one poly vertex of all nodes
+    if (encodecells) {
+	std::vector<int> conn(numnodes), tags(numnodes);
+	for(int i=0; i<numnodes; i++) {
+	    conn[i] = i;
+	    tags[i] = nodes[i]->getTag();
+	}
+	part.connectivity.type = "Int32";
+	part.connectivity.name = "connectivity";
+	this->encode(part.connectivity, conn);
+	part.offsets.type = "Int32";
+	part.offsets.name = "offsets";
+	this->encode(part.offsets, std::vector<int>(1, numnodes));
+	part.types.type = "Int32";
+	part.types.name = "types";
+	this->encode(part.types, std::vector<int>(1, (int)VTK_POLY_VERTEX));
+	part.nodetags.type = "Int32";
+	part.nodetags.name = "NodeTag";
+	this->encode(part.nodetags, tags);
+	part.eletags.type = "Int32";
+	part.eletags.name = "ElementTag";
+	this->encode(part.eletags, std::vector<int>(1, 0));
+    }
+    this->writeCells(part);
 
-    // connectivity
-    this->incrLevel();
+    // point data
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<PointData>\n";
     this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
+    this->writeArray(part.nodetags);
+    if (this->saveNodeData(nodes, nodendf) < 0) {
+	theFile.close();
+	steparrays.clear();
+	return -1;
     }
     this->decrLevel();
     this->indent();
-    theFile<<"</DataArray>\n";
-
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<(int)particles.size()<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cells footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Cells>\n";
-
-    // point data
-    this->indent();
-    theFile<<"<PointData>\n";
+    theFile<<"</PointData>\n";
 
-    // node tags
-    this->incrLevel();
+    // cell data
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<CellData>\n";
     this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
-    }
+    this->writeArray(part.eletags);
     this->decrLevel();
     this->indent();
-    theFile<<"</DataArray>\n";
+    theFile<<"</CellData>\n";
 
-    // node velocity
-    if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    const Vector& vel = particles[i]->getVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
+    // footer
+    this->closeVTU();
 
-    // node displacement
-    if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
+    return 0;
+}
 
-    // node incr displacement
-    if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
+int
+PVDRecorder::saveNodeData(const std::vector<Node*>& nodes, int nodendf)
+{
+    int numnodes = (int)nodes.size();
+    std::vector<double> values;
+
+    // node velocity, displacement, incr displacement, acceleration,
+    // pressure, reaction and unbalanced load
+    for (int type=0; type<7; type++) {
+	const char* name = 0;
+	switch (type) {
+	case 0: if (nodedata.vel) name = "Velocity"; break;
+	case 1: if (nodedata.disp) name = "Displacement"; break;
+	case 2: if (nodedata.incrdisp) name = "IncrDisplacement"; break;
+	case 3: if (nodedata.accel) name = "Acceleration"; break;
+	case 4: if (nodedata.pressure) name = "Pressure"; break;
+	case 5: if (nodedata.reaction) name = "Reaction"; break;
+	case 6: if (nodedata.unbalanced) name = "UnbalancedLoad"; break;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node acceleration
-    if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+	if (name == 0) continue;
+
+	// pressure of the pressure constraints
+	if (type == 4) {
+	    values.assign(numnodes, 0.0);
+	    for(int i=0; i<numnodes; i++) {
+		Pressure_Constraint* thePC = theDomain->getPressure_Constraint(nodes[i]->getTag());
+		if(thePC != 0) {
+		    values[i] = thePC->getPressure();
+		}
 	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node pressure
-    if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    double pressure = particles[i]->getPressure();
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    DataArray& arr = this->stepArray("Float32", name, 1, false);
+	    this->encode(arr, values);
+	    this->writeArray(arr);
+	    continue;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
 
-    // node reaction
-    if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+	values.assign(numnodes*nodendf, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for(int i=0; i<numnodes; i++) {
+	    const Vector* vec = 0;
+	    switch (type) {
+	    case 0: vec = &(nodes[i]->getTrialVel()); break;
+	    case 1: vec = &(nodes[i]->getTrialDisp()); break;
+	    case 2: vec = &(nodes[i]->getIncrDisp()); break;
+	    case 3: vec = &(nodes[i]->getTrialAccel()); break;
+	    case 5: vec = &(nodes[i]->getReaction()); break;
+	    default: vec = &(nodes[i]->getUnbalancedLoad()); break;
 	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-    
-    // node unbalanced load
-    if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+	    for(int j=0; j<nodendf && j<vec->Size(); j++) {
+		values[i*nodendf+j] = (*vec)(j);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	DataArray& arr = this->stepArray("Float32", name, nodendf, true);
+	this->encode(arr, values);
+	this->writeArray(arr);
     }
 
     // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+	values.assign(numnodes*nodendf, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for(int i=0; i<numnodes; i++) {
+	    const Matrix& mat = nodes[i]->getMass();
+	    for(int j=0; j<nodendf && j<mat.noRows(); j++) {
+		values[i*nodendf+j] = mat(j,j);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	DataArray& arr = this->stepArray("Float32", "NodeMass", nodendf, true);
+	this->encode(arr, values);
+	this->writeArray(arr);
     }
 
     // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+	values.assign(numnodes*nodendf, 0.0);
+	for(int i=0; i<numnodes; i++) {
+	    const Matrix& eigens = nodes[i]->getEigenvectors();
+	    if(k >= eigens.noCols()) {
+		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
+		return -1;
+	    }
+	    for(int j=0; j<nodendf && j<eigens.noRows(); j++) {
+		values[i*nodendf+j] = eigens(j,k);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	std::stringstream ss;
+	ss << "EigenVector" << k+1;
+	DataArray& arr = this->stepArray("Float32", ss.str(), nodendf, true);
+	this->encode(arr, values);
+	this->writeArray(arr);
     }
 
-    // point data footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</PointData>\n";
-
-    // cell data
-    this->indent();
-    theFile<<"<CellData>\n";
-
-    // element tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cell data footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</CellData>\n";
-
-    // footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Piece>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</UnstructuredGrid>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
-
     return 0;
 }
 
 int
-PVDRecorder::savePart(int partno, int ctag, int nodendf)
+PVDRecorder::savePartParticle(int nodendf)
 {
     if (theDomain == 0) {
 	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
 	return -1;
     }
     
-    // get time and part
-    std::stringstream ss;
-    ss.precision(precision);
-    ss << std::scientific;
-    ss << partno << ' ' << timestep.back();
-    std::string stime, spart;
-    ss >> spart >> stime;
-    
     // open file
-    theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openVTU(1) < 0) {
 	return -1;
     }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
-    // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<"<UnstructuredGrid>\n";
-
-    // get nodes
-    const ID& eletags = parts[ctag];
-    ID ndtags(0,eletags.Size()*3);
-    std::vector<Element*> eles(eletags.Size());
-    int numelenodes = 0;
-    int increlenodes = 1;
-    for(int i=0; i<eletags.Size(); i++) {
-	eles[i] = theDomain->getElement(eletags(i));
-	if (eles[i] == 0) {
-	    opserr<<"WARNING: element "<<eletags(i)<<" is not defined--pvdRecorder\n";
-	    return -1;
-	}
-	const ID& elenodes = eles[i]->getExternalNodes();
-	if(numelenodes == 0) {
-	    numelenodes = elenodes.Size();
-	    if(ctag==ELE_TAG_PFEMElement2D||ctag==ELE_TAG_PFEMElement2DCompressible||
-	       ctag==ELE_TAG_PFEMElement2DBubble||ctag==ELE_TAG_PFEMElement2Dmini) {
-		numelenodes = 3;
-		increlenodes = 2;
-	    }
-	}
-	for(int j=0; j<numelenodes; j++) {
-	    ndtags.insert(elenodes(j*increlenodes));
+    // get all particles
+    std::vector<Particle*> particles;
+    BackgroundMesh& background = OPS_GetBackgroundMesh();
+    for(int i=0; i<background.numParticleGroups(); i++) {
+	ParticleGroup* group = background.getParticleGroup(i);
+	if(group == 0) continue;
+	for(int j=0; j<group->numParticles(); j++) {
+	    Particle* p = group->getParticle(j);
+	    if(p == 0) continue;
+	    particles.push_back(p);
 	}
     }
+    int numparticles = (int)particles.size();
+
+    // particles move, their part is not cached
+    PartCache part;
 
     // Piece
     this->incrLevel();
     this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<ndtags.Size()<<quota;
-    theFile<<" NumberOfCells="<<quota<<eletags.Size()<<quota<<">\n";
+    theFile<<"<Piece NumberOfPoints="<<quota<<numparticles<<quota;
+    theFile<<" NumberOfCells="<<quota<<1<<quota<<">\n";
         
     // points
     this->incrLevel();
-    this->indent();
-    theFile<<"<Points>\n";
-
-    // points header
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-
-    // points coordinates
-    this->incrLevel();
-    std::vector<Node*> nodes(ndtags.Size());
-    for(int i=0; i<ndtags.Size(); i++) {
-	nodes[i] = theDomain->getNode(ndtags(i));
-	if(nodes[i] == 0) {
-	    opserr<<"WARNIG: Node "<<ndtags(i)<<" is not defined -- pvdRecorder\n";
-	    return -1;
+    std::vector<double> crds(3*numparticles, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int i=0; i<numparticles; i++) {
+	const Vector& crd = particles[i]->getCrds();
+	for(int j=0; j<3 && j<crd.Size(); j++) {
+	    crds[3*i+j] = crd(j);
 	}
-	const Vector& crds = nodes[i]->getCrds();
-	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
-	}
-	theFile<<std::endl;
     }
+    this->writePoints(part, crds);
 
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Points>\n";
-
-    // cells
-    this->indent();
-    theFile<<"<Cells>\n";
+    // cells, one poly vertex of all particles
+    std::vector<int> conn(numparticles);
+    for(int i=0; i<numparticles; i++) {
+	conn[i] = i;
+    }
+    part.connectivity.type = "Int32";
+    part.connectivity.name = "connectivity";
+    this->encode(part.connectivity, conn);
+    part.offsets.type = "Int32";
+    part.offsets.name = "offsets";
+    this->encode(part.offsets, std::vector<int>(1, numparticles));
+    part.types.type = "Int32";
+    part.types.name = "types";
+    this->encode(part.types, std::vector<int>(1, (int)VTK_POLY_VERTEX));
+    this->writeCells(part);
 
-    // connectivity
-    this->incrLevel();
+    // point data
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<PointData>\n";
     this->incrLevel();
-    for(int i=0; i<eletags.Size(); i++) {
-	const ID& elenodes = eles[i]->getExternalNodes();
-	this->indent();
-	for(int j=0; j<numelenodes; j++) {
-	    theFile<<ndtags.getLocationOrdered(elenodes(j*increlenodes))<<' ';
+
+    // node tags
+    part.nodetags.type = "Int32";
+    part.nodetags.name = "NodeTag";
+    this->encode(part.nodetags, conn);
+    this->writeArray(part.nodetags);
+
+    // particles only have velocity and pressure, the other data are zero
+    std::vector<double> values;
+    for (int type=0; type<8+nodedata.numeigen; type++) {
+	std::string name;
+	switch (type) {
+	case 0: if (nodedata.vel) name = "Velocity"; break;
+	case 1: if (nodedata.disp) name = "Displacement"; break;
+	case 2: if (nodedata.incrdisp) name = "IncrDisplacement"; break;
+	case 3: if (nodedata.accel) name = "Acceleration"; break;
+	case 4: if (nodedata.pressure) name = "Pressure"; break;
+	case 5: if (nodedata.reaction) name = "Reaction"; break;
+	case 6: if (nodedata.unbalanced) name = "UnbalancedLoad"; break;
+	case 7: if (nodedata.mass) name = "NodeMass"; break;
+	default: {
+	    std::stringstream ss;
+	    ss << "EigenVector" << type-7;
+	    name = ss.str();
+	    break;
 	}
-	theFile<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+	}
+	if (name.empty()) continue;
 
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    int offset = numelenodes;
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<offset<<std::endl;
-	offset += numelenodes;
+	// particle pressure
+	if (type == 4) {
+	    values.assign(numparticles, 0.0);
+	    for(int i=0; i<numparticles; i++) {
+		values[i] = particles[i]->getPressure();
+	    }
+	    DataArray& arr = this->stepArray("Float32", name, 1, false);
+	    this->encode(arr, values);
+	    this->writeArray(arr);
+	    continue;
+	}
+
+	values.assign(numparticles*nodendf, 0.0);
+	if (type == 0) {
+	    for(int i=0; i<numparticles; i++) {
+		const Vector& vel = particles[i]->getVel();
+		for(int j=0; j<nodendf && j<vel.Size(); j++) {
+		    values[i*nodendf+j] = vel(j);
+		}
+	    }
+	}
+	DataArray& arr = this->stepArray("Float32", name, nodendf, true);
+	this->encode(arr, values);
+	this->writeArray(arr);
     }
     this->decrLevel();
     this->indent();
-    theFile<<"</DataArray>\n";
+    theFile<<"</PointData>\n";
 
-    // types
+    // cell data
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<CellData>\n";
     this->incrLevel();
-    int type = vtktypes[ctag];
-    if (type == 0) {
-	opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
-	return -1;
-    }
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<type<<std::endl;
-    }
+    part.eletags.type = "Int32";
+    part.eletags.name = "ElementTag";
+    this->encode(part.eletags, std::vector<int>(1, 0));
+    this->writeArray(part.eletags);
     this->decrLevel();
     this->indent();
-    theFile<<"</DataArray>\n";
+    theFile<<"</CellData>\n";
 
-    // cells footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Cells>\n";
+    // footer
+    this->closeVTU();
 
-    // point data
-    this->indent();
-    theFile<<"<PointData>\n";
+    return 0;
+}
 
-    // node tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<ndtags.Size(); i++) {
-	this->indent();
-	theFile<<ndtags(i)<<std::endl;
+int
+PVDRecorder::savePart(int partno, int ctag, int nodendf)
+{
+    if (theDomain == 0) {
+	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
+	return -1;
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
-    // node velocity
-    if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
+    // the geometry of the part is kept until the domain changes
+    std::map<int,PartCache>::iterator cache = partcache.find(ctag);
+    if (cache == partcache.end()) {
+	PartCache part;
+
+	// get elements
+	const ID& eletags = parts[ctag];
+	int numeles = eletags.Size();
+	part.eles.resize(numeles);
+	int numelenodes = 0;
+	int increlenodes = 1;
+	std::vector<int> ndtags;
+	ndtags.reserve(numeles*3);
+	for(int i=0; i<numeles; i++) {
+	    part.eles[i] = theDomain->getElement(eletags(i));
+	    if (part.eles[i] == 0) {
+		opserr<<"WARNING: element "<<eletags(i)<<" is not defined--pvdRecorder\n";
+		return -1;
 	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node displacement
-    if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
+	    const ID& elenodes = part.eles[i]->getExternalNodes();
+	    if(numelenodes == 0) {
+		numelenodes = elenodes.Size();
+		if(ctag==ELE_TAG_PFEMElement2D||ctag==ELE_TAG_PFEMElement2DCompressible||
+		   ctag==ELE_TAG_PFEMElement2DBubble||ctag==ELE_TAG_PFEMElement2Dmini) {
+		    numelenodes = 3;
+		    increlenodes = 2;
 		}
 	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node incr displacement
-    if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
+	    for(int j=0; j<numelenodes; j++) {
+		ndtags.push_back(elenodes(j*increlenodes));
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
+	int type = vtktypes[ctag];
+	if (type == 0) {
+	    opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
+	    return -1;
+	}
 
-    // node acceleration
-    if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
+	// get nodes
+	std::sort(ndtags.begin(), ndtags.end());
+	ndtags.erase(std::unique(ndtags.begin(), ndtags.end()), ndtags.end());
+	int numnodes = (int)ndtags.size();
+	part.nodes.resize(numnodes);
+	for(int i=0; i<numnodes; i++) {
+	    part.nodes[i] = theDomain->getNode(ndtags[i]);
+	    if(part.nodes[i] == 0) {
+		opserr<<"WARNIG: Node "<<ndtags[i]<<" is not defined -- pvdRecorder\n";
+		return -1;
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
 
-    // node pressure
-    if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    double pressure = 0.0;
-	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(ndtags(i));
-	    if(thePC != 0) {
-		pressure = thePC->getPressure();
+	// connectivity, offsets and types
+	std::vector<int> conn(numeles*numelenodes), offsets(numeles), types(numeles, type);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for(int i=0; i<numeles; i++) {
+	    const ID& elenodes = part.eles[i]->getExternalNodes();
+	    for(int j=0; j<numelenodes; j++) {
+		conn[i*numelenodes+j] = (int)(std::lower_bound(ndtags.begin(), ndtags.end(),
+							       elenodes(j*increlenodes))-ndtags.begin());
 	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    offsets[i] = (i+1)*numelenodes;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
 
-    // node reaction
-    if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+	// encode at the level of the cell arrays
 	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-    
-    // node unbalanced load
-    if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
 	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	this->incrLevel();
+	part.connectivity.type = "Int32";
+	part.connectivity.name = "connectivity";
+	part.connectivity.numcomp = numelenodes;
+	this->encode(part.connectivity, conn);
+	part.offsets.type = "Int32";
+	part.offsets.name = "offsets";
+	this->encode(part.offsets, offsets);
+	part.types.type = "Int32";
+	part.types.name = "types";
+	this->encode(part.types, types);
+	part.nodetags.type = "Int32";
+	part.nodetags.name = "NodeTag";
+	this->encode(part.nodetags, ndtags);
+	std::vector<int> etags(numeles);
+	for(int i=0; i<numeles; i++) {
+	    etags[i] = eletags(i);
 	}
+	part.eletags.type = "Int32";
+	part.eletags.name = "ElementTag";
+	this->encode(part.eletags, etags);
 	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->decrLevel();
+	this->decrLevel();
+
+	cache = partcache.insert(std::make_pair(ctag, part)).first;
     }
+    PartCache& part = cache->second;
+    const std::vector<Node*>& nodes = part.nodes;
+    const std::vector<Element*>& eles = part.eles;
+    int numnodes = (int)nodes.size();
+    int numeles = (int)eles.size();
 
-    // node mass
-    if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+    // open file
+    if (this->openVTU(partno) < 0) {
+	return -1;
     }
 
-    // node eigen vector
-    for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Matrix& eigens = nodes[i]->getEigenvectors();
-	    if(k >= eigens.noCols()) {
-		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
-		return -1;
-	    }
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+    // Piece
+    this->incrLevel();
+    this->indent();
+    theFile<<"<Piece NumberOfPoints="<<quota<<numnodes<<quota;
+    theFile<<" NumberOfCells="<<quota<<numeles<<quota<<">\n";
+        
+    // points
+    this->incrLevel();
+    std::vector<double> crds(3*numnodes, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int i=0; i<numnodes; i++) {
+	const Vector& crd = nodes[i]->getCrds();
+	for(int j=0; j<3 && j<crd.Size(); j++) {
+	    crds[3*i+j] = crd(j);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
     }
+    this->writePoints(part, crds);
+
+    // cells
+    this->writeCells(part);
 
-    // point data footer
+    // point data
+    this->indent();
+    theFile<<"<PointData>\n";
+    this->incrLevel();
+    this->writeArray(part.nodetags);
+    if (this->saveNodeData(nodes, nodendf) < 0) {
+	theFile.close();
+	steparrays.clear();
+	return -1;
+    }
     this->decrLevel();
     this->indent();
     theFile<<"</PointData>\n";
@@ -1544,26 +1197,14 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
-
-    // element tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<eletags(i)<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeArray(part.eletags);
 
-    // element response
+    // element response, the elements are not safe to query in parallel
+    std::vector<double> values;
     for(int i=0; i<(int)eledata.size(); i++) {
 
-	if(eletags.Size() == 0) break;
+	if(numeles == 0) break;
 
 	// check data
 	int argc = (int)eledata[i].size();
@@ -1572,62 +1213,42 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	for(int j=0; j<argc; j++) {
 	    argv[j] = eledata[i][j].c_str();
 	}
-	const Vector* data =theDomain->getElementResponse(eletags(0),&(argv[0]),argc);
+	const Vector* data =theDomain->getElementResponse(eles[0]->getTag(),&(argv[0]),argc);
 	if(data==0) continue;
 	int eressize = data->Size();
 	if(eressize == 0) continue;
 
-	// save data
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<eles[0]->getClassType();
-	for(int j=0; j<argc; j++) {
-	    theFile<<argv[j];
-	}
-	theFile<<quota;
-	theFile<<" NumberOfComponents="<<quota<<eressize<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int j=0; j<eletags.Size(); j++) {
-	    data=theDomain->getElementResponse(eletags(j),&(argv[0]),argc);
+	// get data
+	values.assign(numeles*eressize, 0.0);
+	for(int j=0; j<numeles; j++) {
+	    data=theDomain->getElementResponse(eles[j]->getTag(),&(argv[0]),argc);
 	    if(data==0) {
-		opserr<<"WARNING: can't get response for element "<<eletags(j)<<"\n";
+		opserr<<"WARNING: can't get response for element "<<eles[j]->getTag()<<"\n";
+		theFile.close();
+		steparrays.clear();
 		return -1;
 	    }
-	    this->indent();
-	    for(int k=0; k<eressize; k++) {
-		if (k>=data->Size()) {
-		    theFile<<0.0<<" ";
-		} else {
-		    theFile<<(*data)(k)<<" ";
-		}
+	    for(int k=0; k<eressize && k<data->Size(); k++) {
+		values[j*eressize+k] = (*data)(k);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+
+	// save data
+	std::string name = eles[0]->getClassType();
+	for(int j=0; j<argc; j++) {
+	    name += argv[j];
+	}
+	DataArray& arr = this->stepArray("Float32", name, eressize, true);
+	this->encode(arr, values);
+	this->writeArray(arr);
     }
 
-    // cell data footer
     this->decrLevel();
     this->indent();
     theFile<<"</CellData>\n";
 
     // footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Piece>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</UnstructuredGrid>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
+    this->closeVTU();
 
     return 0;
 }
@@ -28,12 +28,17 @@
 //
 // Description: This file contains the class definition for 
 // PVDRecorder. A PVDRecorder is used to store all responses in pvd format.
+// The data arrays of the vtu files are written as ascii, as inline
+// base64 or as raw appended binary, optionally zlib compressed (needs
+// _ZLIB). The points and cells of each part are encoded once and
+// reused until the domain changes.
 
 
 #include <string>
 #include <fstream>
 #include <vector>
 #include <map>
+#include <list>
 #include <ID.h>
 #include <Recorder.h>
 
@@ -51,10 +56,12 @@ public:
 	int numeigen;
     };
     typedef std::vector<std::string> EleData;
+    enum DataFormat {ASCII_FORMAT=0, BINARY_FORMAT=1, APPENDED_FORMAT=2};
     
 public:
     PVDRecorder(const char *filename, const NodeData& ndata,
-		const std::vector<EleData>& edata, int ind=2, int pre=10);
+		const std::vector<EleData>& edata, int ind=2, int pre=10,
+		int format=ASCII_FORMAT, bool compress=false);
     ~PVDRecorder();
 
     int record(int commitTag, double timeStamp);
@@ -70,6 +77,27 @@ protected:
     virtual int pvd();
     virtual void addEleData(const EleData& edata) {eledata.push_back(edata);}
 
+private:
+    // an encoded DataArray, data is the ascii text, the base64 text
+    // or the raw appended block
+    struct DataArray {
+	DataArray():type("Float32"),name(),numcomp(1),showcomp(false),data(){}
+	std::string type, name;
+	int numcomp;
+	bool showcomp;
+	std::string data;
+    };
+
+    // the geometry and topology of a part, valid until the domain changes
+    struct PartCache {
+	PartCache():nodes(),eles(),crds(),points(),connectivity(),
+		    offsets(),types(),nodetags(),eletags(){}
+	std::vector<Node*> nodes;
+	std::vector<Element*> eles;
+	std::vector<double> crds;
+	DataArray points, connectivity, offsets, types, nodetags, eletags;
+    };
+
 private:
     virtual void indent();
     virtual void incrLevel() {indentlevel++;}
@@ -78,6 +106,19 @@ private:
     virtual int savePart(int partno, int ctag, int ndf);
     virtual int savePart0(int ndf);
     virtual int savePartParticle(int ndf);
+    virtual int saveNodeData(const std::vector<Node*>& nodes, int ndf);
+    virtual void updateParts();
+
+    int openVTU(int partno);
+    void closeVTU();
+    void writeArray(DataArray& arr);
+    void writePoints(PartCache& part, const std::vector<double>& crds);
+    void writeCells(PartCache& part);
+    DataArray& stepArray(const char* type, const std::string& name,
+			 int numcomp, bool showcomp);
+    void encode(DataArray& arr, const std::vector<double>& values);
+    void encode(DataArray& arr, const std::vector<int>& values);
+    void encodeBinary(DataArray& arr, const char* bytes, size_t numbytes);
     
 private:
     int indentsize, precision, indentlevel;
@@ -92,6 +133,24 @@ private:
     Domain* theDomain;
     std::map<int,int> partnum;
 
+    // output format
+    int dataformat;
+    bool compress;
+
+    // parts and their geometry for the current domain
+    std::map<int,PartCache> partcache;
+    int partstamp, partnodes, parteles, partndf;
+
+    // arrays of the current vtu file and its appended blocks
+    std::list<DataArray> steparrays;
+    std::vector<const std::string*> appended;
+    unsigned long long appendedoffset;
+
+    // the pvd file is kept open, new data sets overwrite the footer
+    std::ofstream pvdFile;
+    std::streampos pvdfooter;
+    int pvdsteps;
+
 public:
     enum VtkType {
 	VTK_VERTEX=1,VTK_POLY_VERTEX=2,VTK_LINE=3,VTK_POLY_LINE=4,
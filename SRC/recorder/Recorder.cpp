@@ -33,11 +33,14 @@
 
 #include <Recorder.h>
 #include <OPS_Globals.h>
+#include <OPS_Stream.h>
+#include <Vector.h>
 
 int Recorder::lastRecorderTag(0);
 
 Recorder::Recorder(int classTag)
-  :MovableObject(classTag), TaggedObject(lastRecorderTag)
+  :MovableObject(classTag), TaggedObject(lastRecorderTag),
+   staging(false), stagedData(), stagedStreams(), stagedSizes()
 {
   lastRecorderTag++;
 }
@@ -47,6 +50,52 @@ Recorder::~Recorder()
 
 }
 
+int
+Recorder::stage(int commitTag, double timeStamp)
+{
+  staging = true;
+  int res = this->record(commitTag, timeStamp);
+  staging = false;
+
+  return res;
+}
+
+int
+Recorder::flush(void)
+{
+  int res = 0;
+  int loc = 0;
+  for (size_t i=0; i<stagedStreams.size(); i++) {
+    int size = stagedSizes[i];
+    Vector theData(size > 0 ? &stagedData[loc] : 0, size);
+    if (stagedStreams[i]->write(theData) < 0)
+      res = -1;
+    loc += size;
+  }
+
+  // keep the capacity for the next step
+  stagedData.clear();
+  stagedStreams.clear();
+  stagedSizes.clear();
+
+  return res;
+}
+
+int
+Recorder::writeData(OPS_Stream &theStream, Vector &theData)
+{
+  if (staging == false)
+    return theStream.write(theData);
+
+  int size = theData.Size();
+  for (int i=0; i<size; i++)
+    stagedData.push_back(theData(i));
+  stagedStreams.push_back(&theStream);
+  stagedSizes.push_back(size);
+
+  return 0;
+}
+
 int 
 Recorder::restart(void)
 {
@@ -59,6 +108,12 @@ Recorder::domainChanged(void)
   return 0;
 }
 
+int 
+Recorder::getRecordedNodes(ID &theNodeTags)
+{
+  return -1;
+}
+
 int 
 Recorder::setDomain(Domain &theDomain)
 {
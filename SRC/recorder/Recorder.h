@@ -37,8 +37,12 @@
 // What: "@(#) Recorder.h, revA"
 
 class Domain;
+class OPS_Stream;
+class Vector;
+class ID;
 #include <MovableObject.h>
 #include <TaggedObject.h>
+#include <vector>
 
 
 class Recorder: public MovableObject, public TaggedObject
@@ -48,9 +52,22 @@ class Recorder: public MovableObject, public TaggedObject
     virtual ~Recorder();
 
     virtual int record(int commitTag, double timeStamp) =0;
+
+    // two phase recording used by the RecorderScheduler: stage() is
+    // called on the analysis thread and keeps what it needs of the
+    // committed state, flush() reduces and writes it and may be called
+    // on a worker thread. By default stage() records and data written
+    // with writeData() during stage() are kept for flush().
+    virtual int stage(int commitTag, double timeStamp);
+    virtual int flush(void);
     
     virtual int restart(void);
     virtual int domainChanged(void);
+
+    // the tags of the nodes whose kinematics the recorder reads, for an
+    // analysis that only recovers part of the domain; -1 if the recorder
+    // needs the state of the whole domain
+    virtual int getRecordedNodes(ID &theNodeTags);
     virtual int setDomain(Domain &theDomain);
     virtual int sendSelf(int commitTag, Channel &theChannel);  
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -59,9 +76,17 @@ class Recorder: public MovableObject, public TaggedObject
     virtual void Print(OPS_Stream &s, int flag); 
 
   protected:
+    // writes the data to the stream, or keeps a copy for flush() if
+    // called while staging
+    int writeData(OPS_Stream &theStream, Vector &theData);
     
   private:	
     static int lastRecorderTag;
+
+    bool staging;
+    std::vector<double> stagedData;
+    std::vector<OPS_Stream *> stagedStreams;
+    std::vector<int> stagedSizes;
 };
 
 
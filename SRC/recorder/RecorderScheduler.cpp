@@ -0,0 +1,212 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// RecorderScheduler.
+
+#include <RecorderScheduler.h>
+#include <Recorder.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <algorithm>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// the live schedulers, so the fork handlers can reach them
+static std::mutex theSchedulersMutex;
+static std::vector<RecorderScheduler *> theSchedulers;
+
+RecorderScheduler::RecorderScheduler(int numThreads)
+  :theThreads(), theMutex(), workReady(), workDone(),
+   theBatch(), nextRecorder(0), numBusy(0), result(0), stop(false),
+   serial(false)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+
+  // the workers may write to the standard streams
+  StandardStream::setThreaded(true);
+
+  for (int i=0; i<numThreads; i++)
+    theThreads.push_back(std::thread(&RecorderScheduler::work, this));
+
+  std::lock_guard<std::mutex> lock(theSchedulersMutex);
+#ifndef _WIN32
+  static bool handlersSet = false;
+  if (handlersSet == false) {
+    pthread_atfork(&RecorderScheduler::prepareFork,
+		   &RecorderScheduler::parentFork,
+		   &RecorderScheduler::childFork);
+    handlersSet = true;
+  }
+#endif
+  theSchedulers.push_back(this);
+}
+
+RecorderScheduler::~RecorderScheduler()
+{
+  {
+    std::lock_guard<std::mutex> lock(theSchedulersMutex);
+    theSchedulers.erase(std::remove(theSchedulers.begin(), theSchedulers.end(), this),
+			theSchedulers.end());
+  }
+
+  this->wait();
+
+  if (serial) {
+    // the threads are those of the parent process and do not exist
+    // here, they are released without being joined
+    new std::vector<std::thread>(std::move(theThreads));
+    StandardStream::setThreaded(false);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    stop = true;
+  }
+  workReady.notify_all();
+
+  for (size_t i=0; i<theThreads.size(); i++)
+    theThreads[i].join();
+
+  StandardStream::setThreaded(false);
+}
+
+// before a fork every scheduler finishes its batch and stays locked, so
+// no worker is writing and no lock is held by a worker when the process
+// is copied; the flush results are kept for the next wait()
+void
+RecorderScheduler::prepareFork(void)
+{
+  theSchedulersMutex.lock();
+  for (size_t i=0; i<theSchedulers.size(); i++) {
+    RecorderScheduler *theScheduler = theSchedulers[i];
+    std::unique_lock<std::mutex> lock(theScheduler->theMutex);
+    while (theScheduler->nextRecorder < (int)theScheduler->theBatch.size() ||
+	   theScheduler->numBusy > 0)
+      theScheduler->workDone.wait(lock);
+    theScheduler->theBatch.clear();
+    theScheduler->nextRecorder = 0;
+    lock.release();
+  }
+}
+
+void
+RecorderScheduler::parentFork(void)
+{
+  for (size_t i=0; i<theSchedulers.size(); i++)
+    theSchedulers[i]->theMutex.unlock();
+  theSchedulersMutex.unlock();
+}
+
+// the child has only the forking thread, the schedulers record serially
+void
+RecorderScheduler::childFork(void)
+{
+  for (size_t i=0; i<theSchedulers.size(); i++) {
+    theSchedulers[i]->serial = true;
+    theSchedulers[i]->theMutex.unlock();
+  }
+  theSchedulersMutex.unlock();
+}
+
+int
+RecorderScheduler::record(Recorder **theRecorders, int numRecorders,
+			  int commitTag, double timeStamp)
+{
+  // the previous step must be written before the recorders are staged
+  int res = this->wait();
+
+  // stage in the order the recorders were added, on this thread
+  std::vector<Recorder *> batch;
+  batch.reserve(numRecorders);
+  for (int i=0; i<numRecorders; i++) {
+    if (theRecorders[i] != 0) {
+      res += theRecorders[i]->stage(commitTag, timeStamp);
+      batch.push_back(theRecorders[i]);
+    }
+  }
+
+  if (serial) {
+    for (size_t i=0; i<batch.size(); i++)
+      if (batch[i]->flush() < 0) {
+	opserr << "WARNING RecorderScheduler - recorder " << batch[i]->getTag() 
+	       << " failed to write its data\n";
+	res += -1;
+      }
+    return res;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    theBatch.swap(batch);
+    nextRecorder = 0;
+  }
+  workReady.notify_all();
+
+  return res;
+}
+
+int
+RecorderScheduler::wait(void)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (nextRecorder < (int)theBatch.size() || numBusy > 0)
+    workDone.wait(lock);
+
+  theBatch.clear();
+  nextRecorder = 0;
+
+  int res = result;
+  result = 0;
+
+  return res;
+}
+
+void
+RecorderScheduler::work(void)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (true) {
+    while (stop == false && nextRecorder >= (int)theBatch.size())
+      workReady.wait(lock);
+
+    if (nextRecorder >= (int)theBatch.size())
+      return;
+
+    Recorder *theRecorder = theBatch[nextRecorder++];
+    numBusy++;
+    lock.unlock();
+
+    int res = theRecorder->flush();
+
+    lock.lock();
+    numBusy--;
+    if (res < 0) {
+      opserr << "WARNING RecorderScheduler - recorder " << theRecorder->getTag() 
+	     << " failed to write its data\n";
+      result = -1;
+    }
+    if (nextRecorder >= (int)theBatch.size() && numBusy == 0)
+      workDone.notify_all();
+  }
+}
@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef RecorderScheduler_h
+#define RecorderScheduler_h
+
+// Description: This file contains the class definition for
+// RecorderScheduler. A RecorderScheduler records the recorders of a
+// Domain in two phases: on the analysis thread every recorder is asked
+// to stage() the committed state it needs, the staged data are then
+// reduced and written by flush() on a pool of worker threads while the
+// analysis goes on with the next step. A batch is finished before the
+// recorders are staged again, so each recorder sees its steps in order
+// and writes the same output as when recorded directly.
+//
+// The schedulers are fork safe: before a fork every live scheduler is
+// drained and locked, and in the child, which has none of the worker
+// threads, the schedulers flush the recorders on the calling thread.
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class Recorder;
+
+class RecorderScheduler
+{
+  public:
+    RecorderScheduler(int numThreads);
+    ~RecorderScheduler();
+
+    // stage all recorders and hand them to the workers, waits for the
+    // previous batch first
+    int record(Recorder **theRecorders, int numRecorders,
+	       int commitTag, double timeStamp);
+
+    // waits until all staged data are written, returns < 0 if a flush
+    // failed since the last wait
+    int wait(void);
+
+    int getNumThreads(void) const {return serial ? 0 : (int)theThreads.size();}
+
+  private:
+    void work(void);
+
+    // fork handlers, see RecorderScheduler.cpp
+    static void prepareFork(void);
+    static void parentFork(void);
+    static void childFork(void);
+
+    std::vector<std::thread> theThreads;
+    std::mutex theMutex;
+    std::condition_variable workReady;
+    std::condition_variable workDone;
+
+    std::vector<Recorder *> theBatch;
+    int nextRecorder;
+    int numBusy;
+    int result;
+    bool stop;
+    bool serial;    // no worker threads, flush on the calling thread
+};
+
+#endif
@@ -38,6 +38,16 @@
 #include <ReliabilityDomain.h>
 #include <LimitStateFunction.h>
 #include <string.h>
+#include <stdio.h>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <errno.h>
+#endif
 
 
 FiniteDifferenceGradient::FiniteDifferenceGradient(FunctionEvaluator *passedGFunEvaluator,
@@ -45,7 +55,7 @@ FiniteDifferenceGradient::FiniteDifferenceGradient(FunctionEvaluator *passedGFun
 						   Domain *passedOpenSeesDomain)
 
 :GradientEvaluator(passedReliabilityDomain, passedGFunEvaluator), 
-theOpenSeesDomain(passedOpenSeesDomain)
+theOpenSeesDomain(passedOpenSeesDomain), numProcesses(1)
 {
 	
 	int nparam = theOpenSeesDomain->getNumParameters();
@@ -69,6 +79,18 @@ FiniteDifferenceGradient::getGradient()
 }
 
 
+void
+FiniteDifferenceGradient::setNumProcesses(int num)
+{
+#ifdef _WIN32
+	if (num > 1)
+		opserr << "WARNING FiniteDifferenceGradient -- worker processes are not available on Windows, running serially" << endln;
+	num = 1;
+#endif
+	numProcesses = (num > 1) ? num : 1;
+}
+
+
 int
 FiniteDifferenceGradient::computeGradient(double g)
 {
@@ -87,6 +109,8 @@ FiniteDifferenceGradient::computeGradient(double g)
 	// get parameters created in the domain
 	int nparam = theOpenSeesDomain->getNumParameters();
 
+	// parameters without analytic gradient need a perturbed analysis
+	ID perturbed(0, nparam);
     
 	// now loop through to create gradient vector
 	// note this is a for loop because there may be some conflict from a nested iterator already 
@@ -114,42 +138,209 @@ FiniteDifferenceGradient::computeGradient(double g)
 		}
 		
 		// if no analytic gradient automatically do finite differences
+		else if (numProcesses > 1) {
+			perturbed[perturbed.Size()] = i;
+			continue;
+		}
 		else {
-			// use parameter defined perturbation
-			double h = theParam->getPerturbation();
-            double original = theParam->getValue();
-            theParam->update(original+h);
-
-			// set perturbed values in the variable namespace
-			if (theFunctionEvaluator->setVariables() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+			if (this->computePerturbed(i, g, lsfExpression, result) < 0)
 				return -1;
-			}
-			
-			// run analysis
-			if (theFunctionEvaluator->runAnalysis() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
-				return -1;
-			}
-			
-            // evaluate LSF and obtain result
-			theFunctionEvaluator->setExpression(lsfExpression);
-			
-			// Add gradient contribution
-			double g_perturbed = theFunctionEvaluator->evaluateExpression();
-			result = (g_perturbed-g)/h;
-            
-            // return values to previous state
-			theParam->update(original);
-
-			//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
 		}
 		
 		(*grad_g)(i) = result;
 		
 	}
 
+	// the perturbed analyses are independent, run them in the worker processes
+	if (perturbed.Size() > 0)
+		return this->computePerturbedParallel(perturbed, g, lsfExpression);
+
 	return 0;
 	
 }
 
+
+int
+FiniteDifferenceGradient::computePerturbed(int index, double g, const char *lsfExpression,
+					   double &result)
+{
+	Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(index);
+
+	// use parameter defined perturbation
+	double h = theParam->getPerturbation();
+	double original = theParam->getValue();
+	theParam->update(original+h);
+
+	// set perturbed values in the variable namespace
+	if (theFunctionEvaluator->setVariables() < 0) {
+		opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+		return -1;
+	}
+	
+	// run analysis
+	if (theFunctionEvaluator->runAnalysis() < 0) {
+		opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
+		return -1;
+	}
+	
+	// evaluate LSF and obtain result
+	theFunctionEvaluator->setExpression(lsfExpression);
+	
+	// Add gradient contribution
+	double g_perturbed = theFunctionEvaluator->evaluateExpression();
+	result = (g_perturbed-g)/h;
+	
+	// return values to previous state
+	theParam->update(original);
+
+	//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
+
+	return 0;
+}
+
+
+int
+FiniteDifferenceGradient::computePerturbedParallel(const ID &indices, double g,
+						   const char *lsfExpression)
+{
+#ifdef _WIN32
+	for (int j = 0; j < indices.Size(); j++) {
+		double result = 0;
+		if (this->computePerturbed(indices(j), g, lsfExpression, result) < 0)
+			return -1;
+		(*grad_g)(indices(j)) = result;
+	}
+	return 0;
+#else
+	int num = indices.Size();
+	int nproc = (numProcesses < num) ? numProcesses : num;
+
+	// the recorders of the parent must be written before the model is
+	// copied, the workers do not record
+	theOpenSeesDomain->waitForRecorders();
+
+	// buffered output would be written again by every worker
+	fflush(stdout);
+	fflush(stderr);
+
+	// every perturbation runs in its own worker forked from the current
+	// model, so it starts from the same state whatever the number of
+	// processes; at most nproc workers run at a time
+	std::vector<struct pollfd> fds;
+	std::vector<pid_t> pids;
+	std::vector<int> slots;
+	ID done(num);
+	int res = 0;
+	int next = 0;
+	while (next < num || fds.empty() == false) {
+
+		// start workers up to nproc
+		while (next < num && (int)fds.size() < nproc && res == 0) {
+			int fd[2];
+			if (pipe(fd) != 0) {
+				opserr << "ERROR FiniteDifferenceGradient -- failed to create pipe for worker process" << endln;
+				res = -1;
+				break;
+			}
+			pid_t pid = fork();
+			if (pid < 0) {
+				opserr << "ERROR FiniteDifferenceGradient -- failed to start worker process" << endln;
+				close(fd[0]);
+				close(fd[1]);
+				res = -1;
+				break;
+			}
+
+			if (pid == 0) {
+				// worker: its own copy of the interpreter and domain,
+				// the files of the parent's recorders are left alone
+				close(fd[0]);
+				for (size_t i = 0; i < fds.size(); i++)
+					close(fds[i].fd);
+				theOpenSeesDomain->suspendRecorders(true);
+				double msg[2];
+				msg[0] = this->computePerturbed(indices(next), g, lsfExpression, msg[1]);
+				ssize_t nwritten = write(fd[1], msg, sizeof(msg));
+				close(fd[1]);
+				fflush(stdout);
+				fflush(stderr);
+				_exit(nwritten == (ssize_t)sizeof(msg) ? 0 : 1);
+			}
+
+			close(fd[1]);
+			struct pollfd pfd;
+			pfd.fd = fd[0];
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+			fds.push_back(pfd);
+			pids.push_back(pid);
+			slots.push_back(next);
+			next++;
+		}
+		if (res < 0)
+			next = num;
+		if (fds.empty())
+			break;
+
+		// wait for a worker to finish, it writes one message and exits
+		if (poll(&fds[0], fds.size(), -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			opserr << "ERROR FiniteDifferenceGradient -- failed to wait for worker processes" << endln;
+			res = -1;
+			for (size_t k = 0; k < fds.size(); k++)
+				fds[k].revents = POLLHUP;
+		}
+
+		for (int k = (int)fds.size() - 1; k >= 0; k--) {
+			if (fds[k].revents == 0)
+				continue;
+
+			double msg[2];
+			size_t nread = 0;
+			while (nread < sizeof(msg)) {
+				ssize_t n = read(fds[k].fd, (char *)msg + nread, sizeof(msg) - nread);
+				if (n < 0 && errno == EINTR)
+					continue;
+				if (n <= 0)
+					break;
+				nread += n;
+			}
+			close(fds[k].fd);
+
+			int status;
+			while (waitpid(pids[k], &status, 0) < 0 && errno == EINTR)
+				;
+
+			int j = slots[k];
+			if (nread < sizeof(msg) || msg[0] < 0) {
+				opserr << "ERROR FiniteDifferenceGradient -- perturbed analysis failed in worker process" << endln;
+				res = -1;
+			} else {
+				(*grad_g)(indices(j)) = msg[1];
+				done(j) = 1;
+			}
+
+			fds.erase(fds.begin() + k);
+			pids.erase(pids.begin() + k);
+			slots.erase(slots.begin() + k);
+		}
+	}
+
+	for (int j = 0; j < num; j++) {
+		if (done(j) == 0) {
+			res = -1;
+		} else {
+			// keep the evaluation count of the serial loop
+			theFunctionEvaluator->incrementEvaluations();
+		}
+	}
+	if (res < 0)
+		opserr << "ERROR FiniteDifferenceGradient -- error running perturbed analyses" << endln;
+
+	// the namespace still holds the values of the parent
+	theFunctionEvaluator->setExpression(lsfExpression);
+
+	return res;
+#endif
+}
@@ -40,6 +40,7 @@
 #include <ReliabilityDomain.h>
 #include <Domain.h>
 #include <FunctionEvaluator.h>
+#include <ID.h>
 
 class FiniteDifferenceGradient : public GradientEvaluator
 {
@@ -52,12 +53,23 @@ public:
 	
 	int		computeGradient(double gFunValue);
 	const Vector &getGradient();
+
+	// each perturbed analysis runs in a copy of the model forked for it,
+	// with its own interpreter and domain, numProcesses at a time (not on
+	// Windows)
+	void	setNumProcesses(int num);
 	
 protected:
 	
 private:
+	int		computePerturbed(int index, double g, const char *lsfExpression,
+					 double &result);
+	int		computePerturbedParallel(const ID &indices, double g,
+						 const char *lsfExpression);
+
 	Domain *theOpenSeesDomain;
 	Vector *grad_g;
+	int numProcesses;
 	
 };
 
@@ -3077,46 +3077,44 @@ TclReliabilityModelBuilder_addGradientEvaluator(ClientData clientData, Tcl_Inter
 			return TCL_ERROR;
 		}
 
-		// Possibly read perturbation factor
-		if (argc>2) {
-			int numExtras;
-			if (argc==3 || argc==4) {
-				numExtras = 1;
-			}
-			else if (argc==5) {
-				numExtras = 2;
-			}
-			else {
-				opserr << "ERROR: Wrong number of arguments to FiniteDifferenceGradient. " << endln;
-				return TCL_ERROR;
-			}
+		int numProcesses = 1;
 
-			int counter = 2;
+		// Possibly read perturbation factor and number of worker processes
+		int counter = 2;
+		while (counter < argc) {
 
-			for (int i=1; i<=numExtras; i++) {
+			if (strcmp(argv[counter],"-pert") == 0 && counter+1 < argc) {
+				counter ++;
 
-				if (strcmp(argv[counter],"-pert") == 0) {
-					counter ++;
-
-					if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
-						opserr << "ERROR: invalid input: perturbationFactor \n";
-						return TCL_ERROR;
-					}
-					counter++;
-				}
-				else if (strcmp(argv[counter],"-check") == 0) {
-					counter++;
-					doGradientCheck = true;
+				if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
+					opserr << "ERROR: invalid input: perturbationFactor \n";
+					return TCL_ERROR;
 				}
-				else {
-					opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				counter++;
+			}
+			else if (strcmp(argv[counter],"-check") == 0) {
+				counter++;
+				doGradientCheck = true;
+			}
+			else if (strcmp(argv[counter],"-numProcesses") == 0 && counter+1 < argc) {
+				counter++;
+
+				if (Tcl_GetInt(interp, argv[counter], &numProcesses) != TCL_OK) {
+					opserr << "ERROR: invalid input: numProcesses \n";
 					return TCL_ERROR;
 				}
+				counter++;
+			}
+			else {
+				opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				return TCL_ERROR;
 			}
 		}
 
-		theGradientEvaluator = new FiniteDifferenceGradient(theFunctionEvaluator, theReliabilityDomain, 
-								    theStructuralDomain);
+		FiniteDifferenceGradient *theFDGradient = new FiniteDifferenceGradient(theFunctionEvaluator,
+									theReliabilityDomain, theStructuralDomain);
+		theFDGradient->setNumProcesses(numProcesses);
+		theGradientEvaluator = theFDGradient;
 	}
 
 	else if (strcmp(argv[1],"OpenSees") == 0 || strcmp(argv[1],"Implicit") == 0) {
@@ -32,6 +32,7 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +56,9 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  static int profSolve = Profiler::getRegion("LinearSOE::numeric");
+  ProfilerScope theScope(profSolve);
+
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -67,6 +71,24 @@ LinearSOE::formAp(const Vector &p, Vector &Ap)
   return 0;
 }
 
+int
+LinearSOE::saveA(void)
+{
+  return -1;
+}
+
+int
+LinearSOE::restoreA(void)
+{
+  return -1;
+}
+
+void
+LinearSOE::clearSavedA(void)
+{
+
+}
+
 double
 LinearSOE::getDeterminant(void)
 {
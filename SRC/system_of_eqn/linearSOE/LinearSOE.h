@@ -74,6 +74,16 @@ class LinearSOE : public MovableObject
 
     virtual int formAp(const Vector &p, Vector &Ap);
 
+    // saveA() keeps a copy of the current A, restoreA() copies it back
+    // in place of zeroA(); used by the integrators to keep the assembled
+    // contribution of the linear elements between iterations. restoreA()
+    // fails if nothing has been saved since the last setSize() or
+    // clearSavedA(), both return -1 if the storage scheme does not
+    // support it.
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual void clearSavedA(void);
+
     virtual const Vector &getX(void) = 0;
     virtual const Vector &getB(void) = 0;    
     virtual const Matrix *getA(void) {return 0;};    
@@ -33,6 +33,7 @@
 #include <BandGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -146,21 +147,38 @@ BandGenLinSOE::setSize(Graph &theGraph)
     numSubD = 0;
     numSuperD = 0;
 
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0) {
+	// rows are sorted, first and last entries give the bandwidth
+	const int *rowStart = theCSR->getRowStart();
+	const int *adjacency = theCSR->getAdjacency();
+	for (int vertexNum=0; vertexNum<size; vertexNum++) {
+	    if (rowStart[vertexNum+1] == rowStart[vertexNum])
+		continue;
+	    int diff = vertexNum - adjacency[rowStart[vertexNum]];
+	    if (diff > numSuperD)
+		numSuperD = diff;
+	    diff = vertexNum - adjacency[rowStart[vertexNum+1]-1];
+	    if (diff < numSubD)
+		numSubD = diff;
+	}
+    } else {
+	Vertex *vertexPtr;
+	VertexIter &theVertices = theGraph.getVertices();
     
-    while ((vertexPtr = theVertices()) != 0) {
-	int vertexNum = vertexPtr->getTag();
-	const ID &theAdjacency = vertexPtr->getAdjacency();
-	for (int i=0; i<theAdjacency.Size(); i++) {
-	    int otherNum = theAdjacency(i);
-	    int diff = vertexNum - otherNum;
-	    if (diff > 0) {
-		if (diff > numSuperD)
-		    numSuperD = diff;
-	    } else 
-		if (diff < numSubD)
-		    numSubD = diff;
+	while ((vertexPtr = theVertices()) != 0) {
+	    int vertexNum = vertexPtr->getTag();
+	    const ID &theAdjacency = vertexPtr->getAdjacency();
+	    for (int i=0; i<theAdjacency.Size(); i++) {
+		int otherNum = theAdjacency(i);
+		int diff = vertexNum - otherNum;
+		if (diff > 0) {
+		    if (diff > numSuperD)
+			numSuperD = diff;
+		} else 
+		    if (diff < numSubD)
+			numSubD = diff;
+	    }
 	}
     }
     numSubD *= -1;
@@ -229,6 +247,8 @@ BandGenLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);
     }
     
+    Abase.clear();
+
     // invoke setSize() on the Solver
     LinearSOESolver *theSolvr = this->getSolver();
     int solverOK = theSolvr->setSize();
@@ -460,6 +480,35 @@ BandGenLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandGenLinSOE::saveA(void)
+{
+    Abase.assign(A, A+Asize);
+    return 0;
+}
+
+int
+BandGenLinSOE::restoreA(void)
+{
+    int theSize = Asize;
+    if (theSize == 0 || (int)Abase.size() != theSize)
+	return -1;
+
+    double *Aptr = A;
+    const double *basePtr = &Abase[0];
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = *basePtr++;
+
+    factored = false;
+    return 0;
+}
+
+void
+BandGenLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
 	
 void 
 BandGenLinSOE::zeroB(void)
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <vector>
 
 class BandGenLinSolver;
 
@@ -63,6 +64,9 @@ class BandGenLinSOE : public LinearSOE
 
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual void clearSavedA(void);
 
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
@@ -83,6 +87,7 @@ class BandGenLinSOE : public LinearSOE
     Vector *vectX;
     Vector *vectB;
     int Asize, Bsize;
+    std::vector<double> Abase;  // saved A, see saveA()
     bool factored;
     
   private:
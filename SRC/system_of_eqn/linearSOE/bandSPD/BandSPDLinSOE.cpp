@@ -34,6 +34,7 @@
 #include <BandSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 //#include <f2c.h>
@@ -154,18 +155,32 @@ BandSPDLinSOE::setSize(Graph &theGraph)
     size = theGraph.getNumVertex();
     half_band = 0;
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != 0) {
-	int vertexNum = vertexPtr->getTag();
-	const ID &theAdjacency = vertexPtr->getAdjacency();
-	for (int i=0; i<theAdjacency.Size(); i++) {
-	    int otherNum = theAdjacency(i);
-	    int diff = vertexNum-otherNum;
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0) {
+	// rows are sorted, the first entry gives the bandwidth
+	const int *rowStart = theCSR->getRowStart();
+	const int *adjacency = theCSR->getAdjacency();
+	for (int vertexNum=0; vertexNum<size; vertexNum++) {
+	    if (rowStart[vertexNum+1] == rowStart[vertexNum])
+		continue;
+	    int diff = vertexNum - adjacency[rowStart[vertexNum]];
 	    if (half_band < diff)
 		half_band = diff;
 	}
+    } else {
+	Vertex *vertexPtr;
+	VertexIter &theVertices = theGraph.getVertices();
+    
+	while ((vertexPtr = theVertices()) != 0) {
+	    int vertexNum = vertexPtr->getTag();
+	    const ID &theAdjacency = vertexPtr->getAdjacency();
+	    for (int i=0; i<theAdjacency.Size(); i++) {
+		int otherNum = theAdjacency(i);
+		int diff = vertexNum-otherNum;
+		if (half_band < diff)
+		    half_band = diff;
+	    }
+	}
     }
     half_band += 1; // include the diagonal
      
@@ -232,6 +247,8 @@ BandSPDLinSOE::setSize(Graph &theGraph)
 	    Bsize = size;
     }
     
+    Abase.clear();
+
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -414,6 +431,35 @@ BandSPDLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandSPDLinSOE::saveA(void)
+{
+    Abase.assign(A, A+Asize);
+    return 0;
+}
+
+int
+BandSPDLinSOE::restoreA(void)
+{
+    int theSize = Asize;
+    if (theSize == 0 || (int)Abase.size() != theSize)
+	return -1;
+
+    double *Aptr = A;
+    const double *basePtr = &Abase[0];
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = *basePtr++;
+
+    factored = false;
+    return 0;
+}
+
+void
+BandSPDLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
 	
 void 
 BandSPDLinSOE::zeroB(void)
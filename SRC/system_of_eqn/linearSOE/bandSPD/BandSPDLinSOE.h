@@ -39,6 +39,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <vector>
 
 class BandSPDLinSolver;
 
@@ -65,6 +66,9 @@ class BandSPDLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual void clearSavedA(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -87,6 +91,7 @@ class BandSPDLinSOE : public LinearSOE
     Vector *vectX;
     Vector *vectB;    
     int Asize, Bsize;
+    std::vector<double> Abase;  // saved A, see saveA()
     int aFactored;
     bool factored;
     
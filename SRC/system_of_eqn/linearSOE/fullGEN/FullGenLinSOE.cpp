@@ -202,6 +202,8 @@ FullGenLinSOE::setSize(Graph &theGraph)
 	matA = new Matrix(A,Bsize, Bsize);	
     }
 
+    Abase.clear();
+
     // invoke setSize() on the Solver    
     LinearSOESolver *theSolvr = this->getSolver();
     int solverOK = theSolvr->setSize();
@@ -379,6 +381,35 @@ FullGenLinSOE::zeroA(void)
 
     factored = false;
 }
+
+int
+FullGenLinSOE::saveA(void)
+{
+    Abase.assign(A, A+size*size);
+    return 0;
+}
+
+int
+FullGenLinSOE::restoreA(void)
+{
+    int theSize = size*size;
+    if (theSize == 0 || (int)Abase.size() != theSize)
+	return -1;
+
+    double *Aptr = A;
+    const double *basePtr = &Abase[0];
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = *basePtr++;
+
+    factored = false;
+    return 0;
+}
+
+void
+FullGenLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
 	
 void 
 FullGenLinSOE::zeroB(void)
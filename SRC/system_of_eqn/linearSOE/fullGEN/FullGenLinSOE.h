@@ -40,6 +40,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <vector>
 
 class FullGenLinSolver;
 
@@ -61,6 +62,9 @@ class FullGenLinSOE : public LinearSOE
     
     void zeroA(void);
     void zeroB(void);
+    int saveA(void);
+    int restoreA(void);
+    void clearSavedA(void);
     
     int formAp(const Vector &p, Vector &Ap);
 
@@ -89,6 +93,7 @@ class FullGenLinSOE : public LinearSOE
     Vector *vectB;    
     Matrix *matA;
     int Asize, Bsize;
+    std::vector<double> Abase;  // saved A, see saveA()
     bool factored;
 };
 
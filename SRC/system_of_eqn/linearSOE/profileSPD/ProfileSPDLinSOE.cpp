@@ -33,6 +33,7 @@
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -177,24 +178,38 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0) {
-	int vertexNum = vertexPtr->getTag();
-	const ID &theAdjacency = vertexPtr->getAdjacency();
-	int iiDiagLoc = iDiagLoc[vertexNum];
-	int *iiDiagLocPtr = &(iDiagLoc[vertexNum]);
-
-	for (int i=0; i<theAdjacency.Size(); i++) {
-	    int otherNum = theAdjacency(i);
-	    int diff = vertexNum-otherNum;
-	    if (diff > 0) {
-		if (iiDiagLoc < diff) {
-		    iiDiagLoc = diff;
-		    *iiDiagLocPtr = diff;
-		}
-	    } 
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0) {
+	// rows are sorted, the first entry gives the column height
+	const int *rowStart = theCSR->getRowStart();
+	const int *adjacency = theCSR->getAdjacency();
+	for (int vertexNum=0; vertexNum<size; vertexNum++) {
+	    if (rowStart[vertexNum+1] == rowStart[vertexNum])
+		continue;
+	    int diff = vertexNum - adjacency[rowStart[vertexNum]];
+	    if (diff > 0)
+		iDiagLoc[vertexNum] = diff;
+	}
+    } else {
+	Vertex *vertexPtr;
+	VertexIter &theVertices = theGraph.getVertices();
+
+	while ((vertexPtr = theVertices()) != 0) {
+	    int vertexNum = vertexPtr->getTag();
+	    const ID &theAdjacency = vertexPtr->getAdjacency();
+	    int iiDiagLoc = iDiagLoc[vertexNum];
+	    int *iiDiagLocPtr = &(iDiagLoc[vertexNum]);
+
+	    for (int i=0; i<theAdjacency.Size(); i++) {
+		int otherNum = theAdjacency(i);
+		int diff = vertexNum-otherNum;
+		if (diff > 0) {
+		    if (iiDiagLoc < diff) {
+			iiDiagLoc = diff;
+			*iiDiagLocPtr = diff;
+		    }
+		} 
+	    }
 	}
     }
 
@@ -278,6 +293,8 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
 	    Bsize = size;
     }
     
+    Abase.clear();
+
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -492,6 +509,35 @@ ProfileSPDLinSOE::zeroA(void)
     
     isAfactored = false;
 }
+
+int
+ProfileSPDLinSOE::saveA(void)
+{
+    Abase.assign(A, A+Asize);
+    return 0;
+}
+
+int
+ProfileSPDLinSOE::restoreA(void)
+{
+    int theSize = Asize;
+    if (theSize == 0 || (int)Abase.size() != theSize)
+	return -1;
+
+    double *Aptr = A;
+    const double *basePtr = &Abase[0];
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = *basePtr++;
+
+    isAfactored = false;
+    return 0;
+}
+
+void
+ProfileSPDLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
 	
 void 
 ProfileSPDLinSOE::zeroB(void)
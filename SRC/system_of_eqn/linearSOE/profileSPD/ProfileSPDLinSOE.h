@@ -37,6 +37,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <vector>
 class ProfileSPDLinSolver;
 
 class ProfileSPDLinSOE : public LinearSOE
@@ -59,6 +60,9 @@ class ProfileSPDLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual void clearSavedA(void);
 
     virtual void setX(int loc, double value);
     virtual void setX(const Vector &x);
@@ -86,6 +90,7 @@ class ProfileSPDLinSOE : public LinearSOE
     Vector *vectB;
     int *iDiagLoc;
     int Asize, Bsize;
+    std::vector<double> Abase;  // saved A, see saveA()
     bool isAfactored, isAcondensed;
     int numInt;
     
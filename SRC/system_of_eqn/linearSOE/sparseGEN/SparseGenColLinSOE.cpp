@@ -36,6 +36,7 @@
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -171,10 +172,15 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-	const ID &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0)
+	newNNZ = theCSR->getRowStart()[size] + size;
+    else {
+	VertexIter &theVertices = theGraph.getVertices();
+	while ((theVertex = theVertices()) != 0) {
+	    const ID &theAdjacency = theVertex->getAdjacency();
+	    newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+	}
     }
     nnz = newNNZ;
 
@@ -246,7 +252,26 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     }
 
     // fill in colStartA and rowA
-    if (size != 0) {
+    if (size != 0 && theCSR != 0) {
+      // rows of the CSRGraph are sorted, place the diag among them
+      const int *rowStart = theCSR->getRowStart();
+      const int *adjacency = theCSR->getAdjacency();
+      int lastLoc = 0;
+      colStartA[0] = 0;
+      for (int a=0; a<size; a++) {
+	bool diagPlaced = false;
+	for (int i=rowStart[a]; i<rowStart[a+1]; i++) {
+	  if (diagPlaced == false && adjacency[i] > a) {
+	    rowA[lastLoc++] = a;
+	    diagPlaced = true;
+	  }
+	  rowA[lastLoc++] = adjacency[i];
+	}
+	if (diagPlaced == false)
+	  rowA[lastLoc++] = a;
+	colStartA[a+1] = lastLoc;
+      }
+    } else if (size != 0) {
       colStartA[0] = 0;
       int startLoc = 0;
       int lastLoc = 0;
@@ -292,6 +317,8 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     }
 
     
+    Abase.clear();
+
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -439,6 +466,35 @@ SparseGenColLinSOE::zeroA(void)
 
     factored = false;
 }
+
+int
+SparseGenColLinSOE::saveA(void)
+{
+    Abase.assign(A, A+Asize);
+    return 0;
+}
+
+int
+SparseGenColLinSOE::restoreA(void)
+{
+    int theSize = Asize;
+    if (theSize == 0 || (int)Abase.size() != theSize)
+	return -1;
+
+    double *Aptr = A;
+    const double *basePtr = &Abase[0];
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = *basePtr++;
+
+    factored = false;
+    return 0;
+}
+
+void
+SparseGenColLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
 	
 void 
 SparseGenColLinSOE::zeroB(void)
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <vector>
 
 class SparseGenColLinSolver;
 
@@ -61,6 +62,9 @@ class SparseGenColLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual void clearSavedA(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -95,6 +99,7 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectX;
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
+    std::vector<double> Abase;  // saved A, see saveA()
     bool factored;
     
   private:
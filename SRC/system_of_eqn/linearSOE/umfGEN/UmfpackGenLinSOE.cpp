@@ -37,6 +37,7 @@
 #include <UmfpackGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -83,13 +84,20 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int nnz = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-	const ID &theAdjacency = theVertex->getAdjacency();
-	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
+    const CSRGraph *theCSR = theGraph.getCSR();
+    if (theCSR != 0)
+	nnz = theCSR->getRowStart()[size] + size;
+    else {
+	VertexIter &theVertices = theGraph.getVertices();
+	while ((theVertex = theVertices()) != 0) {
+	    const ID &theAdjacency = theVertex->getAdjacency();
+	    nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
+	}
     }
 
     // resize A, B, X
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
     Ax.resize(nnz,0.0);
@@ -100,38 +108,59 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 
     // fill in Ai and Ap
     Ap.push_back(0);
-    for (int a=0; a<size; a++) {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	    opserr << "WARNING:UmfpackGenLinSOE::setSize :";
-	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	    size = 0;
-	    return -1;
+    if (theCSR != 0) {
+	// rows of the CSRGraph are sorted, place the diagonal among them
+	const int *rowStart = theCSR->getRowStart();
+	const int *adjacency = theCSR->getAdjacency();
+	for (int a=0; a<size; a++) {
+	    bool diagPlaced = false;
+	    for (int i=rowStart[a]; i<rowStart[a+1]; i++) {
+		if (diagPlaced == false && adjacency[i] > a) {
+		    Ai.push_back(a);
+		    diagPlaced = true;
+		}
+		Ai.push_back(adjacency[i]);
+	    }
+	    if (diagPlaced == false)
+		Ai.push_back(a);
+	    Ap.push_back((int)Ai.size());
 	}
+    } else {
+	for (int a=0; a<size; a++) {
+
+	    theVertex = theGraph.getVertexPtr(a);
+	    if (theVertex == 0) {
+		opserr << "WARNING:UmfpackGenLinSOE::setSize :";
+		opserr << " vertex " << a << " not in graph! - size set to 0\n";
+		size = 0;
+		return -1;
+	    }
 
-	const ID &theAdjacency = theVertex->getAdjacency();
-	int idSize = theAdjacency.Size();
-	ID col(0,idSize+1);
+	    const ID &theAdjacency = theVertex->getAdjacency();
+	    int idSize = theAdjacency.Size();
+	    ID col(0,idSize+1);
 
-	// diagonal
-	col.insert(theVertex->getTag());
+	    // diagonal
+	    col.insert(theVertex->getTag());
 
-	// now we have to place the entries in the ID into order in Ai
-	for (int i=0; i<idSize; i++) {
-	    int row = theAdjacency(i);
-	    col.insert(row);
-	}
+	    // now we have to place the entries in the ID into order in Ai
+	    for (int i=0; i<idSize; i++) {
+		int row = theAdjacency(i);
+		col.insert(row);
+	    }
 
-	// copy to Ai
-	for (int i=0; i<col.Size(); i++) {
-	    Ai.push_back(col(i));
-	}
+	    // copy to Ai
+	    for (int i=0; i<col.Size(); i++) {
+		Ai.push_back(col(i));
+	    }
 
-	// set Ap
-	Ap.push_back(Ap[a]+col.Size());
+	    // set Ap
+	    Ap.push_back(Ap[a]+col.Size());
+	}
     }
 
+    Abase.clear();
+
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -282,6 +311,29 @@ UmfpackGenLinSOE::zeroA(void)
     Ax.assign(Ax.size(),0.0);
 }
 
+int
+UmfpackGenLinSOE::saveA(void)
+{
+    Abase = Ax;
+    return 0;
+}
+
+int
+UmfpackGenLinSOE::restoreA(void)
+{
+    if (Ax.empty() || Abase.size() != Ax.size())
+	return -1;
+
+    Ax = Abase;
+    return 0;
+}
+
+void
+UmfpackGenLinSOE::clearSavedA(void)
+{
+    Abase.clear();
+}
+
 void
 UmfpackGenLinSOE::zeroB(void)
 {
@@ -57,6 +57,9 @@ public:
     
     void zeroA(void);
     void zeroB(void);
+    int saveA(void);
+    int restoreA(void);
+    void clearSavedA(void);
     
     const Vector &getX(void);
     const Vector &getB(void);    
@@ -78,6 +81,7 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    std::vector<double> Abase;
 };
 
 
@@ -0,0 +1,264 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the implementation of the 
+// DenseMapOfTaggedObjects class.
+
+#include <TaggedObject.h>
+#include <DenseMapOfTaggedObjects.h>
+#include <OPS_Globals.h>
+#include <algorithm>
+
+#define DENSE_MAP_EMPTY   -1
+#define DENSE_MAP_REMOVED -2
+
+static inline unsigned int
+hashTag(int tag)
+{
+  // Knuth's multiplicative hash, spreads consecutive and strided tags
+  return (unsigned int)tag * 2654435761u;
+}
+
+struct DenseMapTagLess {
+  bool operator()(const TaggedObject *a, const TaggedObject *b) const {
+    return a->getTag() < b->getTag();
+  }
+};
+
+DenseMapOfTaggedObjects::DenseMapOfTaggedObjects(int initialSize)
+  :hashMask(0), numComponents(0), numHoles(0), numRemovedKeys(0),
+   maxTag(0), sorted(true), myIter(*this)
+{
+  if (initialSize < 16)
+    initialSize = 16;
+  theComponents.reserve(initialSize);
+  this->rehash(2*initialSize);
+}
+
+DenseMapOfTaggedObjects::~DenseMapOfTaggedObjects()
+{
+  this->clearAll();
+}
+
+int
+DenseMapOfTaggedObjects::setSize(int newSize)
+{
+  if (newSize < 0) {
+    opserr << "DenseMapOfTaggedObjects::setSize - invalid size " << newSize << endln;
+    return -1;
+  }
+
+  if (newSize > (int)theComponents.capacity())
+    theComponents.reserve(newSize);
+
+  if (2*newSize > hashMask+1)
+    this->rehash(2*newSize);
+
+  return 0;
+}
+
+int
+DenseMapOfTaggedObjects::findSlot(int tag) const
+{
+  unsigned int pos = hashTag(tag) & hashMask;
+  while (hashSlots[pos] != DENSE_MAP_EMPTY) {
+    if (hashSlots[pos] >= 0 && hashTags[pos] == tag)
+      return hashSlots[pos];
+    pos = (pos + 1) & hashMask;
+  }
+
+  return -1;
+}
+
+void
+DenseMapOfTaggedObjects::insertKey(int tag, int slot)
+{
+  unsigned int pos = hashTag(tag) & hashMask;
+  while (hashSlots[pos] >= 0)
+    pos = (pos + 1) & hashMask;
+
+  if (hashSlots[pos] == DENSE_MAP_REMOVED)
+    numRemovedKeys--;
+
+  hashTags[pos] = tag;
+  hashSlots[pos] = slot;
+}
+
+void
+DenseMapOfTaggedObjects::rehash(int minCapacity)
+{
+  int capacity = 16;
+  while (capacity < minCapacity)
+    capacity *= 2;
+
+  hashMask = capacity - 1;
+  hashTags.assign(capacity, 0);
+  hashSlots.assign(capacity, DENSE_MAP_EMPTY);
+  numRemovedKeys = 0;
+
+  for (size_t i = 0; i < theComponents.size(); i++)
+    if (theComponents[i] != 0)
+      this->insertKey(theComponents[i]->getTag(), (int)i);
+}
+
+void
+DenseMapOfTaggedObjects::compact(void)
+{
+  if (numHoles != 0) {
+    size_t last = 0;
+    for (size_t i = 0; i < theComponents.size(); i++)
+      if (theComponents[i] != 0)
+	theComponents[last++] = theComponents[i];
+    theComponents.resize(last);
+    numHoles = 0;
+  }
+
+  if (sorted == false) {
+    std::sort(theComponents.begin(), theComponents.end(), DenseMapTagLess());
+    sorted = true;
+  }
+
+  this->rehash(hashMask+1);
+}
+
+bool 
+DenseMapOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+  int tag = newComponent->getTag();
+
+  if (this->findSlot(tag) >= 0) {
+    opserr << "DenseMapOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
+      tag << "\n";
+    return false;
+  }
+
+  if (numComponents != 0 && tag < maxTag)
+    sorted = false;
+  if (numComponents == 0 || tag > maxTag)
+    maxTag = tag;
+
+  int slot = (int)theComponents.size();
+  theComponents.push_back(newComponent);
+  numComponents++;
+
+  // keep the table at most half full, counting removed keys
+  if (2*(numComponents + numRemovedKeys) > hashMask+1)
+    this->rehash(4*numComponents);
+  else
+    this->insertKey(tag, slot);
+
+  return true;
+}
+
+TaggedObject *
+DenseMapOfTaggedObjects::removeComponent(int tag)
+{
+  unsigned int pos = hashTag(tag) & hashMask;
+  while (hashSlots[pos] != DENSE_MAP_EMPTY) {
+    if (hashSlots[pos] >= 0 && hashTags[pos] == tag)
+      break;
+    pos = (pos + 1) & hashMask;
+  }
+  if (hashSlots[pos] == DENSE_MAP_EMPTY)
+    return 0;
+
+  int slot = hashSlots[pos];
+  hashSlots[pos] = DENSE_MAP_REMOVED;
+  numRemovedKeys++;
+
+  TaggedObject *removed = theComponents[slot];
+  numComponents--;
+
+  // the array is compacted lazily, except for the last entry
+  if (slot == (int)theComponents.size() - 1)
+    theComponents.pop_back();
+  else {
+    theComponents[slot] = 0;
+    numHoles++;
+  }
+
+  return removed;
+}
+
+int
+DenseMapOfTaggedObjects::getNumComponents(void) const
+{
+  return numComponents;
+}
+
+TaggedObject *
+DenseMapOfTaggedObjects::getComponentPtr(int tag)
+{
+  int slot = this->findSlot(tag);
+  if (slot < 0)
+    return 0;
+
+  return theComponents[slot];
+}
+
+TaggedObjectIter &
+DenseMapOfTaggedObjects::getComponents()
+{
+  if (numHoles != 0 || sorted == false)
+    this->compact();
+
+  myIter.reset();
+  return myIter;
+}
+
+TaggedObjectStorage *
+DenseMapOfTaggedObjects::getEmptyCopy(void)
+{
+  DenseMapOfTaggedObjects *theCopy = new DenseMapOfTaggedObjects();
+
+  if (theCopy == 0) {
+    opserr << "DenseMapOfTaggedObjects::getEmptyCopy-out of memory\n";
+  }	
+
+  return theCopy;
+}
+
+void
+DenseMapOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+  // invoke the destructor on all the tagged objects stored
+  if (invokeDestructor == true) {
+    for (size_t i = 0; i < theComponents.size(); i++)
+      if (theComponents[i] != 0)
+	delete theComponents[i];
+  }
+
+  theComponents.clear();
+  numComponents = 0;
+  numHoles = 0;
+  maxTag = 0;
+  sorted = true;
+  this->rehash(hashMask+1);
+}
+
+void
+DenseMapOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+  // go through the array invoking Print on non-zero entries
+  TaggedObjectIter &theObjects = this->getComponents();
+  TaggedObject *theObject;
+  while ((theObject = theObjects()) != 0)
+    theObject->Print(s, flag);
+}
@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef DenseMapOfTaggedObjects_h
+#define DenseMapOfTaggedObjects_h
+
+// Description: This file contains the class definition for 
+// DenseMapOfTaggedObjects. DenseMapOfTaggedObjects is a storage class
+// that keeps the pointers to the TaggedObjects in one contiguous array
+// and finds them by tag through an open addressing hash table, so that
+// lookup is O(1) whatever the tag numbering and iteration is a walk
+// over the array. Iteration is in increasing tag order, as with
+// MapOfTaggedObjects; components added out of order and holes left by
+// removed components are sorted/compacted once at the next iteration.
+
+#include <TaggedObjectStorage.h>
+#include <DenseMapOfTaggedObjectsIter.h>
+#include <vector>
+
+class DenseMapOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    DenseMapOfTaggedObjects(int initialSize = 64);
+    ~DenseMapOfTaggedObjects();    
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);    
+    int getNumComponents(void) const;
+    
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+    
+    void Print(OPS_Stream &s, int flag =0);
+    friend class DenseMapOfTaggedObjectsIter;
+    
+  protected:    
+    
+  private:
+    int findSlot(int tag) const;          // position in theComponents or -1
+    void insertKey(int tag, int slot);
+    void rehash(int minCapacity);
+    void compact(void);
+
+    std::vector<TaggedObject *> theComponents; // contiguous storage, 0 for holes
+    std::vector<int> hashTags;                 // hash table keys
+    std::vector<int> hashSlots;                // hash table values, -1 empty, -2 removed
+    int hashMask;
+    int numComponents;
+    int numHoles;
+    int numRemovedKeys;
+    int maxTag;
+    bool sorted;                               // components in increasing tag order
+    DenseMapOfTaggedObjectsIter myIter;        // the iter for this object
+};
+
+#endif
@@ -0,0 +1,57 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the implementation of 
+// DenseMapOfTaggedObjectsIter.
+
+#include <DenseMapOfTaggedObjectsIter.h>
+#include <DenseMapOfTaggedObjects.h>
+
+DenseMapOfTaggedObjectsIter::DenseMapOfTaggedObjectsIter(DenseMapOfTaggedObjects &theStorage)
+  :theComponents(&(theStorage.theComponents)), currentComponent(0)
+{
+
+}
+
+
+DenseMapOfTaggedObjectsIter::~DenseMapOfTaggedObjectsIter()
+{
+
+}    
+
+void
+DenseMapOfTaggedObjectsIter::reset(void)
+{
+    currentComponent = 0;
+}
+
+TaggedObject *
+DenseMapOfTaggedObjectsIter::operator()(void)
+{
+    // skip the holes left by components removed since the last reset
+    size_t size = theComponents->size();
+    while (currentComponent < size) {
+	TaggedObject *result = (*theComponents)[currentComponent++];
+	if (result != 0)
+	    return result;
+    }
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef DenseMapOfTaggedObjectsIter_h
+#define DenseMapOfTaggedObjectsIter_h
+
+// Description: This file contains the class definition for 
+// DenseMapOfTaggedObjectsIter. A DenseMapOfTaggedObjectsIter is an iter
+// for returning the TaggedObjects of a storage object of type 
+// DenseMapOfTaggedObjects; it is a plain walk over the contiguous array.
+
+#include <TaggedObjectIter.h>
+#include <vector>
+#include <stddef.h>
+
+class DenseMapOfTaggedObjects;
+
+class DenseMapOfTaggedObjectsIter: public TaggedObjectIter
+{
+  public:
+    DenseMapOfTaggedObjectsIter(DenseMapOfTaggedObjects &theComponents);
+    virtual ~DenseMapOfTaggedObjectsIter();
+    
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+    
+  private:
+    std::vector<TaggedObject *> *theComponents;
+    size_t currentComponent;
+};
+
+#endif
@@ -74,26 +74,17 @@ MapOfTaggedObjects::setSize(int newSize)
 bool 
 MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
 {
-    MAP_TAGGED_ITERATOR theEle;
     int tag = newComponent->getTag();
 
-    // check if the ele already in map, if not we add
-    theEle = theMap.find(tag);
-    if (theEle == theMap.end()) {
-	theMap.insert(MAP_TAGGED_TYPE(tag,newComponent));
-		      
-	// check if sucessfully added 
-	theEle = theMap.find(tag);
-	if (theEle == theMap.end()) {
-	  opserr << "MapOfTaggedObjects::addComponent - map STL failed to add object with tag : " << 
-	    newComponent->getTag() << "\n";
-	  return false;
-	}
-    }
-    
+    // components are usually added in increasing tag order, so insert with
+    // a hint at the end; if the tag is already in the map the iterator
+    // returned points to the existing component
+    MAP_TAGGED_ITERATOR theEle = 
+      theMap.insert(theMap.end(), MAP_TAGGED_TYPE(tag,newComponent));
+
     // if ele already there map cannot add even if allowMultiple is true
     // as the map template does not allow multiple entries wih the same tag
-    else {	
+    if ((*theEle).second != newComponent) {
       opserr << "MapOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
 	newComponent->getTag() << "\n";
       return false;
@@ -84,6 +84,10 @@ OPS_Stream *opserrPtr = &sserr;
 #include <FEM_ObjectBrokerAllClasses.h>
 
 #include <Timer.h>
+#include <Profiler.h>
+#include <UniaxialMaterialBatch.h>
+#include <fstream>
+#include <sstream>
 #include <ModelBuilder.h>
 #include "commands.h"
 
@@ -98,6 +102,8 @@ OPS_Stream *opserrPtr = &sserr;
 #include <Element.h>
 #include <Node.h>
 #include <ElementIter.h>
+#include <vector>
+#include <algorithm>
 #include <NodeIter.h>
 #include <LoadPattern.h>
 #include <LoadPatternIter.h>
@@ -178,6 +184,9 @@ OPS_Stream *opserrPtr = &sserr;
 
 extern void *OPS_NewtonRaphsonAlgorithm(void);
 
+extern void *OPS_ModalSuperpositionAnalysis(void);
+extern void *OPS_GroundMotionBatch(void);
+
 extern void *OPS_Newmark(void);
 extern void *OPS_AlphaOS(void);
 extern void *OPS_AlphaOS_TP(void);
@@ -226,6 +235,9 @@ extern void *OPS_WilsonTheta(void);
 #include <DirectIntegrationAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
 #include <PFEMAnalysis.h>
+#include <ModalSuperpositionAnalysis.h>
+#include <GroundMotionBatch.h>
+#include <RecordFileReader.h>
 
 // system of eqn and solvers
 #include <BandSPDLinSOE.h>
@@ -518,6 +530,7 @@ EigenSOE *theEigenSOE =0;
 StaticAnalysis *theStaticAnalysis = 0;
 DirectIntegrationAnalysis *theTransientAnalysis = 0;
 VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis = 0;
+static ModalSuperpositionAnalysis *theModalAnalysis = 0;
 int numEigen = 0;
 
 #define _PFEM
@@ -619,6 +632,21 @@ opsBarrier(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+materialBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+recorderThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+groundMotionBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+recordCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+linearCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 record(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -896,6 +924,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "eleResponse", &eleResponse, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "iterationStats", &iterationStats, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "nodeDisp", &nodeDisp, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "setNodeDisp", &setNodeDisp, 
@@ -975,6 +1005,16 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 
     Tcl_CreateCommand(interp, "domainChange",  &domainChange,(ClientData)NULL, NULL);
 
+    Tcl_CreateCommand(interp, "materialBatch",  &materialBatch,(ClientData)NULL, NULL);
+
+    Tcl_CreateCommand(interp, "recorderThreads",  &recorderThreads,(ClientData)NULL, NULL);
+
+    Tcl_CreateCommand(interp, "groundMotionBatch",  &groundMotionBatch,(ClientData)NULL, NULL);
+
+    Tcl_CreateCommand(interp, "recordCache",  &recordCache,(ClientData)NULL, NULL);
+
+    Tcl_CreateCommand(interp, "linearCache",  &linearCache,(ClientData)NULL, NULL);
+
     Tcl_CreateCommand(interp, "record",  &record,(ClientData)NULL, NULL);
 
     Tcl_CreateCommand(interp, "metaData",  &neesMetaData,(ClientData)NULL, NULL);
@@ -1025,6 +1065,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "numFact", &numFact, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "analysisProfile", &analysisProfile, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "numIter", &numIter, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "systemSize", &systemSize, 
@@ -1392,6 +1434,11 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   theTransientAnalysis =0;    
   theVariableTimeStepTransientAnalysis =0;    
 
+  if (theModalAnalysis != 0) {
+      delete theModalAnalysis;
+      theModalAnalysis = 0;
+  }
+
   theTest = 0;
   theDatabase = 0;
 
@@ -1432,6 +1479,9 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
       delete theTransientAnalysis;  
   }
 
+  if (theModalAnalysis != 0)
+      delete theModalAnalysis;
+
   // NOTE : DON'T do the above on theVariableTimeStepAnalysis
   // as it and theTansientAnalysis are one in the same
 
@@ -1446,6 +1496,7 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   theStaticAnalysis =0;
   theTransientAnalysis =0;    
   theVariableTimeStepTransientAnalysis =0;   
+  theModalAnalysis = 0;
   //  theSensitivityAlgorithm=0; 
 #ifdef _PFEM
   thePFEMAnalysis = 0;
@@ -1784,6 +1835,23 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   } else if(thePFEMAnalysis != 0) {
       result = thePFEMAnalysis->analyze();
 #endif
+  } else if (theModalAnalysis != 0) {
+    if (argc < 3) {
+      opserr << "WARNING modal superposition analysis: analysis numIncr? deltaT?\n";
+      return TCL_ERROR;
+    }
+    int numIncr;
+    if (Tcl_GetInt(interp, argv[1], &numIncr) != TCL_OK)	
+      return TCL_ERROR;
+    double dT;
+    if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)	
+      return TCL_ERROR;
+
+    // Set global timestep variable
+    ops_Dt = dT;
+
+    result = theModalAnalysis->analyze(numIncr, dT);
+
   } else if (theTransientAnalysis != 0) {
     if (argc < 3) {
       opserr << "WARNING transient analysis: analysis numIncr? deltaT?\n";
@@ -2234,6 +2302,10 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	theTransientAnalysis = 0;
 	theVariableTimeStepTransientAnalysis = 0;
     }
+    if (theModalAnalysis != 0) {
+	delete theModalAnalysis;
+	theModalAnalysis = 0;
+    }
     
     // check argv[1] for type of SOE and create it
     if (strcmp(argv[1],"Static") == 0) {
@@ -2499,6 +2571,28 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	// set the pointer for variabble time step analysis
 	theTransientAnalysis = theVariableTimeStepTransientAnalysis;
 
+    } else if ((strcmp(argv[1],"ModalSuperposition") == 0) ||
+	       (strcmp(argv[1],"Modal") == 0)) {
+
+	OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);
+	theModalAnalysis = (ModalSuperpositionAnalysis *)OPS_ModalSuperpositionAnalysis();
+	if (theModalAnalysis == 0)
+	    return TCL_ERROR;
+
+	// run the eigen analysis giving the modes if not yet done
+	int numModes = theModalAnalysis->getNumModes();
+	if (theDomain.getEigenvalues().Size() < numModes) {
+	    char buffer[20];
+	    sprintf(buffer, "%d", numModes);
+	    TCL_Char *eigenArgv[2] = {"eigen", buffer};
+	    if (eigenAnalysis(clientData, interp, 2, eigenArgv) != TCL_OK) {
+		opserr << "WARNING analysis ModalSuperposition - eigen analysis failed\n";
+		delete theModalAnalysis;
+		theModalAnalysis = 0;
+		return TCL_ERROR;
+	    }
+	}
+
 	#ifdef _RELIABILITY
 
 	//////////////////////////////////
@@ -6235,6 +6329,72 @@ eleResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv
 
 
 
+int 
+iterationStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // iterationStats <-top $n>
+  //   sum of the element local iteration statistics: numElements numUpdates
+  //   numLocalIters numSubdivides numFailures, or with -top for the $n
+  //   elements with the most local iterations: eleTag numUpdates ...
+  int numTop = -1;
+  if (argc > 1) {
+    if (argc < 3 || strcmp(argv[1], "-top") != 0 ||
+	Tcl_GetInt(interp, argv[2], &numTop) != TCL_OK) {
+      opserr << "WARNING iterationStats <-top $n>\n";
+      return TCL_ERROR;
+    }
+  }
+
+  std::vector<int> stats;
+  TCL_Char *eleArgv[1] = {"iterationStats"};
+  Element *theEle;
+  ElementIter &theEles = theDomain.getElements();
+  while ((theEle = theEles()) != 0) {
+    // only the force-based elements record them
+    int classTag = theEle->getClassTag();
+    if (classTag != ELE_TAG_ForceBeamColumn2d &&
+	classTag != ELE_TAG_ForceBeamColumn3d)
+      continue;
+    int tag = theEle->getTag();
+    const Vector *data = theDomain.getElementResponse(tag, eleArgv, 1);
+    if (data != 0 && data->Size() == 4) {
+      stats.push_back(tag);
+      for (int j=0; j<4; j++)
+	stats.push_back((int)(*data)(j));
+    }
+  }
+  int numEle = (int)stats.size()/5;
+
+  std::vector<int> result;
+  if (numTop < 0) {
+    result.assign(5, 0);
+    result[0] = numEle;
+    for (int i=0; i<numEle; i++)
+      for (int j=1; j<5; j++)
+	result[j] += stats[5*i+j];
+  } else {
+    std::vector<std::pair<int,int> > order(numEle);
+    for (int i=0; i<numEle; i++)
+      order[i] = std::make_pair(-stats[5*i+2], i);
+    if (numTop > numEle)
+      numTop = numEle;
+    std::partial_sort(order.begin(), order.begin()+numTop, order.end());
+    for (int i=0; i<numTop; i++)
+      for (int j=0; j<5; j++)
+	result.push_back(stats[5*order[i].second+j]);
+  }
+
+  char buffer[40];
+  for (int i=0; i<(int)result.size(); i++) {
+    sprintf(buffer, "%d ", result[i]);
+    Tcl_AppendResult(interp, buffer, NULL);
+  }
+
+  return TCL_OK;
+}
+
+
+
 int 
 findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -7989,6 +8149,7 @@ setElementRayleighDampingFactors(ClientData clientData,
 
   Element *theEle = theDomain.getElement(eleTag);
   theEle->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+  theDomain.propertiesChanged();
   return TCL_OK;
 }
 
@@ -8842,6 +9003,150 @@ int domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char *
 }
 
 
+int materialBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // materialBatch <on|off>, returns the number of batched materials
+  if (argc > 1) {
+    if (strcmp(argv[1], "on") == 0)
+      theDomain.setMaterialBatch(true);
+    else if (strcmp(argv[1], "off") == 0)
+      theDomain.setMaterialBatch(false);
+    else {
+      opserr << "WARNING materialBatch <on|off>\n";
+      return TCL_ERROR;
+    }
+  }
+
+  int numMat = 0;
+  UniaxialMaterialBatch *theBatch = theDomain.getMaterialBatch();
+  if (theBatch != 0)
+    numMat = theBatch->getNumMaterials();
+
+  char buffer[20];
+  sprintf(buffer, "%d", numMat);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+
+int recorderThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // recorderThreads <numThreads>, returns the number of threads
+  if (argc > 1) {
+    int numThreads;
+    if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+      opserr << "WARNING recorderThreads <numThreads>\n";
+      return TCL_ERROR;
+    }
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+    // the recorder streams of a parallel model communicate when written
+    if (numThreads > 0) {
+      opserr << "WARNING recorderThreads is not available in a parallel model, ignored\n";
+      numThreads = 0;
+    }
+#endif
+    theDomain.setRecorderThreads(numThreads);
+  }
+
+  char buffer[20];
+  sprintf(buffer, "%d", theDomain.getRecorderThreads());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+
+int groundMotionBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // groundMotionBatch dof dT -accel seriesTags ..., returns a list with
+  // the status and peaks of every run
+  TransientAnalysis *theAnalysis = theTransientAnalysis;
+  TransientIntegrator *theIntegrator = theTransientIntegrator;
+  if (theAnalysis == 0) {
+    theAnalysis = theModalAnalysis;
+    theIntegrator = 0;
+  }
+  if (theAnalysis == 0) {
+    opserr << "WARNING groundMotionBatch - no transient analysis has been defined\n";
+    return TCL_ERROR;
+  }
+
+  OPS_ResetInput(clientData, interp, 1, argc, argv, &theDomain, NULL);
+  GroundMotionBatch *theBatch = (GroundMotionBatch *)OPS_GroundMotionBatch();
+  if (theBatch == 0)
+    return TCL_ERROR;
+
+  // failed runs are reported by their status
+  theBatch->run(*theAnalysis, theIntegrator);
+
+  const Matrix &results = theBatch->getResults();
+  char buffer[40];
+  for (int i=0; i<results.noRows(); i++) {
+    Tcl_AppendResult(interp, "{", NULL);
+    for (int j=0; j<results.noCols(); j++) {
+      sprintf(buffer, (j == 0) ? "%g" : " %.12g", results(i,j));
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+    Tcl_AppendResult(interp, "} ", NULL);
+  }
+  delete theBatch;
+
+  return TCL_OK;
+}
+
+
+int recordCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // recordCache <dirName|off>, returns the cache directory
+  if (argc > 1) {
+    const char *dirName = argv[1];
+    if (strcmp(dirName, "off") == 0)
+      dirName = 0;
+    OPS_SetRecordCache(dirName);
+  }
+
+  Tcl_SetResult(interp, (char *)OPS_GetRecordCache(), TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+
+int linearCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // linearCache <on|off>, returns 1 if the cache is on
+  if (argc > 1) {
+    bool onOff = false;
+    if (strcmp(argv[1], "on") == 0)
+      onOff = true;
+    else if (strcmp(argv[1], "off") != 0) {
+      opserr << "WARNING linearCache <on|off>\n";
+      return TCL_ERROR;
+    }
+    if (theStaticIntegrator == 0 && theTransientIntegrator == 0) {
+      opserr << "WARNING linearCache - no integrator has been defined\n";
+      return TCL_ERROR;
+    }
+    if (theStaticIntegrator != 0)
+      theStaticIntegrator->setLinearCache(onOff);
+    if (theTransientIntegrator != 0)
+      theTransientIntegrator->setLinearCache(onOff);
+  }
+
+  int res = 0;
+  if (theStaticIntegrator != 0 && theStaticIntegrator->getLinearCache() == true)
+    res = 1;
+  if (theTransientIntegrator != 0 && theTransientIntegrator->getLinearCache() == true)
+    res = 1;
+
+  char buffer[20];
+  sprintf(buffer, "%d", res);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+
 int record(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   theDomain.record(false);
@@ -9006,6 +9311,66 @@ numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+int
+analysisProfile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // analysisProfile <on|off|reset> <-calls> <-json> <-file $fileName>
+  bool calls = false;
+  bool json = false;
+  const char *fileName = 0;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "on") == 0) {
+      Profiler::setEnabled(true);
+      return TCL_OK;
+    } else if (strcmp(argv[i], "off") == 0) {
+      Profiler::setEnabled(false);
+      return TCL_OK;
+    } else if (strcmp(argv[i], "reset") == 0) {
+      Profiler::reset();
+      return TCL_OK;
+    } else if (strcmp(argv[i], "-calls") == 0) {
+      calls = true;
+    } else if (strcmp(argv[i], "-json") == 0) {
+      json = true;
+    } else if (strcmp(argv[i], "-file") == 0 && i+1 < argc) {
+      fileName = argv[++i];
+    } else {
+      opserr << "WARNING analysisProfile <on|off|reset> <-calls> <-json> <-file $fileName>\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (fileName != 0) {
+    std::ofstream theFile(fileName);
+    if (!theFile) {
+      opserr << "WARNING analysisProfile - could not open file " << fileName << endln;
+      return TCL_ERROR;
+    }
+    Profiler::writeJSON(theFile);
+    return TCL_OK;
+  }
+
+  if (json == true) {
+    std::ostringstream s;
+    Profiler::writeJSON(s);
+    Tcl_SetResult(interp, (char *)s.str().c_str(), TCL_VOLATILE);
+    return TCL_OK;
+  }
+
+  std::vector<std::string> paths;
+  std::vector<double> seconds, numCalls;
+  Profiler::getTotals(paths, seconds, numCalls);
+
+  Tcl_Obj *dict = Tcl_NewDictObj();
+  for (int i=0; i<(int)paths.size(); i++)
+    Tcl_DictObjPut(interp, dict, Tcl_NewStringObj(paths[i].c_str(), -1),
+		   Tcl_NewDoubleObj(calls ? numCalls[i] : seconds[i]));
+  Tcl_SetObjResult(interp, dict);
+
+  return TCL_OK;
+}
+
 int
 systemSize(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -135,6 +135,9 @@ eleDynamicalForce(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
 int 
 eleResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+iterationStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 
 int
 findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
@@ -302,6 +305,9 @@ accelCPU(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+analysisProfile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 numIter(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -0,0 +1,311 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of Profiler.
+
+#include <Profiler.h>
+#include <MovableObject.h>
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+// one node of the call tree, node 0 is the root
+struct ProfilerNode {
+  int region;
+  int parent;
+  int child;      // first child
+  int sibling;    // next sibling
+  double total;
+  double calls;
+  double startTime;
+};
+
+// accumulated time of one element class
+struct ProfilerElementClass {
+  std::string name;
+  double total[Profiler::NumElementPhases];
+  double calls[Profiler::NumElementPhases];
+};
+
+static const char *elementPhaseNames[] = {"update", "tangent", "residual"};
+
+bool Profiler::enabled = false;
+
+// region names are constructed on first use as getRegion() is invoked
+// from static locals which may be initialised in any order
+static std::vector<std::string> &
+profilerRegionNames(void)
+{
+  static std::vector<std::string> names;
+  return names;
+}
+
+static std::vector<ProfilerNode> profilerNodes;
+static int profilerCurrent = 0;
+static std::vector<ProfilerElementClass> profilerElements;
+
+static void
+profilerInitialize(void)
+{
+  if (profilerNodes.empty()) {
+    ProfilerNode root = {-1, -1, -1, -1, 0.0, 0.0, 0.0};
+    profilerNodes.push_back(root);
+    profilerCurrent = 0;
+  }
+}
+
+void
+Profiler::setEnabled(bool onOff)
+{
+  profilerInitialize();
+  enabled = onOff;
+}
+
+void
+Profiler::reset(void)
+{
+  // the tree is kept as scopes may be active, only the totals are zeroed
+  for (size_t i=0; i<profilerNodes.size(); i++) {
+    profilerNodes[i].total = 0.0;
+    profilerNodes[i].calls = 0.0;
+  }
+  for (size_t i=0; i<profilerElements.size(); i++)
+    for (int j=0; j<NumElementPhases; j++) {
+      profilerElements[i].total[j] = 0.0;
+      profilerElements[i].calls[j] = 0.0;
+    }
+}
+
+int
+Profiler::getRegion(const char *name)
+{
+  std::vector<std::string> &names = profilerRegionNames();
+  for (size_t i=0; i<names.size(); i++)
+    if (names[i] == name)
+      return (int)i;
+
+  names.push_back(name);
+  return (int)names.size()-1;
+}
+
+void
+Profiler::start(int region)
+{
+  profilerInitialize();
+
+  // find the child of the current node for the region, the number of
+  // children is small so a linear search is fine
+  int node = profilerNodes[profilerCurrent].child;
+  int last = -1;
+  while (node != -1 && profilerNodes[node].region != region) {
+    last = node;
+    node = profilerNodes[node].sibling;
+  }
+
+  if (node == -1) {
+    ProfilerNode newNode = {region, profilerCurrent, -1, -1, 0.0, 0.0, 0.0};
+    profilerNodes.push_back(newNode);
+    node = (int)profilerNodes.size()-1;
+    if (last == -1)
+      profilerNodes[profilerCurrent].child = node;
+    else
+      profilerNodes[last].sibling = node;
+  }
+
+  profilerCurrent = node;
+  profilerNodes[node].startTime = now();
+}
+
+void
+Profiler::stop(void)
+{
+  if (profilerCurrent <= 0)
+    return;
+
+  ProfilerNode &theNode = profilerNodes[profilerCurrent];
+  theNode.total += now() - theNode.startTime;
+  theNode.calls += 1.0;
+  profilerCurrent = theNode.parent;
+}
+
+double
+Profiler::now(void)
+{
+#ifdef _WIN32
+  static LARGE_INTEGER frequency = {0};
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER count;
+  QueryPerformanceCounter(&count);
+  return (double)count.QuadPart/(double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1.0e-9*ts.tv_nsec;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + 1.0e-6*tv.tv_usec;
+#endif
+}
+
+void
+Profiler::addElementTime(int phase, const MovableObject *theObject,
+			 double seconds)
+{
+  int classTag = theObject->getClassTag();
+  if (classTag < 0 || phase < 0 || phase >= NumElementPhases)
+    return;
+
+  if (classTag >= (int)profilerElements.size()) {
+    ProfilerElementClass empty;
+    for (int j=0; j<NumElementPhases; j++) {
+      empty.total[j] = 0.0;
+      empty.calls[j] = 0.0;
+    }
+    profilerElements.resize(classTag+1, empty);
+  }
+
+  ProfilerElementClass &theClass = profilerElements[classTag];
+  if (theClass.name.empty()) {
+    const char *type = theObject->getClassType();
+    if (type != 0 && strcmp(type, "UnknownMovableObject") != 0)
+      theClass.name = type;
+    else {
+      char buffer[32];
+      sprintf(buffer, "classTag%d", classTag);
+      theClass.name = buffer;
+    }
+  }
+
+  theClass.total[phase] += seconds;
+  theClass.calls[phase] += 1.0;
+}
+
+int
+Profiler::getTotals(std::vector<std::string> &paths,
+		    std::vector<double> &seconds,
+		    std::vector<double> &calls)
+{
+  paths.clear();
+  seconds.clear();
+  calls.clear();
+
+  // nodes are created after their parents so a single pass builds the paths
+  std::vector<std::string> &names = profilerRegionNames();
+  std::vector<std::string> nodePaths(profilerNodes.size());
+  for (size_t i=1; i<profilerNodes.size(); i++) {
+    const ProfilerNode &theNode = profilerNodes[i];
+    if (theNode.parent > 0)
+      nodePaths[i] = nodePaths[theNode.parent] + "/" + names[theNode.region];
+    else
+      nodePaths[i] = names[theNode.region];
+
+    if (theNode.calls > 0.0) {
+      paths.push_back(nodePaths[i]);
+      seconds.push_back(theNode.total);
+      calls.push_back(theNode.calls);
+    }
+  }
+
+  for (size_t i=0; i<profilerElements.size(); i++) {
+    const ProfilerElementClass &theClass = profilerElements[i];
+    for (int j=0; j<NumElementPhases; j++)
+      if (theClass.calls[j] > 0.0) {
+	paths.push_back("element/" + theClass.name + "/" + elementPhaseNames[j]);
+	seconds.push_back(theClass.total[j]);
+	calls.push_back(theClass.calls[j]);
+      }
+  }
+
+  return (int)paths.size();
+}
+
+void
+Profiler::writeNodeJSON(std::ostream &s, int node, int indent)
+{
+  std::string pad(indent, ' ');
+  const ProfilerNode &theNode = profilerNodes[node];
+
+  // self time is the time not spent in any child region
+  double childTotal = 0.0;
+  for (int child = theNode.child; child != -1; child = profilerNodes[child].sibling)
+    childTotal += profilerNodes[child].total;
+
+  s << pad << "{\"name\": \"" << profilerRegionNames()[theNode.region] << "\", "
+    << "\"calls\": " << theNode.calls << ", "
+    << "\"total\": " << theNode.total << ", "
+    << "\"self\": " << theNode.total - childTotal;
+
+  if (theNode.child != -1) {
+    s << ",\n" << pad << " \"children\": [\n";
+    for (int child = theNode.child; child != -1; child = profilerNodes[child].sibling) {
+      writeNodeJSON(s, child, indent+2);
+      if (profilerNodes[child].sibling != -1)
+	s << ",";
+      s << "\n";
+    }
+    s << pad << " ]";
+  }
+  s << "}";
+}
+
+void
+Profiler::writeJSON(std::ostream &s)
+{
+  profilerInitialize();
+
+  std::streamsize oldPrecision = s.precision(12);
+
+  s << "{\n \"enabled\": " << (enabled ? "true" : "false") << ",\n";
+
+  s << " \"regions\": [\n";
+  for (int child = profilerNodes[0].child; child != -1; child = profilerNodes[child].sibling) {
+    writeNodeJSON(s, child, 2);
+    if (profilerNodes[child].sibling != -1)
+      s << ",";
+    s << "\n";
+  }
+  s << " ],\n";
+
+  s << " \"elements\": [";
+  bool first = true;
+  for (size_t i=0; i<profilerElements.size(); i++) {
+    const ProfilerElementClass &theClass = profilerElements[i];
+    if (theClass.name.empty())
+      continue;
+    s << (first ? "\n" : ",\n");
+    first = false;
+    s << "  {\"class\": \"" << theClass.name << "\", \"classTag\": " << i;
+    for (int j=0; j<NumElementPhases; j++)
+      s << ", \"" << elementPhaseNames[j] << "\": {\"calls\": "
+	<< theClass.calls[j] << ", \"total\": " << theClass.total[j] << "}";
+    s << "}";
+  }
+  s << "\n ]\n}\n";
+
+  s.precision(oldPrecision);
+}
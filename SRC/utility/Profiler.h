@@ -0,0 +1,118 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for Profiler.
+// Profiler is a low overhead hierarchical wall clock profiler for the
+// analysis. Code regions are timed with a ProfilerScope placed at the
+// top of the region; nested scopes form a call tree so that time is
+// reported per call path, e.g. "analyze/algorithm/formTangent". Time
+// spent in the element state determination is in addition accumulated
+// per element class with a ProfilerElementScope.
+//
+// The profiler is compiled in always and switched on and off at run
+// time with the analysisProfile command; when off a scope costs a
+// single test of a static flag. It is not thread safe, scopes are to be
+// placed in code run by the analysis thread only.
+//
+// Usage:
+//   static int region = Profiler::getRegion("Domain::update");
+//   ProfilerScope theScope(region);
+
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+class MovableObject;
+
+class Profiler
+{
+  public:
+    enum ElementPhase {ElementUpdate = 0, ElementTangent = 1,
+		       ElementResidual = 2, NumElementPhases = 3};
+
+    static bool isEnabled(void) {return enabled;}
+    static void setEnabled(bool onOff);
+    static void reset(void);
+
+    // returns the id of a named region, registering it on first use
+    static int getRegion(const char *name);
+
+    // enter and leave a region on the current call path
+    static void start(int region);
+    static void stop(void);
+
+    // monotonic wall clock in seconds from an arbitrary origin
+    static double now(void);
+
+    // adds time spent in an element class, theObject is the element
+    static void addElementTime(int phase, const MovableObject *theObject,
+			       double seconds);
+
+    // flattened results, one entry per call path followed by one entry
+    // per element class and phase, e.g. "element/ForceBeamColumn3d/update"
+    static int getTotals(std::vector<std::string> &paths,
+			 std::vector<double> &seconds,
+			 std::vector<double> &calls);
+
+    static void writeJSON(std::ostream &s);
+
+  private:
+    static void writeNodeJSON(std::ostream &s, int node, int indent);
+    static bool enabled;
+};
+
+class ProfilerScope
+{
+  public:
+    ProfilerScope(int region)
+      :active(Profiler::isEnabled())
+      {if (active == true) Profiler::start(region);}
+    ~ProfilerScope()
+      {if (active == true) Profiler::stop();}
+
+  private:
+    bool active;
+};
+
+class ProfilerElementScope
+{
+  public:
+    ProfilerElementScope(int phase, const MovableObject *theEle)
+      :theObject(0), thePhase(phase), startTime(0.0)
+      {if (Profiler::isEnabled() == true) {
+	  theObject = theEle;
+	  startTime = Profiler::now();
+	}
+      }
+    ~ProfilerElementScope()
+      {if (theObject != 0)
+	  Profiler::addElementTime(thePhase, theObject, Profiler::now()-startTime);
+      }
+
+  private:
+    const MovableObject *theObject;
+    int thePhase;
+    double startTime;
+};
+
+#endif